@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/18 18:42:23 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/16 13:28:37 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 08:52:51 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -306,6 +306,146 @@ void		ft_lstiter(t_list *lst, void (*f)(void *));
  */
 t_list		*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *));
 
+/* ************************************************************************** */
+/*                                Allocators                                  */
+/* ************************************************************************** */
+
+/**
+ * @brief Memory interface that containers allocate through.
+ *
+ * Every slot receives ctx first. Sizes passed to realloc and free are
+ * the sizes the block was allocated or last resized with.
+ *
+ * A zeroed t_allocator (or a NULL t_allocator pointer) means the heap:
+ * malloc, realloc and free. An allocator with alloc set and free NULL
+ * never frees blocks individually (arenas).
+ *
+ * @param alloc Allocate size bytes (not zeroed); NULL on failure.
+ * @param realloc Resize ptr; NULL on failure. NULL slot: alloc + copy.
+ * @param free Release ptr. NULL slot: blocks are never freed one by one.
+ * @param ctx Allocator state (arena, pool, counters, ...).
+ */
+typedef struct s_allocator
+{
+	void	*(*alloc)(void *ctx, size_t size);
+	void	*(*realloc)(void *ctx, void *ptr, size_t old_size,
+			size_t new_size);
+	void	(*free)(void *ctx, void *ptr, size_t size);
+	void	*ctx;
+}	t_allocator;
+
+/**
+ * @brief The default allocator (malloc, realloc, free).
+ */
+t_allocator	ft_allocator_heap(void);
+
+/* Calls through an allocator; a NULL allocator means the heap */
+void		*ft_allocator_alloc(const t_allocator *a, size_t size);
+void		*ft_allocator_calloc(const t_allocator *a, size_t count,
+				size_t size);
+void		*ft_allocator_realloc(const t_allocator *a, void *ptr,
+				size_t old_size, size_t new_size);
+void		ft_allocator_free(const t_allocator *a, void *ptr, size_t size);
+
+/* ************************************************************************** */
+/*                             Memory statistics                              */
+/* ************************************************************************** */
+
+# define FT_MEMSTATS_SITES 32
+# define FT_MEMSTATS_BUCKETS 20
+
+/**
+ * @brief Allocation counters for one call site.
+ *
+ * hist[b] counts requests of at most 16 << b bytes (the last bucket
+ * takes everything larger). Releases only bump calls.
+ *
+ * @param name Site name, e.g. "ft_vec_reserve".
+ * @param calls Allocations, resizes and releases recorded here.
+ * @param bytes Sum of requested sizes.
+ * @param max_request Largest single request.
+ * @param hist Request size histogram.
+ */
+typedef struct s_memsite
+{
+	const char	*name;
+	size_t		calls;
+	size_t		bytes;
+	size_t		max_request;
+	size_t		hist[FT_MEMSTATS_BUCKETS];
+}	t_memsite;
+
+/**
+ * @brief Library-wide allocation statistics.
+ *
+ * Only collected when libft is built with MEMSTATS=1 (-D FT_MEMSTATS);
+ * otherwise every hook is an empty function and enabled is 0.
+ *
+ * bytes_live and bytes_peak follow memory the library owns and later
+ * releases itself: container buffers on the heap, arena blocks and pool
+ * chunks. Strings and nodes handed to the caller (ft_strdup, ft_split,
+ * ft_lstnew, ...) are counted in allocs and bytes_total only.
+ *
+ * The last slot of sites is named "(other)" and takes every site past the
+ * first FT_MEMSTATS_SITES - 1; nsites counts it once it has been used.
+ *
+ * @note Not thread-safe; meant for profiling builds.
+ */
+typedef struct s_memstats
+{
+	int			enabled;
+	size_t		allocs;
+	size_t		reallocs;
+	size_t		frees;
+	size_t		bytes_total;
+	size_t		bytes_live;
+	size_t		bytes_peak;
+	size_t		nsites;
+	t_memsite	sites[FT_MEMSTATS_SITES];
+}	t_memstats;
+
+/**
+ * @brief Current statistics (live view, not a copy).
+ */
+const t_memstats	*ft_memstats_get(void);
+
+/**
+ * @brief Write a human-readable report, one line per site, to fd.
+ */
+void		ft_memstats_dump(int fd);
+
+/**
+ * @brief Zero all counters and forget every site.
+ */
+void		ft_memstats_reset(void);
+
+/**
+ * @brief Record a block owned by the library.
+ *
+ * old_size 0 is an allocation, new_size 0 a release, anything else a
+ * resize. Updates bytes_live and bytes_peak.
+ *
+ * @param site Static string naming the call site.
+ */
+void		ft_memstats_record(const char *site, size_t old_size,
+				size_t new_size);
+
+/**
+ * @brief Record an allocation handed over to the caller.
+ * @param site Static string naming the call site.
+ * @param size Bytes allocated.
+ */
+void		ft_memstats_note(const char *site, size_t size);
+
+/**
+ * @brief ft_memstats_record for a block that went through a.
+ *
+ * Only heap allocators are recorded; arena and pool memory is already
+ * recorded where their blocks and chunks are allocated.
+ */
+void		ft_memstats_alloc(const t_allocator *a, const char *site,
+				size_t old_size, size_t new_size);
+
 /* ************************************************************************** */
 /*                              Double-Ended Queue                            */
 /* ************************************************************************** */
@@ -319,13 +459,14 @@ t_list		*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *));
  */
 typedef struct s_deque
 {
-	void	*data;
-	size_t	head;
-	size_t	tail;
-	size_t	len;
-	size_t	cap;
-	size_t	elem_size;
-}			t_deque;
+	void		*data;
+	size_t		head;
+	size_t		tail;
+	size_t		len;
+	size_t		cap;
+	size_t		elem_size;
+	t_allocator	alloc;
+}				t_deque;
 
 /* Lifecycle */
 
@@ -337,6 +478,16 @@ typedef struct s_deque
  */
 t_deque		*ft_deque_new(size_t elem_size, size_t init_cap);
 
+/**
+ * @brief Create a deque that allocates through a custom allocator.
+ * @param elem_size Size of each element in bytes.
+ * @param init_cap Initial capacity (0 for default).
+ * @param alloc Allocator to copy into the deque (NULL for the heap).
+ * @return Pointer to new deque, or NULL on failure.
+ */
+t_deque		*ft_deque_new_with_alloc(size_t elem_size, size_t init_cap,
+				const t_allocator *alloc);
+
 /**
  * @brief Free all memory associated with a deque.
  * @param d Pointer to deque. Safe to call with NULL.
@@ -451,6 +602,102 @@ int			ft_deque_is_empty(t_deque *d);
  */
 int			ft_deque_is_full(t_deque *d);
 
+/* ************************************************************************** */
+/*                              Arena allocator                               */
+/* ************************************************************************** */
+
+/**
+ * @brief Bump allocator for memory that dies all at once.
+ *
+ * Allocations bump a pointer inside large malloc'd blocks and are never
+ * freed one by one. Everything goes away together with ft_arena_reset,
+ * ft_arena_rewind or ft_arena_free, in time proportional to the number
+ * of blocks rather than the number of allocations.
+ *
+ * @param head Newest block (NULL until the first allocation).
+ * @param block_size Minimum size of each new block.
+ */
+typedef struct s_arena
+{
+	struct s_arena_block	*head;
+	size_t					block_size;
+}	t_arena;
+
+/**
+ * @brief Saved fill level of an arena, see ft_arena_mark.
+ */
+typedef struct s_arena_mark
+{
+	struct s_arena_block	*block;
+	size_t					used;
+}	t_arena_mark;
+
+/* Lifecycle */
+t_arena		*ft_arena_new(size_t block_size);
+void		ft_arena_reset(t_arena *arena);
+void		ft_arena_free(t_arena *arena);
+
+/* Allocation */
+void		*ft_arena_alloc(t_arena *arena, size_t size);
+void		*ft_arena_calloc(t_arena *arena, size_t count, size_t size);
+
+/* Scopes */
+t_arena_mark	ft_arena_mark(t_arena *arena);
+void		ft_arena_rewind(t_arena *arena, t_arena_mark mark);
+
+/* Allocator view of an arena (free is a no-op) */
+t_allocator	ft_allocator_arena(t_arena *arena);
+
+/* Strings (arena-owned results, never freed individually) */
+char		*ft_arena_strdup(t_arena *arena, const char *s);
+char		*ft_arena_substr(t_arena *arena, char const *s, unsigned int start,
+				size_t len);
+char		**ft_arena_split(t_arena *arena, char const *s, char c);
+
+/* ************************************************************************** */
+/*                                Object pool                                 */
+/* ************************************************************************** */
+
+/**
+ * @brief Slab allocator for objects of one fixed size.
+ *
+ * Objects are carved from page-sized chunks and recycled through a free
+ * list, so alloc and release are O(1) and millions of small objects cost
+ * a few thousand mallocs instead of millions.
+ *
+ * @param free_list Most recently released object (NULL if none).
+ * @param chunks Newest chunk; chunks link to the previous one.
+ * @param next Next never-used object in the newest chunk.
+ * @param left Never-used objects left in the newest chunk.
+ * @param obj_size Object size, rounded up to 16 bytes.
+ * @param chunk_size Bytes per chunk.
+ */
+typedef struct s_pool
+{
+	void			*free_list;
+	void			*chunks;
+	unsigned char	*next;
+	size_t			left;
+	size_t			obj_size;
+	size_t			chunk_size;
+}	t_pool;
+
+/* Lifecycle */
+t_pool		*ft_pool_new(size_t obj_size);
+void		ft_pool_free(t_pool *pool);
+
+/* Objects (never pass them to free) */
+void		*ft_pool_alloc(t_pool *pool);
+void		ft_pool_release(t_pool *pool, void *obj);
+
+/* Allocator view of a pool (requests above obj_size fail) */
+t_allocator	ft_allocator_pool(t_pool *pool);
+
+/* List nodes from a pool of sizeof(t_list) objects */
+t_list		*ft_pool_lstnew(t_pool *pool, void *content);
+void		ft_pool_lstdelone(t_pool *pool, t_list *lst, void (*del)(void *));
+void		ft_pool_lstclear(t_pool *pool, t_list **lst, void (*del)(void *));
+
 /* ************************************************************************** */
 /*                           Vector / dynamic array                           */
 /* ************************************************************************** */
@@ -460,14 +707,17 @@ int			ft_deque_is_full(t_deque *d);
  *
  * Provides O(1) amortized push/pop at the end and O(1) random access.
  * Elements are stored contiguously for cache efficiency.
+ * All memory, the struct included, comes from alloc (the heap unless
+ * created with ft_vec_new_with_alloc or ft_arena_vec_new).
  */
 typedef struct s_vec
 {
-	void	*data;
-	size_t	len;
-	size_t	cap;
-	size_t	elem_size;
-}			t_vec;
+	void		*data;
+	size_t		len;
+	size_t		cap;
+	size_t		elem_size;
+	t_allocator	alloc;
+}				t_vec;
 
 /**
  * @brief Create a new vector with specified element size and initial capacity.
@@ -477,6 +727,27 @@ typedef struct s_vec
  */
 t_vec		*ft_vec_new(size_t elem_size, size_t init_cap);
 
+/**
+ * @brief Create a vector that allocates through a custom allocator.
+ * @param elem_size Size of each element in bytes. Must be > 0.
+ * @param init_cap Initial capacity. If 0, defaults to a reasonable size.
+ * @param alloc Allocator to copy into the vector (NULL for the heap).
+ * @return Pointer to new vector, or NULL on failure.
+ */
+t_vec		*ft_vec_new_with_alloc(size_t elem_size, size_t init_cap,
+				const t_allocator *alloc);
+
+/**
+ * @brief Create a vector whose struct and buffers live in an arena.
+ * @param arena Arena to allocate from.
+ * @param elem_size Size of each element in bytes. Must be > 0.
+ * @param init_cap Initial capacity. If 0, defaults to a reasonable size.
+ * @return Pointer to new vector, or NULL on failure.
+ * @note Growing leaves the old buffer in the arena until it is reset.
+ */
+t_vec		*ft_arena_vec_new(t_arena *arena, size_t elem_size,
+				size_t init_cap);
+
 /**
  * @brief Append an element to the end of the vector.
  * @param vec Pointer to vector.
@@ -511,6 +782,16 @@ void		*ft_vec_get(t_vec *vec, size_t index);
  */
 int			ft_vec_set(t_vec *vec, size_t index, const void *elem);
 
+/**
+ * @brief Swap the elements at indices i and j in place.
+ * @param vec Pointer to vector.
+ * @param i Index of the first element.
+ * @param j Index of the second element.
+ * @return 1 on success, 0 if out of bounds or NULL vec.
+ * @note Uses ft_memswap, so no buffer is allocated for any elem_size.
+ */
+int			ft_vec_swap(t_vec *vec, size_t i, size_t j);
+
 /**
  * @brief Free all memory associated with a vector.
  * @param vec Pointer to vector. Safe to call with NULL.
@@ -542,6 +823,46 @@ int			ft_vec_reserve(t_vec *vec, size_t new_cap);
  */
 int			ft_vec_insert(t_vec *vec, size_t index, const void *elem);
 
+/* ************************************************************************** */
+/*                                String pool                                 */
+/* ************************************************************************** */
+
+/**
+ * @brief Interning table: one canonical, immutable copy per distinct
+ *        string.
+ *
+ * Interned strings compare with == and carry their hash and length in a
+ * header right before the first byte (ft_strpool_hash, ft_strpool_len).
+ * The table is open-addressed with linear probing, at most half full;
+ * the bytes live in an arena and never move.
+ *
+ * @param slots Hash/pointer table (internal t_strpool_slot records).
+ * @param cap Number of slots (a power of two).
+ * @param count Number of interned strings.
+ * @param strings Arena holding the interned bytes.
+ */
+typedef struct s_strpool
+{
+	struct s_strpool_slot	*slots;
+	size_t					cap;
+	size_t					count;
+	t_arena					*strings;
+}	t_strpool;
+
+/* Lifecycle */
+t_strpool	*ft_strpool_new(void);
+void		ft_strpool_free(t_strpool *pool);
+
+/* Interning (NULL on allocation failure) */
+const char	*ft_strpool_intern(t_strpool *pool, const char *s);
+const char	*ft_strpool_intern_len(t_strpool *pool, const char *s,
+				size_t len);
+const char	*ft_strpool_find(const t_strpool *pool, const char *s);
+
+/* Cached attributes of an interned string */
+size_t		ft_strpool_hash(const char *istr);
+size_t		ft_strpool_len(const char *istr);
+
 /* ************************************************************************** */
 /*                                  Hashmap                                   */
 /* ************************************************************************** */
@@ -557,20 +878,53 @@ int			ft_vec_insert(t_vec *vec, size_t index, const void *elem);
  * @param size Current number of entries.
  * @param cap Number of buckets (capacity).
  * @param del Value destructor function (can be NULL).
+ * @param alloc Allocator for the struct, bucket array, buckets and keys.
+ * @param pool Pool holding bucket storage, or NULL (see ft_pool_hashmap_new).
+ * @param keys Pool the keys are interned in instead of copied, or NULL
+ *        (see ft_hashmap_new_interned).
  */
 typedef struct s_hashmap
 {
-	t_vec	**buckets;
-	size_t	size;
-	size_t	cap;
-	void	(*del)(void *);
+	t_vec		**buckets;
+	size_t		size;
+	size_t		cap;
+	void		(*del)(void *);
+	t_allocator	alloc;
+	t_pool		*pool;
+	t_strpool	*keys;
 }	t_hashmap;
 
 /* Lifecycle */
 t_hashmap	*ft_hashmap_new(size_t init_cap, void (*del)(void *));
+t_hashmap	*ft_hashmap_new_with_alloc(size_t init_cap, void (*del)(void *),
+				const t_allocator *alloc);
 void		ft_hashmap_free(t_hashmap *map);
+t_hashmap	*ft_arena_hashmap_new(t_arena *arena, size_t init_cap,
+				void (*del)(void *));
+
+/*
+ * Pooled buckets: each bucket's t_vec header and its first few entries
+ * share one pool object instead of two mallocs. One bucket pool can
+ * serve any number of maps and must outlive all of them.
+ */
+t_pool		*ft_hashmap_pool_new(void);
+t_hashmap	*ft_pool_hashmap_new(t_pool *pool, size_t init_cap,
+				void (*del)(void *));
 void		ft_hashmap_clear(t_hashmap *map);
 
+/*
+ * Interned keys: ft_hashmap_set interns each key in the string pool and
+ * stores the canonical pointer, so a key shared by many maps exists
+ * once. The *_interned calls take a string already interned in that
+ * pool: no hashing (the hash is cached) and pointer comparison only.
+ * The pool must outlive every map using it.
+ */
+t_hashmap	*ft_hashmap_new_interned(t_strpool *keys, size_t init_cap,
+				void (*del)(void *));
+int			ft_hashmap_set_interned(t_hashmap *map, const char *ikey,
+				void *value);
+void		*ft_hashmap_get_interned(t_hashmap *map, const char *ikey);
+
 /* Operations */
 int			ft_hashmap_set(t_hashmap *map, const char *key, void *value);
 void		*ft_hashmap_get(t_hashmap *map, const char *key);
@@ -675,6 +1029,8 @@ int			ft_strcmp(const char *s1, const char *s2);
  * @param needle Substring to find.
  * @param len Maximum characters to search.
  * @return Pointer to start of match, or NULL if not found.
+ * @note Needles of FT_STRNSTR_LONG bytes or more go through ft_memmem
+ *       (Two-Way), so the worst case stays linear.
  */
 char		*ft_strnstr(const char *haystack, const char *needle, size_t len);
 
@@ -716,12 +1072,29 @@ char		*ft_substr(char const *s, unsigned int start, size_t len);
 
 /**
  * @brief Concatenate two strings into a new string.
- * @param s1 First string.
- * @param s2 Second string.
+ * @param s1 First string (NULL counts as empty).
+ * @param s2 Second string (NULL counts as empty).
  * @return Newly allocated combined string, or NULL on failure.
  */
 char		*ft_strjoin(char const *s1, char const *s2);
 
+/**
+ * @brief Concatenate count strings with one allocation.
+ * @param count Number of string arguments that follow (NULL ones count as
+ *        empty).
+ * @return Newly allocated combined string, or NULL on failure.
+ */
+char		*ft_strjoin_n(size_t count, ...);
+
+/**
+ * @brief Join a NULL-terminated array of strings with sep between them.
+ * @param parts Strings to join, e.g. the result of ft_split.
+ * @param sep Separator (NULL means none).
+ * @return Newly allocated string ("" for an empty array), or NULL on
+ *         failure or if parts is NULL.
+ */
+char		*ft_strjoin_arr(char **parts, const char *sep);
+
 /**
  * @brief Trim characters from beginning and end of string.
  * @param s1 String to trim.
@@ -735,10 +1108,17 @@ char		*ft_strtrim(char const *s1, char const *set);
  * @param s String to split.
  * @param c Delimiter character.
  * @return Null-terminated array of strings, or NULL on failure.
- * @note Caller must free each string and the array.
+ * @note The array and all words share one allocation: release it with
+ *       ft_split_free() (or a single free()), never word by word.
  */
 char		**ft_split(char const *s, char c);
 
+/**
+ * @brief Free an array returned by ft_split.
+ * @param split Array to free (may be NULL).
+ */
+void		ft_split_free(char **split);
+
 /**
  * @brief Apply function to each character, creating new string.
  * @param s Source string.
@@ -754,6 +1134,207 @@ char		*ft_strmapi(char const *s, char (*f)(unsigned int, char));
  */
 void		ft_striteri(char *s, void (*f)(unsigned int, char *));
 
+/* ************************************************************************** */
+/*                              Character sets                                */
+/* ************************************************************************** */
+
+/* Sets of at most this many bytes also keep a list for the SSE4.2 path */
+# define FT_CHARSET_SMALL 16
+
+/**
+ * @brief Set of bytes as a 256-bit bitmap.
+ *
+ * Membership is one shift and mask, so scanning a string against a set
+ * costs O(len + |set|) instead of O(len * |set|). While the set holds
+ * at most FT_CHARSET_SMALL non-NUL bytes they are also kept in list,
+ * which the SSE4.2 kernels match 16 string bytes at a time.
+ */
+typedef struct s_charset
+{
+	uint64_t		bits[4];
+	unsigned char	list[FT_CHARSET_SMALL];
+	size_t			count;
+}	t_charset;
+
+/**
+ * @brief Build the set of the bytes of chars (NULL gives the empty set).
+ */
+t_charset	ft_charset_from(const char *chars);
+
+/**
+ * @brief Add byte c to the set.
+ */
+void		ft_charset_add(t_charset *set, unsigned char c);
+
+/**
+ * @brief 1 if byte c is in the set, 0 otherwise.
+ */
+int			ft_charset_has(const t_charset *set, unsigned char c);
+
+/**
+ * @brief Length of the prefix of s made only of bytes in the set.
+ */
+size_t		ft_charset_span(const char *s, const t_charset *set);
+
+/**
+ * @brief Length of the prefix of s made only of bytes not in the set.
+ */
+size_t		ft_charset_cspan(const char *s, const t_charset *set);
+
+/**
+ * @brief Length of the prefix of s made only of bytes from accept.
+ */
+size_t		ft_strspn(const char *s, const char *accept);
+
+/**
+ * @brief Length of the prefix of s made only of bytes not in reject.
+ */
+size_t		ft_strcspn(const char *s, const char *reject);
+
+/**
+ * @brief First byte of s that is also in accept.
+ * @return Pointer to it, or NULL if there is none.
+ */
+char		*ft_strpbrk(const char *s, const char *accept);
+
+/**
+ * @brief Trim bytes in set from both ends of s.
+ * @return Newly allocated trimmed string, or NULL on failure.
+ */
+char		*ft_strtrim_set(const char *s, const t_charset *set);
+
+/**
+ * @brief Split s on runs of any byte in set.
+ * @return Null-terminated array of words sharing one allocation (free it
+ *         with ft_split_free), or NULL on failure.
+ */
+char		**ft_split_set(const char *s, const t_charset *set);
+
+/* ************************************************************************** */
+/*                               String views                                 */
+/* ************************************************************************** */
+
+/**
+ * @brief Non-owning view of len bytes at ptr.
+ *
+ * Views point into someone else's buffer and are not NUL-terminated, so
+ * slicing, trimming and tokenizing never copy or allocate. The buffer
+ * must outlive every view into it; ft_sv_dup makes an owned C string.
+ */
+typedef struct s_strview
+{
+	const char	*ptr;
+	size_t		len;
+}	t_strview;
+
+/* Returned by ft_sv_find when the needle does not occur */
+# define FT_SV_NPOS SIZE_MAX
+
+/* Construction and slicing */
+t_strview	ft_sv_new(const char *ptr, size_t len);
+t_strview	ft_sv_from(const char *s);
+t_strview	ft_sv_sub(t_strview sv, size_t start, size_t len);
+
+/**
+ * @brief Drop leading and trailing bytes found in set.
+ */
+t_strview	ft_sv_trim(t_strview sv, const char *set);
+
+/**
+ * @brief Tokenize like ft_split, one word per call.
+ *
+ * Skips runs of c, stores the next word in *tok and advances *rest past
+ * it.
+ *
+ * @return 1 if a word was stored, 0 once *rest holds no more words.
+ */
+int			ft_sv_split_next(t_strview *rest, char c, t_strview *tok);
+
+/**
+ * @brief Offset of the first occurrence of needle in hay.
+ * @return Byte offset, or FT_SV_NPOS if needle does not occur.
+ */
+size_t		ft_sv_find(t_strview hay, t_strview needle);
+
+/**
+ * @brief 1 if both views hold the same bytes, 0 otherwise.
+ */
+int			ft_sv_eq(t_strview a, t_strview b);
+
+/**
+ * @brief Parse the whole view as a decimal int ([+-]?[0-9]+).
+ * @param out Receives the value on success (untouched on failure).
+ * @return 1 on success, 0 on an empty view, a stray byte or overflow.
+ */
+int			ft_sv_to_int(t_strview sv, int *out);
+
+/**
+ * @brief Copy the view into a new NUL-terminated string.
+ * @return Newly allocated string, or NULL on failure.
+ */
+char		*ft_sv_dup(t_strview sv);
+
+/* ************************************************************************** */
+/*                              String builder                                */
+/* ************************************************************************** */
+
+# define FT_STRBUF_INLINE 64
+
+/**
+ * @brief Growable NUL-terminated string.
+ *
+ * Contents up to FT_STRBUF_INLINE - 1 bytes live in the struct itself;
+ * the first append that does not fit moves them to the heap, which then
+ * at least doubles on every growth. data is always NUL-terminated and can
+ * be used as a C string at any time.
+ *
+ * @note data may point into the struct: pass a t_strbuf by pointer and
+ *       never copy it by value.
+ *
+ * @param data Current contents (small or heap).
+ * @param len Bytes before the terminator.
+ * @param cap Bytes available at data, terminator included.
+ * @param small Inline storage.
+ */
+typedef struct s_strbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+	char	small[FT_STRBUF_INLINE];
+}	t_strbuf;
+
+/* Lifecycle */
+void		ft_strbuf_init(t_strbuf *sb);
+void		ft_strbuf_free(t_strbuf *sb);
+void		ft_strbuf_clear(t_strbuf *sb);
+
+/**
+ * @brief Make room for extra more bytes without further growth.
+ * @return 1 on success, 0 on allocation failure or overflow.
+ */
+int			ft_strbuf_reserve(t_strbuf *sb, size_t extra);
+
+/* Appending (1 on success, 0 on allocation failure) */
+int			ft_strbuf_append(t_strbuf *sb, const char *s);
+int			ft_strbuf_append_n(t_strbuf *sb, const char *s, size_t n);
+int			ft_strbuf_push_char(t_strbuf *sb, char c);
+
+/**
+ * @brief printf-style append (same conversions as ft_printf).
+ * @return Bytes appended, or -1 on allocation failure (the contents are
+ *         then left as they were before the call).
+ */
+int			ft_strbuf_appendf(t_strbuf *sb, const char *fmt, ...);
+int			ft_strbuf_vappendf(t_strbuf *sb, const char *fmt, va_list ap);
+
+/**
+ * @brief Hand the contents over as a malloc'd string and reset sb.
+ * @return String to free(), or NULL on allocation failure (sb is then
+ *         left untouched).
+ */
+char		*ft_strbuf_detach(t_strbuf *sb);
+
 /* ************************************************************************** */
 /*                             Memory functions                               */
 /* ************************************************************************** */
@@ -811,6 +1392,91 @@ void		*ft_memchr(const void *s, int c, size_t n);
  */
 int			ft_memcmp(const void *s1, const void *s2, size_t n);
 
+/**
+ * @brief Swap the contents of two memory areas.
+ * @param a First memory area.
+ * @param b Second memory area.
+ * @param n Number of bytes to swap.
+ * @note Works in registers (SIMD blocks, then words): no temporary
+ *       buffer for any n. The areas must not overlap unless a == b.
+ */
+void		ft_memswap(void *a, void *b, size_t n);
+
+/**
+ * @brief Locate the last occurrence of a byte in a memory area.
+ * @param s Memory area to search.
+ * @param c Byte to find (converted to unsigned char).
+ * @param n Number of bytes to search.
+ * @return Pointer to last occurrence, or NULL if not found.
+ */
+void		*ft_memrchr(const void *s, int c, size_t n);
+
+/**
+ * @brief Preprocessed needle for the Two-Way string matching algorithm.
+ *
+ * Two-Way (Crochemore-Perrin) runs in O(n + m) time with O(1) space.
+ * The needle is split at a critical factorization (needle[0..ms) and
+ * needle[ms..m)); the right part is matched left to right, the left part
+ * right to left. Periodic needles remember how much of the previous
+ * window is already known to match.
+ *
+ * Both needle and haystack are read through base[i * step], so step -1
+ * with bases pointing at the last bytes searches backwards (last
+ * occurrence) with the same code.
+ *
+ * @param needle Needle base (first byte, or last byte when step is -1).
+ * @param step 1 for forward search, -1 for backward search.
+ * @param m Needle length (at least 2).
+ * @param ms Critical position.
+ * @param period Shift after a full match of the right part.
+ * @param periodic Non-zero when the needle has period `period`.
+ * @param shift Optional Horspool table for forward searches (NULL for
+ *        none): shift[b] is how far a window whose last byte is b can
+ *        slide, 0 when b is the needle's last byte.
+ */
+typedef struct s_twoway
+{
+	const unsigned char	*needle;
+	ptrdiff_t			step;
+	size_t				m;
+	size_t				ms;
+	size_t				period;
+	int					periodic;
+	const unsigned char	*shift;
+}	t_twoway;
+
+/* Prepare a needle (m >= 2), then search n >= m bytes; SIZE_MAX on a miss */
+void		ft_twoway_init(t_twoway *tw, const unsigned char *needle,
+				size_t m, ptrdiff_t step);
+size_t		ft_twoway_find(const t_twoway *tw, const unsigned char *hay,
+				size_t n);
+
+/**
+ * @brief Locate the first occurrence of a byte sequence.
+ * @param hay Memory area to search.
+ * @param n Size of hay in bytes.
+ * @param needle Byte sequence to find.
+ * @param m Size of needle in bytes.
+ * @return Pointer to the first match in hay, hay itself when m is 0,
+ *         or NULL if not found.
+ * @note Two-Way search: O(n + m) time in the worst case, no allocation.
+ */
+void		*ft_memmem(const void *hay, size_t n, const void *needle,
+				size_t m);
+
+/**
+ * @brief Locate the last occurrence of a byte sequence.
+ * @param hay Memory area to search.
+ * @param n Size of hay in bytes.
+ * @param needle Byte sequence to find.
+ * @param m Size of needle in bytes.
+ * @return Pointer to the last match in hay, hay + n when m is 0,
+ *         or NULL if not found.
+ * @note Same worst-case bound as ft_memmem, scanning from the end.
+ */
+void		*ft_memmem_r(const void *hay, size_t n, const void *needle,
+				size_t m);
+
 /**
  * @brief Allocate and zero-initialize memory.
  * @param count Number of elements.
@@ -819,6 +1485,166 @@ int			ft_memcmp(const void *s1, const void *s2, size_t n);
  */
 void		*ft_calloc(size_t count, size_t size);
 
+/* ************************************************************************** */
+/*                             Substring search                               */
+/* ************************************************************************** */
+
+/* ft_strnstr switches from the plain scan to Two-Way at this needle length */
+# define FT_STRNSTR_LONG 8
+
+/**
+ * @brief Needle prepared once for many searches.
+ *
+ * Holds the Two-Way factorization and a Horspool shift table, so every
+ * search skips ahead by up to 255 bytes per probe while keeping the
+ * O(n + m) worst case. The needle is not copied and must outlive the
+ * searcher. The searcher itself is a plain value and may be copied.
+ *
+ * @param tw Two-Way state (tw.shift stays NULL; each search attaches
+ *        shift to a local copy).
+ * @param shift Horspool table (see t_twoway).
+ */
+typedef struct s_strsearch
+{
+	t_twoway		tw;
+	unsigned char	shift[256];
+}	t_strsearch;
+
+/**
+ * @brief Prepare a searcher for the m bytes at needle.
+ */
+void		ft_strsearch_init(t_strsearch *s, const char *needle, size_t m);
+
+/**
+ * @brief First match in the len bytes at hay.
+ *
+ * Pass match + 1 (and the remaining length) to get the next match.
+ *
+ * @return Pointer to the match, hay for an empty needle, or NULL.
+ */
+char		*ft_strsearch_next(const t_strsearch *s, const char *hay,
+				size_t len);
+
+/* ************************************************************************** */
+/*                          Multi-pattern search                              */
+/* ************************************************************************** */
+
+/**
+ * @brief Aho-Corasick automaton over a dictionary of byte patterns.
+ *
+ * Patterns are added to a trie, then ft_acmatch_build resolves failure
+ * links and lays the trie out flat: the root keeps a dense 256-entry
+ * transition table, every other node a contiguous run of sparse edges in
+ * breadth-first order. Matching reads each text byte once, whatever the
+ * number of patterns.
+ *
+ * @param nodes Trie nodes (internal t_acnode records).
+ * @param edges Trie edges (internal t_acedge records).
+ * @param root Dense transitions out of the root (0 stays at the root).
+ * @param npatterns Patterns added so far; ids are 0 .. npatterns - 1.
+ * @param built Non-zero once ft_acmatch_build succeeded.
+ */
+typedef struct s_acmatch
+{
+	t_vec		*nodes;
+	t_vec		*edges;
+	uint32_t	root[256];
+	size_t		npatterns;
+	int			built;
+}	t_acmatch;
+
+/**
+ * @brief One match: pattern id and byte offset of its start in the text.
+ */
+typedef struct s_achit
+{
+	size_t	id;
+	size_t	offset;
+}	t_achit;
+
+/* Lifecycle */
+t_acmatch	*ft_acmatch_new(void);
+void		ft_acmatch_free(t_acmatch *ac);
+
+/**
+ * @brief Add a non-empty pattern before ft_acmatch_build.
+ *
+ * Its id is the number of patterns added before it. Adding the same
+ * bytes twice keeps reporting the first id.
+ *
+ * @return 1 on success, 0 on failure, empty pattern or after build.
+ */
+int			ft_acmatch_add(t_acmatch *ac, const char *pat, size_t len);
+
+/**
+ * @brief Compute failure links and the flat layout; call once after
+ *        the last ft_acmatch_add.
+ * @return 1 on success, 0 on allocation failure.
+ */
+int			ft_acmatch_build(t_acmatch *ac);
+
+/**
+ * @brief Push every match in text onto out (a t_vec of t_achit).
+ *
+ * Matches come in order of their end offset; matches ending at the same
+ * byte come longest first.
+ *
+ * @return 1 on success, 0 if ac is not built or a push failed.
+ */
+int			ft_acmatch_all(const t_acmatch *ac, const char *text,
+				size_t len, t_vec *out);
+
+/**
+ * @brief Stop at the match that ends first (the longest one if several
+ *        end at the same byte).
+ * @return 1 and fills *hit if there is a match, 0 otherwise.
+ */
+int			ft_acmatch_first(const t_acmatch *ac, const char *text,
+				size_t len, t_achit *hit);
+
+/* ************************************************************************** */
+/*                             CPU dispatch                                   */
+/* ************************************************************************** */
+
+/**
+ * @brief Instruction set levels the mem/str kernels can be bound to.
+ *
+ * Levels are ordered: each one implies every level before it.
+ */
+typedef enum e_simd
+{
+	FT_SIMD_SCALAR,
+	FT_SIMD_SSE2,
+	FT_SIMD_SSE42,
+	FT_SIMD_AVX2,
+	FT_SIMD_AVX512
+}	t_simd;
+
+/**
+ * @brief Detect the highest level the running CPU supports.
+ * @return Detected level. Probed once, then cached.
+ * @note Always FT_SIMD_SCALAR on non-x86 targets.
+ */
+t_simd		ft_simd_detect(void);
+
+/**
+ * @brief Level the dispatched functions are currently bound to.
+ * @return Bound level (binds on first use if nothing is bound yet).
+ * @note Binding is not thread-safe. A multithreaded program must call
+ *       this (or any dispatched function) once before starting threads.
+ */
+t_simd		ft_simd_level(void);
+
+/**
+ * @brief Rebind ft_memcpy, ft_memset, ft_memmove, ft_memchr, ft_memcmp,
+ *        ft_strlen and ft_strchr to the kernels of a given level.
+ * @param level Level to bind; must not exceed ft_simd_detect().
+ * @return 1 on success, 0 if the CPU lacks that level (nothing changes).
+ * @note Meant for tests and benchmarks. Not thread-safe against
+ *       concurrent callers of the dispatched functions.
+ */
+int			ft_simd_force(t_simd level);
+
 /* ************************************************************************** */
 /*                          Character conversion                              */
 /* ************************************************************************** */
@@ -845,9 +1671,86 @@ int			ft_tolower(int c);
  * @brief Convert string to integer.
  * @param str String to convert.
  * @return Integer value. Skips leading whitespace and handles +/- sign.
+ * @note Same as (int)ft_strtol(str, NULL, 10, NULL).
  */
 int			ft_atoi(const char *str);
 
+/* Status stored through the err argument of the ft_strto* parsers */
+# define FT_CONV_OK 0
+# define FT_CONV_EMPTY 1
+# define FT_CONV_RANGE 2
+
+/**
+ * @brief Parse [space][+-][0x]digits into a long, like strtol.
+ *
+ * Decimal digits are read 8 at a time with a SWAR kernel.
+ *
+ * @param end If not NULL, receives the first byte after the number (s
+ *        itself when nothing was parsed).
+ * @param base 2..36, or 0 to pick 16 ("0x"), 8 ("0") or 10 from the
+ *        prefix.
+ * @param err If not NULL, receives FT_CONV_OK, FT_CONV_EMPTY (no digits
+ *        or a bad base; returns 0) or FT_CONV_RANGE (value saturated to
+ *        LONG_MIN/LONG_MAX).
+ */
+long		ft_strtol(const char *s, char **end, int base, int *err);
+
+/**
+ * @brief ft_strtol for long long (saturates to LLONG_MIN/LLONG_MAX).
+ */
+long long	ft_strtoll(const char *s, char **end, int base, int *err);
+
+/**
+ * @brief ft_strtol for unsigned long long (saturates to ULLONG_MAX).
+ * @note As with strtoull, a leading '-' negates the value modulo 2^64.
+ */
+unsigned long long	ft_strtoull(const char *s, char **end, int base,
+						int *err);
+
+/**
+ * @brief Parse [space][+-]digits[.digits][e[+-]digits], "inf",
+ *        "infinity" or "nan" (any case) into the nearest double, like
+ *        strtod.
+ *
+ * Correctly rounded for any number of digits. Up to 19 significant
+ * digits are read 8 at a time (SWAR); the value then comes from one
+ * exact double operation (Clinger) or one 64 x 128-bit product against
+ * a power-of-ten table (Eisel-Lemire), and only inputs that product
+ * cannot settle fall back to bignums.
+ *
+ * @param end If not NULL, receives the first byte after the number (s
+ *        itself when nothing was parsed).
+ * @param err If not NULL, receives FT_CONV_OK, FT_CONV_EMPTY (nothing
+ *        parsed; returns 0) or FT_CONV_RANGE (overflow to +-inf).
+ *        Underflow yields the rounded subnormal or 0 with FT_CONV_OK.
+ */
+double		ft_strtod(const char *s, char **end, int *err);
+
+/**
+ * @brief ft_strtod without end pointer or error (0.0 when empty).
+ */
+double		ft_atof(const char *str);
+
+/**
+ * @brief Append every whitespace-separated decimal number of buf to out.
+ * @param buf Input bytes (need not be NUL-terminated).
+ * @param len Number of bytes in buf.
+ * @param out Vector with elem_size == sizeof(int64_t).
+ * @return 1 if all of buf was parsed, 0 on a malformed or out-of-range
+ *         token or a failed push (values before it stay in out).
+ */
+int			ft_parse_ints(const char *buf, size_t len, t_vec *out);
+
+/**
+ * @brief Parse "x,y,z" (ft_strtod numbers, blanks allowed around the
+ *        commas) into a vector.
+ * @param end If not NULL, receives the first byte after z, or s on
+ *        failure.
+ * @return 1 on success, 0 on a missing or out-of-range component or a
+ *         missing comma (out is left unchanged).
+ */
+int			ft_parse_vec3(const char *s, char **end, t_vec3 *out);
+
 /**
  * @brief Convert integer to string.
  * @param n Integer to convert.
@@ -855,6 +1758,86 @@ int			ft_atoi(const char *str);
  */
 char		*ft_itoa(int n);
 
+/* Buffer sizes that fit any value of the type, terminator included */
+# define FT_ITOA_BUFSZ 12
+# define FT_I64TOA_BUFSZ 21
+# define FT_U64TOA_BASE_BUFSZ 65
+
+/**
+ * @brief Write n in decimal into buf, NUL-terminated, without allocating.
+ *
+ * Digits are emitted two at a time from a 200-byte pair table, and the
+ * length is known up front from the bit length of n (count leading
+ * zeros), so nothing is reversed or counted twice.
+ *
+ * @param buf At least FT_ITOA_BUFSZ bytes.
+ * @return Number of characters written, terminator excluded.
+ */
+size_t		ft_itoa_buf(int n, char *buf);
+
+/**
+ * @brief ft_itoa_buf for unsigned int (buf of FT_ITOA_BUFSZ bytes).
+ */
+size_t		ft_utoa_buf(unsigned int n, char *buf);
+
+/**
+ * @brief ft_itoa_buf for int64_t (buf of FT_I64TOA_BUFSZ bytes).
+ */
+size_t		ft_i64toa_buf(int64_t n, char *buf);
+
+/**
+ * @brief ft_itoa_buf for uint64_t (buf of FT_I64TOA_BUFSZ bytes).
+ */
+size_t		ft_u64toa_buf(uint64_t n, char *buf);
+
+/**
+ * @brief Write n in the base given by the length of digits.
+ * @param digits Digit alphabet, e.g. "01" or "0123456789abcdef".
+ * @param buf At least FT_U64TOA_BASE_BUFSZ bytes.
+ * @return Number of characters written, or 0 (and "") if digits has
+ *         fewer than two characters.
+ */
+size_t		ft_u64toa_base_buf(uint64_t n, const char *digits, char *buf);
+
+/*
+ * Doubles: every conversion is exact (correctly rounded, ties to even,
+ * like glibc) and writes into the caller's buffer without allocating.
+ * FT_DTOA_BUFSZ covers sign, 309 integer digits, exponent and terminator;
+ * the precision comes on top of it. A negative precision means 6.
+ */
+# define FT_DTOA_BUFSZ 320
+
+/**
+ * @brief Shortest text that reads back as exactly x.
+ *
+ * Schubfach: one decade chosen from the binary exponent yields the few
+ * candidates directly, so there is no digit loop and no retry at
+ * increasing precision as with %.17g. Positional below 1e17, exponent
+ * form (%g style) from there or below 1e-4.
+ *
+ * @param buf At least FT_DTOA_BUFSZ bytes.
+ * @return Number of characters written, terminator excluded.
+ */
+size_t		ft_dtoa_shortest(double x, char *buf);
+
+/**
+ * @brief x with prec digits after the point, as printf's %.*f.
+ * @param buf At least FT_DTOA_BUFSZ + prec bytes.
+ */
+size_t		ft_dtoa_fixed(double x, int prec, char *buf);
+
+/**
+ * @brief x as d.ddde+XX with prec fraction digits, as printf's %.*e.
+ * @param buf At least FT_DTOA_BUFSZ + prec bytes.
+ */
+size_t		ft_dtoa_exp(double x, int prec, char *buf);
+
+/**
+ * @brief x with prec significant digits (0 means 1), as printf's %.*g.
+ * @param buf At least FT_DTOA_BUFSZ + prec bytes.
+ */
+size_t		ft_dtoa_general(double x, int prec, char *buf);
+
 /* ************************************************************************** */
 /*                        File descriptor output                              */
 /* ************************************************************************** */
@@ -896,7 +1879,9 @@ void		ft_putnbr_fd(int n, int fd);
  * @param format Format string with conversion specifiers.
  * @param ... Variable arguments matching format specifiers.
  * @return Number of characters printed, or -1 on error.
- * @note Supports: %c %s %p %d %i %u %x %X %%
+ * @note Supports: %c %s %p %d %i %u %x %X %f %e %g %%, with an optional
+ *       ".digits" precision for %f %e %g (default 6, at most
+ *       FT_PRINTF_PREC_MAX).
  */
 int			ft_printf(const char *format, ...);
 
@@ -943,4 +1928,29 @@ int			ft_print_unsigned(unsigned int number);
  */
 int			ft_print_hex(unsigned int n, int uppercase);
 
+/* Precisions up to this format on the stack; longer ones use the heap */
+# define FT_PRINT_DOUBLE_PREC 64
+
+/*
+ * Larger precisions are clamped to this. A double's exact expansion
+ * never needs more than 1074 digits after the point.
+ */
+# define FT_PRINTF_PREC_MAX 4096
+
+/**
+ * @brief Parse the ".digits" precision of a conversion, saturating at
+ *        FT_PRINTF_PREC_MAX (shared by ft_printf and ft_strbuf_appendf).
+ * @return The precision, or -1 if there is none.
+ */
+int			ft_printf_parse_prec(const char **fmt);
+
+/**
+ * @brief Print a double as %f, %e or %g.
+ * @param spec 'f', 'e' or 'g'.
+ * @param prec Digits after the point (significant digits for 'g');
+ *        negative means 6.
+ * @return Number of characters printed, or -1 on error.
+ */
+int			ft_print_double(double x, char spec, int prec);
+
 #endif
@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/18 18:42:23 by yiyuli           #+#      #+#            */
-/*   Updated: 2026/01/09 17:56:16 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 08:52:51 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -306,6 +306,146 @@ void		ft_lstiter(t_list *lst, void (*f)(void *));
  */
 t_list		*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *));
 
+/* ************************************************************************** */
+/*                                Allocators                                  */
+/* ************************************************************************** */
+
+/**
+ * @brief Memory interface that containers allocate through.
+ *
+ * Every slot receives ctx first. Sizes passed to realloc and free are
+ * the sizes the block was allocated or last resized with.
+ *
+ * A zeroed t_allocator (or a NULL t_allocator pointer) means the heap:
+ * malloc, realloc and free. An allocator with alloc set and free NULL
+ * never frees blocks individually (arenas).
+ *
+ * @param alloc Allocate size bytes (not zeroed); NULL on failure.
+ * @param realloc Resize ptr; NULL on failure. NULL slot: alloc + copy.
+ * @param free Release ptr. NULL slot: blocks are never freed one by one.
+ * @param ctx Allocator state (arena, pool, counters, ...).
+ */
+typedef struct s_allocator
+{
+	void	*(*alloc)(void *ctx, size_t size);
+	void	*(*realloc)(void *ctx, void *ptr, size_t old_size,
+			size_t new_size);
+	void	(*free)(void *ctx, void *ptr, size_t size);
+	void	*ctx;
+}	t_allocator;
+
+/**
+ * @brief The default allocator (malloc, realloc, free).
+ */
+t_allocator	ft_allocator_heap(void);
+
+/* Calls through an allocator; a NULL allocator means the heap */
+void		*ft_allocator_alloc(const t_allocator *a, size_t size);
+void		*ft_allocator_calloc(const t_allocator *a, size_t count,
+				size_t size);
+void		*ft_allocator_realloc(const t_allocator *a, void *ptr,
+				size_t old_size, size_t new_size);
+void		ft_allocator_free(const t_allocator *a, void *ptr, size_t size);
+
+/* ************************************************************************** */
+/*                             Memory statistics                              */
+/* ************************************************************************** */
+
+# define FT_MEMSTATS_SITES 32
+# define FT_MEMSTATS_BUCKETS 20
+
+/**
+ * @brief Allocation counters for one call site.
+ *
+ * hist[b] counts requests of at most 16 << b bytes (the last bucket
+ * takes everything larger). Releases only bump calls.
+ *
+ * @param name Site name, e.g. "ft_vec_reserve".
+ * @param calls Allocations, resizes and releases recorded here.
+ * @param bytes Sum of requested sizes.
+ * @param max_request Largest single request.
+ * @param hist Request size histogram.
+ */
+typedef struct s_memsite
+{
+	const char	*name;
+	size_t		calls;
+	size_t		bytes;
+	size_t		max_request;
+	size_t		hist[FT_MEMSTATS_BUCKETS];
+}	t_memsite;
+
+/**
+ * @brief Library-wide allocation statistics.
+ *
+ * Only collected when libft is built with MEMSTATS=1 (-D FT_MEMSTATS);
+ * otherwise every hook is an empty function and enabled is 0.
+ *
+ * bytes_live and bytes_peak follow memory the library owns and later
+ * releases itself: container buffers on the heap, arena blocks and pool
+ * chunks. Strings and nodes handed to the caller (ft_strdup, ft_split,
+ * ft_lstnew, ...) are counted in allocs and bytes_total only.
+ *
+ * The last slot of sites is named "(other)" and takes every site past the
+ * first FT_MEMSTATS_SITES - 1; nsites counts it once it has been used.
+ *
+ * @note Not thread-safe; meant for profiling builds.
+ */
+typedef struct s_memstats
+{
+	int			enabled;
+	size_t		allocs;
+	size_t		reallocs;
+	size_t		frees;
+	size_t		bytes_total;
+	size_t		bytes_live;
+	size_t		bytes_peak;
+	size_t		nsites;
+	t_memsite	sites[FT_MEMSTATS_SITES];
+}	t_memstats;
+
+/**
+ * @brief Current statistics (live view, not a copy).
+ */
+const t_memstats	*ft_memstats_get(void);
+
+/**
+ * @brief Write a human-readable report, one line per site, to fd.
+ */
+void		ft_memstats_dump(int fd);
+
+/**
+ * @brief Zero all counters and forget every site.
+ */
+void		ft_memstats_reset(void);
+
+/**
+ * @brief Record a block owned by the library.
+ *
+ * old_size 0 is an allocation, new_size 0 a release, anything else a
+ * resize. Updates bytes_live and bytes_peak.
+ *
+ * @param site Static string naming the call site.
+ */
+void		ft_memstats_record(const char *site, size_t old_size,
+				size_t new_size);
+
+/**
+ * @brief Record an allocation handed over to the caller.
+ * @param site Static string naming the call site.
+ * @param size Bytes allocated.
+ */
+void		ft_memstats_note(const char *site, size_t size);
+
+/**
+ * @brief ft_memstats_record for a block that went through a.
+ *
+ * Only heap allocators are recorded; arena and pool memory is already
+ * recorded where their blocks and chunks are allocated.
+ */
+void		ft_memstats_alloc(const t_allocator *a, const char *site,
+				size_t old_size, size_t new_size);
+
 /* ************************************************************************** */
 /*                              Double-Ended Queue                            */
 /* ************************************************************************** */
@@ -319,13 +459,14 @@ t_list		*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *));
  */
 typedef struct s_deque
 {
-	void	*data;
-	size_t	head;
-	size_t	tail;
-	size_t	len;
-	size_t	cap;
-	size_t	elem_size;
-}			t_deque;
+	void		*data;
+	size_t		head;
+	size_t		tail;
+	size_t		len;
+	size_t		cap;
+	size_t		elem_size;
+	t_allocator	alloc;
+}				t_deque;
 
 /* Lifecycle */
 
@@ -337,6 +478,16 @@ typedef struct s_deque
  */
 t_deque		*ft_deque_new(size_t elem_size, size_t init_cap);
 
+/**
+ * @brief Create a deque that allocates through a custom allocator.
+ * @param elem_size Size of each element in bytes.
+ * @param init_cap Initial capacity (0 for default).
+ * @param alloc Allocator to copy into the deque (NULL for the heap).
+ * @return Pointer to new deque, or NULL on failure.
+ */
+t_deque		*ft_deque_new_with_alloc(size_t elem_size, size_t init_cap,
+				const t_allocator *alloc);
+
 /**
  * @brief Free all memory associated with a deque.
  * @param d Pointer to deque. Safe to call with NULL.
@@ -451,6 +602,102 @@ int			ft_deque_is_empty(t_deque *d);
  */
 int			ft_deque_is_full(t_deque *d);
 
+/* ************************************************************************** */
+/*                              Arena allocator                               */
+/* ************************************************************************** */
+
+/**
+ * @brief Bump allocator for memory that dies all at once.
+ *
+ * Allocations bump a pointer inside large malloc'd blocks and are never
+ * freed one by one. Everything goes away together with ft_arena_reset,
+ * ft_arena_rewind or ft_arena_free, in time proportional to the number
+ * of blocks rather than the number of allocations.
+ *
+ * @param head Newest block (NULL until the first allocation).
+ * @param block_size Minimum size of each new block.
+ */
+typedef struct s_arena
+{
+	struct s_arena_block	*head;
+	size_t					block_size;
+}	t_arena;
+
+/**
+ * @brief Saved fill level of an arena, see ft_arena_mark.
+ */
+typedef struct s_arena_mark
+{
+	struct s_arena_block	*block;
+	size_t					used;
+}	t_arena_mark;
+
+/* Lifecycle */
+t_arena		*ft_arena_new(size_t block_size);
+void		ft_arena_reset(t_arena *arena);
+void		ft_arena_free(t_arena *arena);
+
+/* Allocation */
+void		*ft_arena_alloc(t_arena *arena, size_t size);
+void		*ft_arena_calloc(t_arena *arena, size_t count, size_t size);
+
+/* Scopes */
+t_arena_mark	ft_arena_mark(t_arena *arena);
+void		ft_arena_rewind(t_arena *arena, t_arena_mark mark);
+
+/* Allocator view of an arena (free is a no-op) */
+t_allocator	ft_allocator_arena(t_arena *arena);
+
+/* Strings (arena-owned results, never freed individually) */
+char		*ft_arena_strdup(t_arena *arena, const char *s);
+char		*ft_arena_substr(t_arena *arena, char const *s, unsigned int start,
+				size_t len);
+char		**ft_arena_split(t_arena *arena, char const *s, char c);
+
+/* ************************************************************************** */
+/*                                Object pool                                 */
+/* ************************************************************************** */
+
+/**
+ * @brief Slab allocator for objects of one fixed size.
+ *
+ * Objects are carved from page-sized chunks and recycled through a free
+ * list, so alloc and release are O(1) and millions of small objects cost
+ * a few thousand mallocs instead of millions.
+ *
+ * @param free_list Most recently released object (NULL if none).
+ * @param chunks Newest chunk; chunks link to the previous one.
+ * @param next Next never-used object in the newest chunk.
+ * @param left Never-used objects left in the newest chunk.
+ * @param obj_size Object size, rounded up to 16 bytes.
+ * @param chunk_size Bytes per chunk.
+ */
+typedef struct s_pool
+{
+	void			*free_list;
+	void			*chunks;
+	unsigned char	*next;
+	size_t			left;
+	size_t			obj_size;
+	size_t			chunk_size;
+}	t_pool;
+
+/* Lifecycle */
+t_pool		*ft_pool_new(size_t obj_size);
+void		ft_pool_free(t_pool *pool);
+
+/* Objects (never pass them to free) */
+void		*ft_pool_alloc(t_pool *pool);
+void		ft_pool_release(t_pool *pool, void *obj);
+
+/* Allocator view of a pool (requests above obj_size fail) */
+t_allocator	ft_allocator_pool(t_pool *pool);
+
+/* List nodes from a pool of sizeof(t_list) objects */
+t_list		*ft_pool_lstnew(t_pool *pool, void *content);
+void		ft_pool_lstdelone(t_pool *pool, t_list *lst, void (*del)(void *));
+void		ft_pool_lstclear(t_pool *pool, t_list **lst, void (*del)(void *));
+
 /* ************************************************************************** */
 /*                           Vector / dynamic array                           */
 /* ************************************************************************** */
@@ -460,14 +707,17 @@ int			ft_deque_is_full(t_deque *d);
  *
  * Provides O(1) amortized push/pop at the end and O(1) random access.
  * Elements are stored contiguously for cache efficiency.
+ * All memory, the struct included, comes from alloc (the heap unless
+ * created with ft_vec_new_with_alloc or ft_arena_vec_new).
  */
 typedef struct s_vec
 {
-	void	*data;
-	size_t	len;
-	size_t	cap;
-	size_t	elem_size;
-}			t_vec;
+	void		*data;
+	size_t		len;
+	size_t		cap;
+	size_t		elem_size;
+	t_allocator	alloc;
+}				t_vec;
 
 /**
  * @brief Create a new vector with specified element size and initial capacity.
@@ -477,6 +727,27 @@ typedef struct s_vec
  */
 t_vec		*ft_vec_new(size_t elem_size, size_t init_cap);
 
+/**
+ * @brief Create a vector that allocates through a custom allocator.
+ * @param elem_size Size of each element in bytes. Must be > 0.
+ * @param init_cap Initial capacity. If 0, defaults to a reasonable size.
+ * @param alloc Allocator to copy into the vector (NULL for the heap).
+ * @return Pointer to new vector, or NULL on failure.
+ */
+t_vec		*ft_vec_new_with_alloc(size_t elem_size, size_t init_cap,
+				const t_allocator *alloc);
+
+/**
+ * @brief Create a vector whose struct and buffers live in an arena.
+ * @param arena Arena to allocate from.
+ * @param elem_size Size of each element in bytes. Must be > 0.
+ * @param init_cap Initial capacity. If 0, defaults to a reasonable size.
+ * @return Pointer to new vector, or NULL on failure.
+ * @note Growing leaves the old buffer in the arena until it is reset.
+ */
+t_vec		*ft_arena_vec_new(t_arena *arena, size_t elem_size,
+				size_t init_cap);
+
 /**
  * @brief Append an element to the end of the vector.
  * @param vec Pointer to vector.
@@ -511,6 +782,16 @@ void		*ft_vec_get(t_vec *vec, size_t index);
  */
 int			ft_vec_set(t_vec *vec, size_t index, const void *elem);
 
+/**
+ * @brief Swap the elements at indices i and j in place.
+ * @param vec Pointer to vector.
+ * @param i Index of the first element.
+ * @param j Index of the second element.
+ * @return 1 on success, 0 if out of bounds or NULL vec.
+ * @note Uses ft_memswap, so no buffer is allocated for any elem_size.
+ */
+int			ft_vec_swap(t_vec *vec, size_t i, size_t j);
+
 /**
  * @brief Free all memory associated with a vector.
  * @param vec Pointer to vector. Safe to call with NULL.
@@ -542,6 +823,122 @@ int			ft_vec_reserve(t_vec *vec, size_t new_cap);
  */
 int			ft_vec_insert(t_vec *vec, size_t index, const void *elem);
 
+/* ************************************************************************** */
+/*                                String pool                                 */
+/* ************************************************************************** */
+
+/**
+ * @brief Interning table: one canonical, immutable copy per distinct
+ *        string.
+ *
+ * Interned strings compare with == and carry their hash and length in a
+ * header right before the first byte (ft_strpool_hash, ft_strpool_len).
+ * The table is open-addressed with linear probing, at most half full;
+ * the bytes live in an arena and never move.
+ *
+ * @param slots Hash/pointer table (internal t_strpool_slot records).
+ * @param cap Number of slots (a power of two).
+ * @param count Number of interned strings.
+ * @param strings Arena holding the interned bytes.
+ */
+typedef struct s_strpool
+{
+	struct s_strpool_slot	*slots;
+	size_t					cap;
+	size_t					count;
+	t_arena					*strings;
+}	t_strpool;
+
+/* Lifecycle */
+t_strpool	*ft_strpool_new(void);
+void		ft_strpool_free(t_strpool *pool);
+
+/* Interning (NULL on allocation failure) */
+const char	*ft_strpool_intern(t_strpool *pool, const char *s);
+const char	*ft_strpool_intern_len(t_strpool *pool, const char *s,
+				size_t len);
+const char	*ft_strpool_find(const t_strpool *pool, const char *s);
+
+/* Cached attributes of an interned string */
+size_t		ft_strpool_hash(const char *istr);
+size_t		ft_strpool_len(const char *istr);
+
+/* ************************************************************************** */
+/*                                  Hashmap                                   */
+/* ************************************************************************** */
+
+/**
+ * @brief Hash table with string keys and arbitrary values.
+ *
+ * Provides O(1) average-case lookup, insertion, and deletion.
+ * Uses chaining with t_vec for collision resolution.
+ * Automatically resizes when load factor exceeds 0.75.
+ *
+ * @param buckets Array of bucket vectors (lazily allocated).
+ * @param size Current number of entries.
+ * @param cap Number of buckets (capacity).
+ * @param del Value destructor function (can be NULL).
+ * @param alloc Allocator for the struct, bucket array, buckets and keys.
+ * @param pool Pool holding bucket storage, or NULL (see ft_pool_hashmap_new).
+ * @param keys Pool the keys are interned in instead of copied, or NULL
+ *        (see ft_hashmap_new_interned).
+ */
+typedef struct s_hashmap
+{
+	t_vec		**buckets;
+	size_t		size;
+	size_t		cap;
+	void		(*del)(void *);
+	t_allocator	alloc;
+	t_pool		*pool;
+	t_strpool	*keys;
+}	t_hashmap;
+
+/* Lifecycle */
+t_hashmap	*ft_hashmap_new(size_t init_cap, void (*del)(void *));
+t_hashmap	*ft_hashmap_new_with_alloc(size_t init_cap, void (*del)(void *),
+				const t_allocator *alloc);
+void		ft_hashmap_free(t_hashmap *map);
+t_hashmap	*ft_arena_hashmap_new(t_arena *arena, size_t init_cap,
+				void (*del)(void *));
+
+/*
+ * Pooled buckets: each bucket's t_vec header and its first few entries
+ * share one pool object instead of two mallocs. One bucket pool can
+ * serve any number of maps and must outlive all of them.
+ */
+t_pool		*ft_hashmap_pool_new(void);
+t_hashmap	*ft_pool_hashmap_new(t_pool *pool, size_t init_cap,
+				void (*del)(void *));
+void		ft_hashmap_clear(t_hashmap *map);
+
+/*
+ * Interned keys: ft_hashmap_set interns each key in the string pool and
+ * stores the canonical pointer, so a key shared by many maps exists
+ * once. The *_interned calls take a string already interned in that
+ * pool: no hashing (the hash is cached) and pointer comparison only.
+ * The pool must outlive every map using it.
+ */
+t_hashmap	*ft_hashmap_new_interned(t_strpool *keys, size_t init_cap,
+				void (*del)(void *));
+int			ft_hashmap_set_interned(t_hashmap *map, const char *ikey,
+				void *value);
+void		*ft_hashmap_get_interned(t_hashmap *map, const char *ikey);
+
+/* Operations */
+int			ft_hashmap_set(t_hashmap *map, const char *key, void *value);
+void		*ft_hashmap_get(t_hashmap *map, const char *key);
+int			ft_hashmap_has(t_hashmap *map, const char *key);
+int			ft_hashmap_del(t_hashmap *map, const char *key);
+
+/* Iteration */
+void		ft_hashmap_iter(t_hashmap *map,
+				void (*fn)(const char *, void *, void *),
+				void *ctx);
+
+/* Utility */
+size_t		ft_hashmap_size(t_hashmap *map);
+
 /* ************************************************************************** */
 /*                          Character classification                          */
 /* ************************************************************************** */
@@ -618,12 +1015,22 @@ char		*ft_strrchr(const char *s, int c);
  */
 int			ft_strncmp(const char *s1, const char *s2, size_t n);
 
+/**
+ * @brief Compare two strings.
+ * @param s1 First string.
+ * @param s2 Second string.
+ * @return <0 if s1 < s2, 0 if equal, >0 if s1 > s2.
+ */
+int			ft_strcmp(const char *s1, const char *s2);
+
 /**
  * @brief Locate substring in string, searching at most len characters.
  * @param haystack String to search in.
  * @param needle Substring to find.
  * @param len Maximum characters to search.
  * @return Pointer to start of match, or NULL if not found.
+ * @note Needles of FT_STRNSTR_LONG bytes or more go through ft_memmem
+ *       (Two-Way), so the worst case stays linear.
  */
 char		*ft_strnstr(const char *haystack, const char *needle, size_t len);
 
@@ -665,12 +1072,29 @@ char		*ft_substr(char const *s, unsigned int start, size_t len);
 
 /**
  * @brief Concatenate two strings into a new string.
- * @param s1 First string.
- * @param s2 Second string.
+ * @param s1 First string (NULL counts as empty).
+ * @param s2 Second string (NULL counts as empty).
  * @return Newly allocated combined string, or NULL on failure.
  */
 char		*ft_strjoin(char const *s1, char const *s2);
 
+/**
+ * @brief Concatenate count strings with one allocation.
+ * @param count Number of string arguments that follow (NULL ones count as
+ *        empty).
+ * @return Newly allocated combined string, or NULL on failure.
+ */
+char		*ft_strjoin_n(size_t count, ...);
+
+/**
+ * @brief Join a NULL-terminated array of strings with sep between them.
+ * @param parts Strings to join, e.g. the result of ft_split.
+ * @param sep Separator (NULL means none).
+ * @return Newly allocated string ("" for an empty array), or NULL on
+ *         failure or if parts is NULL.
+ */
+char		*ft_strjoin_arr(char **parts, const char *sep);
+
 /**
  * @brief Trim characters from beginning and end of string.
  * @param s1 String to trim.
@@ -684,10 +1108,17 @@ char		*ft_strtrim(char const *s1, char const *set);
  * @param s String to split.
  * @param c Delimiter character.
  * @return Null-terminated array of strings, or NULL on failure.
- * @note Caller must free each string and the array.
+ * @note The array and all words share one allocation: release it with
+ *       ft_split_free() (or a single free()), never word by word.
  */
 char		**ft_split(char const *s, char c);
 
+/**
+ * @brief Free an array returned by ft_split.
+ * @param split Array to free (may be NULL).
+ */
+void		ft_split_free(char **split);
+
 /**
  * @brief Apply function to each character, creating new string.
  * @param s Source string.
@@ -703,6 +1134,207 @@ char		*ft_strmapi(char const *s, char (*f)(unsigned int, char));
  */
 void		ft_striteri(char *s, void (*f)(unsigned int, char *));
 
+/* ************************************************************************** */
+/*                              Character sets                                */
+/* ************************************************************************** */
+
+/* Sets of at most this many bytes also keep a list for the SSE4.2 path */
+# define FT_CHARSET_SMALL 16
+
+/**
+ * @brief Set of bytes as a 256-bit bitmap.
+ *
+ * Membership is one shift and mask, so scanning a string against a set
+ * costs O(len + |set|) instead of O(len * |set|). While the set holds
+ * at most FT_CHARSET_SMALL non-NUL bytes they are also kept in list,
+ * which the SSE4.2 kernels match 16 string bytes at a time.
+ */
+typedef struct s_charset
+{
+	uint64_t		bits[4];
+	unsigned char	list[FT_CHARSET_SMALL];
+	size_t			count;
+}	t_charset;
+
+/**
+ * @brief Build the set of the bytes of chars (NULL gives the empty set).
+ */
+t_charset	ft_charset_from(const char *chars);
+
+/**
+ * @brief Add byte c to the set.
+ */
+void		ft_charset_add(t_charset *set, unsigned char c);
+
+/**
+ * @brief 1 if byte c is in the set, 0 otherwise.
+ */
+int			ft_charset_has(const t_charset *set, unsigned char c);
+
+/**
+ * @brief Length of the prefix of s made only of bytes in the set.
+ */
+size_t		ft_charset_span(const char *s, const t_charset *set);
+
+/**
+ * @brief Length of the prefix of s made only of bytes not in the set.
+ */
+size_t		ft_charset_cspan(const char *s, const t_charset *set);
+
+/**
+ * @brief Length of the prefix of s made only of bytes from accept.
+ */
+size_t		ft_strspn(const char *s, const char *accept);
+
+/**
+ * @brief Length of the prefix of s made only of bytes not in reject.
+ */
+size_t		ft_strcspn(const char *s, const char *reject);
+
+/**
+ * @brief First byte of s that is also in accept.
+ * @return Pointer to it, or NULL if there is none.
+ */
+char		*ft_strpbrk(const char *s, const char *accept);
+
+/**
+ * @brief Trim bytes in set from both ends of s.
+ * @return Newly allocated trimmed string, or NULL on failure.
+ */
+char		*ft_strtrim_set(const char *s, const t_charset *set);
+
+/**
+ * @brief Split s on runs of any byte in set.
+ * @return Null-terminated array of words sharing one allocation (free it
+ *         with ft_split_free), or NULL on failure.
+ */
+char		**ft_split_set(const char *s, const t_charset *set);
+
+/* ************************************************************************** */
+/*                               String views                                 */
+/* ************************************************************************** */
+
+/**
+ * @brief Non-owning view of len bytes at ptr.
+ *
+ * Views point into someone else's buffer and are not NUL-terminated, so
+ * slicing, trimming and tokenizing never copy or allocate. The buffer
+ * must outlive every view into it; ft_sv_dup makes an owned C string.
+ */
+typedef struct s_strview
+{
+	const char	*ptr;
+	size_t		len;
+}	t_strview;
+
+/* Returned by ft_sv_find when the needle does not occur */
+# define FT_SV_NPOS SIZE_MAX
+
+/* Construction and slicing */
+t_strview	ft_sv_new(const char *ptr, size_t len);
+t_strview	ft_sv_from(const char *s);
+t_strview	ft_sv_sub(t_strview sv, size_t start, size_t len);
+
+/**
+ * @brief Drop leading and trailing bytes found in set.
+ */
+t_strview	ft_sv_trim(t_strview sv, const char *set);
+
+/**
+ * @brief Tokenize like ft_split, one word per call.
+ *
+ * Skips runs of c, stores the next word in *tok and advances *rest past
+ * it.
+ *
+ * @return 1 if a word was stored, 0 once *rest holds no more words.
+ */
+int			ft_sv_split_next(t_strview *rest, char c, t_strview *tok);
+
+/**
+ * @brief Offset of the first occurrence of needle in hay.
+ * @return Byte offset, or FT_SV_NPOS if needle does not occur.
+ */
+size_t		ft_sv_find(t_strview hay, t_strview needle);
+
+/**
+ * @brief 1 if both views hold the same bytes, 0 otherwise.
+ */
+int			ft_sv_eq(t_strview a, t_strview b);
+
+/**
+ * @brief Parse the whole view as a decimal int ([+-]?[0-9]+).
+ * @param out Receives the value on success (untouched on failure).
+ * @return 1 on success, 0 on an empty view, a stray byte or overflow.
+ */
+int			ft_sv_to_int(t_strview sv, int *out);
+
+/**
+ * @brief Copy the view into a new NUL-terminated string.
+ * @return Newly allocated string, or NULL on failure.
+ */
+char		*ft_sv_dup(t_strview sv);
+
+/* ************************************************************************** */
+/*                              String builder                                */
+/* ************************************************************************** */
+
+# define FT_STRBUF_INLINE 64
+
+/**
+ * @brief Growable NUL-terminated string.
+ *
+ * Contents up to FT_STRBUF_INLINE - 1 bytes live in the struct itself;
+ * the first append that does not fit moves them to the heap, which then
+ * at least doubles on every growth. data is always NUL-terminated and can
+ * be used as a C string at any time.
+ *
+ * @note data may point into the struct: pass a t_strbuf by pointer and
+ *       never copy it by value.
+ *
+ * @param data Current contents (small or heap).
+ * @param len Bytes before the terminator.
+ * @param cap Bytes available at data, terminator included.
+ * @param small Inline storage.
+ */
+typedef struct s_strbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+	char	small[FT_STRBUF_INLINE];
+}	t_strbuf;
+
+/* Lifecycle */
+void		ft_strbuf_init(t_strbuf *sb);
+void		ft_strbuf_free(t_strbuf *sb);
+void		ft_strbuf_clear(t_strbuf *sb);
+
+/**
+ * @brief Make room for extra more bytes without further growth.
+ * @return 1 on success, 0 on allocation failure or overflow.
+ */
+int			ft_strbuf_reserve(t_strbuf *sb, size_t extra);
+
+/* Appending (1 on success, 0 on allocation failure) */
+int			ft_strbuf_append(t_strbuf *sb, const char *s);
+int			ft_strbuf_append_n(t_strbuf *sb, const char *s, size_t n);
+int			ft_strbuf_push_char(t_strbuf *sb, char c);
+
+/**
+ * @brief printf-style append (same conversions as ft_printf).
+ * @return Bytes appended, or -1 on allocation failure (the contents are
+ *         then left as they were before the call).
+ */
+int			ft_strbuf_appendf(t_strbuf *sb, const char *fmt, ...);
+int			ft_strbuf_vappendf(t_strbuf *sb, const char *fmt, va_list ap);
+
+/**
+ * @brief Hand the contents over as a malloc'd string and reset sb.
+ * @return String to free(), or NULL on allocation failure (sb is then
+ *         left untouched).
+ */
+char		*ft_strbuf_detach(t_strbuf *sb);
+
 /* ************************************************************************** */
 /*                             Memory functions                               */
 /* ************************************************************************** */
@@ -761,13 +1393,258 @@ void		*ft_memchr(const void *s, int c, size_t n);
 int			ft_memcmp(const void *s1, const void *s2, size_t n);
 
 /**
- * @brief Allocate and zero-initialize memory.
- * @param count Number of elements.
+ * @brief Swap the contents of two memory areas.
+ * @param a First memory area.
+ * @param b Second memory area.
+ * @param n Number of bytes to swap.
+ * @note Works in registers (SIMD blocks, then words): no temporary
+ *       buffer for any n. The areas must not overlap unless a == b.
+ */
+void		ft_memswap(void *a, void *b, size_t n);
+
+/**
+ * @brief Locate the last occurrence of a byte in a memory area.
+ * @param s Memory area to search.
+ * @param c Byte to find (converted to unsigned char).
+ * @param n Number of bytes to search.
+ * @return Pointer to last occurrence, or NULL if not found.
+ */
+void		*ft_memrchr(const void *s, int c, size_t n);
+
+/**
+ * @brief Preprocessed needle for the Two-Way string matching algorithm.
+ *
+ * Two-Way (Crochemore-Perrin) runs in O(n + m) time with O(1) space.
+ * The needle is split at a critical factorization (needle[0..ms) and
+ * needle[ms..m)); the right part is matched left to right, the left part
+ * right to left. Periodic needles remember how much of the previous
+ * window is already known to match.
+ *
+ * Both needle and haystack are read through base[i * step], so step -1
+ * with bases pointing at the last bytes searches backwards (last
+ * occurrence) with the same code.
+ *
+ * @param needle Needle base (first byte, or last byte when step is -1).
+ * @param step 1 for forward search, -1 for backward search.
+ * @param m Needle length (at least 2).
+ * @param ms Critical position.
+ * @param period Shift after a full match of the right part.
+ * @param periodic Non-zero when the needle has period `period`.
+ * @param shift Optional Horspool table for forward searches (NULL for
+ *        none): shift[b] is how far a window whose last byte is b can
+ *        slide, 0 when b is the needle's last byte.
+ */
+typedef struct s_twoway
+{
+	const unsigned char	*needle;
+	ptrdiff_t			step;
+	size_t				m;
+	size_t				ms;
+	size_t				period;
+	int					periodic;
+	const unsigned char	*shift;
+}	t_twoway;
+
+/* Prepare a needle (m >= 2), then search n >= m bytes; SIZE_MAX on a miss */
+void		ft_twoway_init(t_twoway *tw, const unsigned char *needle,
+				size_t m, ptrdiff_t step);
+size_t		ft_twoway_find(const t_twoway *tw, const unsigned char *hay,
+				size_t n);
+
+/**
+ * @brief Locate the first occurrence of a byte sequence.
+ * @param hay Memory area to search.
+ * @param n Size of hay in bytes.
+ * @param needle Byte sequence to find.
+ * @param m Size of needle in bytes.
+ * @return Pointer to the first match in hay, hay itself when m is 0,
+ *         or NULL if not found.
+ * @note Two-Way search: O(n + m) time in the worst case, no allocation.
+ */
+void		*ft_memmem(const void *hay, size_t n, const void *needle,
+				size_t m);
+
+/**
+ * @brief Locate the last occurrence of a byte sequence.
+ * @param hay Memory area to search.
+ * @param n Size of hay in bytes.
+ * @param needle Byte sequence to find.
+ * @param m Size of needle in bytes.
+ * @return Pointer to the last match in hay, hay + n when m is 0,
+ *         or NULL if not found.
+ * @note Same worst-case bound as ft_memmem, scanning from the end.
+ */
+void		*ft_memmem_r(const void *hay, size_t n, const void *needle,
+				size_t m);
+
+/**
+ * @brief Allocate and zero-initialize memory.
+ * @param count Number of elements.
  * @param size Size of each element.
  * @return Pointer to allocated memory, or NULL on failure.
  */
 void		*ft_calloc(size_t count, size_t size);
 
+/* ************************************************************************** */
+/*                             Substring search                               */
+/* ************************************************************************** */
+
+/* ft_strnstr switches from the plain scan to Two-Way at this needle length */
+# define FT_STRNSTR_LONG 8
+
+/**
+ * @brief Needle prepared once for many searches.
+ *
+ * Holds the Two-Way factorization and a Horspool shift table, so every
+ * search skips ahead by up to 255 bytes per probe while keeping the
+ * O(n + m) worst case. The needle is not copied and must outlive the
+ * searcher. The searcher itself is a plain value and may be copied.
+ *
+ * @param tw Two-Way state (tw.shift stays NULL; each search attaches
+ *        shift to a local copy).
+ * @param shift Horspool table (see t_twoway).
+ */
+typedef struct s_strsearch
+{
+	t_twoway		tw;
+	unsigned char	shift[256];
+}	t_strsearch;
+
+/**
+ * @brief Prepare a searcher for the m bytes at needle.
+ */
+void		ft_strsearch_init(t_strsearch *s, const char *needle, size_t m);
+
+/**
+ * @brief First match in the len bytes at hay.
+ *
+ * Pass match + 1 (and the remaining length) to get the next match.
+ *
+ * @return Pointer to the match, hay for an empty needle, or NULL.
+ */
+char		*ft_strsearch_next(const t_strsearch *s, const char *hay,
+				size_t len);
+
+/* ************************************************************************** */
+/*                          Multi-pattern search                              */
+/* ************************************************************************** */
+
+/**
+ * @brief Aho-Corasick automaton over a dictionary of byte patterns.
+ *
+ * Patterns are added to a trie, then ft_acmatch_build resolves failure
+ * links and lays the trie out flat: the root keeps a dense 256-entry
+ * transition table, every other node a contiguous run of sparse edges in
+ * breadth-first order. Matching reads each text byte once, whatever the
+ * number of patterns.
+ *
+ * @param nodes Trie nodes (internal t_acnode records).
+ * @param edges Trie edges (internal t_acedge records).
+ * @param root Dense transitions out of the root (0 stays at the root).
+ * @param npatterns Patterns added so far; ids are 0 .. npatterns - 1.
+ * @param built Non-zero once ft_acmatch_build succeeded.
+ */
+typedef struct s_acmatch
+{
+	t_vec		*nodes;
+	t_vec		*edges;
+	uint32_t	root[256];
+	size_t		npatterns;
+	int			built;
+}	t_acmatch;
+
+/**
+ * @brief One match: pattern id and byte offset of its start in the text.
+ */
+typedef struct s_achit
+{
+	size_t	id;
+	size_t	offset;
+}	t_achit;
+
+/* Lifecycle */
+t_acmatch	*ft_acmatch_new(void);
+void		ft_acmatch_free(t_acmatch *ac);
+
+/**
+ * @brief Add a non-empty pattern before ft_acmatch_build.
+ *
+ * Its id is the number of patterns added before it. Adding the same
+ * bytes twice keeps reporting the first id.
+ *
+ * @return 1 on success, 0 on failure, empty pattern or after build.
+ */
+int			ft_acmatch_add(t_acmatch *ac, const char *pat, size_t len);
+
+/**
+ * @brief Compute failure links and the flat layout; call once after
+ *        the last ft_acmatch_add.
+ * @return 1 on success, 0 on allocation failure.
+ */
+int			ft_acmatch_build(t_acmatch *ac);
+
+/**
+ * @brief Push every match in text onto out (a t_vec of t_achit).
+ *
+ * Matches come in order of their end offset; matches ending at the same
+ * byte come longest first.
+ *
+ * @return 1 on success, 0 if ac is not built or a push failed.
+ */
+int			ft_acmatch_all(const t_acmatch *ac, const char *text,
+				size_t len, t_vec *out);
+
+/**
+ * @brief Stop at the match that ends first (the longest one if several
+ *        end at the same byte).
+ * @return 1 and fills *hit if there is a match, 0 otherwise.
+ */
+int			ft_acmatch_first(const t_acmatch *ac, const char *text,
+				size_t len, t_achit *hit);
+
+/* ************************************************************************** */
+/*                             CPU dispatch                                   */
+/* ************************************************************************** */
+
+/**
+ * @brief Instruction set levels the mem/str kernels can be bound to.
+ *
+ * Levels are ordered: each one implies every level before it.
+ */
+typedef enum e_simd
+{
+	FT_SIMD_SCALAR,
+	FT_SIMD_SSE2,
+	FT_SIMD_SSE42,
+	FT_SIMD_AVX2,
+	FT_SIMD_AVX512
+}	t_simd;
+
+/**
+ * @brief Detect the highest level the running CPU supports.
+ * @return Detected level. Probed once, then cached.
+ * @note Always FT_SIMD_SCALAR on non-x86 targets.
+ */
+t_simd		ft_simd_detect(void);
+
+/**
+ * @brief Level the dispatched functions are currently bound to.
+ * @return Bound level (binds on first use if nothing is bound yet).
+ * @note Binding is not thread-safe. A multithreaded program must call
+ *       this (or any dispatched function) once before starting threads.
+ */
+t_simd		ft_simd_level(void);
+
+/**
+ * @brief Rebind ft_memcpy, ft_memset, ft_memmove, ft_memchr, ft_memcmp,
+ *        ft_strlen and ft_strchr to the kernels of a given level.
+ * @param level Level to bind; must not exceed ft_simd_detect().
+ * @return 1 on success, 0 if the CPU lacks that level (nothing changes).
+ * @note Meant for tests and benchmarks. Not thread-safe against
+ *       concurrent callers of the dispatched functions.
+ */
+int			ft_simd_force(t_simd level);
+
 /* ************************************************************************** */
 /*                          Character conversion                              */
 /* ************************************************************************** */
@@ -794,9 +1671,86 @@ int			ft_tolower(int c);
  * @brief Convert string to integer.
  * @param str String to convert.
  * @return Integer value. Skips leading whitespace and handles +/- sign.
+ * @note Same as (int)ft_strtol(str, NULL, 10, NULL).
  */
 int			ft_atoi(const char *str);
 
+/* Status stored through the err argument of the ft_strto* parsers */
+# define FT_CONV_OK 0
+# define FT_CONV_EMPTY 1
+# define FT_CONV_RANGE 2
+
+/**
+ * @brief Parse [space][+-][0x]digits into a long, like strtol.
+ *
+ * Decimal digits are read 8 at a time with a SWAR kernel.
+ *
+ * @param end If not NULL, receives the first byte after the number (s
+ *        itself when nothing was parsed).
+ * @param base 2..36, or 0 to pick 16 ("0x"), 8 ("0") or 10 from the
+ *        prefix.
+ * @param err If not NULL, receives FT_CONV_OK, FT_CONV_EMPTY (no digits
+ *        or a bad base; returns 0) or FT_CONV_RANGE (value saturated to
+ *        LONG_MIN/LONG_MAX).
+ */
+long		ft_strtol(const char *s, char **end, int base, int *err);
+
+/**
+ * @brief ft_strtol for long long (saturates to LLONG_MIN/LLONG_MAX).
+ */
+long long	ft_strtoll(const char *s, char **end, int base, int *err);
+
+/**
+ * @brief ft_strtol for unsigned long long (saturates to ULLONG_MAX).
+ * @note As with strtoull, a leading '-' negates the value modulo 2^64.
+ */
+unsigned long long	ft_strtoull(const char *s, char **end, int base,
+						int *err);
+
+/**
+ * @brief Parse [space][+-]digits[.digits][e[+-]digits], "inf",
+ *        "infinity" or "nan" (any case) into the nearest double, like
+ *        strtod.
+ *
+ * Correctly rounded for any number of digits. Up to 19 significant
+ * digits are read 8 at a time (SWAR); the value then comes from one
+ * exact double operation (Clinger) or one 64 x 128-bit product against
+ * a power-of-ten table (Eisel-Lemire), and only inputs that product
+ * cannot settle fall back to bignums.
+ *
+ * @param end If not NULL, receives the first byte after the number (s
+ *        itself when nothing was parsed).
+ * @param err If not NULL, receives FT_CONV_OK, FT_CONV_EMPTY (nothing
+ *        parsed; returns 0) or FT_CONV_RANGE (overflow to +-inf).
+ *        Underflow yields the rounded subnormal or 0 with FT_CONV_OK.
+ */
+double		ft_strtod(const char *s, char **end, int *err);
+
+/**
+ * @brief ft_strtod without end pointer or error (0.0 when empty).
+ */
+double		ft_atof(const char *str);
+
+/**
+ * @brief Append every whitespace-separated decimal number of buf to out.
+ * @param buf Input bytes (need not be NUL-terminated).
+ * @param len Number of bytes in buf.
+ * @param out Vector with elem_size == sizeof(int64_t).
+ * @return 1 if all of buf was parsed, 0 on a malformed or out-of-range
+ *         token or a failed push (values before it stay in out).
+ */
+int			ft_parse_ints(const char *buf, size_t len, t_vec *out);
+
+/**
+ * @brief Parse "x,y,z" (ft_strtod numbers, blanks allowed around the
+ *        commas) into a vector.
+ * @param end If not NULL, receives the first byte after z, or s on
+ *        failure.
+ * @return 1 on success, 0 on a missing or out-of-range component or a
+ *         missing comma (out is left unchanged).
+ */
+int			ft_parse_vec3(const char *s, char **end, t_vec3 *out);
+
 /**
  * @brief Convert integer to string.
  * @param n Integer to convert.
@@ -804,6 +1758,86 @@ int			ft_atoi(const char *str);
  */
 char		*ft_itoa(int n);
 
+/* Buffer sizes that fit any value of the type, terminator included */
+# define FT_ITOA_BUFSZ 12
+# define FT_I64TOA_BUFSZ 21
+# define FT_U64TOA_BASE_BUFSZ 65
+
+/**
+ * @brief Write n in decimal into buf, NUL-terminated, without allocating.
+ *
+ * Digits are emitted two at a time from a 200-byte pair table, and the
+ * length is known up front from the bit length of n (count leading
+ * zeros), so nothing is reversed or counted twice.
+ *
+ * @param buf At least FT_ITOA_BUFSZ bytes.
+ * @return Number of characters written, terminator excluded.
+ */
+size_t		ft_itoa_buf(int n, char *buf);
+
+/**
+ * @brief ft_itoa_buf for unsigned int (buf of FT_ITOA_BUFSZ bytes).
+ */
+size_t		ft_utoa_buf(unsigned int n, char *buf);
+
+/**
+ * @brief ft_itoa_buf for int64_t (buf of FT_I64TOA_BUFSZ bytes).
+ */
+size_t		ft_i64toa_buf(int64_t n, char *buf);
+
+/**
+ * @brief ft_itoa_buf for uint64_t (buf of FT_I64TOA_BUFSZ bytes).
+ */
+size_t		ft_u64toa_buf(uint64_t n, char *buf);
+
+/**
+ * @brief Write n in the base given by the length of digits.
+ * @param digits Digit alphabet, e.g. "01" or "0123456789abcdef".
+ * @param buf At least FT_U64TOA_BASE_BUFSZ bytes.
+ * @return Number of characters written, or 0 (and "") if digits has
+ *         fewer than two characters.
+ */
+size_t		ft_u64toa_base_buf(uint64_t n, const char *digits, char *buf);
+
+/*
+ * Doubles: every conversion is exact (correctly rounded, ties to even,
+ * like glibc) and writes into the caller's buffer without allocating.
+ * FT_DTOA_BUFSZ covers sign, 309 integer digits, exponent and terminator;
+ * the precision comes on top of it. A negative precision means 6.
+ */
+# define FT_DTOA_BUFSZ 320
+
+/**
+ * @brief Shortest text that reads back as exactly x.
+ *
+ * Schubfach: one decade chosen from the binary exponent yields the few
+ * candidates directly, so there is no digit loop and no retry at
+ * increasing precision as with %.17g. Positional below 1e17, exponent
+ * form (%g style) from there or below 1e-4.
+ *
+ * @param buf At least FT_DTOA_BUFSZ bytes.
+ * @return Number of characters written, terminator excluded.
+ */
+size_t		ft_dtoa_shortest(double x, char *buf);
+
+/**
+ * @brief x with prec digits after the point, as printf's %.*f.
+ * @param buf At least FT_DTOA_BUFSZ + prec bytes.
+ */
+size_t		ft_dtoa_fixed(double x, int prec, char *buf);
+
+/**
+ * @brief x as d.ddde+XX with prec fraction digits, as printf's %.*e.
+ * @param buf At least FT_DTOA_BUFSZ + prec bytes.
+ */
+size_t		ft_dtoa_exp(double x, int prec, char *buf);
+
+/**
+ * @brief x with prec significant digits (0 means 1), as printf's %.*g.
+ * @param buf At least FT_DTOA_BUFSZ + prec bytes.
+ */
+size_t		ft_dtoa_general(double x, int prec, char *buf);
+
 /* ************************************************************************** */
 /*                        File descriptor output                              */
 /* ************************************************************************** */
@@ -845,7 +1879,9 @@ void		ft_putnbr_fd(int n, int fd);
  * @param format Format string with conversion specifiers.
  * @param ... Variable arguments matching format specifiers.
  * @return Number of characters printed, or -1 on error.
- * @note Supports: %c %s %p %d %i %u %x %X %%
+ * @note Supports: %c %s %p %d %i %u %x %X %f %e %g %%, with an optional
+ *       ".digits" precision for %f %e %g (default 6, at most
+ *       FT_PRINTF_PREC_MAX).
  */
 int			ft_printf(const char *format, ...);
 
@@ -892,6 +1928,31 @@ int			ft_print_unsigned(unsigned int number);
  */
 int			ft_print_hex(unsigned int n, int uppercase);
 
+/* Precisions up to this format on the stack; longer ones use the heap */
+# define FT_PRINT_DOUBLE_PREC 64
+
+/*
+ * Larger precisions are clamped to this. A double's exact expansion
+ * never needs more than 1074 digits after the point.
+ */
+# define FT_PRINTF_PREC_MAX 4096
+
+/**
+ * @brief Parse the ".digits" precision of a conversion, saturating at
+ *        FT_PRINTF_PREC_MAX (shared by ft_printf and ft_strbuf_appendf).
+ * @return The precision, or -1 if there is none.
+ */
+int			ft_printf_parse_prec(const char **fmt);
+
+/**
+ * @brief Print a double as %f, %e or %g.
+ * @param spec 'f', 'e' or 'g'.
+ * @param prec Digits after the point (significant digits for 'g');
+ *        negative means 6.
+ * @return Number of characters printed, or -1 on error.
+ */
+int			ft_print_double(double x, char spec, int prec);
+
 
 /* ************************************************************************** */
 /*                                                                            */
@@ -904,1906 +1965,10405 @@ int			ft_print_hex(unsigned int n, int uppercase);
 
 #ifdef LIBFT_IMPLEMENTATION
 
+/* Every intrinsic, for the kernels compiled under a target pragma */
+# if defined(__SSE2__)
+#  include <immintrin.h>
+# endif
 
-/* ========================================================================== */
-/*                                ft_is                                       */
-/* ========================================================================== */
+/* --- ft_simd_internal.h --- */
 
-/* --- ft_isalnum.c --- */
+#ifndef FT_SIMD_INTERNAL_H
+# define FT_SIMD_INTERNAL_H
 
 
-int	ft_isalnum(int c)
-{
-	if (ft_isalpha(c) || ft_isdigit(c))
-		return (1);
-	return (0);
-}
+# if defined(__AVX2__)
+#  include <immintrin.h>
+# elif defined(__SSE4_2__)
+#  include <nmmintrin.h>
+# elif defined(__SSE2__)
+#  include <emmintrin.h>
+# endif
 
-/* --- ft_isalpha.c --- */
+/*
+ * Word-sized moves go through __builtin_memcpy with a constant size.
+ * The compiler lowers those to a single (possibly unaligned) load or
+ * store; they never turn into a libc call.
+ */
 
+/*
+ * SWAR (SIMD within a register) constants: a byte of ones and a byte of
+ * high bits in every lane. (w - ONES) & ~w & HIGHS is non-zero exactly
+ * when some byte of w is zero.
+ */
+# define FT_SWAR_ONES 0x0101010101010101ULL
+# define FT_SWAR_HIGHS 0x8080808080808080ULL
+
+/*
+ * The memchr, strlen/strchr/strrchr and charset_span kernels read whole
+ * aligned words or vectors, so they may touch bytes before the range or
+ * past its end or terminator. Such a load never crosses a page, so it
+ * cannot fault, but AddressSanitizer reports it. FT_NO_ASAN builds a
+ * function without ASan checks; put it on every function that does such
+ * a load, static helpers included (GCC does not inline across a sanitizer
+ * mismatch).
+ */
+# if defined(__SANITIZE_ADDRESS__)
+#  define FT_NO_ASAN __attribute__((no_sanitize_address))
+# elif defined(__has_feature)
+#  if __has_feature(address_sanitizer)
+#   define FT_NO_ASAN __attribute__((no_sanitize_address))
+#  endif
+# endif
+# ifndef FT_NO_ASAN
+#  define FT_NO_ASAN
+# endif
+
+/*
+ * pcmpistri modes for the charset kernels: unsigned bytes compared for
+ * "equal any", index of the first hit. NOT_ANY negates the result, so the
+ * first byte outside the set, or the terminator, is the hit.
+ */
+# define FT_PCMP_ANY 0x00
+# define FT_PCMP_NOT_ANY 0x10
 
-int	ft_isalpha(int c)
+/**
+ * @brief Kernel table behind the dispatched mem/str functions.
+ *
+ * Every slot starts out NULL. The first public call that finds its slot
+ * empty runs ft_simd_init(), which binds the whole table to the best
+ * kernels the CPU supports. ft_simd_force() rebinds it to a lower level.
+ *
+ * Bulk kernels only handle the long middle of a buffer; the public
+ * functions keep short sizes inline so small copies never pay for an
+ * indirect call.
+ */
+typedef struct s_simd_kernels
 {
-	if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))
-		return (1);
-	return (0);
-}
+	size_t	(*memcpy_bulk)(unsigned char *, const unsigned char *, size_t);
+	size_t	(*memset_bulk)(unsigned char *, unsigned char, size_t);
+	void	(*memmove_fwd)(unsigned char *, const unsigned char *, size_t);
+	void	(*memmove_bwd)(unsigned char *, const unsigned char *, size_t);
+	void	*(*memchr)(const void *, int, size_t);
+	int		(*memcmp)(const void *, const void *, size_t);
+	size_t	(*memswap_bulk)(unsigned char *, unsigned char *, size_t);
+	size_t	(*strlen)(const char *);
+	char	*(*strchr)(const char *, int);
+	char	*(*strrchr)(const char *, int);
+	size_t	(*charset_span)(const char *, const t_charset *, int);
+}	t_simd_kernels;
+
+extern t_simd_kernels	g_simd;
 
-/* --- ft_isascii.c --- */
+/**
+ * @brief Bind every kernel slot for the detected CPU level.
+ * @note Not thread-safe: it rewrites every slot (scalar kernels first,
+ *       then the SIMD ones). It must run before other threads start,
+ *       through ft_simd_level() or any dispatched call.
+ */
+void	ft_simd_init(void);
 
+/**
+ * @brief Overlay the SSE2/SSE4.2/AVX2 kernels up to level on the bound table
+ *        (no-op on targets without SSE2).
+ */
+void	ft_simd_bind_x86(t_simd level);
 
-int	ft_isascii(int c)
-{
-	return (c >= 0 && c <= 127);
-}
+/* ************************************************************************** */
+/*                                 Kernels                                    */
+/* ************************************************************************** */
 
-/* --- ft_isdigit.c --- */
+/*
+ * memcpy_bulk / memset_bulk: n >= FT_MEM_BULK_MIN. Store one unaligned
+ * vector at the start, then whole aligned blocks of dst, and return how
+ * many leading bytes are done. The caller finishes the short tail.
+ *
+ * memmove_fwd / memmove_bwd: n >= FT_MEMMOVE_BULK_MIN, ranges overlap,
+ * fwd for dst < src and bwd for dst > src. The first and last vector
+ * are loaded before anything is stored and written back last, so the
+ * aligned loop never reads a source byte an earlier store touched.
+ *
+ * memswap_bulk: n >= FT_MEM_BULK_MIN, a and b disjoint. Swap whole
+ * unaligned vector blocks and return how many leading bytes are done.
+ *
+ * memchr / memcmp: full public contract, any n. memchr kernels may read
+ * past either end of the range but only within an aligned vector, so
+ * never into another page; memcmp kernels stay inside the range.
+ *
+ * strlen / strchr / strrchr: full public contract. Reads are aligned
+ * words or aligned 64-byte chunks, which may extend before the string or
+ * past its terminator but never into another page.
+ *
+ * charset_span: length of the prefix of s whose bytes are all in the set
+ * (in = 1) or all outside it (in = 0). The SSE4.2 kernel reads aligned
+ * 16-byte chunks under the same page rule.
+ */
 
+size_t	ft_memcpy_bulk_scalar(unsigned char *d, const unsigned char *s,
+			size_t n);
+size_t	ft_memset_bulk_scalar(unsigned char *d, unsigned char c, size_t n);
+void	ft_memmove_fwd_scalar(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	ft_memmove_bwd_scalar(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	*ft_memchr_scalar(const void *s, int c, size_t n);
+int		ft_memcmp_scalar(const void *s1, const void *s2, size_t n);
+size_t	ft_memswap_bulk_scalar(unsigned char *a, unsigned char *b, size_t n);
+size_t	ft_strlen_scalar(const char *s);
+char	*ft_strchr_scalar(const char *s, int c);
+char	*ft_strrchr_scalar(const char *s, int c);
+size_t	ft_charset_span_scalar(const char *s, const t_charset *set, int in);
+
+size_t	ft_memcpy_bulk_sse2(unsigned char *d, const unsigned char *s,
+			size_t n);
+size_t	ft_memset_bulk_sse2(unsigned char *d, unsigned char c, size_t n);
+void	ft_memmove_fwd_sse2(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	ft_memmove_bwd_sse2(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	*ft_memchr_sse2(const void *s, int c, size_t n);
+int		ft_memcmp_sse2(const void *s1, const void *s2, size_t n);
+size_t	ft_memswap_bulk_sse2(unsigned char *a, unsigned char *b, size_t n);
+size_t	ft_strlen_sse2(const char *s);
+char	*ft_strchr_sse2(const char *s, int c);
+char	*ft_strrchr_sse2(const char *s, int c);
+
+size_t	ft_charset_span_sse42(const char *s, const t_charset *set, int in);
+
+size_t	ft_memcpy_bulk_avx2(unsigned char *d, const unsigned char *s,
+			size_t n);
+size_t	ft_memset_bulk_avx2(unsigned char *d, unsigned char c, size_t n);
+void	ft_memmove_fwd_avx2(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	ft_memmove_bwd_avx2(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	*ft_memchr_avx2(const void *s, int c, size_t n);
+int		ft_memcmp_avx2(const void *s1, const void *s2, size_t n);
+size_t	ft_memswap_bulk_avx2(unsigned char *a, unsigned char *b, size_t n);
+size_t	ft_strlen_avx2(const char *s);
+char	*ft_strchr_avx2(const char *s, int c);
+char	*ft_strrchr_avx2(const char *s, int c);
+
+#endif
+
+/* --- ft_mem_internal.h --- */
+
+#ifndef FT_MEM_INTERNAL_H
+# define FT_MEM_INTERNAL_H
+
+
+/* Copies and fills of at least this many bytes use the bulk kernels. */
+# define FT_MEM_BULK_MIN 64
+
+/* Overlapping moves of at least this many bytes use the bulk kernels. */
+# define FT_MEMMOVE_BULK_MIN 32
+
+/*
+ * ft_calloc hands blocks of at least this many bytes to the system
+ * calloc. Matches glibc's default mmap threshold, above which calloc
+ * returns untouched zero pages instead of clearing recycled memory.
+ */
+# define FT_CALLOC_LARGE_MIN 131072
 
-int	ft_isdigit(int n)
-{
-	if (n >= 48 && n <= 57)
-		return (1);
-	return (0);
-}
+/*
+ * Fills of at least this many bytes bypass the cache with streaming
+ * (non-temporal) stores: the buffer would not fit in cache anyway, and
+ * streaming it keeps the caller's working set resident.
+ */
+# define FT_MEMSET_NT_MIN 4194304
 
-/* --- ft_isprint.c --- */
+#endif
 
+/* --- ft_strbuf_internal.h --- */
 
-int	ft_isprint(int c)
-{
-	return (c >= 32 && c <= 126);
-}
+#ifndef FT_STRBUF_INTERNAL_H
+# define FT_STRBUF_INTERNAL_H
 
 
-/* ========================================================================== */
-/*                               ft_mem                                       */
-/* ========================================================================== */
+/*
+ * Conversion helpers behind ft_strbuf_vappendf. Each returns 1 on
+ * success and 0 on allocation failure.
+ */
+int	ft_strbuf_put_base(t_strbuf *sb, unsigned long n, const char *digits);
+int	ft_strbuf_put_nbr(t_strbuf *sb, int n);
+int	ft_strbuf_put_str(t_strbuf *sb, const char *s);
+int	ft_strbuf_put_ptr(t_strbuf *sb, void *ptr);
+int	ft_strbuf_put_double(t_strbuf *sb, double x, char spec, int prec);
 
-/* --- ft_bzero.c --- */
+#endif
 
+/* --- ft_acmatch_internal.h --- */
 
-void	ft_bzero(void *s, size_t n)
-{
-	ft_memset(s, 0, n);
-}
+#ifndef FT_ACMATCH_INTERNAL_H
+# define FT_ACMATCH_INTERNAL_H
 
-/* --- ft_calloc.c --- */
 
+/**
+ * @brief Trie node.
+ *
+ * @param edge Before build: head of the child edge list (0 ends it).
+ *        After build: first of nedges contiguous edges.
+ * @param nedges Number of children (valid after build).
+ * @param fail Longest proper suffix of this node that is also in the
+ *        trie.
+ * @param dict Nearest node on the fail chain that ends a pattern (0 if
+ *        none).
+ * @param out Id + 1 of the pattern ending here, 0 if none.
+ * @param depth Length of the string spelled by this node.
+ */
+typedef struct s_acnode
+{
+	uint32_t	edge;
+	uint32_t	nedges;
+	uint32_t	fail;
+	uint32_t	dict;
+	uint32_t	out;
+	uint32_t	depth;
+}	t_acnode;
 
-void	*ft_calloc(size_t count, size_t size)
+/**
+ * @brief Trie edge; next links siblings before build and is unused
+ *        after.
+ */
+typedef struct s_acedge
 {
-	void	*ptr;
-	size_t	total_size;
+	uint32_t		child;
+	uint32_t		next;
+	unsigned char	byte;
+}	t_acedge;
 
-	total_size = count * size;
-	if (count != 0 && total_size / count != size)
-		return (NULL);
-	ptr = malloc(total_size);
-	if (ptr)
-		ft_bzero(ptr, count * size);
-	return (ptr);
-}
+/**
+ * @brief Breadth-first state of ft_acmatch_build.
+ */
+typedef struct s_acbuild
+{
+	t_acmatch	*ac;
+	t_vec		*list;
+	uint32_t	*queue;
+	size_t		head;
+	size_t		tail;
+}	t_acbuild;
 
-/* --- ft_memchr.c --- */
+t_acnode	*ft_acmatch_node(const t_acmatch *ac, uint32_t s);
 
+/**
+ * @brief Automaton transition from state s on byte c (after build, or
+ *        during build for states already laid out).
+ */
+uint32_t	ft_acmatch_step(const t_acmatch *ac, uint32_t s, unsigned char c);
 
-void	*ft_memchr(const void *str, int c, size_t n)
-{
-	const unsigned char	*p;
+#endif
 
-	p = str;
-	while (n-- != 0)
-	{
-		if (*p == (unsigned char)c)
-			return ((void *)p);
-		p++;
-	}
+/* --- ft_conv_internal.h --- */
+
+#ifndef FT_CONV_INTERNAL_H
+# define FT_CONV_INTERNAL_H
+
+# include <limits.h>
+
+/*
+ * Largest accumulator that can take 8 more decimal digits in one step:
+ * (UINT64_MAX / 10^8) rounded down, exclusive.
+ */
+# define FT_CONV_SWAR_MAX 184467440737ULL
+
+/**
+ * @brief One number as read by ft_conv_scan.
+ *
+ * mag is the magnitude, saturated at UINT64_MAX when err is
+ * FT_CONV_RANGE; end points past the last digit, or at the start of the
+ * input when err is FT_CONV_EMPTY.
+ */
+typedef struct s_numscan
+{
+	uint64_t	mag;
+	const char	*end;
+	int			neg;
+	int			err;
+}	t_numscan;
+
+/**
+ * @brief Value of c as a digit in bases up to 36, or 36 if it is none.
+ */
+int			ft_conv_digit(char c);
+
+/**
+ * @brief Read 8 ASCII decimal digits at p as one value (SWAR).
+ * @param lim End of the input, or NULL for a NUL-terminated string.
+ * @return 1 with the value in *v, or 0 if the 8 bytes are not all
+ *         digits or cannot be loaded.
+ */
+int			ft_conv_load8(const char *p, const char *lim, uint64_t *v);
+
+/**
+ * @brief Accumulate the digits of base at p into ns->mag.
+ * @param lim End of the input, or NULL for a NUL-terminated string.
+ * @return Pointer past the last digit.
+ */
+const char	*ft_conv_digits(const char *p, const char *lim, int base,
+				t_numscan *ns);
+
+/**
+ * @brief Skip the bytes isspace() accepts, stopping at lim (if not NULL).
+ */
+const char	*ft_conv_skip_space(const char *p, const char *lim);
+
+/**
+ * @brief Read [space][+-][0x]digits, strtol style.
+ * @param lim End of the input, or NULL for a NUL-terminated string.
+ */
+void		ft_conv_scan(const char *s, const char *lim, int base,
+				t_numscan *ns);
+
+/**
+ * @brief Signed value of ns clamped to [-max - 1, max]; sets
+ *        FT_CONV_RANGE in ns->err when it had to clamp.
+ */
+int64_t		ft_conv_signed(t_numscan *ns, uint64_t max);
+
+/**
+ * @brief Number of decimal digits of n (1 for 0).
+ */
+size_t		ft_conv_dec_len(uint64_t n);
+
+/* ************************************************************************** */
+/*                                 Bignums                                    */
+/* ************************************************************************** */
+
+/*
+ * 128 limbs of 32 bits hold every intermediate of the exact double
+ * conversions: at worst 2^53 * 10^1074 (about 3620 bits).
+ */
+# define FT_BIGNUM_LIMBS 128
+
+/* Base 10^9 chunks of a full bignum (4096 bits, 1234 digits) */
+# define FT_BIGNUM_DEC_CHUNKS 138
+
+/**
+ * @brief Unsigned integer of len little-endian limbs (no leading zero
+ *        limb, so 0 has len 0).
+ */
+typedef struct s_bignum
+{
+	uint32_t	limb[FT_BIGNUM_LIMBS];
+	size_t		len;
+}	t_bignum;
+
+void		ft_big_set(t_bignum *b, uint64_t v);
+void		ft_big_shl(t_bignum *b, unsigned int bits);
+void		ft_big_mul_small(t_bignum *b, uint32_t m);
+void		ft_big_mul_pow10(t_bignum *b, unsigned int n);
+int			ft_big_cmp(const t_bignum *a, const t_bignum *b);
+void		ft_big_sub(t_bignum *a, const t_bignum *b);
+size_t		ft_big_bitlen(const t_bignum *b);
+
+/**
+ * @brief num / den when the quotient is a single digit; num keeps the
+ *        remainder.
+ */
+uint32_t	ft_big_div_digit(t_bignum *num, const t_bignum *den);
+
+/**
+ * @brief b >>= bits.
+ * @return Dropped part: 0 none, 1 below half, 2 half, 3 above half.
+ */
+int			ft_big_shr_round(t_bignum *b, size_t bits);
+
+/**
+ * @brief b /= d.
+ * @return The remainder.
+ */
+uint32_t	ft_big_div_small(t_bignum *b, uint32_t d);
+
+/**
+ * @brief Decimal digits of b into out, NUL-terminated; b is consumed.
+ * @return Number of digits ("0" for zero).
+ */
+size_t		ft_big_to_dec(t_bignum *b, char *out);
+
+/**
+ * @brief b = b * m + add.
+ */
+void		ft_big_mul_add(t_bignum *b, uint32_t m, uint32_t add);
+
+/**
+ * @brief Low 64 bits of b.
+ */
+uint64_t	ft_big_low64(const t_bignum *b);
+
+/**
+ * @brief floor(num / den) into *out when it is below 2^64; num is
+ *        consumed.
+ * @return 1 if the division left a remainder.
+ */
+int			ft_big_div_u64(t_bignum *num, const t_bignum *den, uint64_t *out);
+
+/**
+ * @brief nd[0] / nd[1] = cx * 2^q / 10^k with both sides integers.
+ */
+void		ft_big_load_ratio(uint64_t cx, int q, int k, t_bignum *nd);
+
+/* ************************************************************************** */
+/*                              Double to text                                */
+/* ************************************************************************** */
+
+typedef unsigned __int128	t_u128;
+
+/* Classes returned by ft_dtoa_decode */
+# define FT_DTOA_FINITE 0
+# define FT_DTOA_INF 1
+# define FT_DTOA_NAN 2
+
+/*
+ * ft_dtoa_shortest switches to exponent form from 1e17 up, where the 17
+ * significant digits a double can need no longer cover the integer part.
+ */
+# define FT_DTOA_SHORTEST_EXP 17
+
+/* Decades covered by the 128-bit power of ten table */
+# define FT_DTOA_POW10_MIN -350
+# define FT_DTOA_POW10_MAX 350
+
+/**
+ * @brief A finite double split as |x| = c * 2^q.
+ */
+typedef struct s_dfp
+{
+	uint64_t	c;
+	int			q;
+	int			neg;
+}	t_dfp;
+
+int			ft_dtoa_decode(double x, t_dfp *fp);
+
+/**
+ * @brief Write "nan", "inf" or "-inf" for class cls into buf.
+ */
+size_t		ft_dtoa_special(int cls, int neg, char *buf);
+
+/**
+ * @brief floor(log10(2^e)), exact for |e| < 5000.
+ */
+int			ft_flog10pow2(int e);
+
+/**
+ * @brief floor(cx * 2^q / 10^k) into *out; the caller guarantees it fits
+ *        in 64 bits.
+ * @return 1 if the division was inexact, 0 otherwise.
+ */
+int			ft_dtoa_scale(uint64_t cx, int q, int k, uint64_t *out);
+int			ft_dtoa_scale_table(uint64_t cx, int q, int k, uint64_t *out);
+
+/**
+ * @brief {hi, lo} of the 128 leading bits of 10^j, rounded up, for j in
+ *        [FT_DTOA_POW10_MIN, FT_DTOA_POW10_MAX]: 10^j lies in
+ *        ((g - 1) * 2^(e - 127), g * 2^(e - 127)] with e = ft_flog2pow10(j).
+ */
+const uint64_t	*ft_dtoa_pow10_128(int j);
+
+/**
+ * @brief floor(log2(10^j)), exact for |j| < 1233.
+ */
+int			ft_flog2pow10(int j);
+int			ft_dtoa_scale_big(uint64_t cx, int q, int k, uint64_t *out);
+
+/**
+ * @brief Decimal digits of round-half-even(|x| * 10^s) into out.
+ * @return Number of digits written ("0" for zero).
+ */
+size_t		ft_dtoa_round(const t_dfp *fp, int s, char *out);
+size_t		ft_dtoa_round_big(const t_dfp *fp, int s, char *out);
+
+/**
+ * @brief prec + 1 significant digits of |x|, correctly rounded, into out.
+ * @return Decimal exponent of the first digit.
+ */
+int			ft_dtoa_exp_digits(const t_dfp *fp, int prec, char *out);
+
+/**
+ * @brief Shortest digits that round-trip to |x| (x not 0).
+ * @return Number of digits; *e10 gets the exponent of the first one.
+ */
+size_t		ft_dtoa_shortest_digits(const t_dfp *fp, char *out, int *e10);
+
+/**
+ * @brief Lay out the n digits of round(|x| * 10^prec) as %.*f, in place.
+ * @return Length of the result.
+ */
+size_t		ft_dtoa_put_fixed(char *d, size_t n, int prec);
+
+/**
+ * @brief Lay out n digits with first-digit exponent e as
+ *        d[.ddd]e+XX, in place.
+ * @return Length of the result.
+ */
+size_t		ft_dtoa_put_exp(char *d, size_t n, int e);
+
+/**
+ * @brief %g-style layout of n digits in place: trailing zeros dropped,
+ *        exponent form when e < -4 or e >= limit.
+ */
+size_t		ft_dtoa_put_general(char *d, size_t n, int e, int limit);
+
+/* ************************************************************************** */
+/*                              Text to double                                */
+/* ************************************************************************** */
+
+/*
+ * Significant digits the bignum fallback keeps. A halfway point between
+ * two doubles never needs more than 767, so anything past 780 only
+ * matters as "zero or not".
+ */
+# define FT_STRTOD_DIGITS 780
+
+/**
+ * @brief A scanned decimal: all its significant digits, as one integer,
+ *        times 10^exp10.
+ */
+typedef struct s_decimal
+{
+	uint64_t	w;
+	int64_t		exp10;
+	int64_t		nd;
+	int			trunc;
+	int			neg;
+	const char	*first;
+	const char	*end;
+}	t_decimal;
+
+/*
+ * w holds the first min(nd, 19) digits and trunc is set when a nonzero
+ * digit past them was dropped. first points at the first significant
+ * digit for the bignum rescan, end past the whole number (the string
+ * itself when there was no digit).
+ */
+
+void		ft_strtod_scan(const char *s, t_decimal *d);
+
+/**
+ * @brief w * 10^q in one rounding when both are exact doubles.
+ */
+int			ft_strtod_clinger(uint64_t w, int q, double *out);
+
+/**
+ * @brief Eisel-Lemire: w * 10^q (w not 0, q within the table) from one
+ *        192-bit product.
+ * @return 1 with the IEEE bits (sign excluded) in *bits, 0 if the product
+ *         cannot settle the rounding.
+ */
+int			ft_strtod_lemire(uint64_t w, int q, uint64_t *bits);
+
+/**
+ * @brief IEEE bits of v * 2^b, rounded to nearest even; lost says that
+ *        nonzero bits below v were already dropped.
+ */
+uint64_t	ft_strtod_round_pack(uint64_t v, int b, int lost);
+
+/**
+ * @brief Exact conversion of d with bignums.
+ */
+uint64_t	ft_strtod_big(const t_decimal *d);
+
+#endif
+
+/* --- ft_hashmap_internal.h --- */
+
+#ifndef FT_HASHMAP_INTERNAL_H
+# define FT_HASHMAP_INTERNAL_H
+
+
+/* Entries stored next to the t_vec header of a pooled bucket. */
+# define FT_HASHMAP_BUCKET_INLINE 4
+
+typedef struct s_hashmap_entry
+{
+	char	*key;
+	void	*value;
+}	t_hashmap_entry;
+
+int				ft_hashmap_grow(t_hashmap *map);
+size_t			ft_hashmap_hash(const t_hashmap *map, const char *key);
+t_hashmap_entry	*ft_hashmap_find(const t_hashmap *map, t_vec *bucket,
+					const char *key);
+int				ft_hashmap_put(t_hashmap *map, const char *key, size_t hash,
+					void *value);
+
+/*
+ * Bucket arrays and key copies, through map->alloc. With map->keys set
+ * the "copy" is the interned key itself and freeing it is a no-op.
+ */
+t_vec			**ft_hashmap_buckets_new(t_hashmap *map, size_t cap);
+void			ft_hashmap_buckets_free(t_hashmap *map, t_vec **buckets,
+					size_t cap);
+char			*ft_hashmap_key_dup(t_hashmap *map, const char *key);
+void			ft_hashmap_key_free(t_hashmap *map, char *key);
+
+/*
+ * Buckets: always create, fill and drop buckets through these so pooled
+ * buckets (map->pool) keep their inline entries out of ft_vec_reserve
+ * and ft_vec_free, which only know heap buffers.
+ */
+t_vec			*ft_hashmap_bucket_new(t_hashmap *map);
+int				ft_hashmap_bucket_push(t_hashmap *map, t_vec *bucket,
+					t_hashmap_entry *entry);
+void			ft_hashmap_bucket_free(t_hashmap *map, t_vec *bucket);
+
+#endif
+
+/* --- ft_arena_internal.h --- */
+
+#ifndef FT_ARENA_INTERNAL_H
+# define FT_ARENA_INTERNAL_H
+
+
+/* Every allocation is aligned to this many bytes. */
+# define FT_ARENA_ALIGN 16
+
+/* Block size used when ft_arena_new is given 0. */
+# define FT_ARENA_DEFAULT_BLOCK 65536
+
+/**
+ * @brief One malloc'd chunk of arena memory.
+ *
+ * Blocks form a list from newest to oldest. Allocation only ever bumps
+ * `used` in the newest block; a request that does not fit opens a new
+ * block of at least the arena's block size.
+ *
+ * @param prev Next older block, or NULL for the first one.
+ * @param data Start of usable memory (aligned to FT_ARENA_ALIGN).
+ * @param cap Usable bytes at data.
+ * @param used Bytes handed out so far.
+ */
+typedef struct s_arena_block
+{
+	struct s_arena_block	*prev;
+	unsigned char			*data;
+	size_t					cap;
+	size_t					used;
+}	t_arena_block;
+
+void	ft_arena_pop_block(t_arena *arena);
+
+#endif
+
+/* --- ft_pool_internal.h --- */
+
+#ifndef FT_POOL_INTERNAL_H
+# define FT_POOL_INTERNAL_H
+
+
+/* Object sizes are rounded up to this, so every object is aligned. */
+# define FT_POOL_ALIGN 16
+
+/* Bytes per chunk: one page, unless objects are too large to fit 8. */
+# define FT_POOL_CHUNK 4096
+
+/* Minimum number of objects per chunk. */
+# define FT_POOL_MIN_OBJS 8
+
+/*
+ * Chunk layout: the first FT_POOL_ALIGN bytes hold the pointer to the
+ * previous chunk, objects follow back to back. A free object stores the
+ * next free object in its first bytes.
+ */
+
+#endif
+
+/* --- ft_memstats_internal.h --- */
+
+#ifndef FT_MEMSTATS_INTERNAL_H
+# define FT_MEMSTATS_INTERNAL_H
+
+
+# ifdef FT_MEMSTATS
+#  define FT_MEMSTATS_ENABLED 1
+# else
+#  define FT_MEMSTATS_ENABLED 0
+# endif
+
+/*
+ * Name of the last site slot, preset at load time and on reset. Every
+ * site past the first FT_MEMSTATS_SITES - 1 is counted there.
+ */
+# define FT_MEMSTATS_OTHER "(other)"
+
+extern t_memstats	g_memstats;
+
+void	ft_memstats_site_hit(const char *site, size_t size);
+
+#endif
+
+/* --- ft_strpool_internal.h --- */
+
+#ifndef FT_STRPOOL_INTERNAL_H
+# define FT_STRPOOL_INTERNAL_H
+
+
+/* Slots in a new table (a power of two). */
+# define FT_STRPOOL_INIT_CAP 64
+
+/* Arena block size for the interned bytes. */
+# define FT_STRPOOL_BLOCK 16384
+
+/* Fibonacci multiplier: spreads djb2's weak low bits over the index. */
+# define FT_STRPOOL_MIX 0x9E3779B97F4A7C15ULL
+
+/**
+ * @brief Table slot: the string's hash, kept inline so a probe that
+ *        misses never touches the string itself.
+ * @param str Canonical string, NULL for an empty slot.
+ */
+typedef struct s_strpool_slot
+{
+	size_t		hash;
+	const char	*str;
+}	t_strpool_slot;
+
+/**
+ * @brief Header stored in the arena right before each canonical string.
+ */
+typedef struct s_strpool_head
+{
+	size_t	hash;
+	size_t	len;
+}	t_strpool_head;
+
+size_t			ft_strpool_hash_bytes(const char *s, size_t len);
+size_t			ft_strpool_index(const t_strpool *pool, size_t hash);
+t_strpool_slot	*ft_strpool_probe(const t_strpool *pool, const char *s,
+					size_t len, size_t hash);
+int				ft_strpool_grow(t_strpool *pool);
+
+#endif
+
+
+/* ========================================================================== */
+/*                                ft_is                                       */
+/* ========================================================================== */
+
+/* --- ft_isalnum.c --- */
+
+
+int	ft_isalnum(int c)
+{
+	if (ft_isalpha(c) || ft_isdigit(c))
+		return (1);
+	return (0);
+}
+
+/* --- ft_isalpha.c --- */
+
+
+int	ft_isalpha(int c)
+{
+	if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))
+		return (1);
+	return (0);
+}
+
+/* --- ft_isascii.c --- */
+
+
+int	ft_isascii(int c)
+{
+	return (c >= 0 && c <= 127);
+}
+
+/* --- ft_isdigit.c --- */
+
+
+int	ft_isdigit(int n)
+{
+	if (n >= 48 && n <= 57)
+		return (1);
+	return (0);
+}
+
+/* --- ft_isprint.c --- */
+
+
+int	ft_isprint(int c)
+{
+	return (c >= 32 && c <= 126);
+}
+
+
+/* ========================================================================== */
+/*                              ft_simd                                       */
+/* ========================================================================== */
+
+/* --- ft_simd_bind.c --- */
+
+
+t_simd_kernels	g_simd;
+
+static t_simd	simd_bind__g_simd_bound = FT_SIMD_SCALAR;
+
+static void	simd_bind__bind_scalar(void)
+{
+	g_simd.memcpy_bulk = ft_memcpy_bulk_scalar;
+	g_simd.memset_bulk = ft_memset_bulk_scalar;
+	g_simd.memmove_fwd = ft_memmove_fwd_scalar;
+	g_simd.memmove_bwd = ft_memmove_bwd_scalar;
+	g_simd.memchr = ft_memchr_scalar;
+	g_simd.memcmp = ft_memcmp_scalar;
+	g_simd.memswap_bulk = ft_memswap_bulk_scalar;
+	g_simd.strlen = ft_strlen_scalar;
+	g_simd.strchr = ft_strchr_scalar;
+	g_simd.strrchr = ft_strrchr_scalar;
+	g_simd.charset_span = ft_charset_span_scalar;
+}
+
+int	ft_simd_force(t_simd level)
+{
+	if (level > ft_simd_detect())
+		return (0);
+	simd_bind__bind_scalar();
+	ft_simd_bind_x86(level);
+	simd_bind__g_simd_bound = level;
+	return (1);
+}
+
+t_simd	ft_simd_level(void)
+{
+	if (!g_simd.memcpy_bulk)
+		ft_simd_init();
+	return (simd_bind__g_simd_bound);
+}
+
+/* --- ft_simd_detect.c --- */
+
+
+static int	simd_detect__g_simd_detected = -1;
+
+#if defined(__x86_64__) || defined(__i386__)
+
+static t_simd	simd_detect__probe_cpu(void)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")
+		&& __builtin_cpu_supports("avx512bw"))
+		return (FT_SIMD_AVX512);
+	if (__builtin_cpu_supports("avx2"))
+		return (FT_SIMD_AVX2);
+	if (__builtin_cpu_supports("sse4.2"))
+		return (FT_SIMD_SSE42);
+	if (__builtin_cpu_supports("sse2"))
+		return (FT_SIMD_SSE2);
+	return (FT_SIMD_SCALAR);
+}
+
+#else
+
+static t_simd	simd_detect__probe_cpu(void)
+{
+	return (FT_SIMD_SCALAR);
+}
+
+#endif
+
+t_simd	ft_simd_detect(void)
+{
+	if (simd_detect__g_simd_detected < 0)
+		simd_detect__g_simd_detected = simd_detect__probe_cpu();
+	return ((t_simd)simd_detect__g_simd_detected);
+}
+
+void	ft_simd_init(void)
+{
+	ft_simd_force(ft_simd_detect());
+}
+
+/* --- ft_simd_x86.c --- */
+
+
+#if defined(__SSE2__)
+
+static void	simd_x86__bind_sse2(void)
+{
+	g_simd.memcpy_bulk = ft_memcpy_bulk_sse2;
+	g_simd.memset_bulk = ft_memset_bulk_sse2;
+	g_simd.memmove_fwd = ft_memmove_fwd_sse2;
+	g_simd.memmove_bwd = ft_memmove_bwd_sse2;
+	g_simd.memchr = ft_memchr_sse2;
+	g_simd.memcmp = ft_memcmp_sse2;
+	g_simd.memswap_bulk = ft_memswap_bulk_sse2;
+	g_simd.strlen = ft_strlen_sse2;
+	g_simd.strchr = ft_strchr_sse2;
+	g_simd.strrchr = ft_strrchr_sse2;
+}
+
+static void	simd_x86__bind_sse42(void)
+{
+	g_simd.charset_span = ft_charset_span_sse42;
+}
+
+static void	simd_x86__bind_avx2(void)
+{
+	g_simd.memcpy_bulk = ft_memcpy_bulk_avx2;
+	g_simd.memset_bulk = ft_memset_bulk_avx2;
+	g_simd.memmove_fwd = ft_memmove_fwd_avx2;
+	g_simd.memmove_bwd = ft_memmove_bwd_avx2;
+	g_simd.memchr = ft_memchr_avx2;
+	g_simd.memcmp = ft_memcmp_avx2;
+	g_simd.memswap_bulk = ft_memswap_bulk_avx2;
+	g_simd.strlen = ft_strlen_avx2;
+	g_simd.strchr = ft_strchr_avx2;
+	g_simd.strrchr = ft_strrchr_avx2;
+}
+
+/**
+ * @brief Overlay the vector kernels a level can use on the scalar table.
+ *
+ * SSE4.2 only adds the pcmpistri charset kernel and AVX2 keeps it; AVX-512
+ * uses the AVX2 kernels. The Makefile builds the *_sse42.c and *_avx2.c
+ * files with -msse4.2 / -mavx2 on every x86 target, so they exist
+ * whenever SSE2 does.
+ */
+void	ft_simd_bind_x86(t_simd level)
+{
+	if (level >= FT_SIMD_SSE2)
+		simd_x86__bind_sse2();
+	if (level >= FT_SIMD_SSE42)
+		simd_x86__bind_sse42();
+	if (level >= FT_SIMD_AVX2)
+		simd_x86__bind_avx2();
+}
+
+#else
+
+void	ft_simd_bind_x86(t_simd level)
+{
+	(void)level;
+}
+
+#endif
+
+
+/* ========================================================================== */
+/*                               ft_mem                                       */
+/* ========================================================================== */
+
+/* --- ft_bzero.c --- */
+
+
+void	ft_bzero(void *s, size_t n)
+{
+	ft_memset(s, 0, n);
+}
+
+/* --- ft_calloc.c --- */
+
+
+/**
+ * Large blocks go to the system calloc: allocators serve them from fresh
+ * mmap'd pages that the kernel has already zeroed and skip the memset,
+ * so the pages are only faulted in when first touched. Small blocks
+ * come from recycled heap memory and are cleared here.
+ */
+void	*ft_calloc(size_t count, size_t size)
+{
+	void	*ptr;
+	size_t	total_size;
+
+	total_size = count * size;
+	if (count != 0 && total_size / count != size)
+		return (NULL);
+	if (total_size >= FT_CALLOC_LARGE_MIN)
+		ptr = calloc(count, size);
+	else
+		ptr = malloc(total_size);
+	if (ptr && total_size < FT_CALLOC_LARGE_MIN)
+		ft_bzero(ptr, total_size);
+	if (ptr)
+		ft_memstats_note("ft_calloc", total_size);
+	return (ptr);
+}
+
+/* --- ft_memchr.c --- */
+
+
+static void	*memchr__memchr_bytes(const unsigned char *p, unsigned char c, size_t n)
+{
+	while (n-- != 0)
+	{
+		if (*p == c)
+			return ((void *)p);
+		p++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Skip whole 8-byte words that do not contain the byte in pat.
+ */
+static const unsigned char	*memchr__skip_words(const unsigned char *p,
+		uint64_t pat, size_t *n)
+{
+	uint64_t	w;
+
+	while (*n >= 8)
+	{
+		__builtin_memcpy(&w, p, 8);
+		w ^= pat;
+		if ((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS)
+			break ;
+		p += 8;
+		*n -= 8;
+	}
+	return (p);
+}
+
+/**
+ * @brief Portable kernel: bytes up to an 8-byte boundary, then one
+ *        word per step until a word holds the byte.
+ */
+void	*ft_memchr_scalar(const void *str, int c, size_t n)
+{
+	const unsigned char	*p;
+	size_t				head;
+	void				*hit;
+
+	p = str;
+	head = (8 - ((uintptr_t)p & 7)) & 7;
+	if (head > n)
+		head = n;
+	hit = memchr__memchr_bytes(p, (unsigned char)c, head);
+	if (hit)
+		return (hit);
+	n -= head;
+	p = memchr__skip_words(p + head, (uint64_t)(unsigned char)c * FT_SWAR_ONES, &n);
+	return (memchr__memchr_bytes(p, (unsigned char)c, n));
+}
+
+void	*ft_memchr(const void *s, int c, size_t n)
+{
+	if (!g_simd.memchr)
+		ft_simd_init();
+	return (g_simd.memchr(s, c, n));
+}
+
+/* --- ft_memchr_avx2.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+static void	*memchr_avx2__first_hit(const unsigned char *p, unsigned int mask, size_t n)
+{
+	size_t	i;
+
+	if (mask == 0)
+		return (NULL);
+	i = __builtin_ctz(mask);
+	if (i >= n)
+		return (NULL);
+	return ((void *)(p + i));
+}
+
+static FT_NO_ASAN __m256i	memchr_avx2__eq32(const unsigned char *p, __m256i v)
+{
+	return (_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p), v));
+}
+
+static FT_NO_ASAN unsigned int	memchr_avx2__match32(const unsigned char *p, __m256i v)
+{
+	return ((unsigned int)_mm256_movemask_epi8(memchr_avx2__eq32(p, v)));
+}
+
+/**
+ * @brief Skip 128-byte blocks without a match while more than 128 bytes
+ *        remain. Returns the block holding the first match, if any.
+ */
+static FT_NO_ASAN const unsigned char	*memchr_avx2__skip128(const unsigned char *p,
+		__m256i v, size_t *n)
+{
+	__m256i	any;
+
+	while (*n > 128)
+	{
+		any = _mm256_or_si256(_mm256_or_si256(memchr_avx2__eq32(p, v), memchr_avx2__eq32(p + 32, v)),
+				_mm256_or_si256(memchr_avx2__eq32(p + 64, v), memchr_avx2__eq32(p + 96, v)));
+		if (_mm256_movemask_epi8(any))
+			return (p);
+		p += 128;
+		*n -= 128;
+	}
+	return (p);
+}
+
+/**
+ * Only aligned 32-byte loads are issued: the first one starts below s
+ * and the last one may end past s + n, but an aligned block never
+ * crosses a page, so no load can fault. Matches outside [s, s + n) are
+ * masked off.
+ */
+FT_NO_ASAN void	*ft_memchr_avx2(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+	__m256i				v;
+	unsigned int		mask;
+	size_t				off;
+
+	if (n == 0)
+		return (NULL);
+	v = _mm256_set1_epi8((char)c);
+	off = (uintptr_t)s & 31;
+	p = (const unsigned char *)s - off;
+	mask = memchr_avx2__match32(p, v) >> off;
+	if (mask || n <= 32 - off)
+		return (memchr_avx2__first_hit(s, mask, n));
+	n -= 32 - off;
+	p = memchr_avx2__skip128(p + 32, v, &n);
+	while (n > 32)
+	{
+		mask = memchr_avx2__match32(p, v);
+		if (mask)
+			return ((void *)(p + __builtin_ctz(mask)));
+		p += 32;
+		n -= 32;
+	}
+	return (memchr_avx2__first_hit(p, memchr_avx2__match32(p, v), n));
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+/* --- ft_memchr_sse2.c --- */
+
+
+#if defined(__SSE2__)
+
+static void	*memchr_sse2__first_hit(const unsigned char *p, unsigned int mask, size_t n)
+{
+	size_t	i;
+
+	if (mask == 0)
+		return (NULL);
+	i = __builtin_ctz(mask);
+	if (i >= n)
+		return (NULL);
+	return ((void *)(p + i));
+}
+
+static FT_NO_ASAN __m128i	memchr_sse2__eq16(const unsigned char *p, __m128i v)
+{
+	return (_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), v));
+}
+
+static FT_NO_ASAN unsigned int	memchr_sse2__match16(const unsigned char *p, __m128i v)
+{
+	return ((unsigned int)_mm_movemask_epi8(memchr_sse2__eq16(p, v)));
+}
+
+/**
+ * @brief Skip 64-byte blocks without a match while more than 64 bytes
+ *        remain. Returns the block holding the first match, if any.
+ */
+static FT_NO_ASAN const unsigned char	*memchr_sse2__skip64(const unsigned char *p,
+		__m128i v, size_t *n)
+{
+	__m128i	any;
+
+	while (*n > 64)
+	{
+		any = _mm_or_si128(_mm_or_si128(memchr_sse2__eq16(p, v), memchr_sse2__eq16(p + 16, v)),
+				_mm_or_si128(memchr_sse2__eq16(p + 32, v), memchr_sse2__eq16(p + 48, v)));
+		if (_mm_movemask_epi8(any))
+			return (p);
+		p += 64;
+		*n -= 64;
+	}
+	return (p);
+}
+
+/**
+ * Only aligned 16-byte loads are issued: the first one starts below s
+ * and the last one may end past s + n, but an aligned block never
+ * crosses a page, so no load can fault. Matches outside [s, s + n) are
+ * masked off.
+ */
+FT_NO_ASAN void	*ft_memchr_sse2(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+	__m128i				v;
+	unsigned int		mask;
+	size_t				off;
+
+	if (n == 0)
+		return (NULL);
+	v = _mm_set1_epi8((char)c);
+	off = (uintptr_t)s & 15;
+	p = (const unsigned char *)s - off;
+	mask = memchr_sse2__match16(p, v) >> off;
+	if (mask || n <= 16 - off)
+		return (memchr_sse2__first_hit(s, mask, n));
+	n -= 16 - off;
+	p = memchr_sse2__skip64(p + 16, v, &n);
+	while (n > 16)
+	{
+		mask = memchr_sse2__match16(p, v);
+		if (mask)
+			return ((void *)(p + __builtin_ctz(mask)));
+		p += 16;
+		n -= 16;
+	}
+	return (memchr_sse2__first_hit(p, memchr_sse2__match16(p, v), n));
+}
+
+#endif
+
+/* --- ft_memcmp.c --- */
+
+
+static int	memcmp__cmp_bytes(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n)
+	{
+		if (a[i] != b[i])
+			return (a[i] - b[i]);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Portable kernel: skip equal 8-byte words, then settle the first
+ *        differing word byte by byte.
+ */
+int	ft_memcmp_scalar(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	uint64_t			wa;
+	uint64_t			wb;
+
+	a = (const unsigned char *)s1;
+	b = (const unsigned char *)s2;
+	while (n >= 8)
+	{
+		__builtin_memcpy(&wa, a, 8);
+		__builtin_memcpy(&wb, b, 8);
+		if (wa != wb)
+			break ;
+		a += 8;
+		b += 8;
+		n -= 8;
+	}
+	return (memcmp__cmp_bytes(a, b, n));
+}
+
+int	ft_memcmp(const void *s1, const void *s2, size_t n)
+{
+	if (!g_simd.memcmp)
+		ft_simd_init();
+	return (g_simd.memcmp(s1, s2, n));
+}
+
+/* --- ft_memcmp_avx2.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+static unsigned int	memcmp_avx2__eq32(const unsigned char *a, const unsigned char *b)
+{
+	__m256i	eq;
+
+	eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)a),
+			_mm256_loadu_si256((const __m256i *)b));
+	return ((unsigned int)_mm256_movemask_epi8(eq));
+}
+
+/**
+ * Same scheme as ft_memcmp_sse2 with 32-byte blocks; shorter ranges go
+ * to the SSE2 kernel.
+ */
+int	ft_memcmp_avx2(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	unsigned int		ne;
+	size_t				i;
+
+	if (n < 32)
+		return (ft_memcmp_sse2(s1, s2, n));
+	a = (const unsigned char *)s1;
+	b = (const unsigned char *)s2;
+	i = 0;
+	while (i + 32 < n)
+	{
+		ne = ~memcmp_avx2__eq32(a + i, b + i);
+		if (ne)
+			break ;
+		i += 32;
+	}
+	if (i + 32 >= n)
+		i = n - 32;
+	ne = ~memcmp_avx2__eq32(a + i, b + i);
+	if (!ne)
+		return (0);
+	i += __builtin_ctz(ne);
+	return (a[i] - b[i]);
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+/* --- ft_memcmp_sse2.c --- */
+
+
+#if defined(__SSE2__)
+
+static unsigned int	memcmp_sse2__eq16(const unsigned char *a, const unsigned char *b)
+{
+	__m128i	eq;
+
+	eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)a),
+			_mm_loadu_si128((const __m128i *)b));
+	return ((unsigned int)_mm_movemask_epi8(eq));
+}
+
+/**
+ * Loads stay inside [s, s + n): whole blocks from the front, then one
+ * block ending exactly at n that overlaps the last full one. Bytes in
+ * the overlap are already known equal, so the first set bit of the
+ * inequality mask is still the first difference.
+ */
+int	ft_memcmp_sse2(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	unsigned int		ne;
+	size_t				i;
+
+	if (n < 16)
+		return (ft_memcmp_scalar(s1, s2, n));
+	a = (const unsigned char *)s1;
+	b = (const unsigned char *)s2;
+	i = 0;
+	while (i + 16 < n)
+	{
+		ne = memcmp_sse2__eq16(a + i, b + i) ^ 0xFFFF;
+		if (ne)
+			break ;
+		i += 16;
+	}
+	if (i + 16 >= n)
+		i = n - 16;
+	ne = memcmp_sse2__eq16(a + i, b + i) ^ 0xFFFF;
+	if (!ne)
+		return (0);
+	i += __builtin_ctz(ne);
+	return (a[i] - b[i]);
+}
+
+#endif
+
+/* --- ft_memcpy.c --- */
+
+
+/**
+ * @brief Copy fewer than 16 bytes.
+ *
+ * Loads the first and last word of the range before storing either of
+ * them, so two overlapping moves cover every length in [4, 15] without
+ * a byte loop.
+ */
+static void	memcpy__copy_small(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	head;
+	uint64_t	tail;
+	uint32_t	head32;
+	uint32_t	tail32;
+
+	if (n >= 8)
+	{
+		__builtin_memcpy(&head, s, 8);
+		__builtin_memcpy(&tail, s + n - 8, 8);
+		__builtin_memcpy(d, &head, 8);
+		__builtin_memcpy(d + n - 8, &tail, 8);
+	}
+	else if (n >= 4)
+	{
+		__builtin_memcpy(&head32, s, 4);
+		__builtin_memcpy(&tail32, s + n - 4, 4);
+		__builtin_memcpy(d, &head32, 4);
+		__builtin_memcpy(d + n - 4, &tail32, 4);
+	}
+	else
+	{
+		while (n--)
+			d[n] = s[n];
+	}
+}
+
+/**
+ * @brief Copy 16 bytes or more one 64-bit word at a time.
+ *
+ * The first word is stored unaligned, then the loop runs on 8-byte
+ * aligned destination addresses and the last word is stored unaligned
+ * again, overlapping whatever the loop already wrote.
+ */
+static void	memcpy__copy_words(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	w;
+	size_t		i;
+
+	__builtin_memcpy(&w, s, 8);
+	__builtin_memcpy(d, &w, 8);
+	i = 8 - ((uintptr_t)d & 7);
+	while (i + 8 <= n)
+	{
+		__builtin_memcpy(&w, s + i, 8);
+		__builtin_memcpy(d + i, &w, 8);
+		i += 8;
+	}
+	__builtin_memcpy(&w, s + n - 8, 8);
+	__builtin_memcpy(d + n - 8, &w, 8);
+}
+
+size_t	ft_memcpy_bulk_scalar(unsigned char *d, const unsigned char *s,
+		size_t n)
+{
+	(void)d;
+	(void)s;
+	(void)n;
+	return (0);
+}
+
+static size_t	memcpy__copy_bulk(unsigned char *d, const unsigned char *s, size_t n)
+{
+	if (!g_simd.memcpy_bulk)
+		ft_simd_init();
+	return (g_simd.memcpy_bulk(d, s, n));
+}
+
+void	*ft_memcpy(void *dest, const void *src, size_t n)
+{
+	const unsigned char	*s;
+	unsigned char		*d;
+	size_t				done;
+
+	if (!src && !dest)
+		return (NULL);
+	d = (unsigned char *)dest;
+	s = (const unsigned char *)src;
+	if (n < 16)
+	{
+		memcpy__copy_small(d, s, n);
+		return (dest);
+	}
+	done = 0;
+	if (n >= FT_MEM_BULK_MIN)
+		done = memcpy__copy_bulk(d, s, n);
+	if (n - done >= 16)
+		memcpy__copy_words(d + done, s + done, n - done);
+	else if (done < n)
+		memcpy__copy_words(d + n - 16, s + n - 16, 16);
+	return (dest);
+}
+
+/* --- ft_memcpy_avx2.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+size_t	ft_memcpy_bulk_avx2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	size_t	i;
+
+	_mm256_storeu_si256((__m256i *)d, _mm256_loadu_si256((const __m256i *)s));
+	i = 32 - ((uintptr_t)d & 31);
+	while (i + 128 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i),
+			_mm256_loadu_si256((const __m256i *)(s + i)));
+		_mm256_store_si256((__m256i *)(d + i + 32),
+			_mm256_loadu_si256((const __m256i *)(s + i + 32)));
+		_mm256_store_si256((__m256i *)(d + i + 64),
+			_mm256_loadu_si256((const __m256i *)(s + i + 64)));
+		_mm256_store_si256((__m256i *)(d + i + 96),
+			_mm256_loadu_si256((const __m256i *)(s + i + 96)));
+		i += 128;
+	}
+	while (i + 32 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i),
+			_mm256_loadu_si256((const __m256i *)(s + i)));
+		i += 32;
+	}
+	return (i);
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+/* --- ft_memcpy_sse2.c --- */
+
+
+#if defined(__SSE2__)
+
+size_t	ft_memcpy_bulk_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	size_t	i;
+
+	_mm_storeu_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+	i = 16 - ((uintptr_t)d & 15);
+	while (i + 64 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i),
+			_mm_loadu_si128((const __m128i *)(s + i)));
+		_mm_store_si128((__m128i *)(d + i + 16),
+			_mm_loadu_si128((const __m128i *)(s + i + 16)));
+		_mm_store_si128((__m128i *)(d + i + 32),
+			_mm_loadu_si128((const __m128i *)(s + i + 32)));
+		_mm_store_si128((__m128i *)(d + i + 48),
+			_mm_loadu_si128((const __m128i *)(s + i + 48)));
+		i += 64;
+	}
+	while (i + 16 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i),
+			_mm_loadu_si128((const __m128i *)(s + i)));
+		i += 16;
+	}
+	return (i);
+}
+
+#endif
+
+/* --- ft_memmem.c --- */
+
+
+void	*ft_memmem(const void *hay, size_t n, const void *needle, size_t m)
+{
+	t_twoway	tw;
+	size_t		j;
+
+	if (m == 0)
+		return ((void *)hay);
+	if (m > n)
+		return (NULL);
+	if (m == 1)
+		return (ft_memchr(hay, *(const unsigned char *)needle, n));
+	ft_twoway_init(&tw, needle, m, 1);
+	j = ft_twoway_find(&tw, hay, n);
+	if (j == SIZE_MAX)
+		return (NULL);
+	return ((unsigned char *)hay + j);
+}
+
+/**
+ * @note The needle and haystack are walked from their last bytes with a
+ *       negative step, so the first backward match is the last one.
+ */
+void	*ft_memmem_r(const void *hay, size_t n, const void *needle, size_t m)
+{
+	t_twoway	tw;
+	size_t		j;
+
+	if (m == 0)
+		return ((unsigned char *)hay + n);
+	if (m > n)
+		return (NULL);
+	if (m == 1)
+		return (ft_memrchr(hay, *(const unsigned char *)needle, n));
+	ft_twoway_init(&tw, (const unsigned char *)needle + m - 1, m, -1);
+	j = ft_twoway_find(&tw, (const unsigned char *)hay + n - 1, n);
+	if (j == SIZE_MAX)
+		return (NULL);
+	return ((unsigned char *)hay + n - j - m);
+}
+
+/* --- ft_memmove.c --- */
+
+
+/**
+ * @brief Move 1 to 3 bytes: first, middle and last byte cover them all.
+ */
+static void	memmove__move_tiny(unsigned char *d, const unsigned char *s, size_t n)
+{
+	unsigned char	first;
+	unsigned char	mid;
+	unsigned char	last;
+
+	first = s[0];
+	mid = s[n >> 1];
+	last = s[n - 1];
+	d[0] = first;
+	d[n >> 1] = mid;
+	d[n - 1] = last;
+}
+
+/**
+ * @brief Move fewer than 16 bytes.
+ *
+ * Every byte is loaded into a register before the first store, so the
+ * result is correct whichever way the two ranges overlap.
+ */
+static void	memmove__move_small(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	head;
+	uint64_t	tail;
+
+	if (n >= 8)
+	{
+		__builtin_memcpy(&head, s, 8);
+		__builtin_memcpy(&tail, s + n - 8, 8);
+		__builtin_memcpy(d, &head, 8);
+		__builtin_memcpy(d + n - 8, &tail, 8);
+	}
+	else if (n >= 4)
+	{
+		__builtin_memcpy(&head, s, 4);
+		__builtin_memcpy(&tail, s + n - 4, 4);
+		__builtin_memcpy(d, &head, 4);
+		__builtin_memcpy(d + n - 4, &tail, 4);
+	}
+	else if (n > 0)
+		memmove__move_tiny(d, s, n);
+}
+
+/**
+ * @brief Move 16 to 31 bytes with four overlapping word loads.
+ */
+static void	memmove__move_medium(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	a;
+	uint64_t	b;
+	uint64_t	c;
+	uint64_t	e;
+
+	__builtin_memcpy(&a, s, 8);
+	__builtin_memcpy(&b, s + 8, 8);
+	__builtin_memcpy(&c, s + n - 16, 8);
+	__builtin_memcpy(&e, s + n - 8, 8);
+	__builtin_memcpy(d, &a, 8);
+	__builtin_memcpy(d + 8, &b, 8);
+	__builtin_memcpy(d + n - 16, &c, 8);
+	__builtin_memcpy(d + n - 8, &e, 8);
+}
+
+/**
+ * @brief Move an overlapping range of at least FT_MEMMOVE_BULK_MIN bytes
+ *        with the bound forward or backward kernel.
+ */
+static void	memmove__move_bulk(unsigned char *d, const unsigned char *s, size_t n)
+{
+	if (!g_simd.memmove_fwd)
+		ft_simd_init();
+	if (d < s)
+		g_simd.memmove_fwd(d, s, n);
+	else
+		g_simd.memmove_bwd(d, s, n);
+}
+
+void	*ft_memmove(void *dst, const void *src, size_t len)
+{
+	const unsigned char	*s;
+	unsigned char		*d;
+
+	if (!src && !dst && len != 0)
+		return (NULL);
+	d = (unsigned char *)dst;
+	s = (const unsigned char *)src;
+	if (d == s)
+		return (dst);
+	if (len < 16)
+		memmove__move_small(d, s, len);
+	else if (len < FT_MEMMOVE_BULK_MIN)
+		memmove__move_medium(d, s, len);
+	else if (d + len <= s || s + len <= d)
+		ft_memcpy(d, s, len);
+	else
+		memmove__move_bulk(d, s, len);
+	return (dst);
+}
+
+/* --- ft_memmove_avx2.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+void	ft_memmove_fwd_avx2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m256i	head;
+	__m256i	tail;
+	__m256i	a;
+	__m256i	b;
+	size_t	i;
+
+	head = _mm256_loadu_si256((const __m256i *)s);
+	tail = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+	i = 32 - ((uintptr_t)d & 31);
+	while (i + 64 <= n)
+	{
+		a = _mm256_loadu_si256((const __m256i *)(s + i));
+		b = _mm256_loadu_si256((const __m256i *)(s + i + 32));
+		_mm256_store_si256((__m256i *)(d + i), a);
+		_mm256_store_si256((__m256i *)(d + i + 32), b);
+		i += 64;
+	}
+	if (i + 32 <= n)
+	{
+		a = _mm256_loadu_si256((const __m256i *)(s + i));
+		_mm256_store_si256((__m256i *)(d + i), a);
+	}
+	_mm256_storeu_si256((__m256i *)(d + n - 32), tail);
+	_mm256_storeu_si256((__m256i *)d, head);
+}
+
+void	ft_memmove_bwd_avx2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m256i	head;
+	__m256i	tail;
+	__m256i	a;
+	__m256i	b;
+	size_t	i;
+
+	head = _mm256_loadu_si256((const __m256i *)s);
+	tail = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+	i = n - ((uintptr_t)(d + n) & 31);
+	while (i >= 64)
+	{
+		i -= 64;
+		a = _mm256_loadu_si256((const __m256i *)(s + i + 32));
+		b = _mm256_loadu_si256((const __m256i *)(s + i));
+		_mm256_store_si256((__m256i *)(d + i + 32), a);
+		_mm256_store_si256((__m256i *)(d + i), b);
+	}
+	if (i >= 32)
+	{
+		a = _mm256_loadu_si256((const __m256i *)(s + i - 32));
+		_mm256_store_si256((__m256i *)(d + i - 32), a);
+	}
+	_mm256_storeu_si256((__m256i *)d, head);
+	_mm256_storeu_si256((__m256i *)(d + n - 32), tail);
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+/* --- ft_memmove_scalar.c --- */
+
+
+void	ft_memmove_fwd_scalar(unsigned char *d, const unsigned char *s,
+		size_t n)
+{
+	uint64_t	head;
+	uint64_t	tail;
+	uint64_t	w;
+	size_t		i;
+
+	__builtin_memcpy(&head, s, 8);
+	__builtin_memcpy(&tail, s + n - 8, 8);
+	i = 8 - ((uintptr_t)d & 7);
+	while (i + 8 <= n)
+	{
+		__builtin_memcpy(&w, s + i, 8);
+		__builtin_memcpy(d + i, &w, 8);
+		i += 8;
+	}
+	__builtin_memcpy(d + n - 8, &tail, 8);
+	__builtin_memcpy(d, &head, 8);
+}
+
+void	ft_memmove_bwd_scalar(unsigned char *d, const unsigned char *s,
+		size_t n)
+{
+	uint64_t	head;
+	uint64_t	tail;
+	uint64_t	w;
+	size_t		i;
+
+	__builtin_memcpy(&head, s, 8);
+	__builtin_memcpy(&tail, s + n - 8, 8);
+	i = n - ((uintptr_t)(d + n) & 7);
+	while (i >= 8)
+	{
+		i -= 8;
+		__builtin_memcpy(&w, s + i, 8);
+		__builtin_memcpy(d + i, &w, 8);
+	}
+	__builtin_memcpy(d, &head, 8);
+	__builtin_memcpy(d + n - 8, &tail, 8);
+}
+
+/* --- ft_memmove_sse2.c --- */
+
+
+#if defined(__SSE2__)
+
+void	ft_memmove_fwd_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m128i	head;
+	__m128i	tail;
+	__m128i	a;
+	__m128i	b;
+	size_t	i;
+
+	head = _mm_loadu_si128((const __m128i *)s);
+	tail = _mm_loadu_si128((const __m128i *)(s + n - 16));
+	i = 16 - ((uintptr_t)d & 15);
+	while (i + 32 <= n)
+	{
+		a = _mm_loadu_si128((const __m128i *)(s + i));
+		b = _mm_loadu_si128((const __m128i *)(s + i + 16));
+		_mm_store_si128((__m128i *)(d + i), a);
+		_mm_store_si128((__m128i *)(d + i + 16), b);
+		i += 32;
+	}
+	if (i + 16 <= n)
+	{
+		a = _mm_loadu_si128((const __m128i *)(s + i));
+		_mm_store_si128((__m128i *)(d + i), a);
+	}
+	_mm_storeu_si128((__m128i *)(d + n - 16), tail);
+	_mm_storeu_si128((__m128i *)d, head);
+}
+
+void	ft_memmove_bwd_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m128i	head;
+	__m128i	tail;
+	__m128i	a;
+	__m128i	b;
+	size_t	i;
+
+	head = _mm_loadu_si128((const __m128i *)s);
+	tail = _mm_loadu_si128((const __m128i *)(s + n - 16));
+	i = n - ((uintptr_t)(d + n) & 15);
+	while (i >= 32)
+	{
+		i -= 32;
+		a = _mm_loadu_si128((const __m128i *)(s + i + 16));
+		b = _mm_loadu_si128((const __m128i *)(s + i));
+		_mm_store_si128((__m128i *)(d + i + 16), a);
+		_mm_store_si128((__m128i *)(d + i), b);
+	}
+	if (i >= 16)
+	{
+		a = _mm_loadu_si128((const __m128i *)(s + i - 16));
+		_mm_store_si128((__m128i *)(d + i - 16), a);
+	}
+	_mm_storeu_si128((__m128i *)d, head);
+	_mm_storeu_si128((__m128i *)(d + n - 16), tail);
+}
+
+#endif
+
+/* --- ft_memrchr.c --- */
+
+
+/**
+ * @brief Scan the bytes [0, n) from the end for c.
+ */
+static void	*memrchr__memrchr_bytes(const unsigned char *p, unsigned char c, size_t n)
+{
+	while (n--)
+	{
+		if (p[n] == c)
+			return ((void *)(p + n));
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Skip whole 8-byte words from the end that hold no c byte.
+ *
+ * @return Number of leading bytes still to scan; the word ending there
+ *         (if any) contains a match.
+ */
+static size_t	memrchr__skip_words_back(const unsigned char *p, uint64_t pattern,
+		size_t n)
+{
+	uint64_t	w;
+
+	while (n >= 8)
+	{
+		__builtin_memcpy(&w, p + n - 8, 8);
+		w ^= pattern;
+		if ((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS)
+			return (n);
+		n -= 8;
+	}
+	return (n);
+}
+
+void	*ft_memrchr(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+	unsigned char		uc;
+	size_t				tail;
+	void				*hit;
+
+	p = (const unsigned char *)s;
+	uc = (unsigned char)c;
+	if (n < 16)
+		return (memrchr__memrchr_bytes(p, uc, n));
+	tail = ((uintptr_t)(p + n)) & 7;
+	hit = memrchr__memrchr_bytes(p + n - tail, uc, tail);
+	if (hit)
+		return (hit);
+	n = memrchr__skip_words_back(p, uc * FT_SWAR_ONES, n - tail);
+	return (memrchr__memrchr_bytes(p, uc, n));
+}
+
+/* --- ft_memset.c --- */
+
+
+/**
+ * @brief Fill fewer than 16 bytes with two overlapping stores.
+ */
+static void	memset__set_small(unsigned char *d, uint64_t word, size_t n)
+{
+	if (n >= 8)
+	{
+		__builtin_memcpy(d, &word, 8);
+		__builtin_memcpy(d + n - 8, &word, 8);
+	}
+	else if (n >= 4)
+	{
+		__builtin_memcpy(d, &word, 4);
+		__builtin_memcpy(d + n - 4, &word, 4);
+	}
+	else
+	{
+		while (n--)
+			d[n] = (unsigned char)word;
+	}
+}
+
+/**
+ * @brief Fill 16 bytes or more with 64-bit stores.
+ *
+ * One unaligned store covers the head, the loop runs on 8-byte aligned
+ * addresses and a last unaligned store covers the tail.
+ */
+static void	memset__set_words(unsigned char *d, uint64_t word, size_t n)
+{
+	size_t	i;
+
+	__builtin_memcpy(d, &word, 8);
+	i = 8 - ((uintptr_t)d & 7);
+	while (i + 8 <= n)
+	{
+		__builtin_memcpy(d + i, &word, 8);
+		i += 8;
+	}
+	__builtin_memcpy(d + n - 8, &word, 8);
+}
+
+size_t	ft_memset_bulk_scalar(unsigned char *d, unsigned char c, size_t n)
+{
+	(void)d;
+	(void)c;
+	(void)n;
+	return (0);
+}
+
+static size_t	memset__set_bulk(unsigned char *d, unsigned char c, size_t n)
+{
+	if (!g_simd.memset_bulk)
+		ft_simd_init();
+	return (g_simd.memset_bulk(d, c, n));
+}
+
+void	*ft_memset(void *b, int v, size_t len)
+{
+	unsigned char	*d;
+	uint64_t		word;
+	size_t			done;
+
+	d = (unsigned char *)b;
+	word = (uint64_t)(unsigned char)v * 0x0101010101010101ULL;
+	if (len < 16)
+	{
+		memset__set_small(d, word, len);
+		return (b);
+	}
+	done = 0;
+	if (len >= FT_MEM_BULK_MIN)
+		done = memset__set_bulk(d, (unsigned char)v, len);
+	if (len - done >= 16)
+		memset__set_words(d + done, word, len - done);
+	else if (done < len)
+		memset__set_words(d + len - 16, word, 16);
+	return (b);
+}
+
+/* --- ft_memset_avx2.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+static size_t	memset_avx2__set_stream(unsigned char *d, __m256i v, size_t i, size_t n)
+{
+	while (i + 128 <= n)
+	{
+		_mm256_stream_si256((__m256i *)(d + i), v);
+		_mm256_stream_si256((__m256i *)(d + i + 32), v);
+		_mm256_stream_si256((__m256i *)(d + i + 64), v);
+		_mm256_stream_si256((__m256i *)(d + i + 96), v);
+		i += 128;
+	}
+	_mm_sfence();
+	return (i);
+}
+
+size_t	ft_memset_bulk_avx2(unsigned char *d, unsigned char c, size_t n)
+{
+	__m256i	v;
+	size_t	i;
+
+	v = _mm256_set1_epi8((char)c);
+	_mm256_storeu_si256((__m256i *)d, v);
+	i = 32 - ((uintptr_t)d & 31);
+	if (n >= FT_MEMSET_NT_MIN)
+		i = memset_avx2__set_stream(d, v, i, n);
+	while (i + 128 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i), v);
+		_mm256_store_si256((__m256i *)(d + i + 32), v);
+		_mm256_store_si256((__m256i *)(d + i + 64), v);
+		_mm256_store_si256((__m256i *)(d + i + 96), v);
+		i += 128;
+	}
+	while (i + 32 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i), v);
+		i += 32;
+	}
+	return (i);
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+/* --- ft_memset_sse2.c --- */
+
+
+#if defined(__SSE2__)
+
+static size_t	memset_sse2__set_stream(unsigned char *d, __m128i v, size_t i, size_t n)
+{
+	while (i + 64 <= n)
+	{
+		_mm_stream_si128((__m128i *)(d + i), v);
+		_mm_stream_si128((__m128i *)(d + i + 16), v);
+		_mm_stream_si128((__m128i *)(d + i + 32), v);
+		_mm_stream_si128((__m128i *)(d + i + 48), v);
+		i += 64;
+	}
+	_mm_sfence();
+	return (i);
+}
+
+size_t	ft_memset_bulk_sse2(unsigned char *d, unsigned char c, size_t n)
+{
+	__m128i	v;
+	size_t	i;
+
+	v = _mm_set1_epi8((char)c);
+	_mm_storeu_si128((__m128i *)d, v);
+	i = 16 - ((uintptr_t)d & 15);
+	if (n >= FT_MEMSET_NT_MIN)
+		i = memset_sse2__set_stream(d, v, i, n);
+	while (i + 64 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i), v);
+		_mm_store_si128((__m128i *)(d + i + 16), v);
+		_mm_store_si128((__m128i *)(d + i + 32), v);
+		_mm_store_si128((__m128i *)(d + i + 48), v);
+		i += 64;
+	}
+	while (i + 16 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i), v);
+		i += 16;
+	}
+	return (i);
+}
+
+#endif
+
+/* --- ft_memswap.c --- */
+
+
+/**
+ * @brief Swap whole 8-byte words, then the last few bytes one by one.
+ */
+static void	memswap__swap_words(unsigned char *a, unsigned char *b, size_t n)
+{
+	uint64_t		wa;
+	uint64_t		wb;
+	unsigned char	c;
+
+	while (n >= 8)
+	{
+		__builtin_memcpy(&wa, a, 8);
+		__builtin_memcpy(&wb, b, 8);
+		__builtin_memcpy(a, &wb, 8);
+		__builtin_memcpy(b, &wa, 8);
+		a += 8;
+		b += 8;
+		n -= 8;
+	}
+	while (n--)
+	{
+		c = a[n];
+		a[n] = b[n];
+		b[n] = c;
+	}
+}
+
+size_t	ft_memswap_bulk_scalar(unsigned char *a, unsigned char *b, size_t n)
+{
+	(void)a;
+	(void)b;
+	(void)n;
+	return (0);
+}
+
+static size_t	memswap__swap_bulk(unsigned char *a, unsigned char *b, size_t n)
+{
+	if (!g_simd.memswap_bulk)
+		ft_simd_init();
+	return (g_simd.memswap_bulk(a, b, n));
+}
+
+/**
+ * Elements of any size are swapped in registers: vector blocks from
+ * FT_MEM_BULK_MIN bytes, 8-byte words below that. No temporary buffer,
+ * on the stack or the heap, is ever needed.
+ */
+void	ft_memswap(void *a, void *b, size_t n)
+{
+	unsigned char	*pa;
+	unsigned char	*pb;
+	size_t			done;
+
+	if (a == b)
+		return ;
+	pa = (unsigned char *)a;
+	pb = (unsigned char *)b;
+	done = 0;
+	if (n >= FT_MEM_BULK_MIN)
+		done = memswap__swap_bulk(pa, pb, n);
+	memswap__swap_words(pa + done, pb + done, n - done);
+}
+
+/* --- ft_memswap_avx2.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+size_t	ft_memswap_bulk_avx2(unsigned char *a, unsigned char *b, size_t n)
+{
+	size_t	i;
+	__m256i	va[2];
+	__m256i	vb[2];
+
+	i = 0;
+	while (i + 64 <= n)
+	{
+		va[0] = _mm256_loadu_si256((const __m256i *)(a + i));
+		va[1] = _mm256_loadu_si256((const __m256i *)(a + i + 32));
+		vb[0] = _mm256_loadu_si256((const __m256i *)(b + i));
+		vb[1] = _mm256_loadu_si256((const __m256i *)(b + i + 32));
+		_mm256_storeu_si256((__m256i *)(a + i), vb[0]);
+		_mm256_storeu_si256((__m256i *)(a + i + 32), vb[1]);
+		_mm256_storeu_si256((__m256i *)(b + i), va[0]);
+		_mm256_storeu_si256((__m256i *)(b + i + 32), va[1]);
+		i += 64;
+	}
+	return (i);
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+/* --- ft_memswap_sse2.c --- */
+
+
+#if defined(__SSE2__)
+
+size_t	ft_memswap_bulk_sse2(unsigned char *a, unsigned char *b, size_t n)
+{
+	size_t	i;
+	__m128i	va[2];
+	__m128i	vb[2];
+
+	i = 0;
+	while (i + 32 <= n)
+	{
+		va[0] = _mm_loadu_si128((const __m128i *)(a + i));
+		va[1] = _mm_loadu_si128((const __m128i *)(a + i + 16));
+		vb[0] = _mm_loadu_si128((const __m128i *)(b + i));
+		vb[1] = _mm_loadu_si128((const __m128i *)(b + i + 16));
+		_mm_storeu_si128((__m128i *)(a + i), vb[0]);
+		_mm_storeu_si128((__m128i *)(a + i + 16), vb[1]);
+		_mm_storeu_si128((__m128i *)(b + i), va[0]);
+		_mm_storeu_si128((__m128i *)(b + i + 16), va[1]);
+		i += 32;
+	}
+	return (i);
+}
+
+#endif
+
+/* --- ft_twoway.c --- */
+
+
+static int	twoway__byte_at(const t_twoway *tw, size_t i)
+{
+	return (tw->needle[(ptrdiff_t)i * tw->step]);
+}
+
+/**
+ * @brief One step of the maximal-suffix scan.
+ *
+ * s holds {ms, j, k, p}: the current maximal suffix start minus one, the
+ * candidate start, the offset being compared and the suffix period.
+ */
+static void	twoway__suffix_step(size_t *s, int cmp)
+{
+	if (cmp < 0)
+	{
+		s[1] += s[2];
+		s[2] = 1;
+		s[3] = s[1] - s[0];
+	}
+	else if (cmp == 0 && s[2]++ == s[3])
+	{
+		s[1] += s[3];
+		s[2] = 1;
+	}
+	else if (cmp > 0)
+	{
+		s[0] = s[1]++;
+		s[2] = 1;
+		s[3] = 1;
+	}
+}
+
+/**
+ * @brief Start of the maximal suffix of the needle for one byte order.
+ * @param order 1 for the natural order, -1 for the reversed one.
+ * @param period Receives the period of that suffix.
+ */
+static size_t	twoway__maximal_suffix(const t_twoway *tw, int order, size_t *period)
+{
+	size_t	s[4];
+
+	s[0] = SIZE_MAX;
+	s[1] = 0;
+	s[2] = 1;
+	s[3] = 1;
+	while (s[1] + s[2] < tw->m)
+		twoway__suffix_step(s, order * (twoway__byte_at(tw, s[1] + s[2])
+				- twoway__byte_at(tw, s[0] + s[2])));
+	*period = s[3];
+	return (s[0] + 1);
+}
+
+/**
+ * @brief Whether needle[0..ms) equals needle[period..period + ms).
+ *
+ * Both ranges are compared as forward byte ranges; for a backward needle
+ * they are the mirrored ranges, which are equal exactly when the
+ * reversed sequences are.
+ */
+static int	twoway__is_periodic(const t_twoway *tw)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+
+	a = tw->needle;
+	b = tw->needle + tw->step * (ptrdiff_t)tw->period;
+	if (tw->step < 0 && tw->ms > 0)
+	{
+		a -= tw->ms - 1;
+		b -= tw->ms - 1;
+	}
+	return (ft_memcmp(a, b, tw->ms) == 0);
+}
+
+void	ft_twoway_init(t_twoway *tw, const unsigned char *needle, size_t m,
+		ptrdiff_t step)
+{
+	size_t	ms_rev;
+	size_t	p_rev;
+
+	tw->needle = needle;
+	tw->step = step;
+	tw->m = m;
+	tw->shift = NULL;
+	tw->ms = twoway__maximal_suffix(tw, 1, &tw->period);
+	ms_rev = twoway__maximal_suffix(tw, -1, &p_rev);
+	if (ms_rev > tw->ms)
+	{
+		tw->ms = ms_rev;
+		tw->period = p_rev;
+	}
+	tw->periodic = twoway__is_periodic(tw);
+	if (!tw->periodic && tw->ms > tw->m - tw->ms)
+		tw->period = tw->ms + 1;
+	else if (!tw->periodic)
+		tw->period = tw->m - tw->ms + 1;
+}
+
+/* --- ft_twoway_find.c --- */
+
+
+/**
+ * @brief Match the right part needle[ms..m) at window j.
+ * @return Index of the first mismatching needle byte, or m.
+ */
+static size_t	twoway_find__match_right(const t_twoway *tw, const unsigned char *h,
+		size_t j, size_t mem)
+{
+	size_t	i;
+
+	i = tw->ms;
+	if (mem > i)
+		i = mem;
+	while (i < tw->m && tw->needle[(ptrdiff_t)i * tw->step]
+		== h[(ptrdiff_t)(i + j) * tw->step])
+		i++;
+	return (i);
+}
+
+/**
+ * @brief Match the left part needle[mem..ms) at window j, right to left.
+ */
+static int	twoway_find__match_left(const t_twoway *tw, const unsigned char *h,
+		size_t j, size_t mem)
+{
+	size_t	i;
+
+	i = tw->ms;
+	while (i > mem && tw->needle[(ptrdiff_t)(i - 1) * tw->step]
+		== h[(ptrdiff_t)(i - 1 + j) * tw->step])
+		i--;
+	return (i <= mem);
+}
+
+/**
+ * @brief Horspool skip: slide by the shift of each window's last byte
+ *        until that byte equals the needle's last byte (forward only).
+ */
+static size_t	twoway_find__shift_windows(const t_twoway *tw, const unsigned char *h,
+		size_t j, size_t n)
+{
+	unsigned char	s;
+
+	while (j <= n - tw->m)
+	{
+		s = tw->shift[h[j + tw->m - 1]];
+		if (!s)
+			return (j);
+		j += s;
+	}
+	return (n);
+}
+
+/**
+ * @brief Jump to the next window whose byte at ms equals needle[ms].
+ *
+ * Only used when no match memory is held, so no window that could match
+ * is skipped. The scan is a vectorised ft_memchr (or ft_memrchr going
+ * backwards), which is where most of the haystack is consumed, unless a
+ * Horspool table is attached.
+ *
+ * @return The new window, or n when none is left.
+ */
+static size_t	twoway_find__skip_windows(const t_twoway *tw, const unsigned char *h,
+		size_t j, size_t n)
+{
+	const unsigned char	*hit;
+	unsigned char		c;
+	size_t				last;
+
+	if (tw->shift)
+		return (twoway_find__shift_windows(tw, h, j, n));
+	c = tw->needle[(ptrdiff_t)tw->ms * tw->step];
+	last = n - tw->m;
+	if (tw->step > 0)
+		hit = ft_memchr(h + j + tw->ms, c, last - j + 1);
+	else
+		hit = ft_memrchr(h - (last + tw->ms), c, last - j + 1);
+	if (!hit)
+		return (n);
+	if (tw->step > 0)
+		return ((size_t)(hit - h) - tw->ms);
+	return ((size_t)(h - hit) - tw->ms);
+}
+
+/**
+ * @brief Run a prepared Two-Way search over n >= tw->m bytes.
+ * @return Offset of the first match in search direction, or SIZE_MAX.
+ */
+size_t	ft_twoway_find(const t_twoway *tw, const unsigned char *h, size_t n)
+{
+	size_t	j;
+	size_t	i;
+	size_t	mem;
+
+	j = 0;
+	mem = 0;
+	while (j <= n - tw->m)
+	{
+		if (mem == 0)
+			j = twoway_find__skip_windows(tw, h, j, n);
+		if (j > n - tw->m)
+			break ;
+		i = twoway_find__match_right(tw, h, j, mem);
+		if (i < tw->m)
+			j += i - tw->ms + 1;
+		else if (twoway_find__match_left(tw, h, j, mem))
+			return (j);
+		else
+			j += tw->period;
+		mem = 0;
+		if (i == tw->m && tw->periodic)
+			mem = tw->m - tw->period;
+	}
+	return (SIZE_MAX);
+}
+
+
+/* ========================================================================== */
+/*                               ft_str                                       */
+/* ========================================================================== */
+
+/* --- ft_atof.c --- */
+
+
+double	ft_atof(const char *str)
+{
+	return (ft_strtod(str, NULL, NULL));
+}
+
+/* --- ft_atoi.c --- */
+
+
+int	ft_atoi(const char *str)
+{
+	return ((int)ft_strtol(str, NULL, 10, NULL));
+}
+
+/* --- ft_itoa.c --- */
+
+
+char	*ft_itoa(int n)
+{
+	char	buf[FT_ITOA_BUFSZ];
+	char	*str;
+	size_t	len;
+
+	len = ft_itoa_buf(n, buf);
+	str = malloc(len + 1);
+	if (!str)
+		return (NULL);
+	ft_memstats_note("ft_itoa", len + 1);
+	ft_memcpy(str, buf, len + 1);
+	return (str);
+}
+
+/* --- ft_split.c --- */
+
+
+/**
+ * @brief Length of the word at s, which ends at c or the terminator.
+ */
+static size_t	split__word_len(char const *s, char c)
+{
+	size_t	len;
+
+	len = 0;
+	while (s[len] && s[len] != c)
+		len++;
+	return (len);
+}
+
+/**
+ * @brief Count the words of s and their total length in one pass.
+ */
+static size_t	split__count_words(char const *s, char c, size_t *bytes)
+{
+	size_t	count;
+	size_t	len;
+
+	count = 0;
+	*bytes = 0;
+	while (*s)
+	{
+		while (*s == c)
+			s++;
+		len = split__word_len(s, c);
+		if (len)
+			count++;
+		*bytes += len;
+		s += len;
+	}
+	return (count);
+}
+
+/**
+ * @brief Copy every word of s into dst, one after the other, and point
+ *        the entries of split at them.
+ */
+static void	split__fill_words(char **split, char *dst, char const *s, char c)
+{
+	size_t	len;
+
+	while (*s)
+	{
+		while (*s == c)
+			s++;
+		len = split__word_len(s, c);
+		if (len)
+		{
+			*split++ = dst;
+			ft_memcpy(dst, s, len);
+			dst[len] = '\0';
+			dst += len + 1;
+		}
+		s += len;
+	}
+	*split = NULL;
+}
+
+/**
+ * One counting pass sizes a single block holding the pointer array
+ * followed by every word, and one copy pass fills it.
+ */
+char	**ft_split(char const *s, char c)
+{
+	char	**split;
+	size_t	words;
+	size_t	bytes;
+	size_t	size;
+
+	if (!s)
+		return (NULL);
+	words = split__count_words(s, c, &bytes);
+	size = (words + 1) * sizeof(char *) + bytes + words;
+	split = malloc(size);
+	if (!split)
+		return (NULL);
+	ft_memstats_note("ft_split", size);
+	split__fill_words(split, (char *)(split + words + 1), s, c);
+	return (split);
+}
+
+void	ft_split_free(char **split)
+{
+	free(split);
+}
+
+/* --- ft_split_set.c --- */
+
+
+/**
+ * @brief Count the words of s and their total length in one pass.
+ */
+static size_t	split_set__count_words(const char *s, const t_charset *set,
+		size_t *bytes)
+{
+	size_t	count;
+	size_t	len;
+
+	count = 0;
+	*bytes = 0;
+	s += ft_charset_span(s, set);
+	while (*s)
+	{
+		len = ft_charset_cspan(s, set);
+		count++;
+		*bytes += len;
+		s += len;
+		s += ft_charset_span(s, set);
+	}
+	return (count);
+}
+
+/**
+ * @brief Copy every word of s into dst and point the entries of split at
+ *        them.
+ */
+static void	split_set__fill_words(char **split, char *dst, const char *s,
+		const t_charset *set)
+{
+	size_t	len;
+
+	s += ft_charset_span(s, set);
+	while (*s)
+	{
+		len = ft_charset_cspan(s, set);
+		*split++ = dst;
+		ft_memcpy(dst, s, len);
+		dst[len] = '\0';
+		dst += len + 1;
+		s += len;
+		s += ft_charset_span(s, set);
+	}
+	*split = NULL;
+}
+
+/**
+ * Same single-block layout as ft_split: the pointer array followed by
+ * every word.
+ */
+char	**ft_split_set(const char *s, const t_charset *set)
+{
+	char	**split;
+	size_t	words;
+	size_t	bytes;
+	size_t	size;
+
+	if (!s || !set)
+		return (NULL);
+	words = split_set__count_words(s, set, &bytes);
+	size = (words + 1) * sizeof(char *) + bytes + words;
+	split = malloc(size);
+	if (!split)
+		return (NULL);
+	ft_memstats_note("ft_split_set", size);
+	split_set__fill_words(split, (char *)(split + words + 1), s, set);
+	return (split);
+}
+
+/* --- ft_strchr.c --- */
+
+
+static uint64_t	strchr__has_zero(uint64_t w)
+{
+	return ((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS);
+}
+
+/**
+ * Same word walk as ft_strlen_scalar, stopping at the first aligned word
+ * that holds either the terminator or c.
+ */
+FT_NO_ASAN char	*ft_strchr_scalar(const char *s, int c)
+{
+	uint64_t	pattern;
+	uint64_t	w;
+	char		ch;
+
+	ch = (char)c;
+	while ((uintptr_t)s & 7)
+	{
+		if (*s == ch)
+			return ((char *)s);
+		if (!*s)
+			return (NULL);
+		s++;
+	}
+	pattern = (unsigned char)ch * FT_SWAR_ONES;
+	__builtin_memcpy(&w, s, 8);
+	while (!strchr__has_zero(w) && !strchr__has_zero(w ^ pattern))
+	{
+		s += 8;
+		__builtin_memcpy(&w, s, 8);
+	}
+	while (*s && *s != ch)
+		s++;
+	if (*s == ch)
+		return ((char *)s);
+	return (NULL);
+}
+
+char	*ft_strchr(const char *s, int c)
+{
+	if (!g_simd.strchr)
+		ft_simd_init();
+	return (g_simd.strchr(s, c));
+}
+
+/* --- ft_strcmp.c --- */
+
+int	ft_strcmp(const char *s1, const char *s2)
+{
+	while (*s1 && (*s1 == *s2))
+	{
+		s1++;
+		s2++;
+	}
+	return (*(const unsigned char *)s1 - *(const unsigned char *)s2);
+}
+
+/* --- ft_strdup.c --- */
+
+
+char	*ft_strdup(const char *s)
+{
+	int		len;
+	char	*dup;
+	char	*temp;
+
+	len = 0;
+	while (s[len])
+		len++;
+	dup = malloc(len + 1);
+	if (!dup)
+		return (NULL);
+	ft_memstats_note("ft_strdup", len + 1);
+	temp = dup;
+	while (*s)
+		*temp++ = *s++;
+	*temp = '\0';
+	return (dup);
+}
+
+/* --- ft_striteri.c --- */
+
+
+void	ft_striteri(char *s, void (*f)(unsigned int, char *))
+{
+	unsigned int	i;
+
+	i = 0;
+	if (s == NULL || f == NULL)
+		return ;
+	while (s[i] != '\0')
+	{
+		f(i, &s[i]);
+		i++;
+	}
+}
+
+/* --- ft_strjoin.c --- */
+
+
+char	*ft_strjoin(char const *s1, char const *s2)
+{
+	size_t	len1;
+	size_t	len2;
+	char	*str;
+
+	len1 = 0;
+	if (s1)
+		len1 = ft_strlen(s1);
+	len2 = 0;
+	if (s2)
+		len2 = ft_strlen(s2);
+	str = (char *)malloc(len1 + len2 + 1);
+	if (!str)
+		return (NULL);
+	ft_memstats_note("ft_strjoin", len1 + len2 + 1);
+	ft_memcpy(str, s1, len1);
+	ft_memcpy(str + len1, s2, len2);
+	str[len1 + len2] = '\0';
+	return (str);
+}
+
+/* --- ft_strjoin_arr.c --- */
+
+
+/**
+ * @brief Length of the joined string, or SIZE_MAX on overflow.
+ */
+static size_t	strjoin_arr__joined_len(char **parts, size_t sep_len)
+{
+	size_t	total;
+	size_t	len;
+	size_t	i;
+
+	total = 0;
+	i = 0;
+	while (parts[i])
+	{
+		len = ft_strlen(parts[i]);
+		if (i > 0)
+			len += sep_len;
+		if (len < sep_len || len >= SIZE_MAX - total)
+			return (SIZE_MAX);
+		total += len;
+		i++;
+	}
+	return (total);
+}
+
+static void	strjoin_arr__copy_joined(char *dst, char **parts, const char *sep,
+		size_t sep_len)
+{
+	size_t	len;
+	size_t	i;
+
+	i = 0;
+	while (parts[i])
+	{
+		if (i > 0)
+		{
+			ft_memcpy(dst, sep, sep_len);
+			dst += sep_len;
+		}
+		len = ft_strlen(parts[i]);
+		ft_memcpy(dst, parts[i], len);
+		dst += len;
+		i++;
+	}
+	*dst = '\0';
+}
+
+/**
+ * The inverse of splitting: ft_strjoin_arr(ft_split(s, ','), ",") gives
+ * s back without its empty fields. One length pass, one allocation, one
+ * copy pass.
+ */
+char	*ft_strjoin_arr(char **parts, const char *sep)
+{
+	size_t	sep_len;
+	size_t	total;
+	char	*str;
+
+	if (!parts)
+		return (NULL);
+	if (!sep)
+		sep = "";
+	sep_len = ft_strlen(sep);
+	total = strjoin_arr__joined_len(parts, sep_len);
+	if (total == SIZE_MAX)
+		return (NULL);
+	str = malloc(total + 1);
+	if (!str)
+		return (NULL);
+	ft_memstats_note("ft_strjoin_arr", total + 1);
+	strjoin_arr__copy_joined(str, parts, sep, sep_len);
+	return (str);
+}
+
+/* --- ft_strjoin_n.c --- */
+
+
+/**
+ * @brief Sum of the lengths of the next count strings of ap (NULL counts
+ *        as empty), or SIZE_MAX if it would not fit with a terminator.
+ */
+static size_t	strjoin_n__total_len(size_t count, va_list *ap)
+{
+	const char	*part;
+	size_t		total;
+	size_t		len;
+
+	total = 0;
+	while (count--)
+	{
+		part = va_arg(*ap, const char *);
+		len = 0;
+		if (part)
+			len = ft_strlen(part);
+		if (len >= SIZE_MAX - total)
+			return (SIZE_MAX);
+		total += len;
+	}
+	return (total);
+}
+
+/**
+ * @brief Copy the next count strings of ap back to back into dst and
+ *        terminate it.
+ */
+static void	strjoin_n__copy_parts(char *dst, size_t count, va_list *ap)
+{
+	const char	*part;
+	size_t		len;
+
+	while (count--)
+	{
+		part = va_arg(*ap, const char *);
+		if (part)
+		{
+			len = ft_strlen(part);
+			ft_memcpy(dst, part, len);
+			dst += len;
+		}
+	}
+	*dst = '\0';
+}
+
+/**
+ * The arguments are walked twice: once to size a single allocation and
+ * once to copy, so joining N strings costs O(total) instead of the
+ * O(N * total) of chained ft_strjoin calls.
+ */
+char	*ft_strjoin_n(size_t count, ...)
+{
+	va_list	ap;
+	size_t	total;
+	char	*str;
+
+	va_start(ap, count);
+	total = strjoin_n__total_len(count, &ap);
+	va_end(ap);
+	if (total == SIZE_MAX)
+		return (NULL);
+	str = malloc(total + 1);
+	if (!str)
+		return (NULL);
+	ft_memstats_note("ft_strjoin_n", total + 1);
+	va_start(ap, count);
+	strjoin_n__copy_parts(str, count, &ap);
+	va_end(ap);
+	return (str);
+}
+
+/* --- ft_strlcat.c --- */
+
+
+size_t	ft_strlcat(char *dst, const char *src, size_t dstsize)
+{
+	size_t	dlen;
+	size_t	slen;
+	size_t	i;
+
+	if (!dst && dstsize == 0)
+		return (ft_strlen(src));
+	dlen = ft_strlen(dst);
+	slen = ft_strlen(src);
+	if (dstsize <= dlen)
+		return (dstsize + slen);
+	i = 0;
+	while (src[i] && dlen + i < dstsize - 1)
+	{
+		dst[dlen + i] = src[i];
+		i++;
+	}
+	dst[dlen + i] = '\0';
+	return (dlen + slen);
+}
+
+/* --- ft_strlcpy.c --- */
+
+
+size_t	ft_strlcpy(char *dst, const char *src, size_t destsize)
+{
+	size_t	i;
+	size_t	res;
+
+	i = 0;
+	res = 0;
+	while (src[res])
+		res++;
+	if (destsize < 1)
+		return (res);
+	while (src[i] && i < destsize - 1)
+	{
+		dst[i] = src[i];
+		i++;
+	}
+	dst[i] = '\0';
+	return (res);
+}
+
+/* --- ft_strlen.c --- */
+
+
+/**
+ * Bytes are checked one by one up to an 8-byte boundary, then a whole
+ * aligned word at a time. An aligned word never straddles a page, so the
+ * bytes read past the terminator in the last word cannot fault.
+ */
+FT_NO_ASAN size_t	ft_strlen_scalar(const char *s)
+{
+	const char	*p;
+	uint64_t	w;
+
+	p = s;
+	while ((uintptr_t)p & 7)
+	{
+		if (!*p)
+			return ((size_t)(p - s));
+		p++;
+	}
+	__builtin_memcpy(&w, p, 8);
+	while (!((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS))
+	{
+		p += 8;
+		__builtin_memcpy(&w, p, 8);
+	}
+	while (*p)
+		p++;
+	return ((size_t)(p - s));
+}
+
+size_t	ft_strlen(const char *s)
+{
+	if (!g_simd.strlen)
+		ft_simd_init();
+	return (g_simd.strlen(s));
+}
+
+/* --- ft_strmapi.c --- */
+
+
+char	*ft_strmapi(char const *s, char (*f)(unsigned int, char))
+{
+	char			*str_new;
+	size_t			s_len;
+	unsigned int	i;
+
+	if (s == NULL || f == NULL)
+		return (NULL);
+	s_len = ft_strlen(s);
+	str_new = (char *)malloc(sizeof(char) * (s_len + 1));
+	if (str_new == NULL)
+		return (NULL);
+	ft_memstats_note("ft_strmapi", s_len + 1);
+	i = 0;
+	while (i < s_len)
+	{
+		str_new[i] = f(i, s[i]);
+		i++;
+	}
+	str_new[i] = '\0';
+	return (str_new);
+}
+
+/* --- ft_strncmp.c --- */
+
+
+int	ft_strncmp(const char *s1, const char *s2, size_t n)
+{
+	unsigned char	c1;
+	unsigned char	c2;
+	size_t			i;
+
+	i = 0;
+	while (i < n && s1[i] && s1[i] == s2[i])
+		i++;
+	if (i == n)
+		return (0);
+	c1 = (unsigned char)s1[i];
+	c2 = (unsigned char)s2[i];
+	return ((c1 > c2) - (c1 < c2));
+}
+
+/* --- ft_strnstr.c --- */
+
+
+static char	*strnstr__scan_short(const char *haystack, const char *needle, size_t len)
+{
+	size_t	i;
+	size_t	j;
+
+	i = 0;
+	while (haystack[i] && i < len)
+	{
+		j = 0;
+		while (i + j < len && haystack[i + j] == needle[j] && needle[j])
+			j++;
+		if (needle[j] == '\0')
+			return ((char *)(haystack + i));
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * Short needles keep the plain scan, which is at most
+ * FT_STRNSTR_LONG * len compares. Longer ones bound the haystack at its
+ * terminator with a vectorised ft_memchr and run ft_memmem on the rest.
+ */
+char	*ft_strnstr(const char *haystack, const char *needle, size_t len)
+{
+	const char	*end;
+	size_t		m;
+
+	if (*needle == '\0')
+		return ((char *)haystack);
+	m = 0;
+	while (m < FT_STRNSTR_LONG && needle[m])
+		m++;
+	if (m < FT_STRNSTR_LONG)
+		return (strnstr__scan_short(haystack, needle, len));
+	m += ft_strlen(needle + m);
+	end = ft_memchr(haystack, '\0', len);
+	if (end)
+		len = (size_t)(end - haystack);
+	return (ft_memmem(haystack, len, needle, m));
+}
+
+/* --- ft_strrchr.c --- */
+
+
+static uint64_t	strrchr__has_zero(uint64_t w)
+{
+	return ((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS);
+}
+
+/**
+ * @brief Last ch among the n bytes at s, or last if there is none.
+ */
+static const char	*strrchr__last_in(const char *s, size_t n, char ch,
+		const char *last)
+{
+	while (n--)
+	{
+		if (s[n] == ch)
+			return (s + n);
+	}
+	return (last);
+}
+
+/**
+ * Single forward pass: aligned words without a terminator are tested for
+ * ch as a whole, and only a word that holds ch is searched byte by byte.
+ */
+FT_NO_ASAN char	*ft_strrchr_scalar(const char *s, int c)
+{
+	const char	*last;
+	uint64_t	pattern;
+	uint64_t	w;
+	char		ch;
+
+	ch = (char)c;
+	if (!ch)
+		return ((char *)s + ft_strlen(s));
+	last = NULL;
+	while (((uintptr_t)s & 7) && *s)
+		last = strrchr__last_in(s++, 1, ch, last);
+	if (!*s)
+		return ((char *)last);
+	pattern = (unsigned char)ch * FT_SWAR_ONES;
+	__builtin_memcpy(&w, s, 8);
+	while (!strrchr__has_zero(w))
+	{
+		if (strrchr__has_zero(w ^ pattern))
+			last = strrchr__last_in(s, 8, ch, last);
+		s += 8;
+		__builtin_memcpy(&w, s, 8);
+	}
+	while (*s)
+		last = strrchr__last_in(s++, 1, ch, last);
+	return ((char *)last);
+}
+
+char	*ft_strrchr(const char *str, int c)
+{
+	if (!g_simd.strrchr)
+		ft_simd_init();
+	return (g_simd.strrchr(str, c));
+}
+
+/* --- ft_strrchr_avx2.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+static FT_NO_ASAN uint64_t	strrchr_avx2__eq64(const char *p, __m256i v)
+{
+	uint64_t	m;
+	int			i;
+
+	m = 0;
+	i = 0;
+	while (i < 64)
+	{
+		m |= (uint64_t)(unsigned int)_mm256_movemask_epi8(
+				_mm256_cmpeq_epi8(
+					_mm256_load_si256((const __m256i *)(p + i)), v)) << i;
+		i += 32;
+	}
+	return (m);
+}
+
+/**
+ * Single forward pass over aligned 64-byte chunks (page-safe like
+ * ft_strlen_avx2). The newest chunk holding c is remembered; at the
+ * chunk with the terminator, matches past it are masked off.
+ */
+FT_NO_ASAN char	*ft_strrchr_avx2(const char *s, int c)
+{
+	const char	*p;
+	const char	*last;
+	uint64_t	z;
+	uint64_t	m;
+	__m256i		v;
+
+	if ((char)c == '\0')
+		return ((char *)s + ft_strlen_avx2(s));
+	v = _mm256_set1_epi8((char)c);
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)63);
+	z = strrchr_avx2__eq64(p, _mm256_setzero_si256()) & (~0ULL << ((uintptr_t)s & 63));
+	m = strrchr_avx2__eq64(p, v) & (~0ULL << ((uintptr_t)s & 63));
+	last = NULL;
+	while (!z)
+	{
+		if (m)
+			last = p + 63 - __builtin_clzll(m);
+		p += 64;
+		z = strrchr_avx2__eq64(p, _mm256_setzero_si256());
+		m = strrchr_avx2__eq64(p, v);
+	}
+	m &= z ^ (z - 1);
+	if (m)
+		return ((char *)p + 63 - __builtin_clzll(m));
+	return ((char *)last);
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+/* --- ft_strrchr_sse2.c --- */
+
+
+#if defined(__SSE2__)
+
+static FT_NO_ASAN uint64_t	strrchr_sse2__eq64(const char *p, __m128i v)
+{
+	uint64_t	m;
+	int			i;
+
+	m = 0;
+	i = 0;
+	while (i < 64)
+	{
+		m |= (uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_load_si128((const __m128i *)(p + i)), v)) << i;
+		i += 16;
+	}
+	return (m);
+}
+
+/**
+ * Single forward pass over aligned 64-byte chunks (page-safe like
+ * ft_strlen_sse2). The newest chunk holding c is remembered; at the
+ * chunk with the terminator, matches past it are masked off.
+ */
+FT_NO_ASAN char	*ft_strrchr_sse2(const char *s, int c)
+{
+	const char	*p;
+	const char	*last;
+	uint64_t	z;
+	uint64_t	m;
+	__m128i		v;
+
+	if ((char)c == '\0')
+		return ((char *)s + ft_strlen_sse2(s));
+	v = _mm_set1_epi8((char)c);
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)63);
+	z = strrchr_sse2__eq64(p, _mm_setzero_si128()) & (~0ULL << ((uintptr_t)s & 63));
+	m = strrchr_sse2__eq64(p, v) & (~0ULL << ((uintptr_t)s & 63));
+	last = NULL;
+	while (!z)
+	{
+		if (m)
+			last = p + 63 - __builtin_clzll(m);
+		p += 64;
+		z = strrchr_sse2__eq64(p, _mm_setzero_si128());
+		m = strrchr_sse2__eq64(p, v);
+	}
+	m &= z ^ (z - 1);
+	if (m)
+		return ((char *)p + 63 - __builtin_clzll(m));
+	return ((char *)last);
+}
+
+#endif
+
+/* --- ft_strscan_avx2.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+/**
+ * @brief Bit i set when byte i of the aligned block at p is zero or equal
+ *        to the byte broadcast in v.
+ *
+ * min(x, x ^ v) is zero exactly for those bytes, so both tests cost one
+ * compare; with v zero it is the plain terminator test.
+ */
+static FT_NO_ASAN unsigned int	strscan_avx2__hit32(const char *p, __m256i v)
+{
+	__m256i	x;
+
+	x = _mm256_load_si256((const __m256i *)p);
+	x = _mm256_min_epu8(x, _mm256_xor_si256(x, v));
+	return ((unsigned int)_mm256_movemask_epi8(
+			_mm256_cmpeq_epi8(x, _mm256_setzero_si256())));
+}
+
+static FT_NO_ASAN uint64_t	strscan_avx2__hits64(const char *p, __m256i v)
+{
+	return ((uint64_t)strscan_avx2__hit32(p, v) | (uint64_t)strscan_avx2__hit32(p + 32, v) << 32);
+}
+
+/**
+ * @brief First byte at or after s that is the terminator or matches v.
+ *
+ * Reads whole aligned 64-byte chunks: the first starts below s (those
+ * bits are shifted out) and the last may run past the terminator, but a
+ * 64-byte aligned chunk never crosses a page.
+ */
+static FT_NO_ASAN const char	*strscan_avx2__scan(const char *s, __m256i v)
+{
+	const char	*p;
+	uint64_t	m;
+
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)63);
+	m = strscan_avx2__hits64(p, v) >> ((uintptr_t)s & 63);
+	if (m)
+		return (s + __builtin_ctzll(m));
+	p += 64;
+	m = strscan_avx2__hits64(p, v);
+	while (!m)
+	{
+		p += 64;
+		m = strscan_avx2__hits64(p, v);
+	}
+	return (p + __builtin_ctzll(m));
+}
+
+FT_NO_ASAN size_t	ft_strlen_avx2(const char *s)
+{
+	return ((size_t)(strscan_avx2__scan(s, _mm256_setzero_si256()) - s));
+}
+
+FT_NO_ASAN char	*ft_strchr_avx2(const char *s, int c)
+{
+	const char	*p;
+
+	p = strscan_avx2__scan(s, _mm256_set1_epi8((char)c));
+	if (*p == (char)c)
+		return ((char *)p);
+	return (NULL);
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+/* --- ft_strscan_sse2.c --- */
+
+
+#if defined(__SSE2__)
+
+/**
+ * @brief Bit i set when byte i of the aligned block at p is zero or equal
+ *        to the byte broadcast in v.
+ *
+ * min(x, x ^ v) is zero exactly for those bytes, so both tests cost one
+ * compare; with v zero it is the plain terminator test.
+ */
+static FT_NO_ASAN unsigned int	strscan_sse2__hit16(const char *p, __m128i v)
+{
+	__m128i	x;
+
+	x = _mm_load_si128((const __m128i *)p);
+	x = _mm_min_epu8(x, _mm_xor_si128(x, v));
+	return ((unsigned int)_mm_movemask_epi8(
+			_mm_cmpeq_epi8(x, _mm_setzero_si128())));
+}
+
+static FT_NO_ASAN uint64_t	strscan_sse2__hits64(const char *p, __m128i v)
+{
+	return ((uint64_t)strscan_sse2__hit16(p, v) | (uint64_t)strscan_sse2__hit16(p + 16, v) << 16
+		| (uint64_t)strscan_sse2__hit16(p + 32, v) << 32
+		| (uint64_t)strscan_sse2__hit16(p + 48, v) << 48);
+}
+
+/**
+ * @brief First byte at or after s that is the terminator or matches v.
+ *
+ * Reads whole aligned 64-byte chunks: the first starts below s (those
+ * bits are shifted out) and the last may run past the terminator, but a
+ * 64-byte aligned chunk never crosses a page.
+ */
+static FT_NO_ASAN const char	*strscan_sse2__scan(const char *s, __m128i v)
+{
+	const char	*p;
+	uint64_t	m;
+
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)63);
+	m = strscan_sse2__hits64(p, v) >> ((uintptr_t)s & 63);
+	if (m)
+		return (s + __builtin_ctzll(m));
+	p += 64;
+	m = strscan_sse2__hits64(p, v);
+	while (!m)
+	{
+		p += 64;
+		m = strscan_sse2__hits64(p, v);
+	}
+	return (p + __builtin_ctzll(m));
+}
+
+FT_NO_ASAN size_t	ft_strlen_sse2(const char *s)
+{
+	return ((size_t)(strscan_sse2__scan(s, _mm_setzero_si128()) - s));
+}
+
+FT_NO_ASAN char	*ft_strchr_sse2(const char *s, int c)
+{
+	const char	*p;
+
+	p = strscan_sse2__scan(s, _mm_set1_epi8((char)c));
+	if (*p == (char)c)
+		return ((char *)p);
 	return (NULL);
 }
 
-/* --- ft_memcmp.c --- */
+#endif
+
+/* --- ft_strsearch.c --- */
+
+
+/**
+ * Every byte starts with the full window shift (capped at 255); bytes of
+ * needle[0..m-1) get their distance to the end, and the last byte gets 0
+ * so the scan stops on every window that could match.
+ */
+static void	strsearch__build_shift(unsigned char *shift, const unsigned char *needle,
+		size_t m)
+{
+	size_t	i;
+	size_t	d;
+
+	d = m;
+	if (d > 255)
+		d = 255;
+	ft_memset(shift, (int)d, 256);
+	i = 0;
+	if (m > 256)
+		i = m - 256;
+	while (i + 1 < m)
+	{
+		shift[needle[i]] = (unsigned char)(m - 1 - i);
+		i++;
+	}
+	shift[needle[m - 1]] = 0;
+}
+
+void	ft_strsearch_init(t_strsearch *s, const char *needle, size_t m)
+{
+	s->tw.needle = (const unsigned char *)needle;
+	s->tw.m = m;
+	if (m < 2)
+		return ;
+	ft_twoway_init(&s->tw, (const unsigned char *)needle, m, 1);
+	strsearch__build_shift(s->shift, (const unsigned char *)needle, m);
+}
+
+/**
+ * The searcher holds no pointer into itself, so it may be copied by value;
+ * the shift table is attached to a local copy of the Two-Way state.
+ */
+char	*ft_strsearch_next(const t_strsearch *s, const char *hay, size_t len)
+{
+	t_twoway	tw;
+	size_t		j;
+
+	if (s->tw.m == 0)
+		return ((char *)hay);
+	if (s->tw.m > len)
+		return (NULL);
+	if (s->tw.m == 1)
+		return (ft_memchr(hay, *s->tw.needle, len));
+	tw = s->tw;
+	tw.shift = s->shift;
+	j = ft_twoway_find(&tw, (const unsigned char *)hay, len);
+	if (j == SIZE_MAX)
+		return (NULL);
+	return ((char *)hay + j);
+}
+
+/* --- ft_strspn.c --- */
+
+
+size_t	ft_strspn(const char *s, const char *accept)
+{
+	t_charset	set;
+
+	set = ft_charset_from(accept);
+	return (ft_charset_span(s, &set));
+}
+
+size_t	ft_strcspn(const char *s, const char *reject)
+{
+	t_charset	set;
+
+	set = ft_charset_from(reject);
+	return (ft_charset_cspan(s, &set));
+}
+
+char	*ft_strpbrk(const char *s, const char *accept)
+{
+	t_charset	set;
+
+	set = ft_charset_from(accept);
+	s += ft_charset_cspan(s, &set);
+	if (*s)
+		return ((char *)s);
+	return (NULL);
+}
+
+/* --- ft_strtrim.c --- */
+
+
+/**
+ * @brief Copy s without the leading and trailing bytes in set.
+ */
+static char	*strtrim__trim_copy(const char *s, const t_charset *set, const char *site)
+{
+	size_t	start;
+	size_t	end;
+	char	*trimmed;
+
+	start = ft_charset_span(s, set);
+	end = start + ft_strlen(s + start);
+	while (end > start && ft_charset_has(set, (unsigned char)s[end - 1]))
+		end--;
+	trimmed = (char *)malloc(end - start + 1);
+	if (!trimmed)
+		return (NULL);
+	ft_memstats_note(site, end - start + 1);
+	ft_memcpy(trimmed, s + start, end - start);
+	trimmed[end - start] = '\0';
+	return (trimmed);
+}
+
+/**
+ * set is turned into a bitmap once, so each byte of s1 costs one lookup
+ * however long set is.
+ */
+char	*ft_strtrim(char const *s1, char const *set)
+{
+	t_charset	bits;
+
+	if (!s1 || !set)
+		return (NULL);
+	bits = ft_charset_from(set);
+	return (strtrim__trim_copy(s1, &bits, "ft_strtrim"));
+}
+
+char	*ft_strtrim_set(const char *s, const t_charset *set)
+{
+	if (!s || !set)
+		return (NULL);
+	return (strtrim__trim_copy(s, set, "ft_strtrim_set"));
+}
+
+/* --- ft_substr.c --- */
+
+
+char	*ft_substr(char const *s, unsigned int start, size_t len)
+{
+	char	*substr;
+	size_t	slen;
+
+	if (!s)
+		return (NULL);
+	slen = ft_strlen(s);
+	if (start >= slen)
+		return (ft_strdup(""));
+	if (len > slen - start)
+		len = slen - start;
+	substr = (char *)malloc(len + 1);
+	if (!substr)
+		return (NULL);
+	ft_memstats_note("ft_substr", len + 1);
+	ft_memcpy(substr, s + start, len);
+	substr[len] = '\0';
+	return (substr);
+}
+
+/* --- ft_tolower.c --- */
+
+
+int	ft_tolower(int c)
+{
+	if (c > 64 && c < 91)
+		c += 32;
+	return (c);
+}
+
+/* --- ft_toupper.c --- */
+
+
+int	ft_toupper(int c)
+{
+	if (c > 96 && c < 123)
+		c -= 32;
+	return (c);
+}
+
+
+/* ========================================================================== */
+/*                                ft_sv                                       */
+/* ========================================================================== */
+
+/* --- ft_sv.c --- */
+
+
+t_strview	ft_sv_new(const char *ptr, size_t len)
+{
+	t_strview	sv;
+
+	sv.ptr = ptr;
+	sv.len = len;
+	return (sv);
+}
+
+/**
+ * @brief View of a C string, without its terminator (empty for NULL).
+ */
+t_strview	ft_sv_from(const char *s)
+{
+	if (!s)
+		return (ft_sv_new("", 0));
+	return (ft_sv_new(s, ft_strlen(s)));
+}
+
+/**
+ * @brief Up to len bytes from start, clamped to the view like ft_substr.
+ */
+t_strview	ft_sv_sub(t_strview sv, size_t start, size_t len)
+{
+	if (start > sv.len)
+		start = sv.len;
+	if (len > sv.len - start)
+		len = sv.len - start;
+	return (ft_sv_new(sv.ptr + start, len));
+}
+
+/* --- ft_sv_dup.c --- */
+
+
+char	*ft_sv_dup(t_strview sv)
+{
+	char	*dup;
+
+	dup = malloc(sv.len + 1);
+	if (!dup)
+		return (NULL);
+	ft_memstats_note("ft_sv_dup", sv.len + 1);
+	ft_memcpy(dup, sv.ptr, sv.len);
+	dup[sv.len] = '\0';
+	return (dup);
+}
+
+/* --- ft_sv_find.c --- */
+
+
+size_t	ft_sv_find(t_strview hay, t_strview needle)
+{
+	const char	*hit;
+
+	hit = ft_memmem(hay.ptr, hay.len, needle.ptr, needle.len);
+	if (!hit)
+		return (FT_SV_NPOS);
+	return ((size_t)(hit - hay.ptr));
+}
+
+int	ft_sv_eq(t_strview a, t_strview b)
+{
+	if (a.len != b.len)
+		return (0);
+	return (a.ptr == b.ptr || ft_memcmp(a.ptr, b.ptr, a.len) == 0);
+}
+
+/* --- ft_sv_split_next.c --- */
+
+
+/**
+ * The word end is found with ft_memchr, so long fields are scanned a
+ * vector at a time.
+ */
+int	ft_sv_split_next(t_strview *rest, char c, t_strview *tok)
+{
+	const char	*end;
+
+	while (rest->len && *rest->ptr == c)
+	{
+		rest->ptr++;
+		rest->len--;
+	}
+	if (!rest->len)
+		return (0);
+	end = ft_memchr(rest->ptr, c, rest->len);
+	if (!end)
+		end = rest->ptr + rest->len;
+	*tok = ft_sv_new(rest->ptr, (size_t)(end - rest->ptr));
+	rest->ptr = end;
+	rest->len -= tok->len;
+	return (1);
+}
+
+/* --- ft_sv_to_int.c --- */
+
+
+/**
+ * The value is built in a long and checked after every digit, so it can
+ * never pass INT_MAX + 1 (the magnitude of INT_MIN) unnoticed.
+ */
+int	ft_sv_to_int(t_strview sv, int *out)
+{
+	long	acc;
+	int		neg;
+	size_t	i;
+
+	neg = (sv.len && sv.ptr[0] == '-');
+	i = (sv.len && (sv.ptr[0] == '-' || sv.ptr[0] == '+'));
+	if (i == sv.len)
+		return (0);
+	acc = 0;
+	while (i < sv.len)
+	{
+		if (!ft_isdigit((unsigned char)sv.ptr[i]))
+			return (0);
+		acc = acc * 10 + (sv.ptr[i++] - '0');
+		if (acc > 2147483647L + neg)
+			return (0);
+	}
+	if (neg)
+		acc = -acc;
+	*out = (int)acc;
+	return (1);
+}
+
+/* --- ft_sv_trim.c --- */
+
+
+t_strview	ft_sv_trim(t_strview sv, const char *set)
+{
+	t_charset	bits;
+
+	if (!set)
+		return (sv);
+	bits = ft_charset_from(set);
+	while (sv.len && ft_charset_has(&bits, (unsigned char)*sv.ptr))
+	{
+		sv.ptr++;
+		sv.len--;
+	}
+	while (sv.len && ft_charset_has(&bits, (unsigned char)sv.ptr[sv.len - 1]))
+		sv.len--;
+	return (sv);
+}
+
+
+/* ========================================================================== */
+/*                           ft_charset                                       */
+/* ========================================================================== */
+
+/* --- ft_charset.c --- */
+
+
+t_charset	ft_charset_from(const char *chars)
+{
+	t_charset	set;
+
+	ft_bzero(&set, sizeof(set));
+	if (!chars)
+		return (set);
+	while (*chars)
+		ft_charset_add(&set, (unsigned char)*chars++);
+	return (set);
+}
+
+/**
+ * The list only tracks non-NUL bytes: every scan stops at the terminator
+ * anyway, and pcmpistri treats a NUL in the set operand as its end.
+ */
+void	ft_charset_add(t_charset *set, unsigned char c)
+{
+	uint64_t	bit;
+
+	bit = (uint64_t)1 << (c & 63);
+	if (set->bits[c >> 6] & bit)
+		return ;
+	set->bits[c >> 6] |= bit;
+	if (!c)
+		return ;
+	if (set->count < FT_CHARSET_SMALL)
+		set->list[set->count] = c;
+	set->count++;
+}
+
+int	ft_charset_has(const t_charset *set, unsigned char c)
+{
+	return ((int)((set->bits[c >> 6] >> (c & 63)) & 1));
+}
+
+/* --- ft_charset_span.c --- */
+
+
+/**
+ * @brief Walk s while membership in the set equals in (0 or 1).
+ */
+size_t	ft_charset_span_scalar(const char *s, const t_charset *set, int in)
+{
+	const unsigned char	*p;
+
+	p = (const unsigned char *)s;
+	while (*p && (int)((set->bits[*p >> 6] >> (*p & 63)) & 1) == in)
+		p++;
+	return ((size_t)(p - (const unsigned char *)s));
+}
+
+static size_t	charset_span__span(const char *s, const t_charset *set, int in)
+{
+	if (!g_simd.charset_span)
+		ft_simd_init();
+	return (g_simd.charset_span(s, set, in));
+}
+
+size_t	ft_charset_span(const char *s, const t_charset *set)
+{
+	return (charset_span__span(s, set, 1));
+}
+
+size_t	ft_charset_cspan(const char *s, const t_charset *set)
+{
+	return (charset_span__span(s, set, 0));
+}
+
+/* --- ft_charset_span_sse42.c --- */
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("sse4.2"))), apply_to = function)
+# elif defined(__GNUC__)
+#  pragma GCC push_options
+#  pragma GCC target("sse4.2")
+# endif
+#endif
+
+
+#if defined(__SSE2__)
+
+/*
+ * pcmpistri compares 16 string bytes against every byte of the set list
+ * at once. Both operands are implicit-length: the list ends at its first
+ * zero pad and the string chunk at its terminator. Chunks are aligned, so
+ * a load may start before s or run past the terminator but never crosses
+ * into another page.
+ */
+
+/**
+ * @brief First byte at or after the aligned p that is not in the list.
+ *
+ * With negative polarity the terminator counts as a hit, so the index is
+ * below 16 as soon as the chunk holds a NUL.
+ */
+static FT_NO_ASAN const char	*charset_span_sse42__skip_in(const char *p, __m128i list)
+{
+	int	i;
+
+	i = _mm_cmpistri(list, _mm_load_si128((const __m128i *)p),
+			FT_PCMP_NOT_ANY);
+	while (i == 16)
+	{
+		p += 16;
+		i = _mm_cmpistri(list, _mm_load_si128((const __m128i *)p),
+				FT_PCMP_NOT_ANY);
+	}
+	return (p + i);
+}
+
+/**
+ * @brief First byte at or after the aligned p that is in the list, or the
+ *        terminator.
+ */
+static FT_NO_ASAN const char	*charset_span_sse42__skip_out(const char *p, __m128i list)
+{
+	__m128i	x;
+
+	x = _mm_load_si128((const __m128i *)p);
+	while (_mm_cmpistri(list, x, FT_PCMP_ANY) == 16
+		&& !_mm_cmpistrz(list, x, FT_PCMP_ANY))
+	{
+		p += 16;
+		x = _mm_load_si128((const __m128i *)p);
+	}
+	if (_mm_cmpistri(list, x, FT_PCMP_ANY) < 16)
+		return (p + _mm_cmpistri(list, x, FT_PCMP_ANY));
+	while (*p)
+		p++;
+	return (p);
+}
+
+/**
+ * Large sets fall back to the bitmap loop; small ones run bytewise up to
+ * the first 16-byte boundary and then a chunk per pcmpistri.
+ */
+FT_NO_ASAN size_t	ft_charset_span_sse42(const char *s, const t_charset *set,
+		int in)
+{
+	const char	*p;
+	__m128i		list;
+
+	if (!set->count && !in)
+		return (ft_strlen(s));
+	if (!set->count || set->count > FT_CHARSET_SMALL)
+		return (ft_charset_span_scalar(s, set, in));
+	p = s;
+	while (((uintptr_t)p & 15) && *p
+		&& ft_charset_has(set, (unsigned char)*p) == in)
+		p++;
+	if (((uintptr_t)p & 15) || !*p)
+		return ((size_t)(p - s));
+	list = _mm_loadu_si128((const __m128i *)set->list);
+	if (in)
+		return ((size_t)(charset_span_sse42__skip_in(p, list) - s));
+	return ((size_t)(charset_span_sse42__skip_out(p, list) - s));
+}
+
+#endif
+
+#if defined(__SSE2__)
+# if defined(__clang__)
+#  pragma clang attribute pop
+# elif defined(__GNUC__)
+#  pragma GCC pop_options
+# endif
+#endif
+
+
+/* ========================================================================== */
+/*                            ft_strbuf                                       */
+/* ========================================================================== */
+
+/* --- ft_strbuf.c --- */
+
+
+void	ft_strbuf_init(t_strbuf *sb)
+{
+	sb->data = sb->small;
+	sb->len = 0;
+	sb->cap = FT_STRBUF_INLINE;
+	sb->small[0] = '\0';
+}
+
+/**
+ * @brief Move to a heap block of at least need bytes, twice the old
+ *        capacity when that is larger.
+ */
+static int	strbuf__strbuf_grow(t_strbuf *sb, size_t need)
+{
+	size_t	cap;
+	char	*data;
+
+	cap = need;
+	if (sb->cap <= SIZE_MAX / 2 && sb->cap * 2 > need)
+		cap = sb->cap * 2;
+	if (sb->data == sb->small)
+	{
+		data = ft_allocator_alloc(NULL, cap);
+		if (data)
+			ft_memcpy(data, sb->small, sb->len + 1);
+	}
+	else
+		data = ft_allocator_realloc(NULL, sb->data, sb->cap, cap);
+	if (!data)
+		return (0);
+	if (sb->data == sb->small)
+		ft_memstats_record("ft_strbuf_reserve", 0, cap);
+	else
+		ft_memstats_record("ft_strbuf_reserve", sb->cap, cap);
+	sb->data = data;
+	sb->cap = cap;
+	return (1);
+}
+
+int	ft_strbuf_reserve(t_strbuf *sb, size_t extra)
+{
+	if (extra > SIZE_MAX - sb->len - 1)
+		return (0);
+	if (sb->len + extra + 1 <= sb->cap)
+		return (1);
+	return (strbuf__strbuf_grow(sb, sb->len + extra + 1));
+}
+
+/**
+ * A heap buffer is handed over as is; inline contents are copied into a
+ * block of exactly len + 1 bytes.
+ */
+char	*ft_strbuf_detach(t_strbuf *sb)
+{
+	char	*s;
+
+	if (sb->data == sb->small)
+	{
+		s = malloc(sb->len + 1);
+		if (!s)
+			return (NULL);
+		ft_memstats_note("ft_strbuf_detach", sb->len + 1);
+		ft_memcpy(s, sb->small, sb->len + 1);
+	}
+	else
+	{
+		s = sb->data;
+		ft_memstats_record("ft_strbuf_detach", sb->cap, 0);
+	}
+	ft_strbuf_init(sb);
+	return (s);
+}
+
+void	ft_strbuf_free(t_strbuf *sb)
+{
+	if (!sb)
+		return ;
+	if (sb->data != sb->small)
+	{
+		free(sb->data);
+		ft_memstats_record("ft_strbuf_free", sb->cap, 0);
+	}
+	ft_strbuf_init(sb);
+}
+
+/* --- ft_strbuf_append.c --- */
+
+
+int	ft_strbuf_append_n(t_strbuf *sb, const char *s, size_t n)
+{
+	if (!ft_strbuf_reserve(sb, n))
+		return (0);
+	ft_memcpy(sb->data + sb->len, s, n);
+	sb->len += n;
+	sb->data[sb->len] = '\0';
+	return (1);
+}
+
+int	ft_strbuf_append(t_strbuf *sb, const char *s)
+{
+	if (!s)
+		return (1);
+	return (ft_strbuf_append_n(sb, s, ft_strlen(s)));
+}
+
+int	ft_strbuf_push_char(t_strbuf *sb, char c)
+{
+	if (sb->len + 2 > sb->cap && !ft_strbuf_reserve(sb, 1))
+		return (0);
+	sb->data[sb->len++] = c;
+	sb->data[sb->len] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Empty the buffer but keep its capacity for reuse.
+ */
+void	ft_strbuf_clear(t_strbuf *sb)
+{
+	sb->len = 0;
+	sb->data[0] = '\0';
+}
+
+/* --- ft_strbuf_appendf.c --- */
+
+
+static int	strbuf_appendf__put_spec(t_strbuf *sb, char spec, int prec, va_list *ap)
+{
+	if (spec == 'f' || spec == 'e' || spec == 'g')
+		return (ft_strbuf_put_double(sb, va_arg(*ap, double), spec, prec));
+	if (spec == 'c')
+		return (ft_strbuf_push_char(sb, (char)va_arg(*ap, int)));
+	if (spec == 's')
+		return (ft_strbuf_put_str(sb, va_arg(*ap, char *)));
+	if (spec == 'p')
+		return (ft_strbuf_put_ptr(sb, va_arg(*ap, void *)));
+	if (spec == 'd' || spec == 'i')
+		return (ft_strbuf_put_nbr(sb, va_arg(*ap, int)));
+	if (spec == 'u')
+		return (ft_strbuf_put_base(sb, va_arg(*ap, unsigned int),
+				"0123456789"));
+	if (spec == 'x')
+		return (ft_strbuf_put_base(sb, va_arg(*ap, unsigned int),
+				"0123456789abcdef"));
+	if (spec == 'X')
+		return (ft_strbuf_put_base(sb, va_arg(*ap, unsigned int),
+				"0123456789ABCDEF"));
+	if (spec == '%')
+		return (ft_strbuf_push_char(sb, '%'));
+	return (1);
+}
+
+/**
+ * @brief Copy each literal run up to the next '%' in one append, then
+ *        convert the argument. Unknown conversions and a lone trailing
+ *        '%' produce nothing, as in ft_printf.
+ */
+static int	strbuf_appendf__format_all(t_strbuf *sb, const char *fmt, va_list *ap)
+{
+	const char	*pct;
+	int			prec;
+
+	while (*fmt)
+	{
+		pct = ft_strchr(fmt, '%');
+		if (!pct)
+			return (ft_strbuf_append(sb, fmt));
+		if (!ft_strbuf_append_n(sb, fmt, (size_t)(pct - fmt)))
+			return (0);
+		fmt = pct + 1;
+		prec = ft_printf_parse_prec(&fmt);
+		if (!*fmt)
+			return (1);
+		if (!strbuf_appendf__put_spec(sb, *fmt++, prec, ap))
+			return (0);
+	}
+	return (1);
+}
+
+int	ft_strbuf_vappendf(t_strbuf *sb, const char *fmt, va_list ap)
+{
+	va_list	args;
+	size_t	start;
+	int		ok;
+
+	if (!fmt)
+		return (-1);
+	start = sb->len;
+	va_copy(args, ap);
+	ok = strbuf_appendf__format_all(sb, fmt, &args);
+	va_end(args);
+	if (!ok)
+	{
+		sb->len = start;
+		sb->data[start] = '\0';
+		return (-1);
+	}
+	return ((int)(sb->len - start));
+}
+
+int	ft_strbuf_appendf(t_strbuf *sb, const char *fmt, ...)
+{
+	va_list	ap;
+	int		n;
+
+	va_start(ap, fmt);
+	n = ft_strbuf_vappendf(sb, fmt, ap);
+	va_end(ap);
+	return (n);
+}
+
+/* --- ft_strbuf_fmt.c --- */
+
+
+/**
+ * @brief Append n in the base given by the length of digits.
+ *
+ * The digits are formatted straight into the reserved tail of the buffer.
+ */
+int	ft_strbuf_put_base(t_strbuf *sb, unsigned long n, const char *digits)
+{
+	if (!ft_strbuf_reserve(sb, FT_U64TOA_BASE_BUFSZ - 1))
+		return (0);
+	sb->len += ft_u64toa_base_buf(n, digits, sb->data + sb->len);
+	return (1);
+}
+
+int	ft_strbuf_put_nbr(t_strbuf *sb, int n)
+{
+	if (!ft_strbuf_reserve(sb, FT_ITOA_BUFSZ - 1))
+		return (0);
+	sb->len += ft_itoa_buf(n, sb->data + sb->len);
+	return (1);
+}
+
+int	ft_strbuf_put_str(t_strbuf *sb, const char *s)
+{
+	if (!s)
+		s = "(null)";
+	return (ft_strbuf_append(sb, s));
+}
+
+int	ft_strbuf_put_ptr(t_strbuf *sb, void *ptr)
+{
+	if (!ptr)
+		return (ft_strbuf_append_n(sb, "(nil)", 5));
+	if (!ft_strbuf_append_n(sb, "0x", 2))
+		return (0);
+	return (ft_strbuf_put_base(sb, (unsigned long)ptr, "0123456789abcdef"));
+}
+
+/**
+ * @brief Append x as %f, %e or %g, formatted in place like put_base.
+ */
+int	ft_strbuf_put_double(t_strbuf *sb, double x, char spec, int prec)
+{
+	if (!ft_strbuf_reserve(sb, FT_DTOA_BUFSZ - 1 + (prec > 0) * (size_t)prec))
+		return (0);
+	if (spec == 'e')
+		sb->len += ft_dtoa_exp(x, prec, sb->data + sb->len);
+	else if (spec == 'g')
+		sb->len += ft_dtoa_general(x, prec, sb->data + sb->len);
+	else
+		sb->len += ft_dtoa_fixed(x, prec, sb->data + sb->len);
+	return (1);
+}
+
+
+/* ========================================================================== */
+/*                           ft_acmatch                                       */
+/* ========================================================================== */
+
+/* --- ft_acmatch_add.c --- */
+
+
+static uint32_t	acmatch_add__trie_child(const t_acmatch *ac, uint32_t s, unsigned char c)
+{
+	const t_acedge	*edges;
+	uint32_t		e;
+
+	edges = ac->edges->data;
+	e = ft_acmatch_node(ac, s)->edge;
+	while (e && edges[e].byte != c)
+		e = edges[e].next;
+	if (!e)
+		return (0);
+	return (edges[e].child);
+}
+
+/**
+ * @brief Append a child of s on byte c and link it into s's edge list.
+ * @return The new node, or 0 on allocation failure.
+ */
+static uint32_t	acmatch_add__trie_grow(t_acmatch *ac, uint32_t s, unsigned char c)
+{
+	t_acnode	node;
+	t_acedge	edge;
+
+	if (ac->nodes->len >= UINT32_MAX || ac->edges->len >= UINT32_MAX)
+		return (0);
+	ft_bzero(&node, sizeof(node));
+	node.depth = ft_acmatch_node(ac, s)->depth + 1;
+	edge.child = (uint32_t)ac->nodes->len;
+	edge.next = ft_acmatch_node(ac, s)->edge;
+	edge.byte = c;
+	if (!ft_vec_push(ac->nodes, &node))
+		return (0);
+	if (!ft_vec_push(ac->edges, &edge))
+	{
+		ac->nodes->len--;
+		return (0);
+	}
+	ft_acmatch_node(ac, s)->edge = (uint32_t)ac->edges->len - 1;
+	return (edge.child);
+}
+
+int	ft_acmatch_add(t_acmatch *ac, const char *pat, size_t len)
+{
+	uint32_t	s;
+	uint32_t	t;
+	size_t		i;
+
+	if (!ac || ac->built || !pat || !len || ac->npatterns >= UINT32_MAX - 1)
+		return (0);
+	s = 0;
+	i = 0;
+	while (i < len)
+	{
+		t = acmatch_add__trie_child(ac, s, (unsigned char)pat[i]);
+		if (!t)
+			t = acmatch_add__trie_grow(ac, s, (unsigned char)pat[i]);
+		if (!t)
+			return (0);
+		s = t;
+		i++;
+	}
+	if (!ft_acmatch_node(ac, s)->out)
+		ft_acmatch_node(ac, s)->out = (uint32_t)ac->npatterns + 1;
+	ac->npatterns++;
+	return (1);
+}
+
+/* --- ft_acmatch_build.c --- */
+
+
+/**
+ * @brief Failure and dictionary links of child v of u on byte c.
+ *
+ * u is already laid out, and so is every node on its fail chain (they
+ * are shallower), so the fail link is one automaton step from fail(u).
+ */
+static void	acmatch_build__link_child(t_acmatch *ac, uint32_t u, uint32_t v, unsigned char c)
+{
+	t_acnode	*child;
+	t_acnode	*fail;
+
+	child = ft_acmatch_node(ac, v);
+	if (u == 0)
+	{
+		ac->root[c] = v;
+		child->fail = 0;
+	}
+	else
+		child->fail = ft_acmatch_step(ac, ft_acmatch_node(ac, u)->fail, c);
+	fail = ft_acmatch_node(ac, child->fail);
+	child->dict = fail->dict;
+	if (fail->out)
+		child->dict = child->fail;
+}
+
+/**
+ * @brief Lay out the next queued node: copy its edge list into one
+ *        contiguous run, link and enqueue its children.
+ *
+ * The new edge vector is created with room for every edge, so the pushes
+ * never reallocate and cannot fail halfway through the layout.
+ */
+static void	acmatch_build__expand(t_acbuild *b)
+{
+	t_acedge	edge;
+	t_acnode	*node;
+	uint32_t	u;
+	uint32_t	e;
+
+	u = b->queue[b->head++];
+	node = ft_acmatch_node(b->ac, u);
+	e = node->edge;
+	node->edge = (uint32_t)b->ac->edges->len;
+	node->nedges = 0;
+	while (e)
+	{
+		edge = ((t_acedge *)b->list->data)[e];
+		ft_vec_push(b->ac->edges, &edge);
+		node->nedges++;
+		acmatch_build__link_child(b->ac, u, edge.child, edge.byte);
+		b->queue[b->tail++] = edge.child;
+		e = edge.next;
+	}
+}
+
+static int	acmatch_build__build_abort(t_acbuild *b)
+{
+	free(b->queue);
+	ft_vec_free(b->ac->edges);
+	b->ac->edges = b->list;
+	return (0);
+}
+
+/**
+ * Breadth-first over the trie: the edge lists are rebuilt into a fresh
+ * vector so the edges of each node end up contiguous, and nodes are laid
+ * out before anything deeper asks for their transitions.
+ */
+int	ft_acmatch_build(t_acmatch *ac)
+{
+	t_acbuild	b;
+	size_t		size;
+
+	if (!ac || ac->built)
+		return (ac != NULL);
+	size = ac->nodes->len * sizeof(uint32_t);
+	b.ac = ac;
+	b.list = ac->edges;
+	b.queue = malloc(size);
+	ac->edges = ft_vec_new(sizeof(t_acedge), b.list->len);
+	if (!b.queue || !ac->edges)
+		return (acmatch_build__build_abort(&b));
+	b.head = 0;
+	b.tail = 1;
+	b.queue[0] = 0;
+	while (b.head < b.tail)
+		acmatch_build__expand(&b);
+	ft_vec_free(b.list);
+	free(b.queue);
+	ac->built = 1;
+	return (1);
+}
+
+/* --- ft_acmatch_match.c --- */
+
+
+static uint32_t	acmatch_match__child_of(const t_acmatch *ac, uint32_t s, unsigned char c)
+{
+	const t_acnode	*node;
+	const t_acedge	*edge;
+	uint32_t		i;
+
+	node = ft_acmatch_node(ac, s);
+	edge = (const t_acedge *)ac->edges->data + node->edge;
+	i = 0;
+	while (i < node->nedges)
+	{
+		if (edge[i].byte == c)
+			return (edge[i].child);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * Follows failure links until a node has an edge on c; the root's dense
+ * table ends every chain in one lookup.
+ */
+uint32_t	ft_acmatch_step(const t_acmatch *ac, uint32_t s, unsigned char c)
+{
+	uint32_t	t;
+
+	while (s)
+	{
+		t = acmatch_match__child_of(ac, s, c);
+		if (t)
+			return (t);
+		s = ft_acmatch_node(ac, s)->fail;
+	}
+	return (ac->root[c]);
+}
+
+/**
+ * @brief Push the matches ending at state s (text offset end) onto out.
+ */
+static int	acmatch_match__report(const t_acmatch *ac, uint32_t s, size_t end, t_vec *out)
+{
+	const t_acnode	*node;
+	t_achit			hit;
+
+	if (!ft_acmatch_node(ac, s)->out)
+		s = ft_acmatch_node(ac, s)->dict;
+	while (s)
+	{
+		node = ft_acmatch_node(ac, s);
+		hit.id = node->out - 1;
+		hit.offset = end - node->depth;
+		if (!ft_vec_push(out, &hit))
+			return (0);
+		s = node->dict;
+	}
+	return (1);
+}
+
+int	ft_acmatch_all(const t_acmatch *ac, const char *text, size_t len,
+		t_vec *out)
+{
+	uint32_t	s;
+	size_t		i;
+
+	if (!ac || !ac->built || !out || (!text && len))
+		return (0);
+	s = 0;
+	i = 0;
+	while (i < len)
+	{
+		s = ft_acmatch_step(ac, s, (unsigned char)text[i++]);
+		if (!acmatch_match__report(ac, s, i, out))
+			return (0);
+	}
+	return (1);
+}
+
+int	ft_acmatch_first(const t_acmatch *ac, const char *text, size_t len,
+		t_achit *hit)
+{
+	const t_acnode	*node;
+	uint32_t		s;
+	size_t			i;
+
+	if (!ac || !ac->built || (!text && len))
+		return (0);
+	s = 0;
+	i = 0;
+	while (i < len)
+	{
+		s = ft_acmatch_step(ac, s, (unsigned char)text[i++]);
+		node = ft_acmatch_node(ac, s);
+		if (!node->out && node->dict)
+			node = ft_acmatch_node(ac, node->dict);
+		if (node->out)
+		{
+			hit->id = node->out - 1;
+			hit->offset = i - node->depth;
+			return (1);
+		}
+	}
+	return (0);
+}
+
+/* --- ft_acmatch_new.c --- */
+
+
+/**
+ * Node 0 is the root and edge 0 a sentinel, so index 0 can mean "none"
+ * in edge lists and transitions.
+ */
+t_acmatch	*ft_acmatch_new(void)
+{
+	t_acmatch	*ac;
+	t_acnode	root;
+	t_acedge	sentinel;
+
+	ac = ft_allocator_calloc(NULL, 1, sizeof(t_acmatch));
+	if (!ac)
+		return (NULL);
+	ac->nodes = ft_vec_new(sizeof(t_acnode), 64);
+	ac->edges = ft_vec_new(sizeof(t_acedge), 64);
+	ft_bzero(&root, sizeof(root));
+	ft_bzero(&sentinel, sizeof(sentinel));
+	if (!ac->nodes || !ac->edges || !ft_vec_push(ac->nodes, &root)
+		|| !ft_vec_push(ac->edges, &sentinel))
+	{
+		ft_vec_free(ac->nodes);
+		ft_vec_free(ac->edges);
+		free(ac);
+		return (NULL);
+	}
+	ft_memstats_record("ft_acmatch_new", 0, sizeof(t_acmatch));
+	return (ac);
+}
+
+void	ft_acmatch_free(t_acmatch *ac)
+{
+	if (!ac)
+		return ;
+	ft_memstats_record("ft_acmatch_free", sizeof(t_acmatch), 0);
+	ft_vec_free(ac->nodes);
+	ft_vec_free(ac->edges);
+	free(ac);
+}
+
+t_acnode	*ft_acmatch_node(const t_acmatch *ac, uint32_t s)
+{
+	return ((t_acnode *)ac->nodes->data + s);
+}
+
+
+/* ========================================================================== */
+/*                              ft_conv                                       */
+/* ========================================================================== */
+
+/* --- ft_bignum.c --- */
+
+
+void	ft_big_set(t_bignum *b, uint64_t v)
+{
+	b->len = 0;
+	while (v)
+	{
+		b->limb[b->len++] = (uint32_t)v;
+		v >>= 32;
+	}
+}
+
+void	ft_big_shl(t_bignum *b, unsigned int bits)
+{
+	size_t		words;
+	size_t		i;
+	uint64_t	carry;
+
+	if (!b->len)
+		return ;
+	words = bits / 32;
+	bits %= 32;
+	ft_memmove(b->limb + words, b->limb, b->len * sizeof(uint32_t));
+	ft_bzero(b->limb, words * sizeof(uint32_t));
+	b->len += words;
+	carry = 0;
+	i = words;
+	while (bits && i < b->len)
+	{
+		carry |= (uint64_t)b->limb[i] << bits;
+		b->limb[i++] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	if (carry)
+		b->limb[b->len++] = (uint32_t)carry;
+}
+
+void	ft_big_mul_small(t_bignum *b, uint32_t m)
+{
+	size_t		i;
+	uint64_t	carry;
+
+	carry = 0;
+	i = 0;
+	while (i < b->len)
+	{
+		carry += (uint64_t)b->limb[i] * m;
+		b->limb[i++] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	if (carry)
+		b->limb[b->len++] = (uint32_t)carry;
+}
+
+/**
+ * Nine decimal places per limb multiply, then the remainder.
+ */
+void	ft_big_mul_pow10(t_bignum *b, unsigned int n)
+{
+	uint32_t	rest;
+
+	while (n >= 9)
+	{
+		ft_big_mul_small(b, 1000000000);
+		n -= 9;
+	}
+	rest = 1;
+	while (n--)
+		rest *= 10;
+	if (rest > 1)
+		ft_big_mul_small(b, rest);
+}
+
+int	ft_big_cmp(const t_bignum *a, const t_bignum *b)
+{
+	size_t	i;
+
+	if (a->len != b->len)
+		return ((a->len > b->len) - (a->len < b->len));
+	i = a->len;
+	while (i--)
+	{
+		if (a->limb[i] != b->limb[i])
+			return ((a->limb[i] > b->limb[i]) - (a->limb[i] < b->limb[i]));
+	}
+	return (0);
+}
+
+/* --- ft_bignum_dec.c --- */
+
+
+/**
+ * Schoolbook division from the top limb, carrying the remainder down.
+ */
+uint32_t	ft_big_div_small(t_bignum *b, uint32_t d)
+{
+	uint64_t	rem;
+	size_t		i;
+
+	rem = 0;
+	i = b->len;
+	while (i--)
+	{
+		rem = (rem << 32) | b->limb[i];
+		b->limb[i] = (uint32_t)(rem / d);
+		rem %= d;
+	}
+	while (b->len && !b->limb[b->len - 1])
+		b->len--;
+	return ((uint32_t)rem);
+}
+
+/**
+ * Nine digits per division by 10^9; the chunks come out lowest first and
+ * are written back in order, all but the leading one zero-padded.
+ */
+size_t	ft_big_to_dec(t_bignum *b, char *out)
+{
+	uint32_t	chunk[FT_BIGNUM_DEC_CHUNKS];
+	size_t		count;
+	size_t		n;
+	char		tmp[FT_ITOA_BUFSZ];
+	size_t		len;
+
+	count = 0;
+	while (b->len)
+		chunk[count++] = ft_big_div_small(b, 1000000000);
+	if (!count)
+		chunk[count++] = 0;
+	n = ft_utoa_buf(chunk[--count], out);
+	while (count--)
+	{
+		len = ft_utoa_buf(chunk[count], tmp);
+		ft_memset(out + n, '0', 9 - len);
+		ft_memcpy(out + n + 9 - len, tmp, len);
+		n += 9;
+	}
+	out[n] = '\0';
+	return (n);
+}
+
+void	ft_big_mul_add(t_bignum *b, uint32_t m, uint32_t add)
+{
+	size_t		i;
+	uint64_t	carry;
+
+	carry = add;
+	i = 0;
+	while (i < b->len)
+	{
+		carry += (uint64_t)b->limb[i] * m;
+		b->limb[i++] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	if (carry)
+		b->limb[b->len++] = (uint32_t)carry;
+}
+
+uint64_t	ft_big_low64(const t_bignum *b)
+{
+	uint64_t	v;
+
+	v = 0;
+	if (b->len > 1)
+		v = (uint64_t)b->limb[1] << 32;
+	if (b->len)
+		v |= b->limb[0];
+	return (v);
+}
+
+/**
+ * Binary long division with the denominator parked 63 bits up: each round
+ * compares, subtracts and doubles the remainder instead of shifting the
+ * denominator back down.
+ */
+int	ft_big_div_u64(t_bignum *num, const t_bignum *den, uint64_t *out)
+{
+	t_bignum	top;
+	int			bit;
+
+	top = *den;
+	ft_big_shl(&top, 63);
+	*out = 0;
+	bit = 63;
+	while (bit >= 0)
+	{
+		if (ft_big_cmp(num, &top) >= 0)
+		{
+			ft_big_sub(num, &top);
+			*out |= 1ULL << bit;
+		}
+		ft_big_shl(num, 1);
+		bit--;
+	}
+	return (num->len != 0);
+}
+
+/* --- ft_bignum_sub.c --- */
+
+
+/**
+ * a must be at least b.
+ */
+void	ft_big_sub(t_bignum *a, const t_bignum *b)
+{
+	size_t		i;
+	int64_t		borrow;
+
+	borrow = 0;
+	i = 0;
+	while (i < a->len)
+	{
+		borrow += (int64_t)a->limb[i];
+		if (i < b->len)
+			borrow -= b->limb[i];
+		a->limb[i++] = (uint32_t)borrow;
+		borrow >>= 32;
+	}
+	while (a->len && !a->limb[a->len - 1])
+		a->len--;
+}
+
+size_t	ft_big_bitlen(const t_bignum *b)
+{
+	if (!b->len)
+		return (0);
+	return (b->len * 32 - __builtin_clz(b->limb[b->len - 1]));
+}
+
+/**
+ * Repeated subtraction: the callers keep the quotient below 10.
+ */
+uint32_t	ft_big_div_digit(t_bignum *num, const t_bignum *den)
+{
+	uint32_t	d;
+
+	d = 0;
+	while (ft_big_cmp(num, den) >= 0)
+	{
+		ft_big_sub(num, den);
+		d++;
+	}
+	return (d);
+}
+
+static void	bignum_sub__shr_limbs(t_bignum *b, size_t bits)
+{
+	size_t	words;
+	size_t	i;
+
+	words = bits / 32;
+	bits %= 32;
+	i = 0;
+	while (i + words < b->len)
+	{
+		b->limb[i] = b->limb[i + words] >> bits;
+		if (bits && i + words + 1 < b->len)
+			b->limb[i] |= b->limb[i + words + 1] << (32 - bits);
+		i++;
+	}
+	b->len -= words;
+	while (b->len && !b->limb[b->len - 1])
+		b->len--;
+}
+
+/**
+ * Returns where the dropped bits fell: 0 nothing dropped, 1 below half,
+ * 2 exactly half, 3 above half.
+ */
+int	ft_big_shr_round(t_bignum *b, size_t bits)
+{
+	size_t	i;
+	int		half;
+	int		rest;
+
+	if (!bits)
+		return (0);
+	if (bits > b->len * 32)
+	{
+		rest = (b->len != 0);
+		b->len = 0;
+		return (rest);
+	}
+	i = (bits - 1) / 32;
+	half = (b->limb[i] >> ((bits - 1) % 32)) & 1;
+	rest = (b->limb[i] & ((1U << ((bits - 1) % 32)) - 1)) != 0;
+	while (!rest && i)
+		rest = (b->limb[--i] != 0);
+	bignum_sub__shr_limbs(b, bits);
+	return (half * 2 + rest);
+}
+
+/* --- ft_conv_digits.c --- */
+
+
+static int	conv_digits__next_digit(const char *p, const char *lim, int base)
+{
+	int	d;
+
+	if (lim && p >= lim)
+		return (-1);
+	d = ft_conv_digit(*p);
+	if (d >= base)
+		return (-1);
+	return (d);
+}
+
+/**
+ * A byte is a digit iff its high nibble is 3 and stays 3 after adding 6.
+ * Three multiply-shifts then fold the digits pairwise into 2-, 4- and
+ * finally one 8-digit value.
+ *
+ * Bounded input needs 8 bytes left. A C string may end anywhere in the
+ * word, so the load must merely stay inside p's page; ASan would flag
+ * the bytes past the terminator, hence FT_NO_ASAN.
+ */
+FT_NO_ASAN int	ft_conv_load8(const char *p, const char *lim, uint64_t *v)
+{
+	uint64_t	w;
+
+	if (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+		return (0);
+	if ((lim && lim - p < 8) || (!lim && ((uintptr_t)p & 4095) > 4096 - 8))
+		return (0);
+	__builtin_memcpy(&w, p, 8);
+	if (((w & 0xF0F0F0F0F0F0F0F0ULL)
+			| (((w + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+		!= 0x3333333333333333ULL)
+		return (0);
+	w = ((w & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+	w = ((w & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+	*v = ((w & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+	return (1);
+}
+
+static void	conv_digits__add_digit(t_numscan *ns, int d, int base)
+{
+	if (ns->mag > (UINT64_MAX - d) / (unsigned int)base)
+	{
+		ns->mag = UINT64_MAX;
+		ns->err = FT_CONV_RANGE;
+	}
+	else
+		ns->mag = ns->mag * base + d;
+}
+
+/**
+ * Decimal runs take 8 digits per step while the accumulator cannot
+ * overflow; the rest, other bases and the last few digits of huge values
+ * go one digit at a time with an exact overflow check.
+ */
+const char	*ft_conv_digits(const char *p, const char *lim, int base,
+		t_numscan *ns)
+{
+	uint64_t	eight;
+	int			d;
+
+	d = conv_digits__next_digit(p, lim, base);
+	while (d >= 0)
+	{
+		if (base == 10 && ns->mag < FT_CONV_SWAR_MAX
+			&& ft_conv_load8(p, lim, &eight))
+		{
+			ns->mag = ns->mag * 100000000 + eight;
+			p += 8;
+		}
+		else
+		{
+			conv_digits__add_digit(ns, d, base);
+			p++;
+		}
+		d = conv_digits__next_digit(p, lim, base);
+	}
+	return (p);
+}
+
+/* --- ft_conv_scan.c --- */
+
+
+int	ft_conv_digit(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + 10);
+	return (36);
+}
+
+const char	*ft_conv_skip_space(const char *p, const char *lim)
+{
+	while ((!lim || p < lim) && (*p == ' ' || (*p >= '\t' && *p <= '\r')))
+		p++;
+	return (p);
+}
+
+/**
+ * @brief Resolve base 0 and consume a "0x" prefix for bases 0 and 16.
+ *
+ * The prefix is only taken when a hex digit follows, so "0x" alone
+ * parses as 0 with end at the 'x'.
+ */
+static int	conv_scan__read_base(const char **p, const char *lim, int base)
+{
+	const char	*s;
+
+	s = *p;
+	if ((base == 0 || base == 16) && (!lim || lim - s >= 3) && s[0] == '0'
+		&& (s[1] == 'x' || s[1] == 'X') && ft_conv_digit(s[2]) < 16)
+	{
+		*p = s + 2;
+		return (16);
+	}
+	if (base != 0)
+		return (base);
+	if ((!lim || s < lim) && s[0] == '0')
+		return (8);
+	return (10);
+}
+
+void	ft_conv_scan(const char *s, const char *lim, int base, t_numscan *ns)
+{
+	const char	*p;
+	const char	*end;
+
+	ft_bzero(ns, sizeof(*ns));
+	ns->end = s;
+	ns->err = FT_CONV_EMPTY;
+	if (base < 0 || base == 1 || base > 36)
+		return ;
+	p = ft_conv_skip_space(s, lim);
+	if ((!lim || p < lim) && (*p == '-' || *p == '+'))
+		ns->neg = (*p++ == '-');
+	base = conv_scan__read_base(&p, lim, base);
+	ns->err = FT_CONV_OK;
+	end = ft_conv_digits(p, lim, base, ns);
+	if (end == p)
+	{
+		ns->err = FT_CONV_EMPTY;
+		ns->neg = 0;
+		return ;
+	}
+	ns->end = end;
+}
+
+int64_t	ft_conv_signed(t_numscan *ns, uint64_t max)
+{
+	if (!ns->neg && ns->mag > max)
+	{
+		ns->err = FT_CONV_RANGE;
+		return ((int64_t)max);
+	}
+	if (ns->neg && ns->mag > max + 1)
+	{
+		ns->err = FT_CONV_RANGE;
+		return (-(int64_t)max - 1);
+	}
+	if (ns->neg)
+		return ((int64_t)(0 - ns->mag));
+	return ((int64_t)ns->mag);
+}
+
+/* --- ft_dtoa.c --- */
+
+
+size_t	ft_dtoa_shortest(double x, char *buf)
+{
+	t_dfp	fp;
+	int		cls;
+	int		e;
+	size_t	n;
+
+	cls = ft_dtoa_decode(x, &fp);
+	if (cls != FT_DTOA_FINITE)
+		return (ft_dtoa_special(cls, fp.neg, buf));
+	buf[0] = '-';
+	if (!fp.c)
+	{
+		ft_memcpy(buf + fp.neg, "0", 2);
+		return (fp.neg + 1);
+	}
+	n = ft_dtoa_shortest_digits(&fp, buf + fp.neg, &e);
+	return (fp.neg + ft_dtoa_put_general(buf + fp.neg, n, e,
+			FT_DTOA_SHORTEST_EXP));
+}
+
+size_t	ft_dtoa_fixed(double x, int prec, char *buf)
+{
+	t_dfp	fp;
+	int		cls;
+	char	*d;
+	size_t	n;
+
+	cls = ft_dtoa_decode(x, &fp);
+	if (cls != FT_DTOA_FINITE)
+		return (ft_dtoa_special(cls, fp.neg, buf));
+	if (prec < 0)
+		prec = 6;
+	buf[0] = '-';
+	d = buf + fp.neg;
+	n = ft_dtoa_round(&fp, prec, d);
+	return (fp.neg + ft_dtoa_put_fixed(d, n, prec));
+}
+
+size_t	ft_dtoa_exp(double x, int prec, char *buf)
+{
+	t_dfp	fp;
+	int		cls;
+	int		e;
+
+	cls = ft_dtoa_decode(x, &fp);
+	if (cls != FT_DTOA_FINITE)
+		return (ft_dtoa_special(cls, fp.neg, buf));
+	if (prec < 0)
+		prec = 6;
+	buf[0] = '-';
+	e = 0;
+	if (fp.c)
+		e = ft_dtoa_exp_digits(&fp, prec, buf + fp.neg);
+	else
+		ft_memset(buf + fp.neg, '0', (size_t)prec + 1);
+	return (fp.neg + ft_dtoa_put_exp(buf + fp.neg, (size_t)prec + 1, e));
+}
+
+/**
+ * C's %g rule: with P significant digits and X the exponent %e would
+ * print, positional when -4 <= X < P, trailing zeros removed either way.
+ */
+size_t	ft_dtoa_general(double x, int prec, char *buf)
+{
+	t_dfp	fp;
+	int		cls;
+	int		e;
+
+	cls = ft_dtoa_decode(x, &fp);
+	if (cls != FT_DTOA_FINITE)
+		return (ft_dtoa_special(cls, fp.neg, buf));
+	if (prec < 0)
+		prec = 6;
+	if (prec == 0)
+		prec = 1;
+	buf[0] = '-';
+	e = 0;
+	if (fp.c)
+		e = ft_dtoa_exp_digits(&fp, prec - 1, buf + fp.neg);
+	else
+		ft_memset(buf + fp.neg, '0', (size_t)prec);
+	return (fp.neg + ft_dtoa_put_general(buf + fp.neg, (size_t)prec, e,
+			prec));
+}
+
+/* --- ft_dtoa_layout.c --- */
+
+
+/**
+ * The first estimate of the exponent may be one low, which shows as an
+ * extra digit; a carry out of the rounding (9.99 -> 10.0) adds one more
+ * and only ever leaves a trailing zero behind.
+ */
+int	ft_dtoa_exp_digits(const t_dfp *fp, int prec, char *out)
+{
+	int		e;
+	size_t	n;
+
+	e = ft_flog10pow2(fp->q + 63 - __builtin_clzll(fp->c));
+	n = ft_dtoa_round(fp, prec - e, out);
+	if (n > (size_t)prec + 1)
+	{
+		e++;
+		n = ft_dtoa_round(fp, prec - e, out);
+	}
+	if (n > (size_t)prec + 1)
+		e++;
+	out[prec + 1] = '\0';
+	return (e);
+}
+
+/**
+ * The integer is padded to at least prec + 1 digits so there is a digit
+ * before the point, which then goes in prec digits from the end.
+ */
+size_t	ft_dtoa_put_fixed(char *d, size_t n, int prec)
+{
+	if (n < (size_t)prec + 1)
+	{
+		ft_memmove(d + prec + 1 - n, d, n);
+		ft_memset(d, '0', prec + 1 - n);
+		n = (size_t)prec + 1;
+	}
+	if (prec)
+	{
+		ft_memmove(d + n - prec + 1, d + n - prec, prec);
+		d[n - prec] = '.';
+		n++;
+	}
+	d[n] = '\0';
+	return (n);
+}
+
+size_t	ft_dtoa_put_exp(char *d, size_t n, int e)
+{
+	size_t	len;
+
+	len = 1;
+	if (n > 1)
+	{
+		ft_memmove(d + 2, d + 1, n - 1);
+		d[1] = '.';
+		len = n + 1;
+	}
+	d[len++] = 'e';
+	d[len++] = '+';
+	if (e < 0)
+		d[len - 1] = '-';
+	if (e < 0)
+		e = -e;
+	if (e < 10)
+		d[len++] = '0';
+	return (len + ft_utoa_buf((unsigned int)e, d + len));
+}
+
+/**
+ * @brief Positional layout of n significant digits whose first digit has
+ *        exponent e.
+ */
+static size_t	dtoa_layout__put_plain(char *d, size_t n, int e)
+{
+	size_t	z;
+
+	if (e < 0)
+	{
+		z = (size_t)(-e - 1);
+		ft_memmove(d + 2 + z, d, n);
+		ft_memcpy(d, "0.", 2);
+		ft_memset(d + 2, '0', z);
+		n += 2 + z;
+	}
+	else if (n <= (size_t)e + 1)
+	{
+		ft_memset(d + n, '0', (size_t)e + 1 - n);
+		n = (size_t)e + 1;
+	}
+	else
+	{
+		ft_memmove(d + e + 2, d + e + 1, n - e - 1);
+		d[e + 1] = '.';
+		n++;
+	}
+	d[n] = '\0';
+	return (n);
+}
+
+size_t	ft_dtoa_put_general(char *d, size_t n, int e, int limit)
+{
+	while (n > 1 && d[n - 1] == '0')
+		n--;
+	if (e < -4 || e >= limit)
+		return (ft_dtoa_put_exp(d, n, e));
+	return (dtoa_layout__put_plain(d, n, e));
+}
+
+/* --- ft_dtoa_pow10.c --- */
+
+
+/*
+ * Row j - FT_DTOA_POW10_MIN holds {hi, lo} of floor(10^j / 2^(e - 127)) + 1
+ * with e = floor(log2(10^j)): the 128 leading bits of 10^j, rounded up.
+ */
+static const uint64_t	dtoa_pow10__g_dtoa_pow10_128[FT_DTOA_POW10_MAX
+	- FT_DTOA_POW10_MIN + 1][2] = {
+	{0xA05C0DD70F6E1619ULL, 0xA8726BC8D55CBB17ULL},
+	{0xC873114CD3499BA0ULL, 0x128F06BB0AB3E9DDULL},
+	{0xFA8FD5A0081C0288ULL, 0x1732C869CD60E454ULL},
+	{0x9C99E58405118195ULL, 0x0E7FBD42205C8EB5ULL},
+	{0xC3C05EE50655E1FAULL, 0x521FAC92A873B262ULL},
+	{0xF4B0769E47EB5A78ULL, 0xE6A797B752909EFAULL},
+	{0x98EE4A22ECF3188BULL, 0x9028BED2939A635DULL},
+	{0xBF29DCABA82FDEAEULL, 0x7432EE873880FC34ULL},
+	{0xEEF453D6923BD65AULL, 0x113FAA2906A13B40ULL},
+	{0x9558B4661B6565F8ULL, 0x4AC7CA59A424C508ULL},
+	{0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF64AULL},
+	{0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DDULL},
+	{0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE86AULL},
+	{0xB64EC836A47146F9ULL, 0x9748E2826CDEE285ULL},
+	{0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B26ULL},
+	{0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F8ULL},
+	{0xB208EF855C969F4FULL, 0xBDBD2D335E51A936ULL},
+	{0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61383ULL},
+	{0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC32ULL},
+	{0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3EULL},
+	{0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0EULL},
+	{0x87D4713D6F33AA6BULL, 0x8672648C40E5AD69ULL},
+	{0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C3ULL},
+	{0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF3ULL},
+	{0x84A57695FE98746DULL, 0x014BB630F7604B58ULL},
+	{0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2EULL},
+	{0xCF42894A5DCE35EAULL, 0x52064CAC828675BAULL},
+	{0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940994ULL},
+	{0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF9ULL},
+	{0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF7ULL},
+	{0xFD00B897478238D0ULL, 0x8920B098955522B5ULL},
+	{0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B1ULL},
+	{0xC5A890362FDDBC62ULL, 0xEB2189F734AA831EULL},
+	{0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E5ULL},
+	{0x9A6BB0AA55653B2DULL, 0x47B233C92125366FULL},
+	{0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840BULL},
+	{0xF148440A256E2C76ULL, 0xC00670EA43CA250EULL},
+	{0x96CD2A865764DBCAULL, 0x380406926A5E5729ULL},
+	{0xBC807527ED3E12BCULL, 0xC605083704F5ECF3ULL},
+	{0xEBA09271E88D976BULL, 0xF7864A44C633682FULL},
+	{0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211EULL},
+	{0xB8157268FDAE9E4CULL, 0x5960EA05BAD82965ULL},
+	{0xE61ACF033D1A45DFULL, 0x6FB92487298E33BEULL},
+	{0x8FD0C16206306BABULL, 0xA5D3B6D479F8E057ULL},
+	{0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186DULL},
+	{0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE88ULL},
+	{0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B15ULL},
+	{0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DDAULL},
+	{0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6151ULL},
+	{0x892731AC9FAF056EULL, 0xBE311C083A225CD3ULL},
+	{0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF407ULL},
+	{0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B109ULL},
+	{0x85F0468293F0EB4EULL, 0x25BBF56008C58EA6ULL},
+	{0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24FULL},
+	{0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE2ULL},
+	{0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4EULL},
+	{0xA37FCE126597973CULL, 0xE50FF107BAB528A1ULL},
+	{0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C9ULL},
+	{0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7BULL},
+	{0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ADULL},
+	{0xC795830D75038C1DULL, 0xD59DF5B9EF6A2418ULL},
+	{0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1EULL},
+	{0x9BECCE62836AC577ULL, 0x4EE367F9430AEC33ULL},
+	{0xC2E801FB244576D5ULL, 0x229C41F793CDA740ULL},
+	{0xF3A20279ED56D48AULL, 0x6B43527578C11110ULL},
+	{0x9845418C345644D6ULL, 0x830A13896B78AAAAULL},
+	{0xBE5691EF416BD60CULL, 0x23CC986BC656D554ULL},
+	{0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA9ULL},
+	{0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6AAULL},
+	{0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC54ULL},
+	{0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF69ULL},
+	{0x91376C36D99995BEULL, 0x23100809B9C21FA2ULL},
+	{0xB58547448FFFFB2DULL, 0xABD40A0C2832A78BULL},
+	{0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516DULL},
+	{0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E4ULL},
+	{0xB1442798F49FFB4AULL, 0x99CD11CFDF41779DULL},
+	{0xDD95317F31C7FA1DULL, 0x40405643D711D584ULL},
+	{0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2573ULL},
+	{0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EED0ULL},
+	{0xD863B256369D4A40ULL, 0x90BED43E40076A83ULL},
+	{0x873E4F75E2224E68ULL, 0x5A7744A6E804A292ULL},
+	{0xA90DE3535AAAE202ULL, 0x711515D0A205CB37ULL},
+	{0xD3515C2831559A83ULL, 0x0D5A5B44CA873E04ULL},
+	{0x8412D9991ED58091ULL, 0xE858790AFE9486C3ULL},
+	{0xA5178FFF668AE0B6ULL, 0x626E974DBE39A873ULL},
+	{0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC81290ULL},
+	{0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B9AULL},
+	{0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E81ULL},
+	{0xC987434744AC874EULL, 0xA327FFB266B56221ULL},
+	{0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA9ULL},
+	{0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4AAULL},
+	{0xC4CE17B399107C22ULL, 0xCB550FB4384D21D4ULL},
+	{0xF6019DA07F549B2BULL, 0x7E2A53A146606A49ULL},
+	{0x99C102844F94E0FBULL, 0x2EDA7444CBFC426EULL},
+	{0xC0314325637A1939ULL, 0xFA911155FEFB5309ULL},
+	{0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CBULL},
+	{0x96267C7535B763B5ULL, 0x4BC1558B2F3458DFULL},
+	{0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F17ULL},
+	{0xEA9C227723EE8BCBULL, 0x465E15A979C1CADDULL},
+	{0x92A1958A7675175FULL, 0x0BFACD89EC191ECAULL},
+	{0xB749FAED14125D36ULL, 0xCEF980EC671F667CULL},
+	{0xE51C79A85916F484ULL, 0x82B7E12780E7401BULL},
+	{0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908811ULL},
+	{0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA16ULL},
+	{0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49BULL},
+	{0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E1ULL},
+	{0xAECC49914078536DULL, 0x58FAE9F773886E19ULL},
+	{0xDA7F5BF590966848ULL, 0xAF39A475506A899FULL},
+	{0x888F99797A5E012DULL, 0x6D8406C952429604ULL},
+	{0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B84ULL},
+	{0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A65ULL},
+	{0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A550680ULL},
+	{0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481FULL},
+	{0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA27ULL},
+	{0x823C12795DB6CE57ULL, 0x76C53D08D6B70859ULL},
+	{0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6FULL},
+	{0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD0AULL},
+	{0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4DULL},
+	{0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DB0ULL},
+	{0xC6B8E9B0709F109AULL, 0x359AB6419CA1091CULL},
+	{0xF867241C8CC6D4C0ULL, 0xC30163D203C94B63ULL},
+	{0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1EULL},
+	{0xC21094364DFB5636ULL, 0x985915FC12F542E5ULL},
+	{0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939EULL},
+	{0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C43ULL},
+	{0xBD8430BD08277231ULL, 0x50C6FF782A838354ULL},
+	{0xECE53CEC4A314EBDULL, 0xA4F8BF5635246429ULL},
+	{0x940F4613AE5ED136ULL, 0x871B7795E136BE9AULL},
+	{0xB913179899F68584ULL, 0x28E2557B59846E40ULL},
+	{0xE757DD7EC07426E5ULL, 0x331AEADA2FE589D0ULL},
+	{0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7622ULL},
+	{0xB4BCA50B065ABE63ULL, 0x0FED077A756B53AAULL},
+	{0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62895ULL},
+	{0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95DULL},
+	{0xB080392CC4349DECULL, 0xBD8D794D96AACFB4ULL},
+	{0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A1ULL},
+	{0x89E42CAAF9491B60ULL, 0xF41686C49DB57245ULL},
+	{0xAC5D37D5B79B6239ULL, 0x311C2875C522CED6ULL},
+	{0xD77485CB25823AC7ULL, 0x7D633293366B828CULL},
+	{0x86A8D39EF77164BCULL, 0xAE5DFF9C02033198ULL},
+	{0xA8530886B54DBDEBULL, 0xD9F57F830283FDFDULL},
+	{0xD267CAA862A12D66ULL, 0xD072DF63C324FD7CULL},
+	{0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6EULL},
+	{0xA46116538D0DEB78ULL, 0x52D9BE85F074E609ULL},
+	{0xCD795BE870516656ULL, 0x67902E276C921F8CULL},
+	{0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B7ULL},
+	{0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A5ULL},
+	{0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CEULL},
+	{0xFAD2A4B13D1B5D6CULL, 0x796B805720085F82ULL},
+	{0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB1ULL},
+	{0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9DULL},
+	{0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D45ULL},
+	{0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4BULL},
+	{0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635EULL},
+	{0xEF340A98172AACE4ULL, 0x86FB897116C87C35ULL},
+	{0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA1ULL},
+	{0xBAE0A846D2195712ULL, 0x8974836059CCA10AULL},
+	{0xE998D258869FACD7ULL, 0x2BD1A438703FC94CULL},
+	{0x91FF83775423CC06ULL, 0x7B6306A34627DDD0ULL},
+	{0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D543ULL},
+	{0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A94ULL},
+	{0x8E938662882AF53EULL, 0x547EB47B7282EE9DULL},
+	{0xB23867FB2A35B28DULL, 0xE99E619A4F23AA44ULL},
+	{0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D5ULL},
+	{0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD05ULL},
+	{0xAE0B158B4738705EULL, 0x9624AB50B148D446ULL},
+	{0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0958ULL},
+	{0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D7ULL},
+	{0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4DULL},
+	{0xD47487CC8470652BULL, 0x7647C32000696720ULL},
+	{0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E074ULL},
+	{0xA5FB0A17C777CF09ULL, 0xF468107100525891ULL},
+	{0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB5ULL},
+	{0x81AC1FE293D599BFULL, 0xC6F14CD848405531ULL},
+	{0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7DULL},
+	{0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851DULL},
+	{0xFD442E4688BD304AULL, 0x908F4A166D1DA664ULL},
+	{0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FFULL},
+	{0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FEULL},
+	{0xF7549530E188C128ULL, 0xD12BEE59E68EF47DULL},
+	{0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CFULL},
+	{0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF02ULL},
+	{0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC2ULL},
+	{0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0BAULL},
+	{0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E8ULL},
+	{0xEBDF661791D60F56ULL, 0x111B495B3464AD22ULL},
+	{0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC35ULL},
+	{0xB84687C269EF3BFBULL, 0x3D5D514F40EEA743ULL},
+	{0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5113ULL},
+	{0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ACULL},
+	{0xB3F4E093DB73A093ULL, 0x59ED216765690F57ULL},
+	{0xE0F218B8D25088B8ULL, 0x306869C13EC3532DULL},
+	{0x8C974F7383725573ULL, 0x1E414218C73A13FCULL},
+	{0xAFBD2350644EEACFULL, 0xE5D1929EF90898FBULL},
+	{0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF3AULL},
+	{0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB784ULL},
+	{0xAB9EB47C81F5114FULL, 0x066EA92F3F326565ULL},
+	{0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBEULL},
+	{0x8613FD0145877585ULL, 0xBD06742CE95F5F37ULL},
+	{0xA798FC4196E952E7ULL, 0x2C48113823B73705ULL},
+	{0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C6ULL},
+	{0x82EF85133DE648C4ULL, 0x9A984D73DBE722FCULL},
+	{0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBBULL},
+	{0xCC963FEE10B7D1B3ULL, 0x318DF905079926A9ULL},
+	{0xFFBBCFE994E5C61FULL, 0xFDF17746497F7053ULL},
+	{0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA634ULL},
+	{0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC1ULL},
+	{0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B1ULL},
+	{0x9C1661A651213E2DULL, 0x06BEA10CA65C084FULL},
+	{0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A63ULL},
+	{0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFBULL},
+	{0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01DULL},
+	{0xBE89523386091465ULL, 0xF6BBB397F1135824ULL},
+	{0xEE2BA6C0678B597FULL, 0x746AA07DED582E2DULL},
+	{0x94DB483840B717EFULL, 0xA8C2A44EB4571CDDULL},
+	{0xBA121A4650E4DDEBULL, 0x92F34D62616CE414ULL},
+	{0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D18ULL},
+	{0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122FULL},
+	{0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BBULL},
+	{0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C6AULL},
+	{0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C2ULL},
+	{0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB3ULL},
+	{0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDFULL},
+	{0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96CULL},
+	{0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C7ULL},
+	{0xD89D64D57A607744ULL, 0xE871C7BF077BA8B8ULL},
+	{0x87625F056C7C4A8BULL, 0x11471CD764AD4973ULL},
+	{0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BD0ULL},
+	{0xD389B47879823479ULL, 0x4AFF1D108D4EC2C4ULL},
+	{0x843610CB4BF160CBULL, 0xCEDF722A585139BBULL},
+	{0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658829ULL},
+	{0xCE947A3DA6A9273EULL, 0x733D226229FEEA33ULL},
+	{0x811CCC668829B887ULL, 0x0806357D5A3F5260ULL},
+	{0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F8ULL},
+	{0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B6ULL},
+	{0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE3ULL},
+	{0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0EULL},
+	{0xC5029163F384A931ULL, 0x0A9E795E65D4DF12ULL},
+	{0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D6ULL},
+	{0x99EA0196163FA42EULL, 0x504BCED1BF8E4E46ULL},
+	{0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D7ULL},
+	{0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4DULL},
+	{0x964E858C91BA2655ULL, 0x3A6A07F8D510F870ULL},
+	{0xBBE226EFB628AFEAULL, 0x890489F70A55368CULL},
+	{0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842FULL},
+	{0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929EULL},
+	{0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173745ULL},
+	{0xE55990879DDCAABDULL, 0xCC420A6A101D0516ULL},
+	{0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232EULL},
+	{0xB32DF8E9F3546564ULL, 0x47939822DC96ABFAULL},
+	{0xDFF9772470297EBDULL, 0x59787E2B93BC56F8ULL},
+	{0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65BULL},
+	{0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F2ULL},
+	{0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEEULL},
+	{0x88B402F7FD75539BULL, 0x11DBCB0218EBB415ULL},
+	{0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A11AULL},
+	{0xD59944A37C0752A2ULL, 0x4BE76D3346F04960ULL},
+	{0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDCULL},
+	{0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB953ULL},
+	{0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A8ULL},
+	{0x825ECC24C873782FULL, 0x8ED400668C0C28C9ULL},
+	{0xA2F67F2DFA90563BULL, 0x728900802F0F32FBULL},
+	{0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFBAULL},
+	{0xFEA126B7D78186BCULL, 0xE2F610C84987BFA9ULL},
+	{0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7CAULL},
+	{0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBCULL},
+	{0xF8A95FCF88747D94ULL, 0x75A44C6397CE912BULL},
+	{0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABBULL},
+	{0xC24452DA229B021BULL, 0xFBE85BADCE996169ULL},
+	{0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C4ULL},
+	{0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41BULL},
+	{0xBDB6B8E905CB600FULL, 0x5400E987BBC1C921ULL},
+	{0xED246723473E3813ULL, 0x290123E9AAB23B69ULL},
+	{0x9436C0760C86E30BULL, 0xF9A0B6720AAF6522ULL},
+	{0xB94470938FA89BCEULL, 0xF808E40E8D5B3E6AULL},
+	{0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E05ULL},
+	{0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C3ULL},
+	{0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF4ULL},
+	{0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B1ULL},
+	{0x8D590723948A535FULL, 0x579C487E5A38AD0FULL},
+	{0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D852ULL},
+	{0xDCDB1B2798182244ULL, 0xF8E431456CF88E66ULL},
+	{0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B5900ULL},
+	{0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F40ULL},
+	{0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB10ULL},
+	{0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4EAULL},
+	{0xA87FEA27A539E9A5ULL, 0x3F2398D747B36225ULL},
+	{0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AAEULL},
+	{0x83A3EEEEF9153E89ULL, 0x1953CF68300424ADULL},
+	{0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD8ULL},
+	{0xCDB02555653131B6ULL, 0x3792F412CB06794EULL},
+	{0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD1ULL},
+	{0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC5ULL},
+	{0xC8DE047564D20A8BULL, 0xF245825A5A445276ULL},
+	{0xFB158592BE068D2EULL, 0xEED6E2F0F0D56713ULL},
+	{0x9CED737BB6C4183DULL, 0x55464DD69685606CULL},
+	{0xC428D05AA4751E4CULL, 0xAA97E14C3C26B887ULL},
+	{0xF53304714D9265DFULL, 0xD53DD99F4B3066A9ULL},
+	{0x993FE2C6D07B7FABULL, 0xE546A8038EFE402AULL},
+	{0xBF8FDB78849A5F96ULL, 0xDE98520472BDD034ULL},
+	{0xEF73D256A5C0F77CULL, 0x963E66858F6D4441ULL},
+	{0x95A8637627989AADULL, 0xDDE7001379A44AA9ULL},
+	{0xBB127C53B17EC159ULL, 0x5560C018580D5D53ULL},
+	{0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A7ULL},
+	{0x9226712162AB070DULL, 0xCAB3961304CA70E9ULL},
+	{0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D23ULL},
+	{0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506BULL},
+	{0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB243ULL},
+	{0xB267ED1940F1C61CULL, 0x55F038B237591ED4ULL},
+	{0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6689ULL},
+	{0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA016ULL},
+	{0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081BULL},
+	{0xD9C7DCED53C72255ULL, 0x96E7BD358C904A22ULL},
+	{0x881CEA14545C7575ULL, 0x7E50D64177DA2E55ULL},
+	{0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9EAULL},
+	{0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E865ULL},
+	{0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113FULL},
+	{0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58FULL},
+	{0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF3ULL},
+	{0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED8ULL},
+	{0xA2425FF75E14FC31ULL, 0xA1258379A94D028EULL},
+	{0xCAD2F7F5359A3B3EULL, 0x096EE45813A04331ULL},
+	{0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FDULL},
+	{0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL},
+	{0xC612062576589DDAULL, 0x95364AFE032A819EULL},
+	{0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL},
+	{0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL},
+	{0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL},
+	{0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL},
+	{0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL},
+	{0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL},
+	{0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL},
+	{0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL},
+	{0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL},
+	{0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL},
+	{0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL},
+	{0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL},
+	{0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL},
+	{0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL},
+	{0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL},
+	{0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL},
+	{0x89705F4136B4A597ULL, 0x31680A88F8953031ULL},
+	{0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL},
+	{0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL},
+	{0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL},
+	{0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL},
+	{0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL},
+	{0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL},
+	{0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL},
+	{0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL},
+	{0x8000000000000000ULL, 0x0000000000000001ULL},
+	{0xA000000000000000ULL, 0x0000000000000001ULL},
+	{0xC800000000000000ULL, 0x0000000000000001ULL},
+	{0xFA00000000000000ULL, 0x0000000000000001ULL},
+	{0x9C40000000000000ULL, 0x0000000000000001ULL},
+	{0xC350000000000000ULL, 0x0000000000000001ULL},
+	{0xF424000000000000ULL, 0x0000000000000001ULL},
+	{0x9896800000000000ULL, 0x0000000000000001ULL},
+	{0xBEBC200000000000ULL, 0x0000000000000001ULL},
+	{0xEE6B280000000000ULL, 0x0000000000000001ULL},
+	{0x9502F90000000000ULL, 0x0000000000000001ULL},
+	{0xBA43B74000000000ULL, 0x0000000000000001ULL},
+	{0xE8D4A51000000000ULL, 0x0000000000000001ULL},
+	{0x9184E72A00000000ULL, 0x0000000000000001ULL},
+	{0xB5E620F480000000ULL, 0x0000000000000001ULL},
+	{0xE35FA931A0000000ULL, 0x0000000000000001ULL},
+	{0x8E1BC9BF04000000ULL, 0x0000000000000001ULL},
+	{0xB1A2BC2EC5000000ULL, 0x0000000000000001ULL},
+	{0xDE0B6B3A76400000ULL, 0x0000000000000001ULL},
+	{0x8AC7230489E80000ULL, 0x0000000000000001ULL},
+	{0xAD78EBC5AC620000ULL, 0x0000000000000001ULL},
+	{0xD8D726B7177A8000ULL, 0x0000000000000001ULL},
+	{0x878678326EAC9000ULL, 0x0000000000000001ULL},
+	{0xA968163F0A57B400ULL, 0x0000000000000001ULL},
+	{0xD3C21BCECCEDA100ULL, 0x0000000000000001ULL},
+	{0x84595161401484A0ULL, 0x0000000000000001ULL},
+	{0xA56FA5B99019A5C8ULL, 0x0000000000000001ULL},
+	{0xCECB8F27F4200F3AULL, 0x0000000000000001ULL},
+	{0x813F3978F8940984ULL, 0x4000000000000001ULL},
+	{0xA18F07D736B90BE5ULL, 0x5000000000000001ULL},
+	{0xC9F2C9CD04674EDEULL, 0xA400000000000001ULL},
+	{0xFC6F7C4045812296ULL, 0x4D00000000000001ULL},
+	{0x9DC5ADA82B70B59DULL, 0xF020000000000001ULL},
+	{0xC5371912364CE305ULL, 0x6C28000000000001ULL},
+	{0xF684DF56C3E01BC6ULL, 0xC732000000000001ULL},
+	{0x9A130B963A6C115CULL, 0x3C7F400000000001ULL},
+	{0xC097CE7BC90715B3ULL, 0x4B9F100000000001ULL},
+	{0xF0BDC21ABB48DB20ULL, 0x1E86D40000000001ULL},
+	{0x96769950B50D88F4ULL, 0x1314448000000001ULL},
+	{0xBC143FA4E250EB31ULL, 0x17D955A000000001ULL},
+	{0xEB194F8E1AE525FDULL, 0x5DCFAB0800000001ULL},
+	{0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000001ULL},
+	{0xB7ABC627050305ADULL, 0xF14A3D9E40000001ULL},
+	{0xE596B7B0C643C719ULL, 0x6D9CCD05D0000001ULL},
+	{0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000001ULL},
+	{0xB35DBF821AE4F38BULL, 0xDDA2802C8A800001ULL},
+	{0xE0352F62A19E306EULL, 0xD50B2037AD200001ULL},
+	{0x8C213D9DA502DE45ULL, 0x4526F422CC340001ULL},
+	{0xAF298D050E4395D6ULL, 0x9670B12B7F410001ULL},
+	{0xDAF3F04651D47B4CULL, 0x3C0CDD765F114001ULL},
+	{0x88D8762BF324CD0FULL, 0xA5880A69FB6AC801ULL},
+	{0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A01ULL},
+	{0xD5D238A4ABE98068ULL, 0x72A4904598D6D881ULL},
+	{0x85A36366EB71F041ULL, 0x47A6DA2B7F864751ULL},
+	{0xA70C3C40A64E6C51ULL, 0x999090B65F67D925ULL},
+	{0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6EULL},
+	{0x82818F1281ED449FULL, 0xBFF8F10E7A8921A5ULL},
+	{0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0EULL},
+	{0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764491ULL},
+	{0xFEE50B7025C36A08ULL, 0x02F236D04753D5B5ULL},
+	{0x9F4F2726179A2245ULL, 0x01D762422C946591ULL},
+	{0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF6ULL},
+	{0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB3ULL},
+	{0x9B934C3B330C8577ULL, 0x63CC55F49F88EB30ULL},
+	{0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FCULL},
+	{0xF316271C7FC3908AULL, 0x8BEF464E3945EF7BULL},
+	{0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ADULL},
+	{0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA318ULL},
+	{0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDEULL},
+	{0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6BULL},
+	{0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B45ULL},
+	{0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B617ULL},
+	{0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CEULL},
+	{0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE42ULL},
+	{0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD2ULL},
+	{0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA3ULL},
+	{0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCCULL},
+	{0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBFULL},
+	{0x8A2DBF142DFCC7ABULL, 0x6E3569326C784338ULL},
+	{0xACB92ED9397BF996ULL, 0x49C2C37F07965405ULL},
+	{0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE907ULL},
+	{0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A4ULL},
+	{0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0DULL},
+	{0xD2D80DB02AABD62BULL, 0xF50A3FA490C30191ULL},
+	{0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FBULL},
+	{0xA4B8CAB1A1563F52ULL, 0x577001B891185939ULL},
+	{0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F87ULL},
+	{0x80B05E5AC60B6178ULL, 0x544F8158315B05B5ULL},
+	{0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C722ULL},
+	{0xC913936DD571C84CULL, 0x03BC3A19CD1E38EAULL},
+	{0xFB5878494ACE3A5FULL, 0x04AB48A04065C724ULL},
+	{0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C77ULL},
+	{0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8395ULL},
+	{0xF5746577930D6500ULL, 0xCA8F44EC7EE3647AULL},
+	{0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECCULL},
+	{0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67FULL},
+	{0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101FULL},
+	{0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A13ULL},
+	{0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC98ULL},
+	{0xEA1575143CF97226ULL, 0xF52D09D71A3293BEULL},
+	{0x924D692CA61BE758ULL, 0x593C2626705F9C57ULL},
+	{0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836DULL},
+	{0xE498F455C38B997AULL, 0x0B6DFB9C0F956448ULL},
+	{0x8EDF98B59A373FECULL, 0x4724BD4189BD5EADULL},
+	{0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB658ULL},
+	{0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EEULL},
+	{0x8B865B215899F46CULL, 0xBD79E0D20082EE75ULL},
+	{0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA12ULL},
+	{0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9496ULL},
+	{0x884134FE908658B2ULL, 0x3109058D147FDCDEULL},
+	{0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD416ULL},
+	{0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91BULL},
+	{0x850FADC09923329EULL, 0x03E2CF6BC604DDB1ULL},
+	{0xA6539930BF6BFF45ULL, 0x84DB8346B786151DULL},
+	{0xCFE87F7CEF46FF16ULL, 0xE612641865679A64ULL},
+	{0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07FULL},
+	{0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09EULL},
+	{0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC6ULL},
+	{0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F7ULL},
+	{0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFBULL},
+	{0xC646D63501A1511DULL, 0xB281E1FD541501B9ULL},
+	{0xF7D88BC24209A565ULL, 0x1F225A7CA91A4227ULL},
+	{0x9AE757596946075FULL, 0x3375788DE9B06959ULL},
+	{0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AFULL},
+	{0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49BULL},
+	{0x9745EB4D50CE6332ULL, 0xF840B7BA963646E1ULL},
+	{0xBD176620A501FBFFULL, 0xB650E5A93BC3D899ULL},
+	{0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBFULL},
+	{0x93BA47C980E98CDFULL, 0xC66F336C36B10138ULL},
+	{0xB8A8D9BBE123F017ULL, 0xB80B0047445D4185ULL},
+	{0xE6D3102AD96CEC1DULL, 0xA60DC059157491E6ULL},
+	{0x9043EA1AC7E41392ULL, 0x87C89837AD68DB30ULL},
+	{0xB454E4A179DD1877ULL, 0x29BABE4598C311FCULL},
+	{0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67BULL},
+	{0x8CE2529E2734BB1DULL, 0x1899E4A65F58660DULL},
+	{0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F90ULL},
+	{0xDC21A1171D42645DULL, 0x76707543F4FA1F74ULL},
+	{0x899504AE72497EBAULL, 0x6A06494A791C53A9ULL},
+	{0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636893ULL},
+	{0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B7ULL},
+	{0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B3ULL},
+	{0xA7F26836F282B732ULL, 0x8E6CAC7768D7141FULL},
+	{0xD1EF0244AF2364FFULL, 0x3207D795430CD927ULL},
+	{0x8335616AED761F1FULL, 0x7F44E6BD49E807B9ULL},
+	{0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A7ULL},
+	{0xCD036837130890A1ULL, 0x36DBA887C37A8C10ULL},
+	{0x802221226BE55A64ULL, 0xC2494954DA2C978AULL},
+	{0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6DULL},
+	{0xC83553C5C8965D3DULL, 0x6F92829494E5ACC8ULL},
+	{0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17FAULL},
+	{0x9C69A97284B578D7ULL, 0xFF2A760414536EFCULL},
+	{0xC38413CF25E2D70DULL, 0xFEF5138519684ABBULL},
+	{0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D6AULL},
+	{0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A62ULL},
+	{0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FBULL},
+	{0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF39ULL},
+	{0x952AB45CFA97A0B2ULL, 0xDD945A747BF26184ULL},
+	{0xBA756174393D88DFULL, 0x94F971119AEEF9E5ULL},
+	{0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85EULL},
+	{0x91ABB422CCB812EEULL, 0xAC62E055C10AB33BULL},
+	{0xB616A12B7FE617AAULL, 0x577B986B314D600AULL},
+	{0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80CULL},
+	{0x8E41ADE9FBEBC27DULL, 0x14588F13BE847308ULL},
+	{0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC9ULL},
+	{0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BCULL},
+	{0x8AEC23D680043BEEULL, 0x25DE7BB9480D5855ULL},
+	{0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6BULL},
+	{0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA05ULL},
+	{0x87AA9AFF79042286ULL, 0x90FB44D2F05D0843ULL},
+	{0xA99541BF57452B28ULL, 0x353A1607AC744A54ULL},
+	{0xD3FA922F2D1675F2ULL, 0x42889B8997915CE9ULL},
+	{0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA12ULL},
+	{0xA59BC234DB398C25ULL, 0x43FAB9837E699096ULL},
+	{0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BCULL},
+	{0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F6ULL},
+	{0xA1BA1BA79E1632DCULL, 0x6462D92A69731733ULL},
+	{0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFFULL},
+	{0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43FULL},
+	{0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A8ULL},
+	{0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD1ULL},
+	{0xF6C69A72A3989F5BULL, 0x8AAD549E57273D46ULL},
+	{0x9A3C2087A63F6399ULL, 0x36AC54E2F678864CULL},
+	{0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DEULL},
+	{0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D6ULL},
+	{0x969EB7C47859E743ULL, 0x9F644AE5A4B1B326ULL},
+	{0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEFULL},
+	{0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EBULL},
+	{0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F3ULL},
+	{0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB30ULL},
+	{0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FBULL},
+	{0x8FA475791A569D10ULL, 0xF96E017D694487BDULL},
+	{0xB38D92D760EC4455ULL, 0x37C981DCC395A9ADULL},
+	{0xE070F78D3927556AULL, 0x85BBE253F47B1418ULL},
+	{0x8C469AB843B89562ULL, 0x93956D7478CCEC8FULL},
+	{0xAF58416654A6BABBULL, 0x387AC8D1970027B3ULL},
+	{0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319FULL},
+	{0x88FCF317F22241E2ULL, 0x441FECE3BDF81F04ULL},
+	{0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C4ULL},
+	{0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B075ULL},
+	{0x85C7056562757456ULL, 0xF6872D5667844E4AULL},
+	{0xA738C6BEBB12D16CULL, 0xB428F8AC016561DCULL},
+	{0xD106F86E69D785C7ULL, 0xE13336D701BEBA53ULL},
+	{0x82A45B450226B39CULL, 0xECC0024661173474ULL},
+	{0xA34D721642B06084ULL, 0x27F002D7F95D0191ULL},
+	{0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F5ULL},
+	{0xFF290242C83396CEULL, 0x7E67047175A15272ULL},
+	{0x9F79A169BD203E41ULL, 0x0F0062C6E984D387ULL},
+	{0xC75809C42C684DD1ULL, 0x52C07B78A3E60869ULL},
+	{0xF92E0C3537826145ULL, 0xA7709A56CCDF8A83ULL},
+	{0x9BBCC7A142B17CCBULL, 0x88A66076400BB692ULL},
+	{0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA436ULL},
+	{0xF356F7EBF83552FEULL, 0x0583F6B8C4124D44ULL},
+	{0x98165AF37B2153DEULL, 0xC3727A337A8B704BULL},
+	{0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5DULL},
+	{0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF74ULL},
+	{0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA9ULL},
+	{0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173693ULL},
+	{0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0438ULL},
+	{0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A3ULL},
+	{0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4CULL},
+	{0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61EULL},
+	{0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D3ULL},
+	{0xB10D8E1456105DADULL, 0x7425A83E872C5F48ULL},
+	{0xDD50F1996B947518ULL, 0xD12F124E28F7771AULL},
+	{0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA70ULL},
+	{0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550CULL},
+	{0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4FULL},
+	{0x8714A775E3E95C78ULL, 0x65ACFAEC34810A72ULL},
+	{0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0EULL},
+	{0xD31045A8341CA07CULL, 0x1EDE48111209A051ULL},
+	{0x83EA2B892091E44DULL, 0x934AED0AAB460433ULL},
+	{0xA4E4B66B68B65D60ULL, 0xF81DA84D56178540ULL},
+	{0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668FULL},
+	{0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B42601AULL},
+	{0xA1075A24E4421730ULL, 0xB24CF65B8612F820ULL},
+	{0xC94930AE1D529CFCULL, 0xDEE033F26797B628ULL},
+	{0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B2ULL},
+	{0x9D412E0806E88AA5ULL, 0x8E1F289560EE864FULL},
+	{0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E3ULL},
+	{0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DCULL},
+	{0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF2AULL},
+	{0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF4ULL},
+	{0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B1ULL},
+	{0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98FULL},
+	{0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F2ULL},
+	{0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EEULL},
+	{0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB5ULL},
+	{0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A2ULL},
+	{0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334BULL},
+	{0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400FULL},
+	{0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511013ULL},
+	{0xDF78E4B2BD342CF6ULL, 0x914DA9246B255417ULL},
+	{0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548FULL},
+	{0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B2ULL},
+	{0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741FULL},
+	{0x8865899617FB1871ULL, 0x7E2FA67C7A658893ULL},
+	{0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB8ULL},
+	{0xD51EA6FA85785631ULL, 0x552A74227F3EA566ULL},
+	{0x8533285C936B35DEULL, 0xD53A88958F872760ULL},
+	{0xA67FF273B8460356ULL, 0x8A892ABAF368F138ULL},
+	{0xD01FEF10A657842CULL, 0x2D2B7569B0432D86ULL},
+	{0x8213F56A67F6B29BULL, 0x9C3B29620E29FC74ULL},
+	{0xA298F2C501F45F42ULL, 0x8349F3BA91B47B90ULL},
+	{0xCB3F2F7642717713ULL, 0x241C70A936219A74ULL},
+	{0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0111ULL},
+	{0x9EC95D1463E8A506ULL, 0xF4363804324A40ABULL},
+	{0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D6ULL},
+	{0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050BULL},
+	{0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8327ULL},
+	{0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F1ULL},
+	{0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CEDULL},
+	{0x976E41088617CA01ULL, 0xD5BE0503E085D814ULL},
+	{0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E19ULL},
+	{0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219FULL},
+	{0x93E1AB8252F33B45ULL, 0xCABB90E5C942B504ULL},
+	{0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936244ULL},
+	{0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD5ULL},
+	{0x906A617D450187E2ULL, 0x27FB2B80668B24C6ULL},
+	{0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF7ULL},
+	{0xE1A63853BBD26451ULL, 0x5E7873F8A0396974ULL},
+	{0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E9ULL},
+	{0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA63ULL},
+	{0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FCULL},
+	{0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9EULL},
+	{0xAC2820D9623BF429ULL, 0x546345FA9FBDCD45ULL},
+	{0xD732290FBACAF133ULL, 0xA97C177947AD4096ULL},
+	{0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485EULL},
+	{0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A75ULL},
+	{0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3112ULL},
+	{0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EACULL},
+	{0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E56ULL},
+	{0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35ECULL},
+	{0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B4ULL},
+	{0xA0555E361951C366ULL, 0xD7E105BCC3326220ULL},
+	{0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA8ULL},
+	{0xFA856334878FC150ULL, 0xB14F98F6F0FEB952ULL},
+	{0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D4ULL},
+	{0xC3B8358109E84F07ULL, 0x0A862F80EC4700C9ULL},
+	{0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FBULL},
+	{0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789DULL},
+	{0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C4ULL},
+	{0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC75ULL},
+	{0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC9ULL},
+	{0xBAA718E68396CFFDULL, 0xD30560258F54E6BBULL},
+	{0xE950DF20247C83FDULL, 0x47C6B82EF32A206AULL},
+	{0x91D28B7416CDD27EULL, 0x4CDC331D57FA5442ULL},
+	{0xB6472E511C81471DULL, 0xE0133FE4ADF8E953ULL},
+	{0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A7ULL},
+	{0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7649ULL},
+	{0xB201833B35D63F73ULL, 0x2CD2CC6551E513DBULL},
+	{0xDE81E40A034BCF4FULL, 0xF8077F7EA65E58D2ULL},
+	{0x8B112E86420F6191ULL, 0xFB04AFAF27FAF783ULL},
+	{0xADD57A27D29339F6ULL, 0x79C5DB9AF1F9B564ULL},
+	{0xD94AD8B1C7380874ULL, 0x18375281AE7822BDULL},
+	{0x87CEC76F1C830548ULL, 0x8F2293910D0B15B6ULL},
+	{0xA9C2794AE3A3C69AULL, 0xB2EB3875504DDB23ULL},
+	{0xD433179D9C8CB841ULL, 0x5FA60692A46151ECULL},
+	{0x849FEEC281D7F328ULL, 0xDBC7C41BA6BCD334ULL},
+	{0xA5C7EA73224DEFF3ULL, 0x12B9B522906C0801ULL},
+	{0xCF39E50FEAE16BEFULL, 0xD768226B34870A01ULL},
+	{0x81842F29F2CCE375ULL, 0xE6A1158300D46641ULL},
+	{0xA1E53AF46F801C53ULL, 0x60495AE3C1097FD1ULL},
+	{0xCA5E89B18B602368ULL, 0x385BB19CB14BDFC5ULL},
+	{0xFCF62C1DEE382C42ULL, 0x46729E03DD9ED7B6ULL},
+	{0x9E19DB92B4E31BA9ULL, 0x6C07A2C26A8346D2ULL},
+	{0xC5A05277621BE293ULL, 0xC7098B7305241886ULL},
+	{0xF70867153AA2DB38ULL, 0xB8CBEE4FC66D1EA8ULL},
+	{0x9A65406D44A5C903ULL, 0x737F74F1DC043329ULL},
+	{0xC0FE908895CF3B44ULL, 0x505F522E53053FF3ULL},
+	{0xF13E34AABB430A15ULL, 0x647726B9E7C68FF0ULL},
+	{0x96C6E0EAB509E64DULL, 0x5ECA783430DC19F6ULL},
+	{0xBC789925624C5FE0ULL, 0xB67D16413D132073ULL},
+	{0xEB96BF6EBADF77D8ULL, 0xE41C5BD18C57E890ULL},
+	{0x933E37A534CBAAE7ULL, 0x8E91B962F7B6F15AULL},
+	{0xB80DC58E81FE95A1ULL, 0x723627BBB5A4ADB1ULL},
+	{0xE61136F2227E3B09ULL, 0xCEC3B1AAA30DD91DULL},
+	{0x8FCAC257558EE4E6ULL, 0x213A4F0AA5E8A7B2ULL},
+	{0xB3BD72ED2AF29E1FULL, 0xA988E2CD4F62D19EULL},
+	{0xE0ACCFA875AF45A7ULL, 0x93EB1B80A33B8606ULL},
+	{0x8C6C01C9498D8B88ULL, 0xBC72F130660533C4ULL},
+	{0xAF87023B9BF0EE6AULL, 0xEB8FAD7C7F8680B5ULL},
+	{0xDB68C2CA82ED2A05ULL, 0xA67398DB9F6820E2ULL},
+	{0x892179BE91D43A43ULL, 0x88083F8943A1148DULL},
+	{0xAB69D82E364948D4ULL, 0x6A0A4F6B948959B1ULL},
+	{0xD6444E39C3DB9B09ULL, 0x848CE34679ABB01DULL},
+	{0x85EAB0E41A6940E5ULL, 0xF2D80E0C0C0B4E12ULL},
+	{0xA7655D1D2103911FULL, 0x6F8E118F0F0E2196ULL},
+	{0xD13EB46469447567ULL, 0x4B7195F2D2D1A9FCULL},
+	{0x82C730BEC1CAC960ULL, 0x8F26FDB7C3C30A3EULL},
+	{0xA378FCEE723D7BB8ULL, 0xB2F0BD25B4B3CCCDULL},
+	{0xCC573C2A0ECCDAA6ULL, 0xDFACEC6F21E0C000ULL}
+};
+
+int	ft_flog2pow10(int j)
+{
+	return ((int)(((int64_t)j * 913124641741LL) >> 38));
+}
+
+const uint64_t	*ft_dtoa_pow10_128(int j)
+{
+	return (dtoa_pow10__g_dtoa_pow10_128[j - FT_DTOA_POW10_MIN]);
+}
+
+/**
+ * @brief Bits of w strictly between bit 63 and bit s, nonzero?
+ */
+static int	dtoa_pow10__mid_bits(const uint64_t *w, int s)
+{
+	if (s >= 128)
+		return (w[1] || (w[2] << (191 - s) << 1));
+	return ((w[1] << (127 - s) << 1) != 0);
+}
+
+/**
+ * The product overshoots cx * 10^-k * 2^(127 - e) by at most cx, so when
+ * the bits shifted out exceed cx the floor is settled and the exact value
+ * is not an integer. Otherwise, about once in 2^64 draws, the bignums
+ * decide.
+ */
+int	ft_dtoa_scale_table(uint64_t cx, int q, int k, uint64_t *out)
+{
+	const uint64_t	*g;
+	t_u128			lo;
+	t_u128			hi;
+	uint64_t		w[3];
+	int				s;
+
+	s = 127 - q - ft_flog2pow10(-k);
+	if (-k < FT_DTOA_POW10_MIN || -k > FT_DTOA_POW10_MAX || s < 64 || s > 191)
+		return (ft_dtoa_scale_big(cx, q, k, out));
+	g = ft_dtoa_pow10_128(-k);
+	lo = (t_u128)cx * g[1];
+	hi = (t_u128)cx * g[0] + (uint64_t)(lo >> 64);
+	w[0] = (uint64_t)lo;
+	w[1] = (uint64_t)hi;
+	w[2] = (uint64_t)(hi >> 64);
+	if (s >= 128)
+		*out = w[2] >> (s - 128);
+	else
+		*out = (w[2] << (127 - s) << 1) | (w[1] >> (s - 64));
+	if (dtoa_pow10__mid_bits(w, s) || w[0] > cx)
+		return (1);
+	return (ft_dtoa_scale_big(cx, q, k, out));
+}
+
+/* --- ft_dtoa_round.c --- */
+
+
+/**
+ * @brief Whole result below 10^18: one scaled integer with a spare low bit
+ *        for the half, plus the inexact flag as the sticky bit.
+ */
+static size_t	dtoa_round__fast_round(const t_dfp *fp, int s, char *out)
+{
+	uint64_t	t;
+	uint64_t	r;
+	int			lost;
+
+	lost = ft_dtoa_scale(fp->c << 1, fp->q, -s, &t);
+	r = t >> 1;
+	if ((t & 1) && (lost || (r & 1)))
+		r++;
+	return (ft_u64toa_buf(r, out));
+}
+
+/**
+ * Places past the last nonzero binary fraction digit (10^s beyond 2^-q)
+ * are zeros; they are appended instead of carried through the bignums.
+ */
+size_t	ft_dtoa_round(const t_dfp *fp, int s, char *out)
+{
+	int		pad;
+	int		lim;
+	size_t	n;
+
+	lim = 0;
+	if (fp->q < 0)
+		lim = -fp->q;
+	pad = 0;
+	if (s > lim)
+		pad = s - lim;
+	s -= pad;
+	if (!fp->c)
+		n = ft_u64toa_buf(0, out);
+	else if (ft_flog10pow2(fp->q + 64 - __builtin_clzll(fp->c)) + s + 1 <= 18)
+		n = dtoa_round__fast_round(fp, s, out);
+	else
+		n = ft_dtoa_round_big(fp, s, out);
+	if (fp->c && pad)
+		ft_memset(out + n, '0', pad);
+	if (fp->c)
+		n += pad;
+	out[n] = '\0';
+	return (n);
+}
+
+/* --- ft_dtoa_round_big.c --- */
+
+
+/**
+ * @brief Add one to the last of n digits, growing to n + 1 on a carry out.
+ */
+static size_t	dtoa_round_big__round_up(char *out, size_t n)
+{
+	size_t	i;
+
+	i = n;
+	while (i && out[i - 1] == '9')
+		out[--i] = '0';
+	if (i)
+	{
+		out[i - 1]++;
+		return (n);
+	}
+	ft_memmove(out + 1, out, n);
+	out[0] = '1';
+	return (n + 1);
+}
+
+/**
+ * @brief Scale den up to the leading decade of num / den.
+ * @return Index of the last integer digit (digits to generate minus one).
+ */
+static size_t	dtoa_round_big__big_align(t_bignum *num, t_bignum *den)
+{
+	int			j;
+	t_bignum	ten;
+
+	j = ft_flog10pow2((int)ft_big_bitlen(num) - (int)ft_big_bitlen(den) - 1);
+	if (j < 0)
+		j = 0;
+	ft_big_mul_pow10(den, j);
+	ten = *den;
+	ft_big_mul_small(&ten, 10);
+	if (ft_big_cmp(num, &ten) >= 0)
+	{
+		*den = ten;
+		j++;
+	}
+	return ((size_t)j);
+}
+
+/**
+ * @brief Digits by repeated subtraction, for a power of ten divisor.
+ */
+static size_t	dtoa_round_big__by_division(const t_dfp *fp, int s, char *out)
+{
+	t_bignum	nd[2];
+	size_t		last;
+	size_t		i;
+	int			cmp;
+
+	ft_big_load_ratio(fp->c, fp->q, -s, nd);
+	last = dtoa_round_big__big_align(&nd[0], &nd[1]);
+	i = 0;
+	while (i <= last)
+	{
+		out[i] = (char)('0' + ft_big_div_digit(&nd[0], &nd[1]));
+		if (i < last)
+			ft_big_mul_small(&nd[0], 10);
+		i++;
+	}
+	ft_big_shl(&nd[0], 1);
+	cmp = ft_big_cmp(&nd[0], &nd[1]);
+	if (cmp > 0 || (cmp == 0 && (out[last] & 1)))
+		return (dtoa_round_big__round_up(out, last + 1));
+	return (last + 1);
+}
+
+/**
+ * @brief c * 10^s / 2^-q: the division is a shift, whose dropped bits
+ *        decide the rounding, and the quotient is printed by ft_big_to_dec.
+ */
+static size_t	dtoa_round_big__by_shift(const t_dfp *fp, int s, char *out)
+{
+	t_bignum	num;
+	int			dropped;
+	size_t		n;
+
+	ft_big_set(&num, fp->c);
+	if (fp->q > 0)
+		ft_big_shl(&num, fp->q);
+	ft_big_mul_pow10(&num, s);
+	dropped = 0;
+	if (fp->q < 0)
+		dropped = ft_big_shr_round(&num, -fp->q);
+	n = ft_big_to_dec(&num, out);
+	if (dropped == 3 || (dropped == 2 && (out[n - 1] & 1)))
+		return (dtoa_round_big__round_up(out, n));
+	return (n);
+}
+
+/**
+ * Exact digits for results too wide for a 64-bit integer.
+ */
+size_t	ft_dtoa_round_big(const t_dfp *fp, int s, char *out)
+{
+	size_t	n;
+
+	if (s >= 0)
+		n = dtoa_round_big__by_shift(fp, s, out);
+	else
+		n = dtoa_round_big__by_division(fp, s, out);
+	out[n] = '\0';
+	return (n);
+}
+
+/* --- ft_dtoa_scale.c --- */
+
+
+static const uint64_t	dtoa_scale__g_dtoa_pow10[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+	10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+	100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL,
+	10000000000000000000ULL
+};
+
+/**
+ * @brief w = a * 10^k (k <= 38) as three 64-bit words, least significant
+ *        first.
+ */
+static void	dtoa_scale__mul192(uint64_t a, int k, uint64_t *w)
+{
+	t_u128	b;
+	t_u128	lo;
+	t_u128	hi;
+	t_u128	mid;
+
+	b = (t_u128)dtoa_scale__g_dtoa_pow10[k / 2] * dtoa_scale__g_dtoa_pow10[k - k / 2];
+	lo = (t_u128)a * (uint64_t)b;
+	hi = (t_u128)a * (uint64_t)(b >> 64);
+	mid = (lo >> 64) + (uint64_t)hi;
+	w[0] = (uint64_t)lo;
+	w[1] = (uint64_t)mid;
+	w[2] = (uint64_t)(hi >> 64) + (uint64_t)(mid >> 64);
+}
+
+/**
+ * @brief Low 64 bits of w >> s.
+ * @return 1 if a shifted-out bit was set.
+ */
+static int	dtoa_scale__shr192(const uint64_t *w, unsigned int s, uint64_t *out)
+{
+	unsigned int	idx;
+	unsigned int	bits;
+	unsigned int	i;
+	int				lost;
+
+	idx = s / 64;
+	bits = s % 64;
+	*out = 0;
+	lost = 0;
+	i = 0;
+	while (i < idx && i < 3)
+		lost |= (w[i++] != 0);
+	if (idx >= 3)
+		return (lost);
+	*out = w[idx] >> bits;
+	if (bits && idx < 2)
+		*out |= w[idx + 1] << (64 - bits);
+	if (bits)
+		lost |= ((w[idx] << (64 - bits)) != 0);
+	return (lost);
+}
+
+/**
+ * @brief floor(n / 10^k) for k <= 38.
+ */
+static int	dtoa_scale__scale_div(t_u128 n, int k, uint64_t *out, int lost)
+{
+	t_u128	p;
+
+	p = (t_u128)dtoa_scale__g_dtoa_pow10[k / 2] * dtoa_scale__g_dtoa_pow10[k - k / 2];
+	*out = (uint64_t)(n / p);
+	return (lost || (n % p) != 0);
+}
+
+/**
+ * @brief ft_dtoa_scale for 0 < k <= 38.
+ */
+static int	dtoa_scale__scale_down(uint64_t cx, int q, int k, uint64_t *out)
+{
+	if (q <= -64)
+	{
+		*out = 0;
+		return (cx != 0);
+	}
+	if (q < 0)
+		return (dtoa_scale__scale_div(cx >> -q, k, out, (cx << (64 + q)) != 0));
+	if (q <= 63 + __builtin_clzll(cx | 1))
+		return (dtoa_scale__scale_div((t_u128)cx << q, k, out, 0));
+	return (ft_dtoa_scale_table(cx, q, k, out));
+}
+
+/**
+ * Within 38 decades 10^k fits 128 bits and the result is exact from one
+ * 192-bit product or a 128-bit division. Further out the rounded-up table
+ * of ft_dtoa_scale_table is used.
+ */
+int	ft_dtoa_scale(uint64_t cx, int q, int k, uint64_t *out)
+{
+	uint64_t	w[3];
+
+	if (k > 0 && k <= 38)
+		return (dtoa_scale__scale_down(cx, q, k, out));
+	if (k > 0 || k < -38 || q >= 64)
+		return (ft_dtoa_scale_table(cx, q, k, out));
+	dtoa_scale__mul192(cx, -k, w);
+	if (q >= 0)
+	{
+		*out = w[0] << q;
+		return (0);
+	}
+	return (dtoa_scale__shr192(w, -q, out));
+}
+
+/* --- ft_dtoa_scale_big.c --- */
+
+
+/**
+ * The larger power of each base goes to whichever side keeps both
+ * integers.
+ */
+void	ft_big_load_ratio(uint64_t cx, int q, int k, t_bignum *nd)
+{
+	ft_big_set(&nd[0], cx);
+	ft_big_set(&nd[1], 1);
+	if (q > 0)
+		ft_big_shl(&nd[0], q);
+	else
+		ft_big_shl(&nd[1], -q);
+	if (k < 0)
+		ft_big_mul_pow10(&nd[0], -k);
+	else
+		ft_big_mul_pow10(&nd[1], k);
+}
+
+int	ft_dtoa_scale_big(uint64_t cx, int q, int k, uint64_t *out)
+{
+	t_bignum	nd[2];
+
+	ft_big_load_ratio(cx, q, k, nd);
+	return (ft_big_div_u64(&nd[0], &nd[1], out));
+}
+
+/* --- ft_dtoa_shortest.c --- */
+
+
+/**
+ * @brief cx * 2^q / 10^k rounded to odd: the floor with its low bit set
+ *        when anything was cut off.
+ */
+static uint64_t	dtoa_shortest__round_odd(uint64_t cx, int q, int k)
+{
+	uint64_t	v;
+
+	if (ft_dtoa_scale(cx, q, k, &v))
+		v |= 1;
+	return (v);
+}
+
+/**
+ * @brief Pick among s, s + 1 and the multiples of ten around them.
+ *
+ * vb, vbl and vbr are 4 * x, 4 * (x - ulp / 2) and 4 * (x + ulp / 2) in
+ * units of 10^k, rounded to odd. A candidate wins when it lies inside the
+ * rounding interval, which is closed for even significands.
+ */
+static uint64_t	dtoa_shortest__pick(const uint64_t *v, uint64_t out)
+{
+	uint64_t	s;
+	uint64_t	sp10;
+	int			uin;
+	int			win;
+
+	s = v[0] >> 2;
+	sp10 = s / 10 * 10;
+	uin = (v[1] + out <= sp10 << 2);
+	win = (((sp10 + 10) << 2) + out <= v[2]);
+	if (s >= 100 && uin != win)
+		return (sp10 + 10 * win);
+	uin = (v[1] + out <= s << 2);
+	win = (((s + 1) << 2) + out <= v[2]);
+	if (uin != win)
+		return (s + win);
+	if (v[0] < (s << 2) + 2 || (v[0] == (s << 2) + 2 && !(s & 1)))
+		return (s);
+	return (s + 1);
+}
+
+/**
+ * Schubfach (R. Giulietti): the candidates come from one decade k chosen
+ * from the binary exponent, so no digit loop or retry is needed. Instead
+ * of a table of 128-bit powers of ten the three bounds are scaled exactly
+ * by ft_dtoa_scale, which only falls back to bignums beyond 10^+-38.
+ */
+size_t	ft_dtoa_shortest_digits(const t_dfp *fp, char *out, int *e10)
+{
+	uint64_t	v[3];
+	uint64_t	cb;
+	int			k;
+	size_t		n;
+
+	cb = fp->c << 2;
+	if (fp->c == 1ULL << 52 && fp->q > -1074)
+	{
+		k = (int)(((int64_t)fp->q * 661971961083LL - 274743187321LL) >> 41);
+		v[1] = dtoa_shortest__round_odd(cb - 1, fp->q, k);
+	}
+	else
+	{
+		k = ft_flog10pow2(fp->q);
+		v[1] = dtoa_shortest__round_odd(cb - 2, fp->q, k);
+	}
+	v[0] = dtoa_shortest__round_odd(cb, fp->q, k);
+	v[2] = dtoa_shortest__round_odd(cb + 2, fp->q, k);
+	n = ft_u64toa_buf(dtoa_shortest__pick(v, fp->c & 1), out);
+	*e10 = k + (int)n - 1;
+	while (n > 1 && out[n - 1] == '0')
+		n--;
+	out[n] = '\0';
+	return (n);
+}
+
+/* --- ft_dtoa_util.c --- */
+
+
+/**
+ * 661971961083 / 2^41 is log10(2) to within 2^-41, close enough for the
+ * floor to be exact over every double exponent.
+ */
+int	ft_flog10pow2(int e)
+{
+	return ((int)(((int64_t)e * 661971961083LL) >> 41));
+}
+
+int	ft_dtoa_decode(double x, t_dfp *fp)
+{
+	uint64_t	bits;
+	int			biased;
+
+	__builtin_memcpy(&bits, &x, sizeof(bits));
+	fp->neg = (int)(bits >> 63);
+	biased = (int)((bits >> 52) & 0x7FF);
+	fp->c = bits & ((1ULL << 52) - 1);
+	if (biased == 0x7FF && fp->c)
+		return (FT_DTOA_NAN);
+	if (biased == 0x7FF)
+		return (FT_DTOA_INF);
+	fp->q = -1074;
+	if (biased)
+	{
+		fp->c |= 1ULL << 52;
+		fp->q = biased - 1075;
+	}
+	return (FT_DTOA_FINITE);
+}
+
+/**
+ * The sign is kept for NaN too ("-nan"), as glibc prints it.
+ */
+size_t	ft_dtoa_special(int cls, int neg, char *buf)
+{
+	size_t	len;
+
+	len = 0;
+	if (neg)
+		buf[len++] = '-';
+	if (cls == FT_DTOA_NAN)
+		ft_memcpy(buf + len, "nan", 4);
+	else
+		ft_memcpy(buf + len, "inf", 4);
+	return (len + 3);
+}
+
+/* --- ft_parse_ints.c --- */
+
+
+/**
+ * @brief Append v, storing in place while the vector has room.
+ */
+static int	parse_ints__append(t_vec *out, int64_t v)
+{
+	if (out->len < out->cap)
+	{
+		((int64_t *)out->data)[out->len++] = v;
+		return (1);
+	}
+	return (ft_vec_push(out, &v));
+}
+
+static int	parse_ints__at_separator(const char *p, const char *lim)
+{
+	return (p == lim || *p == ' ' || (*p >= '\t' && *p <= '\r'));
+}
+
+/**
+ * Every number is scanned in place with the bounded decimal kernel, so
+ * the buffer needs no terminator and nothing is copied.
+ */
+int	ft_parse_ints(const char *buf, size_t len, t_vec *out)
+{
+	const char	*p;
+	const char	*lim;
+	t_numscan	ns;
+	int64_t		v;
+
+	if (!buf || !out || out->elem_size != sizeof(int64_t))
+		return (0);
+	lim = buf + len;
+	p = ft_conv_skip_space(buf, lim);
+	while (p < lim)
+	{
+		ft_conv_scan(p, lim, 10, &ns);
+		v = ft_conv_signed(&ns, INT64_MAX);
+		if (ns.err != FT_CONV_OK || !parse_ints__at_separator(ns.end, lim)
+			|| !parse_ints__append(out, v))
+			return (0);
+		p = ft_conv_skip_space(ns.end, lim);
+	}
+	return (1);
+}
+
+/* --- ft_parse_vec3.c --- */
+
+
+/**
+ * @brief One double, then the ',' before the next one unless last.
+ */
+static int	parse_vec3__read_component(const char **p, double *v, int last)
+{
+	char	*end;
+	int		err;
+
+	*v = ft_strtod(*p, &end, &err);
+	if (err != FT_CONV_OK)
+		return (0);
+	*p = end;
+	if (last)
+		return (1);
+	while (**p == ' ' || **p == '\t')
+		(*p)++;
+	if (**p != ',')
+		return (0);
+	(*p)++;
+	return (1);
+}
+
+int	ft_parse_vec3(const char *s, char **end, t_vec3 *out)
+{
+	t_vec3		v;
+	const char	*p;
+
+	p = s;
+	if (!parse_vec3__read_component(&p, &v.x, 0) || !parse_vec3__read_component(&p, &v.y, 0)
+		|| !parse_vec3__read_component(&p, &v.z, 1))
+	{
+		if (end)
+			*end = (char *)s;
+		return (0);
+	}
+	*out = v;
+	if (end)
+		*end = (char *)p;
+	return (1);
+}
+
+/* --- ft_strtod.c --- */
+
+
+static int	strtod__match_word(const char *p, const char *word)
+{
+	while (*word)
+	{
+		if (ft_tolower((unsigned char)*p) != *word)
+			return (0);
+		p++;
+		word++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Skip the optional "(n-char-sequence)" after "nan".
+ */
+static const char	*strtod__skip_nan_tag(const char *p)
+{
+	const char	*q;
+
+	if (*p != '(')
+		return (p);
+	q = p + 1;
+	while (ft_isalnum((unsigned char)*q) || *q == '_')
+		q++;
+	if (*q != ')')
+		return (p);
+	return (q + 1);
+}
+
+/**
+ * @brief "inf", "infinity" or "nan[(tag)]" in any case, after the space
+ *        and sign the scan already skipped.
+ * @return 1 with the bits in *bits and d->end set, 0 if none matches.
+ */
+static int	strtod__parse_special(const char *s, t_decimal *d, uint64_t *bits)
+{
+	const char	*p;
+
+	p = ft_conv_skip_space(s, NULL);
+	p += (*p == '-' || *p == '+');
+	if (strtod__match_word(p, "inf"))
+	{
+		d->end = p + 3;
+		if (strtod__match_word(p + 3, "inity"))
+			d->end = p + 8;
+		*bits = 0x7FF0000000000000ULL;
+		return (1);
+	}
+	if (!strtod__match_word(p, "nan"))
+		return (0);
+	d->end = strtod__skip_nan_tag(p + 3);
+	*bits = 0x7FF8000000000000ULL;
+	return (1);
+}
+
+/**
+ * Clinger's exact product first, then Eisel-Lemire. With more than 19
+ * digits the true value lies between w and w + 1 units, so it is settled
+ * when both ends round alike; otherwise the bignums decide.
+ */
+static uint64_t	strtod__to_bits(const t_decimal *d, int *err)
+{
+	int64_t		q;
+	double		x;
+	uint64_t	bits;
+	uint64_t	upper;
+
+	q = d->exp10;
+	if (d->nd > 19)
+		q += d->nd - 19;
+	if (!d->w || q < -342)
+		return (0);
+	if (q > 308)
+		bits = 0x7FF0000000000000ULL;
+	else if (!d->trunc && ft_strtod_clinger(d->w, (int)q, &x))
+		__builtin_memcpy(&bits, &x, sizeof(bits));
+	else if (!ft_strtod_lemire(d->w, (int)q, &bits) || (d->trunc
+			&& (!ft_strtod_lemire(d->w + 1, (int)q, &upper) || upper != bits)))
+		bits = ft_strtod_big(d);
+	if (bits == 0x7FF0000000000000ULL)
+		*err = FT_CONV_RANGE;
+	return (bits);
+}
+
+double	ft_strtod(const char *s, char **end, int *err)
+{
+	t_decimal	d;
+	uint64_t	bits;
+	int			e;
+	double		x;
+
+	ft_strtod_scan(s, &d);
+	e = FT_CONV_OK;
+	bits = 0;
+	if (d.end != s)
+		bits = strtod__to_bits(&d, &e);
+	else if (!strtod__parse_special(s, &d, &bits))
+	{
+		e = FT_CONV_EMPTY;
+		d.neg = 0;
+	}
+	if (end)
+		*end = (char *)d.end;
+	if (err)
+		*err = e;
+	bits |= (uint64_t)d.neg << 63;
+	__builtin_memcpy(&x, &bits, sizeof(x));
+	return (x);
+}
+
+/* --- ft_strtod_big.c --- */
+
+
+/**
+ * @brief Up to FT_STRTOD_DIGITS significant digits of d into b, nine per
+ *        limb pass, with a final 1 standing in for any nonzero rest.
+ * @return Number of digits b holds.
+ */
+static int64_t	strtod_big__load_digits(const t_decimal *d, t_bignum *b)
+{
+	const char	*p;
+	int64_t		used;
+	uint32_t	chunk;
+	uint32_t	scale;
+
+	ft_big_set(b, 0);
+	p = d->first;
+	used = 0;
+	while (used < d->nd && used < FT_STRTOD_DIGITS)
+	{
+		chunk = 0;
+		scale = 1;
+		while (scale < 1000000000 && used < d->nd && used < FT_STRTOD_DIGITS)
+		{
+			p += (*p == '.');
+			chunk = chunk * 10 + (uint32_t)(*p++ - '0');
+			scale *= 10;
+			used++;
+		}
+		ft_big_mul_add(b, scale, chunk);
+	}
+	return (used);
+}
+
+/**
+ * @brief 1 if a digit past the first FT_STRTOD_DIGITS is nonzero.
+ */
+static int	strtod_big__rest_nonzero(const t_decimal *d)
+{
+	const char	*p;
+	int64_t		i;
+
+	p = d->first;
+	i = 0;
+	while (i < d->nd)
+	{
+		p += (*p == '.');
+		if (i >= FT_STRTOD_DIGITS && *p != '0')
+			return (1);
+		p++;
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief num * 10^q as IEEE bits: 64 leading bits and a sticky flag for
+ *        the rest, from a shift when q >= 0 or from a 64-bit quotient.
+ */
+static uint64_t	strtod_big__big_bits(t_bignum *num, int q)
+{
+	t_bignum	den;
+	uint64_t	v;
+	int			s;
+	int			lost;
+
+	if (q >= 0)
+	{
+		ft_big_mul_pow10(num, q);
+		s = (int)ft_big_bitlen(num) - 64;
+		if (s < 0)
+			s = 0;
+		lost = (ft_big_shr_round(num, s) != 0);
+		return (ft_strtod_round_pack(ft_big_low64(num), s, lost));
+	}
+	ft_big_set(&den, 1);
+	ft_big_mul_pow10(&den, -q);
+	s = 63 - (int)ft_big_bitlen(num) + (int)ft_big_bitlen(&den);
+	if (s > 0)
+		ft_big_shl(num, s);
+	else
+		ft_big_shl(&den, -s);
+	lost = ft_big_div_u64(num, &den, &v);
+	return (ft_strtod_round_pack(v, -s, lost));
+}
+
+/**
+ * Inputs whose leading digit is past 10^308 or below 10^-325 never get
+ * here (the caller saturates them), which keeps every bignum within
+ * FT_BIGNUM_LIMBS.
+ */
+uint64_t	ft_strtod_big(const t_decimal *d)
+{
+	t_bignum	num;
+	int64_t		used;
+
+	used = strtod_big__load_digits(d, &num);
+	if (d->nd > used && strtod_big__rest_nonzero(d))
+	{
+		ft_big_mul_add(&num, 10, 1);
+		used++;
+	}
+	return (strtod_big__big_bits(&num, (int)(d->exp10 + d->nd - used)));
+}
+
+/* --- ft_strtod_fast.c --- */
+
+
+static const double	strtod_fast__g_exact_pow10[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+	1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief Significand bits a double keeps for a value whose leading bit
+ *        is 2^e2: 53, fewer for subnormals, 0 or less when even the
+ *        smallest subnormal is out of reach.
+ */
+static int	strtod_fast__keep_bits(int e2)
+{
+	if (e2 >= -1022)
+		return (53);
+	return (e2 + 1075);
+}
+
+/**
+ * Exponents past the top binade saturate to infinity. For subnormals the
+ * exponent field stays 0, and a carry out of the significand moves into
+ * it by plain addition.
+ */
+uint64_t	ft_strtod_round_pack(uint64_t v, int b, int lost)
+{
+	int			n;
+	int			e2;
+	int			shift;
+	uint64_t	m;
+
+	n = 64 - __builtin_clzll(v | 1);
+	e2 = n - 1 + b;
+	if (!v || e2 > 1023)
+		return ((uint64_t)(v != 0) * 0x7FF0000000000000ULL);
+	shift = n - strtod_fast__keep_bits(e2);
+	if (shift > 64)
+		return (0);
+	if (shift <= 0)
+		m = v << -shift;
+	else
+	{
+		m = (v >> (shift - 1)) >> 1;
+		lost |= ((v & ((1ULL << (shift - 1)) - 1)) != 0);
+		if (((v >> (shift - 1)) & 1) && (lost || (m & 1)))
+			m++;
+	}
+	if (e2 < -1022)
+		return (m);
+	return (((uint64_t)(e2 + 1022) << 52) + m);
+}
+
+/**
+ * Both operands are exact doubles, so the single multiply or divide is
+ * the correctly rounded result.
+ */
+int	ft_strtod_clinger(uint64_t w, int q, double *out)
+{
+	if (w > (1ULL << 53) || q < -22 || q > 22)
+		return (0);
+	*out = (double)w;
+	if (q < 0)
+		*out /= strtod_fast__g_exact_pow10[-q];
+	else
+		*out *= strtod_fast__g_exact_pow10[q];
+	return (1);
+}
+
+/**
+ * @brief 1 if some rounding boundary lies within wn below the product,
+ *        whose top word p[2] is worth 2^b per unit.
+ *
+ * The table overshoots, so the exact product is in [p - wn, p). Every
+ * multiple of half an ulp changes the rounding; when one falls in that
+ * range (the bits under the round bit are at most wn) p cannot decide.
+ */
+static int	strtod_fast__undecided(const uint64_t *p, int b, uint64_t wn)
+{
+	int	n;
+	int	shift;
+
+	n = 64 - __builtin_clzll(p[2]);
+	shift = n - strtod_fast__keep_bits(n - 1 + b);
+	if (shift > 63)
+		return (1);
+	return (!((p[2] & ((1ULL << (shift - 1)) - 1)) || p[1] || p[0] > wn));
+}
+
+/**
+ * Eisel-Lemire with the rounded-up table of ft_dtoa_pow10_128: instead of
+ * the usual "low bits all ones" heuristic, the exact error bound of the
+ * product decides when to give up.
+ */
+int	ft_strtod_lemire(uint64_t w, int q, uint64_t *bits)
+{
+	const uint64_t	*g;
+	uint64_t		p[3];
+	t_u128			lo;
+	t_u128			hi;
+	int				lz;
+
+	lz = __builtin_clzll(w);
+	w <<= lz;
+	g = ft_dtoa_pow10_128(q);
+	lo = (t_u128)w * g[1];
+	hi = (t_u128)w * g[0] + (uint64_t)(lo >> 64);
+	p[0] = (uint64_t)lo;
+	p[1] = (uint64_t)hi;
+	p[2] = (uint64_t)(hi >> 64);
+	lz = ft_flog2pow10(q) + 1 - lz;
+	if (strtod_fast__undecided(p, lz, w))
+		return (0);
+	*bits = ft_strtod_round_pack(p[2], lz, 1);
+	return (1);
+}
+
+/* --- ft_strtod_scan.c --- */
+
+
+static void	strtod_scan__add_digit(t_decimal *d, const char *p)
+{
+	int	digit;
+
+	digit = *p - '0';
+	if (!d->nd && !digit)
+		return ;
+	if (!d->nd)
+		d->first = p;
+	if (d->nd < 19)
+		d->w = d->w * 10 + digit;
+	else
+		d->trunc |= (digit != 0);
+	d->nd++;
+}
+
+/**
+ * @brief Take 8 digits at once: into w while it has room for all of them,
+ *        or only as "zero or not" once it is full.
+ */
+static void	strtod_scan__add_eight(t_decimal *d, const char *p, uint64_t v)
+{
+	if (d->nd >= 19)
+		d->trunc |= (v != 0);
+	else if (d->nd)
+		d->w = d->w * 100000000 + v;
+	if (d->nd)
+	{
+		d->nd += 8;
+		return ;
+	}
+	if (!v)
+		return ;
+	d->nd = (int64_t)ft_conv_dec_len(v);
+	d->first = p + 8 - d->nd;
+	d->w = v;
+}
+
+static const char	*strtod_scan__scan_digits(const char *p, t_decimal *d)
+{
+	uint64_t	v;
+
+	while ((unsigned char)(*p - '0') < 10)
+	{
+		if ((d->nd <= 11 || d->nd >= 19) && ft_conv_load8(p, NULL, &v))
+		{
+			strtod_scan__add_eight(d, p, v);
+			p += 8;
+		}
+		else
+			strtod_scan__add_digit(d, p++);
+	}
+	return (p);
+}
+
+/**
+ * @brief Consume "e[+-]digits" if a digit follows; the magnitude
+ *        saturates far beyond any double.
+ */
+static const char	*strtod_scan__scan_exponent(const char *p, t_decimal *d)
+{
+	const char	*q;
+	int64_t		e;
+	int			neg;
+
+	if (*p != 'e' && *p != 'E')
+		return (p);
+	q = p + 1;
+	neg = 0;
+	if (*q == '+' || *q == '-')
+		neg = (*q++ == '-');
+	if (!ft_isdigit(*q))
+		return (p);
+	e = 0;
+	while (ft_isdigit(*q))
+	{
+		if (e < 100000000)
+			e = e * 10 + (*q - '0');
+		q++;
+	}
+	if (neg)
+		e = -e;
+	d->exp10 += e;
+	return (q);
+}
+
+void	ft_strtod_scan(const char *s, t_decimal *d)
+{
+	const char	*p;
+	const char	*digits;
+	const char	*frac;
+
+	ft_bzero(d, sizeof(*d));
+	d->end = s;
+	p = ft_conv_skip_space(s, NULL);
+	if (*p == '-' || *p == '+')
+		d->neg = (*p++ == '-');
+	digits = p;
+	p = strtod_scan__scan_digits(p, d);
+	if (*p == '.')
+	{
+		frac = p + 1;
+		p = strtod_scan__scan_digits(frac, d);
+		d->exp10 = -(p - frac);
+		if (p == frac && frac == digits + 1)
+			return ;
+	}
+	if (p == digits)
+		return ;
+	d->end = strtod_scan__scan_exponent(p, d);
+}
+
+/* --- ft_strtol.c --- */
+
+
+static void	strtol__finish(const t_numscan *ns, char **end, int *err)
+{
+	if (end)
+		*end = (char *)ns->end;
+	if (err)
+		*err = ns->err;
+}
+
+/**
+ * Like strtoull, a leading '-' negates the value modulo 2^64.
+ */
+unsigned long long	ft_strtoull(const char *s, char **end, int base,
+		int *err)
+{
+	t_numscan	ns;
+
+	ft_conv_scan(s, NULL, base, &ns);
+	strtol__finish(&ns, end, err);
+	if (ns.neg && ns.err == FT_CONV_OK)
+		return (0 - ns.mag);
+	return (ns.mag);
+}
+
+long long	ft_strtoll(const char *s, char **end, int base, int *err)
+{
+	t_numscan	ns;
+	long long	v;
+
+	ft_conv_scan(s, NULL, base, &ns);
+	v = ft_conv_signed(&ns, LLONG_MAX);
+	strtol__finish(&ns, end, err);
+	return (v);
+}
+
+long	ft_strtol(const char *s, char **end, int base, int *err)
+{
+	t_numscan	ns;
+	long		v;
+
+	ft_conv_scan(s, NULL, base, &ns);
+	v = ft_conv_signed(&ns, LONG_MAX);
+	strtol__finish(&ns, end, err);
+	return (v);
+}
+
+/* --- ft_u64toa.c --- */
+
+
+static const char		u64toa__g_digit_pairs[201]
+	= "00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+/*
+ * Entry t is the smallest value with t + 1 digits, except entry 0, which
+ * is 0 so that 0 itself counts as one digit.
+ */
+static const uint64_t	u64toa__g_pow10[20] = {
+	0ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+	10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+	100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL,
+	10000000000000000000ULL
+};
+
+/**
+ * The bit length of n gives its digit count to within one:
+ * bits * 1233 / 4096 approximates bits * log10(2). One table compare
+ * settles the rest.
+ */
+size_t	ft_conv_dec_len(uint64_t n)
+{
+	size_t	t;
+
+	t = ((64 - __builtin_clzll(n | 1)) * 1233) >> 12;
+	return (t + (n >= u64toa__g_pow10[t]));
+}
+
+/**
+ * Digits are written from the end two at a time, one division by 100
+ * and one table copy per pair.
+ */
+size_t	ft_u64toa_buf(uint64_t n, char *buf)
+{
+	size_t	len;
+	size_t	i;
+
+	len = ft_conv_dec_len(n);
+	buf[len] = '\0';
+	i = len;
+	while (n >= 100)
+	{
+		i -= 2;
+		__builtin_memcpy(buf + i, u64toa__g_digit_pairs + (n % 100) * 2, 2);
+		n /= 100;
+	}
+	if (n >= 10)
+		__builtin_memcpy(buf, u64toa__g_digit_pairs + n * 2, 2);
+	else
+		buf[0] = '0' + n;
+	return (len);
+}
+
+size_t	ft_i64toa_buf(int64_t n, char *buf)
+{
+	if (n < 0)
+	{
+		buf[0] = '-';
+		return (1 + ft_u64toa_buf(0 - (uint64_t)n, buf + 1));
+	}
+	return (ft_u64toa_buf((uint64_t)n, buf));
+}
+
+size_t	ft_utoa_buf(unsigned int n, char *buf)
+{
+	return (ft_u64toa_buf(n, buf));
+}
+
+size_t	ft_itoa_buf(int n, char *buf)
+{
+	return (ft_i64toa_buf(n, buf));
+}
+
+/* --- ft_u64toa_base.c --- */
+
+
+/**
+ * @brief Power-of-two bases: the digit count comes from the bit length
+ *        and each digit is a mask and a shift.
+ */
+static size_t	u64toa_base__to_pow2(uint64_t n, const char *digits, unsigned int shift,
+		char *buf)
+{
+	size_t		len;
+	size_t		i;
+	uint64_t	mask;
+
+	len = (64 - __builtin_clzll(n | 1) + shift - 1) / shift;
+	mask = ((uint64_t)1 << shift) - 1;
+	buf[len] = '\0';
+	i = len;
+	while (i > 0)
+	{
+		buf[--i] = digits[n & mask];
+		n >>= shift;
+	}
+	return (len);
+}
+
+/**
+ * @brief Other bases: digits are produced backwards into a local buffer
+ *        and copied out once.
+ */
+static size_t	u64toa_base__to_base(uint64_t n, const char *digits, size_t base, char *buf)
+{
+	char	tmp[64];
+	size_t	i;
+
+	i = sizeof(tmp);
+	tmp[--i] = digits[n % base];
+	n /= base;
+	while (n)
+	{
+		tmp[--i] = digits[n % base];
+		n /= base;
+	}
+	ft_memcpy(buf, tmp + i, sizeof(tmp) - i);
+	buf[sizeof(tmp) - i] = '\0';
+	return (sizeof(tmp) - i);
+}
+
+size_t	ft_u64toa_base_buf(uint64_t n, const char *digits, char *buf)
+{
+	size_t	base;
+
+	base = ft_strlen(digits);
+	if (base < 2)
+	{
+		buf[0] = '\0';
+		return (0);
+	}
+	if (base == 10 && !ft_strncmp(digits, "0123456789", 10))
+		return (ft_u64toa_buf(n, buf));
+	if ((base & (base - 1)) == 0)
+		return (u64toa_base__to_pow2(n, digits, __builtin_ctzll(base), buf));
+	return (u64toa_base__to_base(n, digits, base, buf));
+}
+
+
+/* ========================================================================== */
+/*                               ft_put                                       */
+/* ========================================================================== */
+
+/* --- ft_putchar_fd.c --- */
+
+
+void	ft_putchar_fd(char c, int fd)
+{
+	write(fd, &c, 1);
+}
+
+/* --- ft_putendl_fd.c --- */
+
+
+void	ft_putendl_fd(char *s, int fd)
+{
+	ft_putstr_fd(s, fd);
+	ft_putchar_fd('\n', fd);
+}
+
+/* --- ft_putnbr_fd.c --- */
+
+
+void	ft_putnbr_fd(int n, int fd)
+{
+	char	buf[FT_ITOA_BUFSZ];
+
+	write(fd, buf, ft_itoa_buf(n, buf));
+}
+
+/* --- ft_putstr_fd.c --- */
+
+
+void	ft_putstr_fd(char *s, int fd)
+{
+	int	len;
+
+	len = 0;
+	if (!s)
+		return ;
+	while (s[len] != '\0')
+	{
+		write(fd, &s[len], 1);
+		len++;
+	}
+}
+
+
+/* ========================================================================== */
+/*                            ft_printf                                       */
+/* ========================================================================== */
+
+/* --- ft_print_char.c --- */
+
+
+int	ft_print_char(int character)
+{
+	char	to_print;
+
+	to_print = (char)character;
+	if (write(1, &to_print, 1) == -1)
+		return (-1);
+	return (1);
+}
+
+/* --- ft_print_double.c --- */
+
+
+static size_t	print_double__format_double(double x, char spec, int prec, char *buf)
+{
+	if (spec == 'e')
+		return (ft_dtoa_exp(x, prec, buf));
+	if (spec == 'g')
+		return (ft_dtoa_general(x, prec, buf));
+	return (ft_dtoa_fixed(x, prec, buf));
+}
+
+/**
+ * Everyday precisions format on the stack; only a very long one borrows
+ * a heap buffer for the call.
+ */
+int	ft_print_double(double x, char spec, int prec)
+{
+	char	stack[FT_DTOA_BUFSZ + FT_PRINT_DOUBLE_PREC];
+	char	*buf;
+	size_t	size;
+	size_t	len;
+	int		ret;
+
+	buf = stack;
+	size = 0;
+	if (prec > FT_PRINT_DOUBLE_PREC)
+	{
+		size = FT_DTOA_BUFSZ + (size_t)prec;
+		buf = ft_allocator_alloc(NULL, size);
+		if (!buf)
+			return (-1);
+	}
+	len = print_double__format_double(x, spec, prec, buf);
+	ret = (int)len;
+	if (write(1, buf, len) == -1)
+		ret = -1;
+	if (size)
+		ft_allocator_free(NULL, buf, size);
+	return (ret);
+}
+
+/* --- ft_print_hex.c --- */
+
+
+int	ft_print_hex(unsigned int n, int uppercase)
+{
+	char	buf[FT_U64TOA_BASE_BUFSZ];
+	size_t	len;
+
+	if (uppercase == 1)
+		len = ft_u64toa_base_buf(n, "0123456789ABCDEF", buf);
+	else
+		len = ft_u64toa_base_buf(n, "0123456789abcdef", buf);
+	if (write(1, buf, len) == -1)
+		return (-1);
+	return ((int)len);
+}
+
+/* --- ft_print_nbr.c --- */
+
+
+int	ft_print_unsigned(unsigned int number)
+{
+	char	buf[FT_ITOA_BUFSZ];
+	size_t	len;
+
+	len = ft_utoa_buf(number, buf);
+	if (write(1, buf, len) == -1)
+		return (-1);
+	return ((int)len);
+}
+
+int	ft_print_nbr(int number)
+{
+	char	buf[FT_ITOA_BUFSZ];
+	size_t	len;
+
+	len = ft_itoa_buf(number, buf);
+	if (write(1, buf, len) == -1)
+		return (-1);
+	return ((int)len);
+}
+
+/* --- ft_print_ptr.c --- */
+
+
+int	ft_print_ptr(void *ptr)
+{
+	char	buf[FT_U64TOA_BASE_BUFSZ + 2];
+	size_t	len;
+
+	if (!ptr)
+		return (write(1, "(nil)", 5));
+	buf[0] = '0';
+	buf[1] = 'x';
+	len = 2 + ft_u64toa_base_buf((uintptr_t)ptr, "0123456789abcdef", buf + 2);
+	if (write(1, buf, len) == -1)
+		return (-1);
+	return ((int)len);
+}
+
+/* --- ft_print_str.c --- */
+
+
+int	ft_print_str(char *str)
+{
+	int	length;
+
+	if (!str)
+		str = "(null)";
+	length = ft_strlen(str);
+	if (write(1, str, length) == -1)
+		return (-1);
+	return (length);
+}
+
+/* --- ft_printf.c --- */
+
+
+static int	printf__ft_handle_format(va_list *args, char specifier, int prec)
+{
+	if (specifier == 'f' || specifier == 'e' || specifier == 'g')
+		return (ft_print_double(va_arg(*args, double), specifier, prec));
+	if (specifier == 'c')
+		return (ft_print_char(va_arg(*args, int)));
+	else if (specifier == 's')
+		return (ft_print_str(va_arg(*args, char *)));
+	else if (specifier == 'p')
+		return (ft_print_ptr(va_arg(*args, void *)));
+	else if (specifier == 'd' || specifier == 'i')
+		return (ft_print_nbr(va_arg(*args, int)));
+	else if (specifier == 'u')
+		return (ft_print_unsigned(va_arg(*args, unsigned int)));
+	else if (specifier == 'x')
+		return (ft_print_hex(va_arg(*args, unsigned int), 0));
+	else if (specifier == 'X')
+		return (ft_print_hex(va_arg(*args, unsigned int), 1));
+	else if (specifier == '%')
+		return (ft_print_char('%'));
+	return (0);
+}
+
+/**
+ * A ".digits" precision may sit between '%' and the conversion. If the
+ * string ends inside it, format is left on the last byte read so the
+ * caller's step lands on the terminator.
+ */
+static int	printf__ft_print_format(va_list *args, const char **format)
+{
+	int	prec;
+
+	(*format)++;
+	prec = ft_printf_parse_prec(format);
+	if (!**format)
+	{
+		(*format)--;
+		return (0);
+	}
+	return (printf__ft_handle_format(args, **format, prec));
+}
+
+static int	printf__ft_parse_format(va_list *args, const char *format)
+{
+	int	total_len;
+	int	result;
+
+	total_len = 0;
+	while (*format)
+	{
+		if (*format == '%' && *(format + 1))
+		{
+			result = printf__ft_print_format(args, &format);
+			if (result == -1)
+				return (-1);
+			total_len += result;
+		}
+		else if (*format != '%')
+		{
+			if (write(1, format, 1) == -1)
+				return (-1);
+			total_len++;
+		}
+		format++;
+	}
+	return (total_len);
+}
+
+int	ft_printf(const char *format, ...)
+{
+	va_list	args;
+	int		total_len;
+
+	if (!format)
+		return (-1);
+	va_start(args, format);
+	total_len = printf__ft_parse_format(&args, format);
+	va_end(args);
+	return (total_len);
+}
+
+/* --- ft_printf_prec.c --- */
+
+
+/**
+ * @brief Read an optional ".digits" precision and step past it.
+ *
+ * Digits keep being consumed past FT_PRINTF_PREC_MAX, but the value
+ * stops growing there, so no digit string can overflow it.
+ *
+ * @param fmt Cursor on the byte after '%'.
+ * @return The precision (at most FT_PRINTF_PREC_MAX), or -1 if *fmt
+ *         does not start with '.'.
+ */
+int	ft_printf_parse_prec(const char **fmt)
+{
+	int	prec;
+
+	if (**fmt != '.')
+		return (-1);
+	prec = 0;
+	(*fmt)++;
+	while (ft_isdigit(**fmt))
+	{
+		prec = prec * 10 + (**fmt - '0');
+		if (prec > FT_PRINTF_PREC_MAX)
+			prec = FT_PRINTF_PREC_MAX;
+		(*fmt)++;
+	}
+	return (prec);
+}
+
+
+/* ========================================================================== */
+/*                               ft_lst                                       */
+/* ========================================================================== */
+
+/* --- ft_lstadd_back_bonus.c --- */
+
+
+void	ft_lstadd_back(t_list **lst, t_list *new)
+{
+	t_list	*current;
+
+	if (*lst == NULL)
+	{
+		*lst = new;
+		return ;
+	}
+	current = *lst;
+	while (current->next != NULL)
+		current = current->next;
+	current->next = new;
+}
+
+/* --- ft_lstadd_front_bonus.c --- */
+
+
+void	ft_lstadd_front(t_list **lst, t_list *new)
+{
+	if (new == NULL)
+		return ;
+	new->next = *lst;
+	*lst = new;
+}
+
+/* --- ft_lstclear_bonus.c --- */
+
+
+void	ft_lstclear(t_list **lst, void (*del)(void *))
+{
+	t_list	*next_node;
+
+	if (lst == NULL || *lst == NULL)
+		return ;
+	while (*lst != NULL)
+	{
+		next_node = (*lst)->next;
+		ft_lstdelone(*lst, del);
+		*lst = next_node;
+	}
+	*lst = NULL;
+}
+
+/* --- ft_lstdelone_bonus.c --- */
+
+
+void	ft_lstdelone(t_list *lst, void (*del)(void *))
+{
+	if (lst != NULL && del != NULL)
+	{
+		del(lst->content);
+		free(lst);
+	}
+}
+
+/* --- ft_lstiter_bonus.c --- */
+
+
+void	ft_lstiter(t_list *lst, void (*f)(void *))
+{
+	while (lst != NULL && f != NULL)
+	{
+		f(lst->content);
+		lst = lst->next;
+	}
+}
+
+/* --- ft_lstlast_bonus.c --- */
+
+
+t_list	*ft_lstlast(t_list *lst)
+{
+	if (lst == NULL)
+		return (NULL);
+	while (lst->next != NULL)
+		lst = lst->next;
+	return (lst);
+}
+
+/* --- ft_lstmap_bonus.c --- */
+
+
+t_list	*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *))
+{
+	t_list	*new_list;
+	t_list	*new_node;
+	void	*new_content;
+
+	if (!lst || !f || !del)
+		return (NULL);
+	new_list = NULL;
+	while (lst)
+	{
+		new_content = f(lst->content);
+		new_node = ft_lstnew(new_content);
+		if (!new_node)
+		{
+			del(new_content);
+			ft_lstclear(&new_list, del);
+			return (NULL);
+		}
+		ft_lstadd_back(&new_list, new_node);
+		lst = lst->next;
+	}
+	return (new_list);
+}
+
+/* --- ft_lstnew_bonus.c --- */
+
+
+t_list	*ft_lstnew(void *content)
+{
+	t_list	*new_node;
+
+	new_node = (t_list *)malloc(sizeof(t_list));
+	if (new_node == NULL)
+		return (NULL);
+	ft_memstats_note("ft_lstnew", sizeof(t_list));
+	new_node->content = content;
+	new_node->next = NULL;
+	return (new_node);
+}
+
+/* --- ft_lstsize_bonus.c --- */
+
+
+int	ft_lstsize(t_list *lst)
+{
+	int	size;
+
+	size = 0;
+	while (lst != NULL)
+	{
+		size++;
+		lst = lst->next;
+	}
+	return (size);
+}
+
+
+/* ========================================================================== */
+/*                               ft_vec                                       */
+/* ========================================================================== */
+
+/* --- ft_vec_clear.c --- */
+
+
+/**
+ * @brief Reset vector to empty state without freeing memory.
+ *
+ * Sets length to 0, keeping the allocated capacity intact.
+ * Useful for reusing a vector without reallocation overhead.
+ *
+ * @param vec Pointer to the vector (can be NULL).
+ */
+void	ft_vec_clear(t_vec *vec)
+{
+	if (!vec)
+		return ;
+	vec->len = 0;
+}
+
+/* --- ft_vec_free.c --- */
+
+
+/**
+ * @brief Free all memory associated with the vector.
+ *
+ * Frees both the internal data buffer and the vector struct itself.
+ * Safe to call with NULL. Does not free heap-allocated elements
+ * stored within the vector (user responsibility). Memory goes back
+ * through the vector's allocator (a no-op for arenas).
+ *
+ * @param vec Pointer to the vector to free (can be NULL).
+ */
+void	ft_vec_free(t_vec *vec)
+{
+	t_allocator	alloc;
+
+	if (!vec)
+		return ;
+	alloc = vec->alloc;
+	ft_memstats_alloc(&alloc, "ft_vec_free",
+		sizeof(t_vec) + vec->cap * vec->elem_size, 0);
+	ft_allocator_free(&alloc, vec->data, vec->cap * vec->elem_size);
+	ft_allocator_free(&alloc, vec, sizeof(t_vec));
+}
+
+/* --- ft_vec_get.c --- */
+
+
+/**
+ * @brief Get a pointer to the element at the specified index.
+ *
+ * Performs bounds checking and returns NULL if index is out of range.
+ * The returned pointer is valid until the next push or reserve operation.
+ *
+ * @param vec Pointer to the vector.
+ * @param index Zero-based index of the element.
+ * @return Pointer to the element, or NULL if out of bounds.
+ */
+void	*ft_vec_get(t_vec *vec, size_t index)
+{
+	if (!vec || index >= vec->len)
+		return (NULL);
+	return ((char *)vec->data + (index * vec->elem_size));
+}
+
+/* --- ft_vec_insert.c --- */
+
+
+/**
+ * @brief Shift elements right starting from index.
+ *
+ * Moves elements from index to len-1 one position to the right.
+ * Uses memmove to handle overlapping regions safely.
+ *
+ * @param vec Pointer to the vector.
+ * @param index Starting index for the shift.
+ */
+static void	vec_insert__ft_vec_shift_right(t_vec *vec, size_t index)
+{
+	void	*src;
+	void	*dst;
+	size_t	bytes;
+
+	src = (char *)vec->data + (index * vec->elem_size);
+	dst = (char *)vec->data + ((index + 1) * vec->elem_size);
+	bytes = (vec->len - index) * vec->elem_size;
+	ft_memmove(dst, src, bytes);
+}
+
+/**
+ * @brief Insert an element at the specified index.
+ *
+ * Shifts existing elements to the right and inserts the new element.
+ * Index must be <= len (insert at len is equivalent to push).
+ * Grows capacity automatically if needed.
+ *
+ * @param vec Pointer to the vector.
+ * @param index Position to insert at (0 to len).
+ * @param elem Pointer to the element to insert.
+ * @return 1 on success, 0 on failure or invalid index.
+ */
+int	ft_vec_insert(t_vec *vec, size_t index, const void *elem)
+{
+	void	*dst;
+
+	if (!vec || !elem || index > vec->len)
+		return (0);
+	if (vec->len == vec->cap)
+	{
+		if (!ft_vec_reserve(vec, vec->cap + vec->cap / 2 + 1))
+			return (0);
+	}
+	if (index < vec->len)
+		vec_insert__ft_vec_shift_right(vec, index);
+	dst = (char *)vec->data + (index * vec->elem_size);
+	ft_memcpy(dst, elem, vec->elem_size);
+	vec->len++;
+	return (1);
+}
+
+/* --- ft_vec_new.c --- */
+
+
+/**
+ * @brief Create a new dynamic array (vector).
+ *
+ * Allocates and initializes a new vector with the specified element size
+ * and initial capacity. If init_cap is 0, defaults to 8 elements.
+ *
+ * @param elem_size Size of each element in bytes (must be > 0).
+ * @param init_cap Initial capacity (0 for default of 8).
+ * @return Pointer to newly allocated t_vec, or NULL on failure.
+ */
+t_vec	*ft_vec_new(size_t elem_size, size_t init_cap)
+{
+	return (ft_vec_new_with_alloc(elem_size, init_cap, NULL));
+}
+
+/**
+ * @brief Create a new vector that allocates through alloc.
+ *
+ * The allocator is copied into the vector; the struct, the data buffer
+ * and every later regrowth go through it, and ft_vec_free hands them
+ * back to it.
+ *
+ * @param elem_size Size of each element in bytes (must be > 0).
+ * @param init_cap Initial capacity (0 for default of 8).
+ * @param alloc Allocator to use (NULL for the heap).
+ * @return Pointer to newly allocated t_vec, or NULL on failure.
+ */
+t_vec	*ft_vec_new_with_alloc(size_t elem_size, size_t init_cap,
+		const t_allocator *alloc)
+{
+	t_vec	*vec;
+
+	if (elem_size == 0)
+		return (NULL);
+	vec = ft_allocator_calloc(alloc, 1, sizeof(t_vec));
+	if (!vec)
+		return (NULL);
+	if (alloc)
+		vec->alloc = *alloc;
+	if (init_cap == 0)
+		init_cap = 8;
+	vec->data = ft_allocator_calloc(alloc, init_cap, elem_size);
+	if (!vec->data)
+		return (ft_allocator_free(alloc, vec, sizeof(t_vec)), NULL);
+	vec->elem_size = elem_size;
+	vec->cap = init_cap;
+	vec->len = 0;
+	ft_memstats_alloc(alloc, "ft_vec_new", 0,
+		sizeof(t_vec) + init_cap * elem_size);
+	return (vec);
+}
+
+/**
+ * @brief Create a vector that lives entirely in an arena.
+ *
+ * Shorthand for ft_vec_new_with_alloc with ft_allocator_arena(arena):
+ * ft_vec_free on it is a no-op and the memory is released with the
+ * arena.
+ *
+ * @param arena Arena to allocate from.
+ * @param elem_size Size of each element in bytes (must be > 0).
+ * @param init_cap Initial capacity (0 for default of 8).
+ * @return Pointer to arena-owned t_vec, or NULL on failure.
+ */
+t_vec	*ft_arena_vec_new(t_arena *arena, size_t elem_size, size_t init_cap)
+{
+	t_allocator	alloc;
+
+	alloc = ft_allocator_arena(arena);
+	return (ft_vec_new_with_alloc(elem_size, init_cap, &alloc));
+}
+
+/* --- ft_vec_pop.c --- */
+
+
+/**
+ * @brief Remove and optionally retrieve the last element.
+ *
+ * Decrements the vector length. If out is not NULL, copies the
+ * removed element to the provided buffer before removal.
+ *
+ * @param vec Pointer to the vector.
+ * @param out Buffer to receive the popped element (can be NULL).
+ * @return 1 on success, 0 if vec is NULL or empty.
+ */
+int	ft_vec_pop(t_vec *vec, void *out)
+{
+	void	*src;
+
+	if (!vec || vec->len == 0)
+		return (0);
+	vec->len--;
+	if (out)
+	{
+		src = (char *)vec->data + (vec->len * vec->elem_size);
+		ft_memcpy(out, src, vec->elem_size);
+	}
+	return (1);
+}
+
+/* --- ft_vec_push.c --- */
+
+
+/**
+ * @brief Calculate the next capacity for vector growth.
+ *
+ * Uses 1.5x growth factor for memory efficiency.
+ * Returns 0 if overflow would occur.
+ *
+ * @param cap Current capacity.
+ * @return New capacity, or 0 on overflow.
+ */
+static size_t	vec_push__ft_vec_next_cap(size_t cap)
+{
+	size_t	new_cap;
+
+	if (cap == 0)
+		return (8);
+	if (cap > SIZE_MAX / 2)
+		return (0);
+	new_cap = cap + cap / 2;
+	if (new_cap <= cap)
+		new_cap = cap + 1;
+	return (new_cap);
+}
+
+/**
+ * @brief Grow the vector's capacity by 1.5x.
+ *
+ * Called internally when push would exceed current capacity.
+ * Delegates to ft_vec_reserve for the actual reallocation.
+ *
+ * @param vec Pointer to the vector.
+ * @return 1 on success, 0 on allocation failure or overflow.
+ */
+static int	vec_push__ft_vec_grow(t_vec *vec)
+{
+	size_t	new_cap;
+
+	new_cap = vec_push__ft_vec_next_cap(vec->cap);
+	if (new_cap == 0)
+		return (0);
+	return (ft_vec_reserve(vec, new_cap));
+}
+
+/**
+ * @brief Append an element to the end of the vector.
+ *
+ * Copies elem_size bytes from elem to the end of the vector.
+ * Automatically grows capacity if needed (1.5x growth factor).
+ *
+ * @param vec Pointer to the vector.
+ * @param elem Pointer to the element to copy.
+ * @return 1 on success, 0 on failure or NULL params.
+ */
+int	ft_vec_push(t_vec *vec, const void *elem)
+{
+	void	*dst;
+
+	if (!vec || !elem)
+		return (0);
+	if (vec->len == vec->cap)
+	{
+		if (!vec_push__ft_vec_grow(vec))
+			return (0);
+	}
+	dst = (char *)vec->data + (vec->len * vec->elem_size);
+	ft_memcpy(dst, elem, vec->elem_size);
+	vec->len++;
+	return (1);
+}
+
+/* --- ft_vec_reserve.c --- */
 
 
-int	ft_memcmp(const void *s1, const void *s2, size_t n)
+/**
+ * @brief Ensure vector has at least the specified capacity.
+ *
+ * If new_cap is greater than current capacity, reallocates the
+ * internal buffer. Existing elements are preserved. Does nothing
+ * if new_cap <= current capacity. The buffer is resized through the
+ * vector's allocator and the new slots are zeroed.
+ *
+ * @param vec Pointer to the vector.
+ * @param new_cap Minimum required capacity.
+ * @return 1 on success, 0 on allocation failure or overflow.
+ */
+int	ft_vec_reserve(t_vec *vec, size_t new_cap)
 {
-	const unsigned char	*p1;
-	const unsigned char	*p2;
-	size_t				i;
+	void	*new_data;
 
-	p1 = (const unsigned char *)s1;
-	p2 = (const unsigned char *)s2;
-	i = 0;
-	while (i < n)
-	{
-		if (p1[i] != p2[i])
-			return (p1[i] - p2[i]);
-		i++;
-	}
-	return (0);
+	if (!vec)
+		return (0);
+	if (new_cap <= vec->cap)
+		return (1);
+	if (new_cap > SIZE_MAX / vec->elem_size)
+		return (0);
+	new_data = ft_allocator_realloc(&vec->alloc, vec->data,
+			vec->cap * vec->elem_size, new_cap * vec->elem_size);
+	if (!new_data)
+		return (0);
+	ft_memstats_alloc(&vec->alloc, "ft_vec_reserve",
+		vec->cap * vec->elem_size, new_cap * vec->elem_size);
+	ft_bzero((char *)new_data + vec->len * vec->elem_size,
+		(new_cap - vec->len) * vec->elem_size);
+	vec->data = new_data;
+	vec->cap = new_cap;
+	return (1);
 }
 
-/* --- ft_memcpy.c --- */
+/* --- ft_vec_set.c --- */
 
 
-void	*ft_memcpy(void *dest, const void *src, size_t n)
+/**
+ * @brief Set the value of an element at the specified index.
+ *
+ * Copies elem_size bytes from elem to the element at index.
+ * Index must be within current length (cannot extend vector).
+ *
+ * @param vec Pointer to the vector.
+ * @param index Zero-based index of the element to set.
+ * @param elem Pointer to the source data.
+ * @return 1 on success, 0 if out of bounds or NULL params.
+ */
+int	ft_vec_set(t_vec *vec, size_t index, const void *elem)
 {
-	const unsigned char	*s;
-	unsigned char		*d;
+	void	*dst;
 
-	if (!src && !dest)
-		return (NULL);
-	d = (unsigned char *)dest;
-	s = (const unsigned char *)src;
-	while (n--)
-		*d++ = *s++;
-	return (dest);
+	if (!vec || !elem || index >= vec->len)
+		return (0);
+	dst = (char *)vec->data + (index * vec->elem_size);
+	ft_memcpy(dst, elem, vec->elem_size);
+	return (1);
 }
 
-/* --- ft_memmove.c --- */
+/* --- ft_vec_swap.c --- */
 
 
-void	*ft_memmove(void *dst, const void *src, size_t len)
+/**
+ * @brief Swap two elements of the vector in place.
+ *
+ * The elements are exchanged with ft_memswap, in registers, so even very
+ * large elements need no temporary buffer. Swapping an element with
+ * itself is a no-op.
+ *
+ * @param vec Pointer to the vector.
+ * @param i Zero-based index of the first element.
+ * @param j Zero-based index of the second element.
+ * @return 1 on success, 0 if out of bounds or NULL vec.
+ */
+int	ft_vec_swap(t_vec *vec, size_t i, size_t j)
 {
-	const unsigned char	*s;
-	unsigned char		*d;
+	if (!vec || i >= vec->len || j >= vec->len)
+		return (0);
+	ft_memswap((char *)vec->data + i * vec->elem_size,
+		(char *)vec->data + j * vec->elem_size, vec->elem_size);
+	return (1);
+}
 
-	if (!src && !dst && len != 0)
+
+/* ========================================================================== */
+/*                             ft_deque                                       */
+/* ========================================================================== */
+
+/* --- ft_deque_access.c --- */
+
+
+void	*ft_deque_front(t_deque *d)
+{
+	if (!d || d->len == 0)
 		return (NULL);
-	d = (unsigned char *)dst;
-	s = (const unsigned char *)src;
-	if (dst < src)
-	{
-		while (len--)
-			*d++ = *s++;
-	}
-	else
-	{
-		d += len;
-		s += len;
-		while (len--)
-			*--d = *--s;
-	}
-	return (dst);
+	return ((char *)d->data + (d->head * d->elem_size));
 }
 
-/* --- ft_memset.c --- */
+void	*ft_deque_back(t_deque *d)
+{
+	size_t	back_idx;
 
+	if (!d || d->len == 0)
+		return (NULL);
+	back_idx = (d->tail - 1 + d->cap) % d->cap;
+	return ((char *)d->data + (back_idx * d->elem_size));
+}
 
-void	*ft_memset(void *b, int v, size_t len)
+void	*ft_deque_get(t_deque *d, size_t index)
 {
-	unsigned char	*ptr;
+	size_t	phys_idx;
 
-	ptr = (unsigned char *)b;
-	while (len--)
-		*ptr++ = (unsigned char)v;
-	return (b);
+	if (!d || index >= d->len)
+		return (NULL);
+	phys_idx = (d->head + index) % d->cap;
+	return ((char *)d->data + (phys_idx * d->elem_size));
 }
 
+/* --- ft_deque_new.c --- */
 
-/* ========================================================================== */
-/*                               ft_str                                       */
-/* ========================================================================== */
 
-/* --- ft_atoi.c --- */
+t_deque	*ft_deque_new(size_t elem_size, size_t init_cap)
+{
+	return (ft_deque_new_with_alloc(elem_size, init_cap, NULL));
+}
+
+t_deque	*ft_deque_new_with_alloc(size_t elem_size, size_t init_cap,
+		const t_allocator *alloc)
+{
+	t_deque	*d;
 
+	if (elem_size == 0)
+		return (NULL);
+	d = ft_allocator_calloc(alloc, 1, sizeof(t_deque));
+	if (!d)
+		return (NULL);
+	if (alloc)
+		d->alloc = *alloc;
+	if (init_cap == 0)
+		init_cap = 8;
+	d->data = ft_allocator_calloc(alloc, init_cap, elem_size);
+	if (!d->data)
+		return (ft_allocator_free(alloc, d, sizeof(t_deque)), NULL);
+	d->elem_size = elem_size;
+	d->cap = init_cap;
+	d->head = 0;
+	d->tail = 0;
+	d->len = 0;
+	ft_memstats_alloc(alloc, "ft_deque_new", 0,
+		sizeof(t_deque) + init_cap * elem_size);
+	return (d);
+}
 
-static int	ft_isspace(int c)
+void	ft_deque_clear(t_deque *d)
 {
-	return (c == ' ' || (c >= 9 && c <= 13));
+	if (!d)
+		return ;
+	d->head = 0;
+	d->tail = 0;
+	d->len = 0;
 }
 
-int	ft_atoi(const char *str)
+/* --- ft_deque_pop.c --- */
+
+
+int	ft_deque_pop_front(t_deque *d, void *out)
 {
-	int	sign;
-	int	result;
+	void	*src;
 
-	while (ft_isspace(*str))
-		str++;
-	sign = 1;
-	if (*str == '-' || *str == '+')
+	if (!d || d->len == 0)
+		return (0);
+	if (out)
 	{
-		if (*str == '-')
-			sign = -1;
-		str++;
+		src = (char *)d->data + (d->head * d->elem_size);
+		ft_memcpy(out, src, d->elem_size);
 	}
-	result = 0;
-	while (ft_isdigit(*str))
+	d->head = (d->head + 1) % d->cap;
+	d->len--;
+	return (1);
+}
+
+int	ft_deque_pop_back(t_deque *d, void *out)
+{
+	void	*src;
+
+	if (!d || d->len == 0)
+		return (0);
+	d->tail = (d->tail - 1 + d->cap) % d->cap;
+	if (out)
 	{
-		result = result * 10 + (*str - '0');
-		str++;
+		src = (char *)d->data + (d->tail * d->elem_size);
+		ft_memcpy(out, src, d->elem_size);
 	}
-	return ((int)(sign * result));
+	d->len--;
+	return (1);
 }
 
-/* --- ft_itoa.c --- */
+/* --- ft_deque_push.c --- */
 
 
-static int	ft_numlen(long n)
+static void	deque_push__copy_linearized(t_deque *d, void *new_data)
 {
-	int	len;
+	size_t	i;
+	void	*src;
+	void	*dst;
 
-	len = 0;
-	if (n <= 0)
-	{
-		len++;
-		n = -n;
-	}
-	while (n > 0)
+	i = 0;
+	while (i < d->len)
 	{
-		n /= 10;
-		len++;
+		src = (char *)d->data + (((d->head + i) % d->cap) * d->elem_size);
+		dst = (char *)new_data + (i * d->elem_size);
+		ft_memcpy(dst, src, d->elem_size);
+		i++;
 	}
-	return (len);
 }
 
-char	*ft_itoa(int n)
+static int	deque_push__ft_deque_grow(t_deque *d)
 {
-	char	*str;
-	int		len;
-	long	nbr;
+	void	*new_data;
+	size_t	new_cap;
 
-	nbr = n;
-	len = ft_numlen(n);
-	str = malloc(sizeof(char) * (len + 1));
-	if (!str)
-		return (NULL);
-	str[len--] = '\0';
-	if (nbr == 0)
-		str[0] = '0';
-	if (nbr < 0)
+	new_cap = d->cap * 2;
+	if (new_cap < d->cap)
+		return (0);
+	new_data = ft_allocator_calloc(&d->alloc, new_cap, d->elem_size);
+	if (!new_data)
+		return (0);
+	deque_push__copy_linearized(d, new_data);
+	ft_memstats_alloc(&d->alloc, "deque_push__ft_deque_grow", d->cap * d->elem_size,
+		new_cap * d->elem_size);
+	ft_allocator_free(&d->alloc, d->data, d->cap * d->elem_size);
+	d->data = new_data;
+	d->cap = new_cap;
+	d->head = 0;
+	d->tail = d->len;
+	return (1);
+}
+
+int	ft_deque_push_front(t_deque *d, const void *elem)
+{
+	void	*dst;
+
+	if (!d || !elem)
+		return (0);
+	if (d->len == d->cap)
 	{
-		str[0] = '-';
-		nbr = -nbr;
+		if (!deque_push__ft_deque_grow(d))
+			return (0);
 	}
-	while (nbr > 0)
+	d->head = (d->head - 1 + d->cap) % d->cap;
+	dst = (char *)d->data + (d->head * d->elem_size);
+	ft_memcpy(dst, elem, d->elem_size);
+	d->len++;
+	return (1);
+}
+
+int	ft_deque_push_back(t_deque *d, const void *elem)
+{
+	void	*dst;
+
+	if (!d || !elem)
+		return (0);
+	if (d->len == d->cap)
 	{
-		str[len--] = (nbr % 10) + '0';
-		nbr /= 10;
+		if (!deque_push__ft_deque_grow(d))
+			return (0);
 	}
-	return (str);
+	dst = (char *)d->data + (d->tail * d->elem_size);
+	ft_memcpy(dst, elem, d->elem_size);
+	d->tail = (d->tail + 1) % d->cap;
+	d->len++;
+	return (1);
+}
+
+/* --- ft_deque_swap.c --- */
+
+
+void	ft_deque_swap(t_deque *d)
+{
+	if (!d || d->len < 2)
+		return ;
+	ft_memswap(ft_deque_get(d, 0), ft_deque_get(d, 1), d->elem_size);
 }
 
-/* --- ft_split.c --- */
+/* --- ft_deque_utils.c --- */
 
 
-static int	split__count_words(char const *s, char c)
+void	ft_deque_free(t_deque *d)
 {
-	int	count;
-	int	i;
+	t_allocator	alloc;
 
-	count = 0;
-	i = 0;
-	while (s[i])
-	{
-		while (s[i] == c)
-			i++;
-		if (s[i])
-			count++;
-		while (s[i] && s[i] != c)
-			i++;
-	}
-	return (count);
+	if (!d)
+		return ;
+	alloc = d->alloc;
+	ft_memstats_alloc(&alloc, "ft_deque_free",
+		sizeof(t_deque) + d->cap * d->elem_size, 0);
+	ft_allocator_free(&alloc, d->data, d->cap * d->elem_size);
+	ft_allocator_free(&alloc, d, sizeof(t_deque));
 }
 
-static char	*word_dup(char const *s, int start, int end)
+int	ft_deque_is_empty(t_deque *d)
 {
-	char	*word;
-	int		i;
+	if (!d)
+		return (1);
+	return (d->len == 0);
+}
 
-	word = malloc((end - start + 1) * sizeof(char));
-	if (!word)
-		return (NULL);
-	i = 0;
-	while (start < end)
-		word[i++] = s[start++];
-	word[i] = '\0';
-	return (word);
+int	ft_deque_is_full(t_deque *d)
+{
+	if (!d)
+		return (0);
+	return (d->len == d->cap);
 }
 
-static void	*free_split(char **split, int size)
+void	ft_deque_rotate(t_deque *d)
 {
-	int	i;
+	void	*first;
+	void	*back;
 
-	i = 0;
-	while (i < size)
-	{
-		free(split[i]);
-		i++;
-	}
-	free(split);
-	return (NULL);
+	if (!d || d->len <= 1)
+		return ;
+	first = (char *)d->data + (d->head * d->elem_size);
+	back = (char *)d->data + (d->tail * d->elem_size);
+	ft_memcpy(back, first, d->elem_size);
+	d->head = (d->head + 1) % d->cap;
+	d->tail = (d->tail + 1) % d->cap;
 }
 
-char	**ft_split(char const *s, char c)
+void	ft_deque_rrotate(t_deque *d)
 {
-	char	**split;
-	int		i;
-	int		j;
-	int		start;
+	void	*last;
+	void	*front;
+	size_t	last_idx;
 
-	if (!s)
-		return (NULL);
-	split = malloc((split__count_words(s, c) + 1) * sizeof(char *));
-	if (!split)
-		return (NULL);
-	i = 0;
-	j = 0;
-	while (j < split__count_words(s, c))
-	{
-		while (s[i] == c)
-			i++;
-		start = i;
-		while (s[i] && s[i] != c)
-			i++;
-		split[j] = word_dup(s, start, i);
-		if (!split[j++])
-			return (free_split(split, j - 1));
-	}
-	split[j] = NULL;
-	return (split);
+	if (!d || d->len <= 1)
+		return ;
+	last_idx = (d->tail - 1 + d->cap) % d->cap;
+	last = (char *)d->data + (last_idx * d->elem_size);
+	d->head = (d->head - 1 + d->cap) % d->cap;
+	d->tail = (d->tail - 1 + d->cap) % d->cap;
+	front = (char *)d->data + (d->head * d->elem_size);
+	ft_memcpy(front, last, d->elem_size);
 }
 
-/* --- ft_strchr.c --- */
 
-char	*ft_strchr(const char *s, int c)
-{
-	char	ch;
+/* ========================================================================== */
+/*                           ft_hashmap                                       */
+/* ========================================================================== */
 
-	ch = (unsigned char)c;
-	while (*s != '\0')
-	{
-		if (*s == ch)
-			return ((char *)s);
-		s++;
-	}
-	if (ch == '\0')
-		return ((char *)s);
-	return (NULL);
-}
+/* --- ft_hashmap_alloc.c --- */
 
-/* --- ft_strcmp.c --- */
 
-int	ft_strcmp(const char *s1, const char *s2)
+t_vec	**ft_hashmap_buckets_new(t_hashmap *map, size_t cap)
 {
-	while (*s1 && (*s1 == *s2))
-	{
-		s1++;
-		s2++;
-	}
-	return (*(const unsigned char *)s1 - *(const unsigned char *)s2);
+	return (ft_allocator_calloc(&map->alloc, cap, sizeof(t_vec *)));
 }
 
-/* --- ft_strdup.c --- */
-
+void	ft_hashmap_buckets_free(t_hashmap *map, t_vec **buckets, size_t cap)
+{
+	ft_allocator_free(&map->alloc, buckets, cap * sizeof(t_vec *));
+}
 
-char	*ft_strdup(const char *s)
+char	*ft_hashmap_key_dup(t_hashmap *map, const char *key)
 {
-	int		len;
 	char	*dup;
-	char	*temp;
+	size_t	len;
 
-	len = 0;
-	while (s[len])
-		len++;
-	dup = malloc(len + 1);
+	if (map->keys)
+		return ((char *)key);
+	len = ft_strlen(key);
+	dup = ft_allocator_alloc(&map->alloc, len + 1);
 	if (!dup)
 		return (NULL);
-	temp = dup;
-	while (*s)
-		*temp++ = *s++;
-	*temp = '\0';
+	ft_memcpy(dup, key, len + 1);
+	ft_memstats_alloc(&map->alloc, "ft_hashmap_key", 0, len + 1);
 	return (dup);
 }
 
-/* --- ft_striteri.c --- */
-
-
-void	ft_striteri(char *s, void (*f)(unsigned int, char *))
+void	ft_hashmap_key_free(t_hashmap *map, char *key)
 {
-	unsigned int	i;
+	size_t	size;
 
-	i = 0;
-	if (s == NULL || f == NULL)
+	if (!key || map->keys)
 		return ;
-	while (s[i] != '\0')
-	{
-		f(i, &s[i]);
-		i++;
-	}
+	size = ft_strlen(key) + 1;
+	ft_memstats_alloc(&map->alloc, "ft_hashmap_key", size, 0);
+	ft_allocator_free(&map->alloc, key, size);
 }
 
-/* --- ft_strjoin.c --- */
+/* --- ft_hashmap_bucket.c --- */
 
 
-char	*ft_strjoin(char const *s1, char const *s2)
+/**
+ * @brief Carve a bucket from the map's pool.
+ *
+ * The t_vec header and FT_HASHMAP_BUCKET_INLINE entries share the pool
+ * object: data points right behind the header.
+ */
+static t_vec	*hashmap_bucket__pooled_bucket_new(t_pool *pool)
 {
-	size_t	i;
-	size_t	j;
-	char	*str;
+	t_vec	*bucket;
 
-	i = ft_strlen(s1) + ft_strlen(s2) + 1;
-	str = (char *)malloc(sizeof(char) * i);
-	if (!str)
+	bucket = ft_pool_alloc(pool);
+	if (!bucket)
 		return (NULL);
-	i = 0;
-	j = 0;
-	if (s1)
-		while (s1[j])
-			str[i++] = s1[j++];
-	j = 0;
-	if (s2)
-		while (s2[j])
-			str[i++] = s2[j++];
-	str[i] = '\0';
-	return (str);
+	ft_bzero(bucket, sizeof(t_vec));
+	bucket->data = bucket + 1;
+	bucket->cap = FT_HASHMAP_BUCKET_INLINE;
+	bucket->elem_size = sizeof(t_hashmap_entry);
+	return (bucket);
 }
 
-/* --- ft_strlcat.c --- */
-
-
-size_t	ft_strlcat(char *dst, const char *src, size_t dstsize)
+t_vec	*ft_hashmap_bucket_new(t_hashmap *map)
 {
-	size_t	dlen;
-	size_t	slen;
-	size_t	i;
-
-	if (!dst && dstsize == 0)
-		return (ft_strlen(src));
-	dlen = ft_strlen(dst);
-	slen = ft_strlen(src);
-	if (dstsize <= dlen)
-		return (dstsize + slen);
-	i = 0;
-	while (src[i] && dlen + i < dstsize - 1)
-	{
-		dst[dlen + i] = src[i];
-		i++;
-	}
-	dst[dlen + i] = '\0';
-	return (dlen + slen);
+	if (map->pool)
+		return (hashmap_bucket__pooled_bucket_new(map->pool));
+	return (ft_vec_new_with_alloc(sizeof(t_hashmap_entry), 4, &map->alloc));
 }
 
-/* --- ft_strlcpy.c --- */
-
-
-size_t	ft_strlcpy(char *dst, const char *src, size_t destsize)
+/**
+ * @brief Append an entry to a bucket.
+ *
+ * A pooled bucket that outgrows its inline entries moves them to a heap
+ * buffer first; from then on it grows like any heap vector.
+ */
+int	ft_hashmap_bucket_push(t_hashmap *map, t_vec *bucket,
+		t_hashmap_entry *entry)
 {
-	size_t	i;
-	size_t	res;
+	void	*data;
 
-	i = 0;
-	res = 0;
-	while (src[res])
-		res++;
-	if (destsize < 1)
-		return (res);
-	while (src[i] && i < destsize - 1)
+	if (map->pool && bucket->data == (void *)(bucket + 1)
+		&& bucket->len == bucket->cap)
 	{
-		dst[i] = src[i];
-		i++;
+		data = ft_allocator_calloc(NULL, bucket->cap * 2, bucket->elem_size);
+		if (!data)
+			return (0);
+		ft_memstats_record("ft_hashmap_bucket", 0,
+			bucket->cap * 2 * bucket->elem_size);
+		ft_memcpy(data, bucket->data, bucket->len * bucket->elem_size);
+		bucket->data = data;
+		bucket->cap *= 2;
 	}
-	dst[i] = '\0';
-	return (res);
+	return (ft_vec_push(bucket, entry));
 }
 
-/* --- ft_strlen.c --- */
-
-
-size_t	ft_strlen(const char *s)
+void	ft_hashmap_bucket_free(t_hashmap *map, t_vec *bucket)
 {
-	size_t	i;
-
-	i = 0;
-	while (s[i])
-		i++;
-	return (i);
+	if (!map->pool)
+	{
+		ft_vec_free(bucket);
+		return ;
+	}
+	if (bucket->data != (void *)(bucket + 1))
+	{
+		ft_memstats_record("ft_hashmap_bucket",
+			bucket->cap * bucket->elem_size, 0);
+		free(bucket->data);
+	}
+	ft_pool_release(map->pool, bucket);
 }
 
-/* --- ft_strmapi.c --- */
+/* --- ft_hashmap_free.c --- */
 
 
-char	*ft_strmapi(char const *s, char (*f)(unsigned int, char))
+/**
+ * @brief Free a single bucket and all its entries.
+ *
+ * Iterates through all entries in the bucket, freeing keys and
+ * calling the del function on values if provided.
+ *
+ * @param map Hashmap owning the bucket.
+ * @param bucket The bucket vector to free.
+ */
+static void	hashmap_free__free_bucket(t_hashmap *map, t_vec *bucket)
 {
-	char			*str_new;
-	size_t			s_len;
-	unsigned int	i;
+	size_t			i;
+	t_hashmap_entry	*entry;
 
-	if (s == NULL || f == NULL)
-		return (NULL);
-	s_len = ft_strlen(s);
-	str_new = (char *)malloc(sizeof(char) * (s_len + 1));
-	if (str_new == NULL)
-		return (NULL);
+	if (!bucket)
+		return ;
 	i = 0;
-	while (i < s_len)
+	while (i < bucket->len)
 	{
-		str_new[i] = f(i, s[i]);
+		entry = ft_vec_get(bucket, i);
+		ft_hashmap_key_free(map, entry->key);
+		if (map->del && entry->value)
+			map->del(entry->value);
 		i++;
 	}
-	str_new[i] = '\0';
-	return (str_new);
+	ft_hashmap_bucket_free(map, bucket);
 }
 
-/* --- ft_strncmp.c --- */
-
-
-int	ft_strncmp(const char *s1, const char *s2, size_t n)
+/**
+ * @brief Remove all entries without freeing the hashmap.
+ *
+ * Frees all buckets and their entries, then resets the bucket
+ * array to all NULLs. The hashmap can be reused after clearing.
+ *
+ * @param map Hashmap to clear. Safe to call with NULL.
+ */
+void	ft_hashmap_clear(t_hashmap *map)
 {
-	unsigned char	c1;
-	unsigned char	c2;
-	unsigned char	i;
+	size_t	i;
 
+	if (!map)
+		return ;
 	i = 0;
-	while (i < n && s1[i] && s1[i] == s2[i])
+	while (i < map->cap)
+	{
+		hashmap_free__free_bucket(map, map->buckets[i]);
+		map->buckets[i] = NULL;
 		i++;
-	if (i == n)
-		return (0);
-	c1 = (unsigned char)s1[i];
-	c2 = (unsigned char)s2[i];
-	return ((c1 > c2) - (c1 < c2));
+	}
+	map->size = 0;
 }
 
-/* --- ft_strnstr.c --- */
-
-
-char	*ft_strnstr(const char *haystack, const char *needle, size_t len)
+/**
+ * @brief Free a hashmap and all its contents.
+ *
+ * Frees all entries, all buckets, the bucket array, and the
+ * hashmap struct itself. Safe to call with NULL.
+ *
+ * @param map Hashmap to free.
+ */
+void	ft_hashmap_free(t_hashmap *map)
 {
-	size_t	i;
-	size_t	j;
+	t_allocator	alloc;
 
-	if (*needle == '\0')
-		return ((char *)haystack);
-	i = 0;
-	while (haystack[i] && i < len)
-	{
-		j = 0;
-		while (i + j < len && haystack[i + j] == needle[j] && needle[j])
-			j++;
-		if (needle[j] == '\0')
-			return ((char *)(haystack + i));
-		i++;
-	}
-	return (NULL);
+	if (!map)
+		return ;
+	ft_hashmap_clear(map);
+	alloc = map->alloc;
+	ft_memstats_alloc(&alloc, "ft_hashmap_free",
+		sizeof(t_hashmap) + map->cap * sizeof(t_vec *), 0);
+	ft_allocator_free(&alloc, map->buckets, map->cap * sizeof(t_vec *));
+	ft_allocator_free(&alloc, map, sizeof(t_hashmap));
 }
 
-/* --- ft_strrchr.c --- */
+/* --- ft_hashmap_grow.c --- */
 
 
-char	*ft_strrchr(const char *str, int c)
+/**
+ * @brief djb2 of key, or the hash cached in front of an interned key.
+ */
+size_t	ft_hashmap_hash(const t_hashmap *map, const char *key)
 {
-	const char	*last_occurrence;
-
-	last_occurrence = NULL;
-	while (*str != '\0')
+	size_t			hash;
+	unsigned char	*str;
+
+	if (map->keys)
+		return (ft_strpool_hash(key));
+	hash = 5381;
+	str = (unsigned char *)key;
+	while (*str)
 	{
-		if (*str == (char)c)
-			last_occurrence = str;
+		hash = ((hash << 5) + hash) + *str;
 		str++;
 	}
-	if ((char)c == '\0')
-		return ((char *)str);
-	return ((char *)last_occurrence);
+	return (hash);
 }
 
-/* --- ft_strtrim.c --- */
+static int	hashmap_grow__rehash_insert(t_hashmap *map, t_vec **buckets, size_t cap,
+		t_hashmap_entry *entry)
+{
+	size_t	idx;
 
+	idx = ft_hashmap_hash(map, entry->key) % cap;
+	if (!buckets[idx])
+		buckets[idx] = ft_hashmap_bucket_new(map);
+	if (!buckets[idx])
+		return (0);
+	return (ft_hashmap_bucket_push(map, buckets[idx], entry));
+}
 
-static int	ft_checkset(char c, const char *set)
+static int	hashmap_grow__rehash_all(t_hashmap *map, t_vec **new_b, size_t new_cap)
 {
-	while (*set)
+	size_t			i;
+	size_t			j;
+	t_vec			**old_b;
+	t_hashmap_entry	*entry;
+
+	old_b = map->buckets;
+	i = 0;
+	while (i < map->cap)
 	{
-		if (c == *set)
-			return (1);
-		set++;
+		if (old_b[i])
+		{
+			j = 0;
+			while (j < old_b[i]->len)
+			{
+				entry = ft_vec_get(old_b[i], j);
+				if (!hashmap_grow__rehash_insert(map, new_b, new_cap, entry))
+					return (0);
+				j++;
+			}
+		}
+		i++;
 	}
-	return (0);
+	return (1);
 }
 
-char	*ft_strtrim(char const *s1, char const *set)
+static void	hashmap_grow__free_bucket_shells(t_hashmap *map, t_vec **buckets, size_t cap)
 {
-	size_t	start;
-	size_t	end;
-	size_t	len;
-	char	*trimmed;
+	size_t	i;
 
-	if (!s1 || !set)
-		return (NULL);
-	start = 0;
-	while (s1[start] && ft_checkset(s1[start], set))
-		start++;
-	end = ft_strlen(s1);
-	while (end > start && ft_checkset(s1[end - 1], set))
-		end--;
-	len = end - start;
-	trimmed = (char *)malloc(sizeof(char) * (len + 1));
-	if (!trimmed)
-		return (NULL);
-	ft_strlcpy(trimmed, s1 + start, len + 1);
-	trimmed[len] = '\0';
-	return (trimmed);
+	i = 0;
+	while (i < cap)
+	{
+		if (buckets[i])
+			ft_hashmap_bucket_free(map, buckets[i]);
+		i++;
+	}
 }
 
-/* --- ft_substr.c --- */
+int	ft_hashmap_grow(t_hashmap *map)
+{
+	t_vec	**new_buckets;
+	size_t	new_cap;
+
+	if (map->cap > SIZE_MAX / 2)
+		return (0);
+	new_cap = map->cap * 2;
+	new_buckets = ft_hashmap_buckets_new(map, new_cap);
+	if (!new_buckets)
+		return (0);
+	if (!hashmap_grow__rehash_all(map, new_buckets, new_cap))
+	{
+		hashmap_grow__free_bucket_shells(map, new_buckets, new_cap);
+		return (ft_hashmap_buckets_free(map, new_buckets, new_cap), 0);
+	}
+	hashmap_grow__free_bucket_shells(map, map->buckets, map->cap);
+	ft_hashmap_buckets_free(map, map->buckets, map->cap);
+	ft_memstats_alloc(&map->alloc, "ft_hashmap_grow",
+		map->cap * sizeof(t_vec *), new_cap * sizeof(t_vec *));
+	map->buckets = new_buckets;
+	map->cap = new_cap;
+	return (1);
+}
 
+/* --- ft_hashmap_interned.c --- */
 
-char	*ft_substr(char const *s, unsigned int start, size_t len)
+
+/**
+ * @brief Create a hash table whose keys are interned in a string pool.
+ *
+ * Works like ft_hashmap_new, but ft_hashmap_set stores the canonical
+ * copy from keys instead of duplicating the key per map, and freeing the
+ * map leaves the strings to the pool.
+ *
+ * @param keys Pool to intern keys in (not owned by the map).
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @return New hashmap, or NULL on failure or a NULL pool.
+ */
+t_hashmap	*ft_hashmap_new_interned(t_strpool *keys, size_t init_cap,
+		void (*del)(void *))
 {
-	char	*substr;
-	size_t	slen;
+	t_hashmap	*map;
 
-	if (!s)
+	if (!keys)
 		return (NULL);
-	slen = ft_strlen(s);
-	if (start >= slen)
-		return (ft_strdup(""));
-	if (len > slen - start)
-		len = slen - start;
-	substr = (char *)malloc(len + 1);
-	if (!substr)
+	map = ft_hashmap_new(init_cap, del);
+	if (!map)
 		return (NULL);
-	ft_memcpy(substr, s + start, len);
-	substr[len] = '\0';
-	return (substr);
+	map->keys = keys;
+	return (map);
 }
 
-/* --- ft_tolower.c --- */
-
+/**
+ * @brief ft_hashmap_set for a key already interned in map->keys.
+ *
+ * Nothing is hashed or copied: the bucket comes from the cached hash and
+ * an existing entry is found by pointer.
+ *
+ * @return 1 on success, 0 on failure or if map has no string pool.
+ */
+int	ft_hashmap_set_interned(t_hashmap *map, const char *ikey, void *value)
+{
+	if (!map || !map->keys || !ikey)
+		return (0);
+	return (ft_hashmap_put(map, ikey, ft_strpool_hash(ikey), value));
+}
 
-int	ft_tolower(int c)
+/**
+ * @brief Value stored under an interned key, compared by pointer only.
+ * @return The value, or NULL if absent or map has no string pool.
+ */
+void	*ft_hashmap_get_interned(t_hashmap *map, const char *ikey)
 {
-	if (c > 64 && c < 91)
-		c += 32;
-	return (c);
+	t_hashmap_entry	*entry;
+
+	if (!map || !map->keys || !ikey)
+		return (NULL);
+	entry = ft_hashmap_find(map,
+			map->buckets[ft_strpool_hash(ikey) % map->cap], ikey);
+	if (!entry)
+		return (NULL);
+	return (entry->value);
 }
 
-/* --- ft_toupper.c --- */
+/* --- ft_hashmap_new.c --- */
 
 
-int	ft_toupper(int c)
+/**
+ * @brief Create a new hash table.
+ *
+ * Allocates a hash table with the specified initial bucket count.
+ * If init_cap is 0, defaults to 16 buckets. The del function is
+ * called on values during removal/clear/free operations.
+ *
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @return New hashmap, or NULL on allocation failure.
+ */
+t_hashmap	*ft_hashmap_new(size_t init_cap, void (*del)(void *))
 {
-	if (c > 96 && c < 123)
-		c -= 32;
-	return (c);
+	return (ft_hashmap_new_with_alloc(init_cap, del, NULL));
 }
 
+/**
+ * @brief Create a hash table that allocates through alloc.
+ *
+ * The struct, bucket array, buckets and key copies all go through the
+ * allocator, which is copied into the map.
+ *
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @param alloc Allocator to use (NULL for the heap).
+ * @return New hashmap, or NULL on allocation failure.
+ */
+t_hashmap	*ft_hashmap_new_with_alloc(size_t init_cap, void (*del)(void *),
+		const t_allocator *alloc)
+{
+	t_hashmap	*map;
 
-/* ========================================================================== */
-/*                               ft_put                                       */
-/* ========================================================================== */
-
-/* --- ft_putchar_fd.c --- */
-
+	map = ft_allocator_calloc(alloc, 1, sizeof(t_hashmap));
+	if (!map)
+		return (NULL);
+	if (alloc)
+		map->alloc = *alloc;
+	if (init_cap == 0)
+		init_cap = 16;
+	map->buckets = ft_allocator_calloc(alloc, init_cap, sizeof(t_vec *));
+	if (!map->buckets)
+		return (ft_allocator_free(alloc, map, sizeof(t_hashmap)), NULL);
+	map->cap = init_cap;
+	map->size = 0;
+	map->del = del;
+	ft_memstats_alloc(alloc, "ft_hashmap_new", 0,
+		sizeof(t_hashmap) + init_cap * sizeof(t_vec *));
+	return (map);
+}
 
-void	ft_putchar_fd(char c, int fd)
+/**
+ * @brief Create a hash table whose buckets and keys live in an arena.
+ *
+ * Shorthand for ft_hashmap_new_with_alloc with ft_allocator_arena(arena).
+ * del is still called on values; everything else is released with the
+ * arena.
+ *
+ * @param arena Arena to allocate from.
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @return New hashmap, or NULL on allocation failure.
+ */
+t_hashmap	*ft_arena_hashmap_new(t_arena *arena, size_t init_cap,
+		void (*del)(void *))
 {
-	write(fd, &c, 1);
+	t_allocator	alloc;
+
+	alloc = ft_allocator_arena(arena);
+	return (ft_hashmap_new_with_alloc(init_cap, del, &alloc));
 }
 
-/* --- ft_putendl_fd.c --- */
+/* --- ft_hashmap_pool.c --- */
 
 
-void	ft_putendl_fd(char *s, int fd)
+/**
+ * @brief Create a pool sized for hashmap buckets.
+ *
+ * Each object holds a bucket's t_vec header plus its first
+ * FT_HASHMAP_BUCKET_INLINE entries. Share one such pool between many
+ * maps to keep their buckets packed in a few pages.
+ *
+ * @return New pool, or NULL on failure. Free it with ft_pool_free once
+ *         every map using it is freed.
+ */
+t_pool	*ft_hashmap_pool_new(void)
 {
-	ft_putstr_fd(s, fd);
-	ft_putchar_fd('\n', fd);
+	return (ft_pool_new(sizeof(t_vec)
+			+ FT_HASHMAP_BUCKET_INLINE * sizeof(t_hashmap_entry)));
 }
 
-/* --- ft_putnbr_fd.c --- */
-
-
-static void	putnbr_fd__print_recursive(long nb, int fd)
+/**
+ * @brief Create a hash table whose buckets come from a bucket pool.
+ *
+ * Works like ft_hashmap_new. Buckets and their first few entries live in
+ * pool objects, so a bucket costs no malloc until it outgrows them.
+ *
+ * @param pool Pool from ft_hashmap_pool_new (not owned by the map).
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @return New hashmap, or NULL on failure or an unsuitable pool.
+ */
+t_hashmap	*ft_pool_hashmap_new(t_pool *pool, size_t init_cap,
+		void (*del)(void *))
 {
-	char	c;
+	t_hashmap	*map;
 
-	if (nb >= 10)
-		putnbr_fd__print_recursive(nb / 10, fd);
-	c = '0' + (nb % 10);
-	write(fd, &c, 1);
+	if (!pool || pool->obj_size < sizeof(t_vec)
+		+ FT_HASHMAP_BUCKET_INLINE * sizeof(t_hashmap_entry))
+		return (NULL);
+	map = ft_hashmap_new(init_cap, del);
+	if (!map)
+		return (NULL);
+	map->pool = pool;
+	return (map);
 }
 
-void	ft_putnbr_fd(int n, int fd)
+/* --- ft_hashmap_set.c --- */
+
+
+/**
+ * @brief Entry for key in bucket, or NULL. Interned keys are canonical,
+ *        so they match by pointer alone.
+ */
+t_hashmap_entry	*ft_hashmap_find(const t_hashmap *map, t_vec *bucket,
+		const char *key)
 {
-	long	nb;
+	size_t			i;
+	t_hashmap_entry	*entry;
 
-	nb = n;
-	if (nb < 0)
+	if (!bucket)
+		return (NULL);
+	i = 0;
+	while (i < bucket->len)
 	{
-		write(fd, "-", 1);
-		nb = -nb;
+		entry = ft_vec_get(bucket, i);
+		if (entry->key == key
+			|| (!map->keys && ft_strcmp(entry->key, key) == 0))
+			return (entry);
+		i++;
 	}
-	putnbr_fd__print_recursive(nb, fd);
+	return (NULL);
 }
 
-/* --- ft_putstr_fd.c --- */
-
+static void	hashmap_set__update_entry(t_hashmap *map, t_hashmap_entry *existing, void *value)
+{
+	if (existing->value == value)
+		return ;
+	if (map->del && existing->value)
+		map->del(existing->value);
+	existing->value = value;
+}
 
-void	ft_putstr_fd(char *s, int fd)
+/**
+ * @brief Insert or update key, whose hash the caller already has.
+ *
+ * A failed grow leaves a valid map that is just over-full.
+ */
+int	ft_hashmap_put(t_hashmap *map, const char *key, size_t hash,
+		void *value)
 {
-	int	len;
+	size_t			idx;
+	t_hashmap_entry	*existing;
+	t_hashmap_entry	new_entry;
+
+	idx = hash % map->cap;
+	existing = ft_hashmap_find(map, map->buckets[idx], key);
+	if (existing)
+		return (hashmap_set__update_entry(map, existing, value), 1);
+	if (!map->buckets[idx])
+		map->buckets[idx] = ft_hashmap_bucket_new(map);
+	if (!map->buckets[idx])
+		return (0);
+	new_entry.key = ft_hashmap_key_dup(map, key);
+	new_entry.value = value;
+	if (!new_entry.key || !ft_hashmap_bucket_push(map, map->buckets[idx],
+			&new_entry))
+		return (ft_hashmap_key_free(map, new_entry.key), 0);
+	map->size++;
+	if (map->size * 4 > map->cap * 3)
+		ft_hashmap_grow(map);
+	return (1);
+}
 
-	len = 0;
-	if (!s)
-		return ;
-	while (s[len] != '\0')
-	{
-		write(fd, &s[len], 1);
-		len++;
-	}
+int	ft_hashmap_set(t_hashmap *map, const char *key, void *value)
+{
+	if (!map || !key)
+		return (0);
+	if (map->keys)
+		return (ft_hashmap_set_interned(map,
+				ft_strpool_intern(map->keys, key), value));
+	return (ft_hashmap_put(map, key, ft_hashmap_hash(map, key), value));
 }
 
 
 /* ========================================================================== */
-/*                            ft_printf                                       */
+/*                          ft_vec_math                                       */
 /* ========================================================================== */
 
-/* --- ft_print_char.c --- */
+/* --- ft_vec2_basic.c --- */
 
 
-int	ft_print_char(int character)
+t_vec2	ft_vec2_new(double x, double y)
 {
-	char	to_print;
+	t_vec2	v;
 
-	to_print = (char)character;
-	if (write(1, &to_print, 1) == -1)
-		return (-1);
-	return (1);
+	v.x = x;
+	v.y = y;
+	return (v);
 }
 
-/* --- ft_print_hex.c --- */
+t_vec2	ft_vec2_add(t_vec2 a, t_vec2 b)
+{
+	t_vec2	result;
 
+	result.x = a.x + b.x;
+	result.y = a.y + b.y;
+	return (result);
+}
 
-static int	print_hex__print_hex_rec(unsigned int n, char *base)
+t_vec2	ft_vec2_sub(t_vec2 a, t_vec2 b)
 {
-	int	len;
-	int	check;
+	t_vec2	result;
 
-	len = 0;
-	if (n >= 16)
-	{
-		check = print_hex__print_hex_rec(n / 16, base);
-		if (check == -1)
-			return (-1);
-		len += check;
-	}
-	if (write(1, &base[n % 16], 1) == -1)
-		return (-1);
-	return (len + 1);
+	result.x = a.x - b.x;
+	result.y = a.y - b.y;
+	return (result);
 }
 
-int	ft_print_hex(unsigned int n, int uppercase)
+t_vec2	ft_vec2_scale(t_vec2 v, double s)
 {
-	if (uppercase == 1)
-		return (print_hex__print_hex_rec(n, "0123456789ABCDEF"));
-	else
-		return (print_hex__print_hex_rec(n, "0123456789abcdef"));
+	t_vec2	result;
+
+	result.x = v.x * s;
+	result.y = v.y * s;
+	return (result);
 }
 
-/* --- ft_print_nbr.c --- */
+/* --- ft_vec2_ops.c --- */
 
+#include <math.h>
 
-static int	print_nbr__print_recursive(unsigned int number)
-{
-	int	length;
-	int	check_error;
+#define FT_EPSILON 1e-10
 
-	length = 0;
-	if (number >= 10)
-	{
-		check_error = print_nbr__print_recursive(number / 10);
-		if (check_error == -1)
-			return (-1);
-		length += check_error;
-	}
-	if (write(1, &"0123456789"[number % 10], 1) == -1)
-		return (-1);
-	return (length + 1);
+double	ft_vec2_dot(t_vec2 a, t_vec2 b)
+{
+	return (a.x * b.x + a.y * b.y);
 }
 
-int	ft_print_unsigned(unsigned int number)
+double	ft_vec2_len(t_vec2 v)
 {
-	return (print_nbr__print_recursive(number));
+	return (sqrt(v.x * v.x + v.y * v.y));
 }
 
-int	ft_print_nbr(int number)
+double	ft_vec2_len_sq(t_vec2 v)
 {
-	int				length;
-	int				check_error;
-	unsigned int	unsigned_num;
-
-	length = 0;
-	if (number < 0)
-	{
-		if (write(1, "-", 1) == -1)
-			return (-1);
-		length++;
-		unsigned_num = -(unsigned int)number;
-	}
-	else
-		unsigned_num = (unsigned int)number;
-	check_error = print_nbr__print_recursive(unsigned_num);
-	if (check_error == -1)
-		return (-1);
-	return (length + check_error);
+	return (v.x * v.x + v.y * v.y);
 }
 
-/* --- ft_print_ptr.c --- */
-
-
-static int	ft_putptr_recursive(unsigned long n)
+t_vec2	ft_vec2_norm(t_vec2 v)
 {
-	int	len;
-	int	check;
+	double	len;
+	t_vec2	result;
 
-	len = 0;
-	if (n >= 16)
-	{
-		check = ft_putptr_recursive(n / 16);
-		if (check == -1)
-			return (-1);
-		len += check;
-	}
-	if (write(1, &"0123456789abcdef"[n % 16], 1) == -1)
-		return (-1);
-	return (len + 1);
+	len = ft_vec2_len(v);
+	if (len < FT_EPSILON && len > -FT_EPSILON)
+		return (ft_vec2_new(0, 0));
+	result.x = v.x / len;
+	result.y = v.y / len;
+	return (result);
 }
 
-int	ft_print_ptr(void *ptr)
+double	ft_vec2_dist(t_vec2 a, t_vec2 b)
 {
-	int	len;
-
-	if (!ptr)
-		return (write(1, "(nil)", 5));
-	if (write(1, "0x", 2) == -1)
-		return (-1);
-	len = ft_putptr_recursive((unsigned long)ptr);
-	if (len == -1)
-		return (-1);
-	return (len + 2);
+	return (ft_vec2_len(ft_vec2_sub(b, a)));
 }
 
-/* --- ft_print_str.c --- */
+/* --- ft_vec2_transform.c --- */
 
+#include <math.h>
 
-int	ft_print_str(char *str)
+t_vec2	ft_vec2_lerp(t_vec2 a, t_vec2 b, double t)
 {
-	int	length;
+	t_vec2	result;
 
-	if (!str)
-		str = "(null)";
-	length = ft_strlen(str);
-	if (write(1, str, length) == -1)
-		return (-1);
-	return (length);
+	result.x = a.x + t * (b.x - a.x);
+	result.y = a.y + t * (b.y - a.y);
+	return (result);
 }
 
-/* --- ft_printf.c --- */
+t_vec2	ft_vec2_rotate(t_vec2 v, double angle)
+{
+	t_vec2	result;
+	double	c;
+	double	s;
+
+	c = cos(angle);
+	s = sin(angle);
+	result.x = v.x * c - v.y * s;
+	result.y = v.x * s + v.y * c;
+	return (result);
+}
+
+/* --- ft_vec3_basic.c --- */
 
 
-static int	ft_handle_format(va_list args, char specifier)
+t_vec3	ft_vec3_new(double x, double y, double z)
 {
-	if (specifier == 'c')
-		return (ft_print_char(va_arg(args, int)));
-	else if (specifier == 's')
-		return (ft_print_str(va_arg(args, char *)));
-	else if (specifier == 'p')
-		return (ft_print_ptr(va_arg(args, void *)));
-	else if (specifier == 'd' || specifier == 'i')
-		return (ft_print_nbr(va_arg(args, int)));
-	else if (specifier == 'u')
-		return (ft_print_unsigned(va_arg(args, unsigned int)));
-	else if (specifier == 'x')
-		return (ft_print_hex(va_arg(args, unsigned int), 0));
-	else if (specifier == 'X')
-		return (ft_print_hex(va_arg(args, unsigned int), 1));
-	else if (specifier == '%')
-		return (ft_print_char('%'));
-	return (0);
+	t_vec3	v;
+
+	v.x = x;
+	v.y = y;
+	v.z = z;
+	return (v);
 }
 
-static int	ft_print_format(va_list args, const char **format)
+t_vec3	ft_vec3_add(t_vec3 a, t_vec3 b)
 {
-	int	result;
+	t_vec3	result;
 
-	(*format)++;
-	result = ft_handle_format(args, **format);
+	result.x = a.x + b.x;
+	result.y = a.y + b.y;
+	result.z = a.z + b.z;
 	return (result);
 }
 
-static int	ft_parse_format(va_list args, const char *format)
+t_vec3	ft_vec3_sub(t_vec3 a, t_vec3 b)
 {
-	int	total_len;
-	int	result;
+	t_vec3	result;
 
-	total_len = 0;
-	while (*format)
-	{
-		if (*format == '%' && *(format + 1))
-		{
-			result = ft_print_format(args, &format);
-			if (result == -1)
-				return (-1);
-			total_len += result;
-		}
-		else if (*format != '%')
-		{
-			if (write(1, format, 1) == -1)
-				return (-1);
-			total_len++;
-		}
-		format++;
-	}
-	return (total_len);
+	result.x = a.x - b.x;
+	result.y = a.y - b.y;
+	result.z = a.z - b.z;
+	return (result);
 }
 
-int	ft_printf(const char *format, ...)
+t_vec3	ft_vec3_scale(t_vec3 v, double s)
 {
-	va_list	args;
-	int		total_len;
+	t_vec3	result;
 
-	if (!format)
-		return (-1);
-	va_start(args, format);
-	total_len = ft_parse_format(args, format);
-	va_end(args);
-	return (total_len);
+	result.x = v.x * s;
+	result.y = v.y * s;
+	result.z = v.z * s;
+	return (result);
 }
 
+t_vec3	ft_vec3_negate(t_vec3 v)
+{
+	return (ft_vec3_new(-v.x, -v.y, -v.z));
+}
 
-/* ========================================================================== */
-/*                               ft_lst                                       */
-/* ========================================================================== */
+/* --- ft_vec3_norm.c --- */
 
-/* --- ft_lstadd_back_bonus.c --- */
 
+#define FT_EPSILON 1e-10
 
-void	ft_lstadd_back(t_list **lst, t_list *new)
+t_vec3	ft_vec3_norm(t_vec3 v)
 {
-	t_list	*current;
+	double	len;
+	t_vec3	result;
 
-	if (*lst == NULL)
-	{
-		*lst = new;
-		return ;
-	}
-	current = *lst;
-	while (current->next != NULL)
-		current = current->next;
-	current->next = new;
+	len = ft_vec3_len(v);
+	if (len < FT_EPSILON && len > -FT_EPSILON)
+		return (ft_vec3_new(0, 0, 0));
+	result.x = v.x / len;
+	result.y = v.y / len;
+	result.z = v.z / len;
+	return (result);
 }
 
-/* --- ft_lstadd_front_bonus.c --- */
+/* --- ft_vec3_ops.c --- */
 
+#include <math.h>
 
-void	ft_lstadd_front(t_list **lst, t_list *new)
+double	ft_vec3_dot(t_vec3 a, t_vec3 b)
 {
-	if (new == NULL)
-		return ;
-	new->next = *lst;
-	*lst = new;
+	return (a.x * b.x + a.y * b.y + a.z * b.z);
 }
 
-/* --- ft_lstclear_bonus.c --- */
-
-
-void	ft_lstclear(t_list **lst, void (*del)(void *))
+t_vec3	ft_vec3_cross(t_vec3 a, t_vec3 b)
 {
-	t_list	*next_node;
+	t_vec3	result;
 
-	if (lst == NULL || *lst == NULL)
-		return ;
-	while (*lst != NULL)
-	{
-		next_node = (*lst)->next;
-		ft_lstdelone(*lst, del);
-		*lst = next_node;
-	}
-	*lst = NULL;
+	result.x = a.y * b.z - a.z * b.y;
+	result.y = a.z * b.x - a.x * b.z;
+	result.z = a.x * b.y - a.y * b.x;
+	return (result);
 }
 
-/* --- ft_lstdelone_bonus.c --- */
-
-
-void	ft_lstdelone(t_list *lst, void (*del)(void *))
+double	ft_vec3_len(t_vec3 v)
 {
-	if (lst != NULL && del != NULL)
-	{
-		del(lst->content);
-		free(lst);
-	}
+	return (sqrt(v.x * v.x + v.y * v.y + v.z * v.z));
 }
 
-/* --- ft_lstiter_bonus.c --- */
-
-
-void	ft_lstiter(t_list *lst, void (*f)(void *))
+double	ft_vec3_len_sq(t_vec3 v)
 {
-	while (lst != NULL && f != NULL)
-	{
-		f(lst->content);
-		lst = lst->next;
-	}
+	return (v.x * v.x + v.y * v.y + v.z * v.z);
 }
 
-/* --- ft_lstlast_bonus.c --- */
-
-
-t_list	*ft_lstlast(t_list *lst)
+double	ft_vec3_dist(t_vec3 a, t_vec3 b)
 {
-	if (lst == NULL)
-		return (NULL);
-	while (lst->next != NULL)
-		lst = lst->next;
-	return (lst);
+	return (ft_vec3_len(ft_vec3_sub(b, a)));
 }
 
-/* --- ft_lstmap_bonus.c --- */
+/* --- ft_vec3_transform.c --- */
 
 
-t_list	*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *))
+t_vec3	ft_vec3_lerp(t_vec3 a, t_vec3 b, double t)
 {
-	t_list	*new_list;
-	t_list	*new_node;
-	void	*new_content;
+	t_vec3	result;
 
-	if (!lst || !f || !del)
-		return (NULL);
-	new_list = NULL;
-	while (lst)
-	{
-		new_content = f(lst->content);
-		new_node = ft_lstnew(new_content);
-		if (!new_node)
-		{
-			del(new_content);
-			ft_lstclear(&new_list, del);
-			return (NULL);
-		}
-		ft_lstadd_back(&new_list, new_node);
-		lst = lst->next;
-	}
-	return (new_list);
+	result.x = a.x + t * (b.x - a.x);
+	result.y = a.y + t * (b.y - a.y);
+	result.z = a.z + t * (b.z - a.z);
+	return (result);
 }
 
-/* --- ft_lstnew_bonus.c --- */
-
-
-t_list	*ft_lstnew(void *content)
+t_vec3	ft_vec3_reflect(t_vec3 v, t_vec3 normal)
 {
-	t_list	*new_node;
+	double	d;
 
-	new_node = (t_list *)malloc(sizeof(t_list));
-	if (new_node == NULL)
-		return (NULL);
-	new_node->content = content;
-	new_node->next = NULL;
-	return (new_node);
+	d = 2.0 * ft_vec3_dot(v, normal);
+	return (ft_vec3_sub(v, ft_vec3_scale(normal, d)));
 }
 
-/* --- ft_lstsize_bonus.c --- */
 
+/* ========================================================================== */
+/*                             ft_alloc                                       */
+/* ========================================================================== */
+
+/* --- ft_allocator.c --- */
 
-int	ft_lstsize(t_list *lst)
+
+/**
+ * @brief Allocate through an allocator.
+ * @param a Allocator, or NULL for the heap. A NULL alloc slot also
+ *          means the heap.
+ * @param size Bytes to allocate.
+ * @return New memory (not zeroed), or NULL on failure.
+ */
+void	*ft_allocator_alloc(const t_allocator *a, size_t size)
 {
-	int	size;
+	if (!a || !a->alloc)
+		return (malloc(size));
+	return (a->alloc(a->ctx, size));
+}
 
-	size = 0;
-	while (lst != NULL)
+/**
+ * @brief Resize a block through an allocator.
+ *
+ * Allocators without a realloc slot get alloc + copy + free.
+ *
+ * @param a Allocator, or NULL for the heap.
+ * @param ptr Block to resize (NULL behaves like ft_allocator_alloc).
+ * @param old_size Current size of the block.
+ * @param new_size Requested size.
+ * @return Resized block, or NULL on failure (ptr is then untouched).
+ */
+void	*ft_allocator_realloc(const t_allocator *a, void *ptr, size_t old_size,
+		size_t new_size)
+{
+	void	*new_ptr;
+
+	if (!a || (!a->alloc && !a->realloc))
+		return (realloc(ptr, new_size));
+	if (a->realloc)
+		return (a->realloc(a->ctx, ptr, old_size, new_size));
+	new_ptr = a->alloc(a->ctx, new_size);
+	if (!new_ptr || !ptr)
+		return (new_ptr);
+	if (old_size > new_size)
+		old_size = new_size;
+	ft_memcpy(new_ptr, ptr, old_size);
+	ft_allocator_free(a, ptr, old_size);
+	return (new_ptr);
+}
+
+/**
+ * @brief Release a block through an allocator.
+ * @param a Allocator, or NULL for the heap.
+ * @param ptr Block to release (NULL is ignored).
+ * @param size Size the block was allocated or last resized with.
+ */
+void	ft_allocator_free(const t_allocator *a, void *ptr, size_t size)
+{
+	if (!ptr)
+		return ;
+	if (!a || (!a->alloc && !a->free))
 	{
-		size++;
-		lst = lst->next;
+		free(ptr);
+		return ;
 	}
-	return (size);
+	if (a->free)
+		a->free(a->ctx, ptr, size);
 }
 
+/**
+ * @brief Allocate zeroed memory for count elements through an allocator.
+ * @return Zeroed memory, or NULL on overflow or failure.
+ */
+void	*ft_allocator_calloc(const t_allocator *a, size_t count, size_t size)
+{
+	void	*ptr;
 
-/* ========================================================================== */
-/*                               ft_vec                                       */
-/* ========================================================================== */
+	if (!a || !a->alloc)
+		return (calloc(count, size));
+	if (size != 0 && count > SIZE_MAX / size)
+		return (NULL);
+	ptr = a->alloc(a->ctx, count * size);
+	if (ptr)
+		ft_bzero(ptr, count * size);
+	return (ptr);
+}
 
-/* --- ft_vec_clear.c --- */
+/* --- ft_allocator_heap.c --- */
 
 
-/**
- * @brief Reset vector to empty state without freeing memory.
- *
- * Sets length to 0, keeping the allocated capacity intact.
- * Useful for reusing a vector without reallocation overhead.
- *
- * @param vec Pointer to the vector (can be NULL).
- */
-void	ft_vec_clear(t_vec *vec)
+static void	*allocator_heap__heap_alloc(void *ctx, size_t size)
 {
-	if (!vec)
-		return ;
-	vec->len = 0;
+	(void)ctx;
+	return (malloc(size));
 }
 
-/* --- ft_vec_free.c --- */
+static void	*allocator_heap__heap_realloc(void *ctx, void *ptr, size_t old_size,
+		size_t new_size)
+{
+	(void)ctx;
+	(void)old_size;
+	return (realloc(ptr, new_size));
+}
 
+static void	allocator_heap__heap_free(void *ctx, void *ptr, size_t size)
+{
+	(void)ctx;
+	(void)size;
+	free(ptr);
+}
 
 /**
- * @brief Free all memory associated with the vector.
+ * @brief The default allocator: malloc, realloc and free.
  *
- * Frees both the internal data buffer and the vector struct itself.
- * Safe to call with NULL. Does not free heap-allocated elements
- * stored within the vector (user responsibility).
- *
- * @param vec Pointer to the vector to free (can be NULL).
+ * A zeroed t_allocator behaves the same; this one is handy as a base
+ * for wrappers that forward to the heap.
  */
-void	ft_vec_free(t_vec *vec)
+t_allocator	ft_allocator_heap(void)
 {
-	if (!vec)
-		return ;
-	if (vec->data)
-		free(vec->data);
-	free(vec);
+	t_allocator	a;
+
+	a.alloc = allocator_heap__heap_alloc;
+	a.realloc = allocator_heap__heap_realloc;
+	a.free = allocator_heap__heap_free;
+	a.ctx = NULL;
+	return (a);
 }
 
-/* --- ft_vec_get.c --- */
 
+/* ========================================================================== */
+/*                             ft_arena                                       */
+/* ========================================================================== */
+
+/* --- ft_arena_alloc.c --- */
+
+
+static uintptr_t	arena_alloc__align_up(uintptr_t n)
+{
+	return ((n + FT_ARENA_ALIGN - 1) & ~(uintptr_t)(FT_ARENA_ALIGN - 1));
+}
 
 /**
- * @brief Get a pointer to the element at the specified index.
- *
- * Performs bounds checking and returns NULL if index is out of range.
- * The returned pointer is valid until the next push or reserve operation.
+ * @brief Open a new block able to hold at least size bytes.
  *
- * @param vec Pointer to the vector.
- * @param index Zero-based index of the element.
- * @return Pointer to the element, or NULL if out of bounds.
+ * The header sits at the start of the malloc'd chunk and data follows
+ * it, rounded up to FT_ARENA_ALIGN.
  */
-void	*ft_vec_get(t_vec *vec, size_t index)
+static t_arena_block	*arena_alloc__arena_grow(t_arena *arena, size_t size)
 {
-	if (!vec || index >= vec->len)
+	t_arena_block	*block;
+	size_t			cap;
+
+	cap = arena->block_size;
+	if (size > cap)
+		cap = size;
+	if (cap > SIZE_MAX - sizeof(t_arena_block) - FT_ARENA_ALIGN)
 		return (NULL);
-	return ((char *)vec->data + (index * vec->elem_size));
+	block = malloc(sizeof(t_arena_block) + FT_ARENA_ALIGN + cap);
+	if (!block)
+		return (NULL);
+	ft_memstats_record("ft_arena_alloc", 0,
+		sizeof(t_arena_block) + FT_ARENA_ALIGN + cap);
+	block->data = (unsigned char *)arena_alloc__align_up((uintptr_t)(block + 1));
+	block->cap = cap;
+	block->used = 0;
+	block->prev = arena->head;
+	arena->head = block;
+	return (block);
 }
 
-/* --- ft_vec_insert.c --- */
-
-
 /**
- * @brief Shift elements right starting from index.
- *
- * Moves elements from index to len-1 one position to the right.
- * Uses memmove to handle overlapping regions safely.
- *
- * @param vec Pointer to the vector.
- * @param index Starting index for the shift.
+ * @brief Free the newest block (reset, rewind and free all go through
+ *        here).
  */
-static void	ft_vec_shift_right(t_vec *vec, size_t index)
+void	ft_arena_pop_block(t_arena *arena)
 {
-	void	*src;
-	void	*dst;
-	size_t	bytes;
+	t_arena_block	*block;
 
-	src = (char *)vec->data + (index * vec->elem_size);
-	dst = (char *)vec->data + ((index + 1) * vec->elem_size);
-	bytes = (vec->len - index) * vec->elem_size;
-	ft_memmove(dst, src, bytes);
+	block = arena->head;
+	arena->head = block->prev;
+	ft_memstats_record("ft_arena_free",
+		sizeof(t_arena_block) + FT_ARENA_ALIGN + block->cap, 0);
+	free(block);
 }
 
 /**
- * @brief Insert an element at the specified index.
+ * @brief Allocate size bytes from the arena.
  *
- * Shifts existing elements to the right and inserts the new element.
- * Index must be <= len (insert at len is equivalent to push).
- * Grows capacity automatically if needed.
+ * Bumps a pointer in the newest block; only a block that is full costs
+ * a malloc. The memory is not zeroed.
  *
- * @param vec Pointer to the vector.
- * @param index Position to insert at (0 to len).
- * @param elem Pointer to the element to insert.
- * @return 1 on success, 0 on failure or invalid index.
+ * @param arena Arena to allocate from.
+ * @param size Bytes to allocate (0 is treated as 1).
+ * @return Pointer aligned to 16 bytes, or NULL on failure.
+ * @note Never free the result; it lives until rewind, reset or free.
  */
-int	ft_vec_insert(t_vec *vec, size_t index, const void *elem)
+void	*ft_arena_alloc(t_arena *arena, size_t size)
 {
-	void	*dst;
+	t_arena_block	*block;
+	size_t			off;
 
-	if (!vec || !elem || index > vec->len)
-		return (0);
-	if (vec->len == vec->cap)
+	if (!arena)
+		return (NULL);
+	if (size == 0)
+		size = 1;
+	block = arena->head;
+	if (block)
 	{
-		if (!ft_vec_reserve(vec, vec->cap + vec->cap / 2 + 1))
-			return (0);
+		off = arena_alloc__align_up(block->used);
+		if (off <= block->cap && size <= block->cap - off)
+		{
+			block->used = off + size;
+			return (block->data + off);
+		}
 	}
-	if (index < vec->len)
-		ft_vec_shift_right(vec, index);
-	dst = (char *)vec->data + (index * vec->elem_size);
-	ft_memcpy(dst, elem, vec->elem_size);
-	vec->len++;
-	return (1);
+	block = arena_alloc__arena_grow(arena, size);
+	if (!block)
+		return (NULL);
+	block->used = size;
+	return (block->data);
 }
 
-/* --- ft_vec_new.c --- */
-
-
 /**
- * @brief Create a new dynamic array (vector).
- *
- * Allocates and initializes a new vector with the specified element size
- * and initial capacity. If init_cap is 0, defaults to 8 elements.
- *
- * @param elem_size Size of each element in bytes (must be > 0).
- * @param init_cap Initial capacity (0 for default of 8).
- * @return Pointer to newly allocated t_vec, or NULL on failure.
+ * @brief Allocate zeroed memory for count elements of size bytes.
+ * @return Pointer to zeroed memory, or NULL on overflow or failure.
  */
-t_vec	*ft_vec_new(size_t elem_size, size_t init_cap)
+void	*ft_arena_calloc(t_arena *arena, size_t count, size_t size)
 {
-	t_vec	*vec;
+	void	*ptr;
 
-	if (elem_size == 0)
+	if (size != 0 && count > SIZE_MAX / size)
 		return (NULL);
-	vec = ft_calloc(1, sizeof(t_vec));
-	if (!vec)
-		return (NULL);
-	if (init_cap == 0)
-		init_cap = 8;
-	vec->data = ft_calloc(init_cap, elem_size);
-	if (!vec->data)
-		return (free(vec), NULL);
-	vec->elem_size = elem_size;
-	vec->cap = init_cap;
-	vec->len = 0;
-	return (vec);
+	ptr = ft_arena_alloc(arena, count * size);
+	if (ptr)
+		ft_bzero(ptr, count * size);
+	return (ptr);
 }
 
-/* --- ft_vec_pop.c --- */
+/* --- ft_arena_allocator.c --- */
+
 
+static void	*arena_allocator__arena_alloc(void *ctx, size_t size)
+{
+	return (ft_arena_alloc(ctx, size));
+}
 
 /**
- * @brief Remove and optionally retrieve the last element.
- *
- * Decrements the vector length. If out is not NULL, copies the
- * removed element to the provided buffer before removal.
- *
- * @param vec Pointer to the vector.
- * @param out Buffer to receive the popped element (can be NULL).
- * @return 1 on success, 0 if vec is NULL or empty.
+ * @brief Grow in place when ptr is the newest allocation, copy otherwise.
  */
-int	ft_vec_pop(t_vec *vec, void *out)
+static void	*arena_allocator__arena_realloc(void *ctx, void *ptr, size_t old_size,
+		size_t new_size)
 {
-	void	*src;
+	t_arena_block	*block;
+	void			*new_ptr;
 
-	if (!vec || vec->len == 0)
-		return (0);
-	vec->len--;
-	if (out)
+	block = ((t_arena *)ctx)->head;
+	if (ptr && block && (unsigned char *)ptr + old_size
+		== block->data + block->used
+		&& new_size <= block->cap - ((unsigned char *)ptr - block->data))
 	{
-		src = (char *)vec->data + (vec->len * vec->elem_size);
-		ft_memcpy(out, src, vec->elem_size);
+		block->used = ((unsigned char *)ptr - block->data) + new_size;
+		return (ptr);
 	}
-	return (1);
+	new_ptr = ft_arena_alloc(ctx, new_size);
+	if (!new_ptr || !ptr)
+		return (new_ptr);
+	if (old_size > new_size)
+		old_size = new_size;
+	ft_memcpy(new_ptr, ptr, old_size);
+	return (new_ptr);
 }
 
-/* --- ft_vec_push.c --- */
-
-
 /**
- * @brief Calculate the next capacity for vector growth.
+ * @brief Allocator that takes memory from an arena.
  *
- * Uses 1.5x growth factor for memory efficiency.
- * Returns 0 if overflow would occur.
+ * Its free slot is NULL, so releasing a block is a no-op: the memory
+ * goes back with ft_arena_rewind, ft_arena_reset or ft_arena_free.
  *
- * @param cap Current capacity.
- * @return New capacity, or 0 on overflow.
+ * @param arena Arena to allocate from; must outlive every user.
  */
-static size_t	ft_vec_next_cap(size_t cap)
+t_allocator	ft_allocator_arena(t_arena *arena)
 {
-	size_t	new_cap;
+	t_allocator	a;
 
-	if (cap == 0)
-		return (8);
-	if (cap > SIZE_MAX / 2)
-		return (0);
-	new_cap = cap + cap / 2;
-	if (new_cap <= cap)
-		new_cap = cap + 1;
-	return (new_cap);
+	a.alloc = arena_allocator__arena_alloc;
+	a.realloc = arena_allocator__arena_realloc;
+	a.free = NULL;
+	a.ctx = arena;
+	return (a);
 }
 
+/* --- ft_arena_mark.c --- */
+
+
 /**
- * @brief Grow the vector's capacity by 1.5x.
- *
- * Called internally when push would exceed current capacity.
- * Delegates to ft_vec_reserve for the actual reallocation.
- *
- * @param vec Pointer to the vector.
- * @return 1 on success, 0 on allocation failure or overflow.
+ * @brief Record the arena's current fill level.
+ * @param arena Arena to mark.
+ * @return Mark to pass to ft_arena_rewind.
  */
-static int	ft_vec_grow(t_vec *vec)
+t_arena_mark	ft_arena_mark(t_arena *arena)
 {
-	size_t	new_cap;
+	t_arena_mark	mark;
 
-	new_cap = ft_vec_next_cap(vec->cap);
-	if (new_cap == 0)
-		return (0);
-	return (ft_vec_reserve(vec, new_cap));
+	mark.block = NULL;
+	mark.used = 0;
+	if (arena && arena->head)
+	{
+		mark.block = arena->head;
+		mark.used = arena->head->used;
+	}
+	return (mark);
 }
 
 /**
- * @brief Append an element to the end of the vector.
+ * @brief Release everything allocated since mark was taken.
  *
- * Copies elem_size bytes from elem to the end of the vector.
- * Automatically grows capacity if needed (1.5x growth factor).
+ * Blocks opened after the mark are freed; the marked block goes back to
+ * its recorded fill level. Marks taken after this one become invalid.
  *
- * @param vec Pointer to the vector.
- * @param elem Pointer to the element to copy.
- * @return 1 on success, 0 on failure or NULL params.
+ * @param arena Arena to rewind. Safe to call with NULL.
+ * @param mark Mark taken earlier from the same arena.
  */
-int	ft_vec_push(t_vec *vec, const void *elem)
+void	ft_arena_rewind(t_arena *arena, t_arena_mark mark)
 {
-	void	*dst;
-
-	if (!vec || !elem)
-		return (0);
-	if (vec->len == vec->cap)
-	{
-		if (!ft_vec_grow(vec))
-			return (0);
-	}
-	dst = (char *)vec->data + (vec->len * vec->elem_size);
-	ft_memcpy(dst, elem, vec->elem_size);
-	vec->len++;
-	return (1);
+	if (!arena)
+		return ;
+	while (arena->head && arena->head != mark.block)
+		ft_arena_pop_block(arena);
+	if (arena->head)
+		arena->head->used = mark.used;
 }
 
-/* --- ft_vec_reserve.c --- */
+/* --- ft_arena_new.c --- */
 
 
 /**
- * @brief Ensure vector has at least the specified capacity.
+ * @brief Create an empty arena.
  *
- * If new_cap is greater than current capacity, reallocates the
- * internal buffer. Existing elements are preserved. Does nothing
- * if new_cap <= current capacity.
+ * No memory is reserved until the first allocation.
  *
- * @param vec Pointer to the vector.
- * @param new_cap Minimum required capacity.
- * @return 1 on success, 0 on allocation failure or overflow.
+ * @param block_size Bytes per block (0 for a default of 64 KiB).
+ * @return New arena, or NULL on allocation failure.
  */
-int	ft_vec_reserve(t_vec *vec, size_t new_cap)
+t_arena	*ft_arena_new(size_t block_size)
 {
-	void	*new_data;
+	t_arena	*arena;
 
-	if (!vec)
-		return (0);
-	if (new_cap <= vec->cap)
-		return (1);
-	if (new_cap > SIZE_MAX / vec->elem_size)
-		return (0);
-	new_data = ft_calloc(new_cap, vec->elem_size);
-	if (!new_data)
-		return (0);
-	ft_memcpy(new_data, vec->data, vec->len * vec->elem_size);
-	free(vec->data);
-	vec->data = new_data;
-	vec->cap = new_cap;
-	return (1);
+	arena = malloc(sizeof(t_arena));
+	if (!arena)
+		return (NULL);
+	ft_memstats_record("ft_arena_new", 0, sizeof(t_arena));
+	if (block_size == 0)
+		block_size = FT_ARENA_DEFAULT_BLOCK;
+	arena->head = NULL;
+	arena->block_size = block_size;
+	return (arena);
 }
 
-/* --- ft_vec_set.c --- */
-
-
 /**
- * @brief Set the value of an element at the specified index.
+ * @brief Release every allocation but keep the oldest block for reuse.
  *
- * Copies elem_size bytes from elem to the element at index.
- * Index must be within current length (cannot extend vector).
+ * A reset arena serves the next batch of allocations from memory it
+ * already owns, so a steady request loop stops calling malloc.
  *
- * @param vec Pointer to the vector.
- * @param index Zero-based index of the element to set.
- * @param elem Pointer to the source data.
- * @return 1 on success, 0 if out of bounds or NULL params.
+ * @param arena Arena to reset. Safe to call with NULL.
  */
-int	ft_vec_set(t_vec *vec, size_t index, const void *elem)
+void	ft_arena_reset(t_arena *arena)
 {
-	void	*dst;
-
-	if (!vec || !elem || index >= vec->len)
-		return (0);
-	dst = (char *)vec->data + (index * vec->elem_size);
-	ft_memcpy(dst, elem, vec->elem_size);
-	return (1);
+	if (!arena || !arena->head)
+		return ;
+	while (arena->head->prev)
+		ft_arena_pop_block(arena);
+	arena->head->used = 0;
 }
 
+/**
+ * @brief Free an arena and every allocation made from it.
+ * @param arena Arena to free. Safe to call with NULL.
+ */
+void	ft_arena_free(t_arena *arena)
+{
+	if (!arena)
+		return ;
+	while (arena->head)
+		ft_arena_pop_block(arena);
+	ft_memstats_record("ft_arena_free", sizeof(t_arena), 0);
+	free(arena);
+}
 
-/* ========================================================================== */
-/*                             ft_deque                                       */
-/* ========================================================================== */
-
-/* --- ft_deque_access.c --- */
+/* --- ft_arena_split.c --- */
 
 
-void	*ft_deque_front(t_deque *d)
+static size_t	arena_split__count_words(char const *s, char c)
 {
-	if (!d || d->len == 0)
-		return (NULL);
-	return ((char *)d->data + (d->head * d->elem_size));
+	size_t	count;
+
+	count = 0;
+	while (*s)
+	{
+		while (*s == c)
+			s++;
+		if (*s)
+			count++;
+		while (*s && *s != c)
+			s++;
+	}
+	return (count);
 }
 
-void	*ft_deque_back(t_deque *d)
+/**
+ * @brief Copy the next word of *s into the arena and move *s past it.
+ */
+static char	*arena_split__next_word(t_arena *arena, char const **s, char c)
 {
-	size_t	back_idx;
+	char	*word;
+	size_t	len;
 
-	if (!d || d->len == 0)
+	while (**s == c)
+		(*s)++;
+	len = 0;
+	while ((*s)[len] && (*s)[len] != c)
+		len++;
+	word = ft_arena_alloc(arena, len + 1);
+	if (!word)
 		return (NULL);
-	back_idx = (d->tail - 1 + d->cap) % d->cap;
-	return ((char *)d->data + (back_idx * d->elem_size));
+	ft_memcpy(word, *s, len);
+	word[len] = '\0';
+	*s += len;
+	return (word);
 }
 
-void	*ft_deque_get(t_deque *d, size_t index)
+/**
+ * @brief Arena version of ft_split.
+ *
+ * The array and every word come from the arena, so there is nothing to
+ * free word by word; the result goes away with the arena.
+ *
+ * @param arena Arena to allocate from.
+ * @param s String to split.
+ * @param c Delimiter character.
+ * @return NULL-terminated array of words, or NULL on failure.
+ */
+char	**ft_arena_split(t_arena *arena, char const *s, char c)
 {
-	size_t	phys_idx;
+	char	**split;
+	size_t	words;
+	size_t	j;
 
-	if (!d || index >= d->len)
+	if (!s)
 		return (NULL);
-	phys_idx = (d->head + index) % d->cap;
-	return ((char *)d->data + (phys_idx * d->elem_size));
+	words = arena_split__count_words(s, c);
+	split = ft_arena_alloc(arena, (words + 1) * sizeof(char *));
+	if (!split)
+		return (NULL);
+	j = 0;
+	while (j < words)
+	{
+		split[j] = arena_split__next_word(arena, &s, c);
+		if (!split[j++])
+			return (NULL);
+	}
+	split[j] = NULL;
+	return (split);
 }
 
-/* --- ft_deque_new.c --- */
+/* --- ft_arena_str.c --- */
 
 
-t_deque	*ft_deque_new(size_t elem_size, size_t init_cap)
+/**
+ * @brief Duplicate a string into the arena.
+ * @param arena Arena to allocate from.
+ * @param s String to copy.
+ * @return Arena-owned copy, or NULL on failure.
+ */
+char	*ft_arena_strdup(t_arena *arena, const char *s)
 {
-	t_deque	*d;
+	char	*dup;
+	size_t	len;
 
-	if (elem_size == 0)
+	if (!s)
 		return (NULL);
-	d = ft_calloc(1, sizeof(t_deque));
-	if (!d)
+	len = ft_strlen(s);
+	dup = ft_arena_alloc(arena, len + 1);
+	if (!dup)
 		return (NULL);
-	if (init_cap == 0)
-		init_cap = 8;
-	d->data = ft_calloc(init_cap, elem_size);
-	if (!d->data)
-		return (free(d), NULL);
-	d->elem_size = elem_size;
-	d->cap = init_cap;
-	d->head = 0;
-	d->tail = 0;
-	d->len = 0;
-	return (d);
+	ft_memcpy(dup, s, len + 1);
+	return (dup);
 }
 
-void	ft_deque_clear(t_deque *d)
+/**
+ * @brief Arena version of ft_substr.
+ * @param arena Arena to allocate from.
+ * @param s Source string.
+ * @param start Start index in s.
+ * @param len Maximum length of the substring.
+ * @return Arena-owned substring, or NULL on failure.
+ */
+char	*ft_arena_substr(t_arena *arena, char const *s, unsigned int start,
+		size_t len)
 {
-	if (!d)
-		return ;
-	d->head = 0;
-	d->tail = 0;
-	d->len = 0;
+	char	*sub;
+	size_t	slen;
+
+	if (!s)
+		return (NULL);
+	slen = ft_strlen(s);
+	if (start >= slen)
+		len = 0;
+	else if (len > slen - start)
+		len = slen - start;
+	sub = ft_arena_alloc(arena, len + 1);
+	if (!sub)
+		return (NULL);
+	if (len)
+		ft_memcpy(sub, s + start, len);
+	sub[len] = '\0';
+	return (sub);
 }
 
-/* --- ft_deque_pop.c --- */
 
+/* ========================================================================== */
+/*                              ft_pool                                       */
+/* ========================================================================== */
 
-int	ft_deque_pop_front(t_deque *d, void *out)
+/* --- ft_pool_alloc.c --- */
+
+
+/**
+ * @brief Add a chunk and make its objects available for carving.
+ */
+static int	pool_alloc__pool_grow(t_pool *pool)
 {
-	void	*src;
+	unsigned char	*chunk;
 
-	if (!d || d->len == 0)
+	chunk = malloc(pool->chunk_size);
+	if (!chunk)
 		return (0);
-	if (out)
-	{
-		src = (char *)d->data + (d->head * d->elem_size);
-		ft_memcpy(out, src, d->elem_size);
-	}
-	d->head = (d->head + 1) % d->cap;
-	d->len--;
+	ft_memstats_record("ft_pool_alloc", 0, pool->chunk_size);
+	*(void **)chunk = pool->chunks;
+	pool->chunks = chunk;
+	pool->next = chunk + FT_POOL_ALIGN;
+	pool->left = (pool->chunk_size - FT_POOL_ALIGN) / pool->obj_size;
 	return (1);
 }
 
-int	ft_deque_pop_back(t_deque *d, void *out)
+/**
+ * @brief Take one object from the pool.
+ *
+ * Recycled objects come first; otherwise the next object is carved from
+ * the newest chunk, and a new chunk is malloc'd only when that is used
+ * up. The memory is not zeroed.
+ *
+ * @param pool Pool to allocate from.
+ * @return Object aligned to 16 bytes, or NULL on failure.
+ */
+void	*ft_pool_alloc(t_pool *pool)
 {
-	void	*src;
+	void	*obj;
 
-	if (!d || d->len == 0)
-		return (0);
-	d->tail = (d->tail - 1 + d->cap) % d->cap;
-	if (out)
+	if (!pool)
+		return (NULL);
+	if (pool->free_list)
 	{
-		src = (char *)d->data + (d->tail * d->elem_size);
-		ft_memcpy(out, src, d->elem_size);
+		obj = pool->free_list;
+		pool->free_list = *(void **)obj;
+		return (obj);
 	}
-	d->len--;
-	return (1);
+	if (pool->left == 0 && !pool_alloc__pool_grow(pool))
+		return (NULL);
+	obj = pool->next;
+	pool->next += pool->obj_size;
+	pool->left--;
+	return (obj);
 }
 
-/* --- ft_deque_push.c --- */
+/**
+ * @brief Return an object to the pool for reuse.
+ * @param pool Pool the object came from.
+ * @param obj Object to recycle. Safe to pass NULL.
+ * @note Chunk memory is kept until ft_pool_free.
+ */
+void	ft_pool_release(t_pool *pool, void *obj)
+{
+	if (!pool || !obj)
+		return ;
+	*(void **)obj = pool->free_list;
+	pool->free_list = obj;
+}
 
+/* --- ft_pool_allocator.c --- */
 
-static void	deque_push__copy_linearized(t_deque *d, void *new_data)
-{
-	size_t	i;
-	void	*src;
-	void	*dst;
 
-	i = 0;
-	while (i < d->len)
-	{
-		src = (char *)d->data + (((d->head + i) % d->cap) * d->elem_size);
-		dst = (char *)new_data + (i * d->elem_size);
-		ft_memcpy(dst, src, d->elem_size);
-		i++;
-	}
+static void	*pool_allocator__pool_alloc(void *ctx, size_t size)
+{
+	if (size > ((t_pool *)ctx)->obj_size)
+		return (NULL);
+	return (ft_pool_alloc(ctx));
 }
 
-static int	ft_deque_grow(t_deque *d)
+static void	*pool_allocator__pool_realloc(void *ctx, void *ptr, size_t old_size,
+		size_t new_size)
 {
-	void	*new_data;
-	size_t	new_cap;
-
-	new_cap = d->cap * 2;
-	if (new_cap < d->cap)
-		return (0);
-	new_data = ft_calloc(new_cap, d->elem_size);
-	if (!new_data)
-		return (0);
-	deque_push__copy_linearized(d, new_data);
-	free(d->data);
-	d->data = new_data;
-	d->cap = new_cap;
-	d->head = 0;
-	d->tail = d->len;
-	return (1);
+	(void)old_size;
+	if (new_size > ((t_pool *)ctx)->obj_size)
+		return (NULL);
+	if (ptr)
+		return (ptr);
+	return (ft_pool_alloc(ctx));
 }
 
-int	ft_deque_push_front(t_deque *d, const void *elem)
+static void	pool_allocator__pool_free(void *ctx, void *ptr, size_t size)
 {
-	void	*dst;
-
-	if (!d || !elem)
-		return (0);
-	if (d->len == d->cap)
-	{
-		if (!ft_deque_grow(d))
-			return (0);
-	}
-	d->head = (d->head - 1 + d->cap) % d->cap;
-	dst = (char *)d->data + (d->head * d->elem_size);
-	ft_memcpy(dst, elem, d->elem_size);
-	d->len++;
-	return (1);
+	(void)size;
+	ft_pool_release(ctx, ptr);
 }
 
-int	ft_deque_push_back(t_deque *d, const void *elem)
+/**
+ * @brief Allocator that serves blocks of up to obj_size from a pool.
+ *
+ * Larger requests fail, so it suits containers whose every allocation
+ * is bounded (a t_vec with a fixed capacity, list nodes, small structs).
+ *
+ * @param pool Pool to allocate from; must outlive every user.
+ */
+t_allocator	ft_allocator_pool(t_pool *pool)
 {
-	void	*dst;
+	t_allocator	a;
 
-	if (!d || !elem)
-		return (0);
-	if (d->len == d->cap)
-	{
-		if (!ft_deque_grow(d))
-			return (0);
-	}
-	dst = (char *)d->data + (d->tail * d->elem_size);
-	ft_memcpy(dst, elem, d->elem_size);
-	d->tail = (d->tail + 1) % d->cap;
-	d->len++;
-	return (1);
+	a.alloc = pool_allocator__pool_alloc;
+	a.realloc = pool_allocator__pool_realloc;
+	a.free = pool_allocator__pool_free;
+	a.ctx = pool;
+	return (a);
 }
 
-/* --- ft_deque_swap.c --- */
+/* --- ft_pool_lst.c --- */
 
 
-static void	deque_swap__swap_with_buffer(void *first, void *second, char *buf, size_t size)
+/**
+ * @brief Pool version of ft_lstnew.
+ * @param pool Pool created with an object size of at least sizeof(t_list).
+ * @param content Pointer to content for the new node.
+ * @return Pointer to the new node, or NULL on failure.
+ */
+t_list	*ft_pool_lstnew(t_pool *pool, void *content)
 {
-	ft_memcpy(buf, first, size);
-	ft_memcpy(first, second, size);
-	ft_memcpy(second, buf, size);
+	t_list	*node;
+
+	if (!pool || pool->obj_size < sizeof(t_list))
+		return (NULL);
+	node = ft_pool_alloc(pool);
+	if (!node)
+		return (NULL);
+	node->content = content;
+	node->next = NULL;
+	return (node);
 }
 
-void	ft_deque_swap(t_deque *d)
+/**
+ * @brief Pool version of ft_lstdelone: the node goes back to the pool.
+ * @param pool Pool the node came from.
+ * @param lst Node to delete.
+ * @param del Content destructor (can be NULL).
+ */
+void	ft_pool_lstdelone(t_pool *pool, t_list *lst, void (*del)(void *))
 {
-	void	*first;
-	void	*second;
-	char	stack_buf[64];
-	void	*heap_buf;
-
-	if (!d || d->len < 2)
+	if (!lst)
 		return ;
-	first = ft_deque_get(d, 0);
-	second = ft_deque_get(d, 1);
-	if (d->elem_size <= 64)
-		deque_swap__swap_with_buffer(first, second, stack_buf, d->elem_size);
-	else
-	{
-		heap_buf = malloc(d->elem_size);
-		if (!heap_buf)
-			return ;
-		deque_swap__swap_with_buffer(first, second, heap_buf, d->elem_size);
-		free(heap_buf);
-	}
+	if (del)
+		del(lst->content);
+	ft_pool_release(pool, lst);
 }
 
-/* --- ft_deque_utils.c --- */
-
-
-void	ft_deque_free(t_deque *d)
+/**
+ * @brief Pool version of ft_lstclear.
+ * @param pool Pool the nodes came from.
+ * @param lst Address of the first node; set to NULL.
+ * @param del Content destructor (can be NULL).
+ */
+void	ft_pool_lstclear(t_pool *pool, t_list **lst, void (*del)(void *))
 {
-	if (!d)
+	t_list	*next;
+
+	if (!lst)
 		return ;
-	if (d->data)
-		free(d->data);
-	free(d);
+	while (*lst)
+	{
+		next = (*lst)->next;
+		ft_pool_lstdelone(pool, *lst, del);
+		*lst = next;
+	}
 }
 
-int	ft_deque_is_empty(t_deque *d)
-{
-	if (!d)
-		return (1);
-	return (d->len == 0);
-}
+/* --- ft_pool_new.c --- */
 
-int	ft_deque_is_full(t_deque *d)
-{
-	if (!d)
-		return (0);
-	return (d->len == d->cap);
-}
 
-void	ft_deque_rotate(t_deque *d)
+/**
+ * @brief Create a pool of fixed-size objects.
+ *
+ * No memory is reserved until the first allocation.
+ *
+ * @param obj_size Size of every object (must be > 0).
+ * @return New pool, or NULL on failure or absurd sizes.
+ */
+t_pool	*ft_pool_new(size_t obj_size)
 {
-	void	*first;
-	void	*back;
+	t_pool	*pool;
 
-	if (!d || d->len <= 1)
-		return ;
-	first = (char *)d->data + (d->head * d->elem_size);
-	back = (char *)d->data + (d->tail * d->elem_size);
-	ft_memcpy(back, first, d->elem_size);
-	d->head = (d->head + 1) % d->cap;
-	d->tail = (d->tail + 1) % d->cap;
+	if (obj_size == 0 || obj_size > (SIZE_MAX - FT_POOL_ALIGN)
+		/ (FT_POOL_MIN_OBJS + 1))
+		return (NULL);
+	pool = ft_allocator_calloc(NULL, 1, sizeof(t_pool));
+	if (!pool)
+		return (NULL);
+	ft_memstats_record("ft_pool_new", 0, sizeof(t_pool));
+	pool->obj_size = (obj_size + FT_POOL_ALIGN - 1)
+		& ~(size_t)(FT_POOL_ALIGN - 1);
+	pool->chunk_size = FT_POOL_CHUNK;
+	if (pool->obj_size * FT_POOL_MIN_OBJS > FT_POOL_CHUNK - FT_POOL_ALIGN)
+		pool->chunk_size = FT_POOL_ALIGN + pool->obj_size * FT_POOL_MIN_OBJS;
+	return (pool);
 }
 
-void	ft_deque_rrotate(t_deque *d)
+/**
+ * @brief Free a pool and every object in it, live or not.
+ * @param pool Pool to free. Safe to call with NULL.
+ */
+void	ft_pool_free(t_pool *pool)
 {
-	void	*last;
-	void	*front;
-	size_t	last_idx;
+	void	*prev;
 
-	if (!d || d->len <= 1)
-		return ;
-	last_idx = (d->tail - 1 + d->cap) % d->cap;
-	last = (char *)d->data + (last_idx * d->elem_size);
-	d->head = (d->head - 1 + d->cap) % d->cap;
-	d->tail = (d->tail - 1 + d->cap) % d->cap;
-	front = (char *)d->data + (d->head * d->elem_size);
-	ft_memcpy(front, last, d->elem_size);
+	if (!pool)
+		return ;
+	while (pool->chunks)
+	{
+		prev = *(void **)pool->chunks;
+		ft_memstats_record("ft_pool_free", pool->chunk_size, 0);
+		free(pool->chunks);
+		pool->chunks = prev;
+	}
+	ft_memstats_record("ft_pool_free", sizeof(t_pool), 0);
+	free(pool);
 }
 
 
 /* ========================================================================== */
-/*                          ft_vec_math                                       */
+/*                          ft_memstats                                       */
 /* ========================================================================== */
 
-/* --- ft_vec2_basic.c --- */
+/* --- ft_memstats_dump.c --- */
 
 
-t_vec2	ft_vec2_new(double x, double y)
+static void	memstats_dump__put_size(int fd, size_t n)
 {
-	t_vec2	v;
+	char	buf[24];
+	size_t	i;
 
-	v.x = x;
-	v.y = y;
-	return (v);
+	i = sizeof(buf);
+	buf[--i] = '\0';
+	buf[--i] = (char)('0' + n % 10);
+	while (n >= 10)
+	{
+		n /= 10;
+		buf[--i] = (char)('0' + n % 10);
+	}
+	ft_putstr_fd(buf + i, fd);
 }
 
-t_vec2	ft_vec2_add(t_vec2 a, t_vec2 b)
+static void	memstats_dump__put_field(int fd, char *label, size_t n)
 {
-	t_vec2	result;
-
-	result.x = a.x + b.x;
-	result.y = a.y + b.y;
-	return (result);
+	ft_putstr_fd(label, fd);
+	memstats_dump__put_size(fd, n);
 }
 
-t_vec2	ft_vec2_sub(t_vec2 a, t_vec2 b)
+/**
+ * @brief One line per site: totals, then the non-empty histogram buckets
+ *        as "<=bytes:count" (">bytes:count" for the overflow bucket).
+ */
+static void	memstats_dump__dump_site(int fd, const t_memsite *site)
 {
-	t_vec2	result;
-
-	result.x = a.x - b.x;
-	result.y = a.y - b.y;
-	return (result);
+	size_t	b;
+
+	ft_putstr_fd("  ", fd);
+	ft_putstr_fd((char *)site->name, fd);
+	memstats_dump__put_field(fd, " calls=", site->calls);
+	memstats_dump__put_field(fd, " bytes=", site->bytes);
+	memstats_dump__put_field(fd, " max=", site->max_request);
+	b = 0;
+	while (b < FT_MEMSTATS_BUCKETS)
+	{
+		if (site->hist[b] && b + 1 < FT_MEMSTATS_BUCKETS)
+			memstats_dump__put_field(fd, " <=", (size_t)16 << b);
+		else if (site->hist[b])
+			memstats_dump__put_field(fd, " >", (size_t)16 << (b - 1));
+		if (site->hist[b])
+			memstats_dump__put_field(fd, ":", site->hist[b]);
+		b++;
+	}
+	ft_putchar_fd('\n', fd);
 }
 
-t_vec2	ft_vec2_scale(t_vec2 v, double s)
+void	ft_memstats_dump(int fd)
 {
-	t_vec2	result;
+	size_t	i;
 
-	result.x = v.x * s;
-	result.y = v.y * s;
-	return (result);
+	if (!g_memstats.enabled)
+	{
+		ft_putstr_fd("memstats: disabled (build libft with MEMSTATS=1)\n",
+			fd);
+		return ;
+	}
+	memstats_dump__put_field(fd, "memstats: allocs=", g_memstats.allocs);
+	memstats_dump__put_field(fd, " reallocs=", g_memstats.reallocs);
+	memstats_dump__put_field(fd, " frees=", g_memstats.frees);
+	memstats_dump__put_field(fd, " total=", g_memstats.bytes_total);
+	memstats_dump__put_field(fd, " live=", g_memstats.bytes_live);
+	memstats_dump__put_field(fd, " peak=", g_memstats.bytes_peak);
+	ft_putchar_fd('\n', fd);
+	i = 0;
+	while (i < g_memstats.nsites)
+		memstats_dump__dump_site(fd, &g_memstats.sites[i++]);
 }
 
-/* --- ft_vec2_ops.c --- */
+/* --- ft_memstats_get.c --- */
 
-#include <math.h>
 
-#define FT_EPSILON 1e-10
+t_memstats	g_memstats = {.enabled = FT_MEMSTATS_ENABLED,
+	.sites[FT_MEMSTATS_SITES - 1].name = FT_MEMSTATS_OTHER};
 
-double	ft_vec2_dot(t_vec2 a, t_vec2 b)
+const t_memstats	*ft_memstats_get(void)
 {
-	return (a.x * b.x + a.y * b.y);
+	return (&g_memstats);
 }
 
-double	ft_vec2_len(t_vec2 v)
+void	ft_memstats_reset(void)
 {
-	return (sqrt(v.x * v.x + v.y * v.y));
+	ft_bzero(&g_memstats, sizeof(g_memstats));
+	g_memstats.enabled = FT_MEMSTATS_ENABLED;
+	g_memstats.sites[FT_MEMSTATS_SITES - 1].name = FT_MEMSTATS_OTHER;
 }
 
-double	ft_vec2_len_sq(t_vec2 v)
+/* --- ft_memstats_off.c --- */
+
+
+#ifndef FT_MEMSTATS
+
+void	ft_memstats_record(const char *site, size_t old_size, size_t new_size)
 {
-	return (v.x * v.x + v.y * v.y);
+	(void)site;
+	(void)old_size;
+	(void)new_size;
 }
 
-t_vec2	ft_vec2_norm(t_vec2 v)
+void	ft_memstats_note(const char *site, size_t size)
 {
-	double	len;
-	t_vec2	result;
-
-	len = ft_vec2_len(v);
-	if (len < FT_EPSILON && len > -FT_EPSILON)
-		return (ft_vec2_new(0, 0));
-	result.x = v.x / len;
-	result.y = v.y / len;
-	return (result);
+	(void)site;
+	(void)size;
 }
 
-double	ft_vec2_dist(t_vec2 a, t_vec2 b)
+void	ft_memstats_alloc(const t_allocator *a, const char *site,
+		size_t old_size, size_t new_size)
 {
-	return (ft_vec2_len(ft_vec2_sub(b, a)));
+	(void)a;
+	(void)site;
+	(void)old_size;
+	(void)new_size;
 }
 
-/* --- ft_vec2_transform.c --- */
+#endif
 
-#include <math.h>
+/* --- ft_memstats_record.c --- */
 
-t_vec2	ft_vec2_lerp(t_vec2 a, t_vec2 b, double t)
-{
-	t_vec2	result;
 
-	result.x = a.x + t * (b.x - a.x);
-	result.y = a.y + t * (b.y - a.y);
-	return (result);
+#ifdef FT_MEMSTATS
+
+void	ft_memstats_record(const char *site, size_t old_size, size_t new_size)
+{
+	if (old_size == 0 && new_size == 0)
+		return ;
+	if (old_size == 0)
+		g_memstats.allocs++;
+	else if (new_size == 0)
+		g_memstats.frees++;
+	else
+		g_memstats.reallocs++;
+	g_memstats.bytes_total += new_size;
+	g_memstats.bytes_live += new_size;
+	g_memstats.bytes_live -= old_size;
+	if (g_memstats.bytes_live > g_memstats.bytes_peak)
+		g_memstats.bytes_peak = g_memstats.bytes_live;
+	ft_memstats_site_hit(site, new_size);
 }
 
-t_vec2	ft_vec2_rotate(t_vec2 v, double angle)
+void	ft_memstats_note(const char *site, size_t size)
 {
-	t_vec2	result;
-	double	c;
-	double	s;
+	g_memstats.allocs++;
+	g_memstats.bytes_total += size;
+	ft_memstats_site_hit(site, size);
+}
 
-	c = cos(angle);
-	s = sin(angle);
-	result.x = v.x * c - v.y * s;
-	result.y = v.x * s + v.y * c;
-	return (result);
+void	ft_memstats_alloc(const t_allocator *a, const char *site,
+		size_t old_size, size_t new_size)
+{
+	if (a && a->alloc && a->alloc != ft_allocator_heap().alloc)
+		return ;
+	ft_memstats_record(site, old_size, new_size);
 }
 
-/* --- ft_vec3_basic.c --- */
+#endif
 
+/* --- ft_memstats_site.c --- */
 
-t_vec3	ft_vec3_new(double x, double y, double z)
+
+#ifdef FT_MEMSTATS
+
+/**
+ * @brief Histogram bucket of a request: sizes up to 16 << b bytes.
+ */
+static size_t	memstats_site__bucket_of(size_t size)
 {
-	t_vec3	v;
+	size_t	b;
 
-	v.x = x;
-	v.y = y;
-	v.z = z;
-	return (v);
+	if (size <= 16)
+		return (0);
+	b = (size_t)(64 - __builtin_clzll((unsigned long long)(size - 1))) - 4;
+	if (b >= FT_MEMSTATS_BUCKETS)
+		b = FT_MEMSTATS_BUCKETS - 1;
+	return (b);
 }
 
-t_vec3	ft_vec3_add(t_vec3 a, t_vec3 b)
+/**
+ * @brief Find the slot for site, adding it if new.
+ *
+ * Sites are compared by pointer first and by content second, so the same
+ * literal from two translation units lands in one slot. The last slot is
+ * reserved: once the other FT_MEMSTATS_SITES - 1 are named, new sites all
+ * land in "(other)", which then counts in nsites.
+ */
+static t_memsite	*memstats_site__site_slot(const char *site)
 {
-	t_vec3	result;
+	size_t	i;
 
-	result.x = a.x + b.x;
-	result.y = a.y + b.y;
-	result.z = a.z + b.z;
-	return (result);
+	i = 0;
+	while (i < g_memstats.nsites)
+	{
+		if (g_memstats.sites[i].name == site
+			|| !ft_strcmp(g_memstats.sites[i].name, site))
+			return (&g_memstats.sites[i]);
+		i++;
+	}
+	if (g_memstats.nsites >= FT_MEMSTATS_SITES - 1)
+	{
+		g_memstats.nsites = FT_MEMSTATS_SITES;
+		return (&g_memstats.sites[FT_MEMSTATS_SITES - 1]);
+	}
+	g_memstats.sites[g_memstats.nsites].name = site;
+	return (&g_memstats.sites[g_memstats.nsites++]);
 }
 
-t_vec3	ft_vec3_sub(t_vec3 a, t_vec3 b)
+/**
+ * @brief Count one event at site; size 0 is a release.
+ */
+void	ft_memstats_site_hit(const char *site, size_t size)
 {
-	t_vec3	result;
+	t_memsite	*slot;
 
-	result.x = a.x - b.x;
-	result.y = a.y - b.y;
-	result.z = a.z - b.z;
-	return (result);
+	slot = memstats_site__site_slot(site);
+	slot->calls++;
+	if (size == 0)
+		return ;
+	slot->bytes += size;
+	if (size > slot->max_request)
+		slot->max_request = size;
+	slot->hist[memstats_site__bucket_of(size)]++;
 }
 
-t_vec3	ft_vec3_scale(t_vec3 v, double s)
+#endif
+
+
+/* ========================================================================== */
+/*                           ft_strpool                                       */
+/* ========================================================================== */
+
+/* --- ft_strpool_hash.c --- */
+
+
+/**
+ * @brief djb2 over len bytes; the same value ft_hashmap computes for a
+ *        NUL-terminated key.
+ */
+size_t	ft_strpool_hash_bytes(const char *s, size_t len)
 {
-	t_vec3	result;
+	size_t				hash;
+	const unsigned char	*p;
 
-	result.x = v.x * s;
-	result.y = v.y * s;
-	result.z = v.z * s;
-	return (result);
+	hash = 5381;
+	p = (const unsigned char *)s;
+	while (len--)
+		hash = ((hash << 5) + hash) + *p++;
+	return (hash);
 }
 
-t_vec3	ft_vec3_negate(t_vec3 v)
+/**
+ * @brief Home slot of hash in the pool's table.
+ */
+size_t	ft_strpool_index(const t_strpool *pool, size_t hash)
 {
-	return (ft_vec3_new(-v.x, -v.y, -v.z));
+	return ((size_t)(((uint64_t)hash * FT_STRPOOL_MIX) >> 32)
+		& (pool->cap - 1));
 }
 
-/* --- ft_vec3_norm.c --- */
+/**
+ * @brief Cached hash of an interned string: O(1), no byte is read.
+ * @param istr String returned by ft_strpool_intern (any pool).
+ */
+size_t	ft_strpool_hash(const char *istr)
+{
+	return (((const t_strpool_head *)istr - 1)->hash);
+}
 
+/**
+ * @brief Cached length of an interned string: O(1).
+ * @param istr String returned by ft_strpool_intern (any pool).
+ */
+size_t	ft_strpool_len(const char *istr)
+{
+	return (((const t_strpool_head *)istr - 1)->len);
+}
 
-#define FT_EPSILON 1e-10
+/* --- ft_strpool_intern.c --- */
 
-t_vec3	ft_vec3_norm(t_vec3 v)
+
+/**
+ * @brief Linear probe for s from its home slot.
+ * @return The slot holding s, or the empty slot that ends its run.
+ */
+t_strpool_slot	*ft_strpool_probe(const t_strpool *pool, const char *s,
+		size_t len, size_t hash)
 {
-	double	len;
-	t_vec3	result;
+	t_strpool_slot	*slot;
+	size_t			i;
 
-	len = ft_vec3_len(v);
-	if (len < FT_EPSILON && len > -FT_EPSILON)
-		return (ft_vec3_new(0, 0, 0));
-	result.x = v.x / len;
-	result.y = v.y / len;
-	result.z = v.z / len;
-	return (result);
+	i = ft_strpool_index(pool, hash);
+	while (1)
+	{
+		slot = pool->slots + i;
+		if (!slot->str || (slot->hash == hash
+				&& ft_strpool_len(slot->str) == len
+				&& ft_memcmp(slot->str, s, len) == 0))
+			return (slot);
+		i = (i + 1) & (pool->cap - 1);
+	}
 }
 
-/* --- ft_vec3_ops.c --- */
-
-#include <math.h>
-
-double	ft_vec3_dot(t_vec3 a, t_vec3 b)
+/**
+ * @brief Copy s behind its header into the arena.
+ */
+static const char	*strpool_intern__store(t_strpool *pool, const char *s, size_t len,
+		size_t hash)
 {
-	return (a.x * b.x + a.y * b.y + a.z * b.z);
+	t_strpool_head	*head;
+	char			*str;
+
+	if (len > SIZE_MAX - sizeof(t_strpool_head) - 1)
+		return (NULL);
+	head = ft_arena_alloc(pool->strings, sizeof(t_strpool_head) + len + 1);
+	if (!head)
+		return (NULL);
+	head->hash = hash;
+	head->len = len;
+	str = (char *)(head + 1);
+	ft_memcpy(str, s, len);
+	str[len] = '\0';
+	return (str);
 }
 
-t_vec3	ft_vec3_cross(t_vec3 a, t_vec3 b)
+/**
+ * @brief Canonical copy of the len bytes at s (which need not be
+ *        NUL-terminated), added on first sight.
+ *
+ * Equal byte strings always yield the same pointer, so interned strings
+ * compare with ==.
+ *
+ * @return The interned string, or NULL on allocation failure.
+ */
+const char	*ft_strpool_intern_len(t_strpool *pool, const char *s,
+		size_t len)
 {
-	t_vec3	result;
+	t_strpool_slot	*slot;
+	size_t			hash;
 
-	result.x = a.y * b.z - a.z * b.y;
-	result.y = a.z * b.x - a.x * b.z;
-	result.z = a.x * b.y - a.y * b.x;
-	return (result);
+	if (!pool || (!s && len))
+		return (NULL);
+	hash = ft_strpool_hash_bytes(s, len);
+	slot = ft_strpool_probe(pool, s, len, hash);
+	if (slot->str)
+		return (slot->str);
+	if ((pool->count + 1) * 2 > pool->cap)
+	{
+		if (!ft_strpool_grow(pool))
+			return (NULL);
+		slot = ft_strpool_probe(pool, s, len, hash);
+	}
+	slot->str = strpool_intern__store(pool, s, len, hash);
+	if (!slot->str)
+		return (NULL);
+	slot->hash = hash;
+	pool->count++;
+	return (slot->str);
 }
 
-double	ft_vec3_len(t_vec3 v)
+/**
+ * @brief ft_strpool_intern_len for a NUL-terminated string.
+ */
+const char	*ft_strpool_intern(t_strpool *pool, const char *s)
 {
-	return (sqrt(v.x * v.x + v.y * v.y + v.z * v.z));
+	if (!s)
+		return (NULL);
+	return (ft_strpool_intern_len(pool, s, ft_strlen(s)));
 }
 
-double	ft_vec3_len_sq(t_vec3 v)
+/**
+ * @brief Canonical copy of s if it was interned, without adding it.
+ * @return The interned string, or NULL if s is not in the pool.
+ */
+const char	*ft_strpool_find(const t_strpool *pool, const char *s)
 {
-	return (v.x * v.x + v.y * v.y + v.z * v.z);
+	size_t	len;
+
+	if (!pool || !s)
+		return (NULL);
+	len = ft_strlen(s);
+	return (ft_strpool_probe(pool, s, len,
+			ft_strpool_hash_bytes(s, len))->str);
 }
 
-double	ft_vec3_dist(t_vec3 a, t_vec3 b)
+/* --- ft_strpool_new.c --- */
+
+
+static t_strpool_slot	*strpool_new__slots_new(size_t cap)
 {
-	return (ft_vec3_len(ft_vec3_sub(b, a)));
+	t_strpool_slot	*slots;
+
+	slots = ft_allocator_calloc(NULL, cap, sizeof(t_strpool_slot));
+	if (slots)
+		ft_memstats_record("ft_strpool_slots", 0,
+			cap * sizeof(t_strpool_slot));
+	return (slots);
 }
 
-/* --- ft_vec3_transform.c --- */
+/**
+ * @brief Create an empty interning pool.
+ *
+ * Strings are copied into an arena owned by the pool and stay there,
+ * at a fixed address, until ft_strpool_free.
+ *
+ * @return New pool, or NULL on allocation failure.
+ */
+t_strpool	*ft_strpool_new(void)
+{
+	t_strpool	*pool;
 
+	pool = ft_allocator_calloc(NULL, 1, sizeof(t_strpool));
+	if (!pool)
+		return (NULL);
+	pool->strings = ft_arena_new(FT_STRPOOL_BLOCK);
+	pool->slots = strpool_new__slots_new(FT_STRPOOL_INIT_CAP);
+	if (!pool->strings || !pool->slots)
+	{
+		ft_arena_free(pool->strings);
+		free(pool->slots);
+		free(pool);
+		return (NULL);
+	}
+	pool->cap = FT_STRPOOL_INIT_CAP;
+	ft_memstats_record("ft_strpool_new", 0, sizeof(t_strpool));
+	return (pool);
+}
 
-t_vec3	ft_vec3_lerp(t_vec3 a, t_vec3 b, double t)
+/**
+ * @brief Free a pool and every string interned in it.
+ * @param pool Pool to free. Safe to call with NULL.
+ * @note Maps created with ft_hashmap_new_interned on this pool must be
+ *       freed first.
+ */
+void	ft_strpool_free(t_strpool *pool)
 {
-	t_vec3	result;
+	if (!pool)
+		return ;
+	ft_memstats_record("ft_strpool_slots",
+		pool->cap * sizeof(t_strpool_slot), 0);
+	ft_memstats_record("ft_strpool_free", sizeof(t_strpool), 0);
+	ft_arena_free(pool->strings);
+	free(pool->slots);
+	free(pool);
+}
 
-	result.x = a.x + t * (b.x - a.x);
-	result.y = a.y + t * (b.y - a.y);
-	result.z = a.z + t * (b.z - a.z);
-	return (result);
+static void	strpool_new__place(t_strpool *pool, const t_strpool_slot *slot)
+{
+	size_t	i;
+
+	i = ft_strpool_index(pool, slot->hash);
+	while (pool->slots[i].str)
+		i = (i + 1) & (pool->cap - 1);
+	pool->slots[i] = *slot;
 }
 
-t_vec3	ft_vec3_reflect(t_vec3 v, t_vec3 normal)
+/**
+ * @brief Double the table. Slots carry their hash, so moving them reads
+ *        no string.
+ */
+int	ft_strpool_grow(t_strpool *pool)
 {
-	double	d;
+	t_strpool	next;
+	size_t		i;
 
-	d = 2.0 * ft_vec3_dot(v, normal);
-	return (ft_vec3_sub(v, ft_vec3_scale(normal, d)));
+	if (pool->cap > SIZE_MAX / 2 / sizeof(t_strpool_slot))
+		return (0);
+	next.cap = pool->cap * 2;
+	next.slots = strpool_new__slots_new(next.cap);
+	if (!next.slots)
+		return (0);
+	i = 0;
+	while (i < pool->cap)
+	{
+		if (pool->slots[i].str)
+			strpool_new__place(&next, pool->slots + i);
+		i++;
+	}
+	ft_memstats_record("ft_strpool_slots",
+		pool->cap * sizeof(t_strpool_slot), 0);
+	free(pool->slots);
+	pool->slots = next.slots;
+	pool->cap = next.cap;
+	return (1);
 }
 
 
@@ -12,42 +12,38 @@ set -e
 
 SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
 PROJECT_ROOT="$(dirname "$SCRIPT_DIR")"
-HEADER_FILE="$PROJECT_ROOT/includes/libft.h"
+INCLUDE_DIR="$PROJECT_ROOT/includes"
+HEADER_FILE="$INCLUDE_DIR/libft.h"
 SOURCE_DIR="$PROJECT_ROOT/srcs"
 
 # Module order (logical grouping)
 MODULES=(
 	"ft_is"
+	"ft_simd"
 	"ft_mem"
 	"ft_str"
+	"ft_sv"
+	"ft_charset"
+	"ft_strbuf"
+	"ft_acmatch"
+	"ft_conv"
 	"ft_put"
 	"ft_printf"
 	"ft_lst"
 	"ft_vec"
 	"ft_deque"
+	"ft_hashmap"
 	"ft_vec_math"
+	"ft_alloc"
+	"ft_arena"
+	"ft_pool"
+	"ft_memstats"
+	"ft_strpool"
 )
 
-# Function to process a source file
-# Strips 42 header, removes #include "libft.h", and renames static helpers
-process_source() {
-	local src_file="$1"
-	local filename=$(basename "$src_file" .c)
-	# Create prefix from filename (remove ft_ prefix and _bonus suffix)
-	local prefix=$(echo "$filename" | sed 's/^ft_//' | sed 's/_bonus$//')
-
-	# First pass: find static function names (non ft_ prefixed)
-	local static_funcs=$(grep -E '^static[ 	]+(int|void|char|size_t|long|unsigned)[ 	]+[a-z_]+[ 	]*\(' "$src_file" 2>/dev/null | \
-		sed -E 's/^static[ 	]+(int|void|char|size_t|long|unsigned)[ 	]+([a-z_]+)[ 	]*\(.*/\2/' | \
-		grep -v '^ft_' || true)
-
-	# Build sed commands for renaming
-	local sed_cmds=""
-	for func in $static_funcs; do
-		sed_cmds="$sed_cmds -e s/${func}/${prefix}__${func}/g"
-	done
-
-	# Process the file: strip header, strip include, apply renames
+# Strip the 12-line 42 header and every local #include (libft.h and the
+# internal headers are all inlined above the implementation)
+strip_file() {
 	awk '
 		BEGIN { in_header = 1; header_lines = 0 }
 		in_header && header_lines < 12 && /^\/\*|^\*\*|^\*\/|^[ 	]*\*/ {
@@ -55,10 +51,71 @@ process_source() {
 			next
 		}
 		{ in_header = 0 }
-		/^# *include.*"libft\.h"/ { next }
+		/^# *include *"/ { next }
 		NR == header_lines + 1 && /^$/ { next }
 		{ print }
-	' "$src_file" | if [ -n "$sed_cmds" ]; then sed $sed_cmds; else cat; fi
+	' "$1"
+}
+
+# Internal header, without its 42 header and local includes
+process_header() {
+	printf '/* --- %s --- */\n\n' "$(basename "$1")"
+	strip_file "$1"
+	printf '\n'
+}
+
+# Function to process a source file
+# Strips 42 header and local includes, and renames file-local statics
+# (helpers and tables) so that equal names in different files don't clash
+process_source() {
+	local src_file="$1"
+	local filename=$(basename "$src_file" .c)
+	# Create prefix from filename (remove ft_ prefix and _bonus suffix)
+	local prefix=$(echo "$filename" | sed 's/^ft_//' | sed 's/_bonus$//')
+
+	strip_file "$src_file" | perl -e '
+		my $prefix = shift;
+		my @lines = <STDIN>;
+		my %names;
+		for (@lines) {
+			$names{$1} = 1
+				if /^static\b[^(=\[;]*?\b([A-Za-z_]\w*)\s*[(\[=;]/;
+		}
+		for my $line (@lines) {
+			for my $n (keys %names) {
+				$line =~ s/(?<![.>\w])$n\b/${prefix}__$n/g;
+			}
+			print $line;
+		}
+	' "$prefix"
+}
+
+# *_sse42.c / *_avx2.c units are built with -msse4.2 / -mavx2 in the
+# Makefile. Here the same code is compiled for that target through a
+# pragma, and its #if defined(__SSE4_2__) / (__AVX2__) guard becomes the
+# __SSE2__ guard the dispatcher binds the kernels under.
+process_simd_source() {
+	local target="$1"
+	local src_file="$2"
+
+	printf '#if defined(__SSE2__)\n'
+	printf '# if defined(__clang__)\n'
+	printf '#  pragma clang attribute push (__attribute__((target("%s"))), apply_to = function)\n' "$target"
+	printf '# elif defined(__GNUC__)\n'
+	printf '#  pragma GCC push_options\n'
+	printf '#  pragma GCC target("%s")\n' "$target"
+	printf '# endif\n'
+	printf '#endif\n\n'
+	process_source "$src_file" \
+		| sed -e 's/defined(__SSE4_2__)/defined(__SSE2__)/' \
+			-e 's/defined(__AVX2__)/defined(__SSE2__)/'
+	printf '\n#if defined(__SSE2__)\n'
+	printf '# if defined(__clang__)\n'
+	printf '#  pragma clang attribute pop\n'
+	printf '# elif defined(__GNUC__)\n'
+	printf '#  pragma GCC pop_options\n'
+	printf '# endif\n'
+	printf '#endif\n'
 }
 
 # Output the header section (declarations)
@@ -79,8 +136,21 @@ cat << 'IMPL_START'
 
 #ifdef LIBFT_IMPLEMENTATION
 
+/* Every intrinsic, for the kernels compiled under a target pragma */
+# if defined(__SSE2__)
+#  include <immintrin.h>
+# endif
+
 IMPL_START
 
+# Internal headers, in module order: ft_simd_internal.h comes first and
+# the other module headers build on it
+for module in "${MODULES[@]}"; do
+	for hdr in $(find "$SOURCE_DIR/$module" -name '*.h' -type f 2>/dev/null | sort); do
+		process_header "$hdr"
+	done
+done
+
 # Process each module in order
 for module in "${MODULES[@]}"; do
 	module_dir="$SOURCE_DIR/$module"
@@ -98,7 +168,11 @@ for module in "${MODULES[@]}"; do
 		find "$module_dir" -name '*.c' -type f | sort | while read -r src_file; do
 			filename=$(basename "$src_file")
 			printf '/* --- %s --- */\n\n' "$filename"
-			process_source "$src_file"
+			case "$filename" in
+				*_avx2.c) process_simd_source "avx2" "$src_file" ;;
+				*_sse42.c) process_simd_source "sse4.2" "$src_file" ;;
+				*) process_source "$src_file" ;;
+			esac
 			printf '\n'
 		done
 	fi
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_acmatch_add.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:26:30 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:26:30 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_acmatch_internal.h"
+
+static uint32_t	trie_child(const t_acmatch *ac, uint32_t s, unsigned char c)
+{
+	const t_acedge	*edges;
+	uint32_t		e;
+
+	edges = ac->edges->data;
+	e = ft_acmatch_node(ac, s)->edge;
+	while (e && edges[e].byte != c)
+		e = edges[e].next;
+	if (!e)
+		return (0);
+	return (edges[e].child);
+}
+
+/**
+ * @brief Append a child of s on byte c and link it into s's edge list.
+ * @return The new node, or 0 on allocation failure.
+ */
+static uint32_t	trie_grow(t_acmatch *ac, uint32_t s, unsigned char c)
+{
+	t_acnode	node;
+	t_acedge	edge;
+
+	if (ac->nodes->len >= UINT32_MAX || ac->edges->len >= UINT32_MAX)
+		return (0);
+	ft_bzero(&node, sizeof(node));
+	node.depth = ft_acmatch_node(ac, s)->depth + 1;
+	edge.child = (uint32_t)ac->nodes->len;
+	edge.next = ft_acmatch_node(ac, s)->edge;
+	edge.byte = c;
+	if (!ft_vec_push(ac->nodes, &node))
+		return (0);
+	if (!ft_vec_push(ac->edges, &edge))
+	{
+		ac->nodes->len--;
+		return (0);
+	}
+	ft_acmatch_node(ac, s)->edge = (uint32_t)ac->edges->len - 1;
+	return (edge.child);
+}
+
+int	ft_acmatch_add(t_acmatch *ac, const char *pat, size_t len)
+{
+	uint32_t	s;
+	uint32_t	t;
+	size_t		i;
+
+	if (!ac || ac->built || !pat || !len || ac->npatterns >= UINT32_MAX - 1)
+		return (0);
+	s = 0;
+	i = 0;
+	while (i < len)
+	{
+		t = trie_child(ac, s, (unsigned char)pat[i]);
+		if (!t)
+			t = trie_grow(ac, s, (unsigned char)pat[i]);
+		if (!t)
+			return (0);
+		s = t;
+		i++;
+	}
+	if (!ft_acmatch_node(ac, s)->out)
+		ft_acmatch_node(ac, s)->out = (uint32_t)ac->npatterns + 1;
+	ac->npatterns++;
+	return (1);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_acmatch_build.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:31:56 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:31:56 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_acmatch_internal.h"
+
+/**
+ * @brief Failure and dictionary links of child v of u on byte c.
+ *
+ * u is already laid out, and so is every node on its fail chain (they
+ * are shallower), so the fail link is one automaton step from fail(u).
+ */
+static void	link_child(t_acmatch *ac, uint32_t u, uint32_t v, unsigned char c)
+{
+	t_acnode	*child;
+	t_acnode	*fail;
+
+	child = ft_acmatch_node(ac, v);
+	if (u == 0)
+	{
+		ac->root[c] = v;
+		child->fail = 0;
+	}
+	else
+		child->fail = ft_acmatch_step(ac, ft_acmatch_node(ac, u)->fail, c);
+	fail = ft_acmatch_node(ac, child->fail);
+	child->dict = fail->dict;
+	if (fail->out)
+		child->dict = child->fail;
+}
+
+/**
+ * @brief Lay out the next queued node: copy its edge list into one
+ *        contiguous run, link and enqueue its children.
+ *
+ * The new edge vector is created with room for every edge, so the pushes
+ * never reallocate and cannot fail halfway through the layout.
+ */
+static void	expand(t_acbuild *b)
+{
+	t_acedge	edge;
+	t_acnode	*node;
+	uint32_t	u;
+	uint32_t	e;
+
+	u = b->queue[b->head++];
+	node = ft_acmatch_node(b->ac, u);
+	e = node->edge;
+	node->edge = (uint32_t)b->ac->edges->len;
+	node->nedges = 0;
+	while (e)
+	{
+		edge = ((t_acedge *)b->list->data)[e];
+		ft_vec_push(b->ac->edges, &edge);
+		node->nedges++;
+		link_child(b->ac, u, edge.child, edge.byte);
+		b->queue[b->tail++] = edge.child;
+		e = edge.next;
+	}
+}
+
+static int	build_abort(t_acbuild *b)
+{
+	free(b->queue);
+	ft_vec_free(b->ac->edges);
+	b->ac->edges = b->list;
+	return (0);
+}
+
+/**
+ * Breadth-first over the trie: the edge lists are rebuilt into a fresh
+ * vector so the edges of each node end up contiguous, and nodes are laid
+ * out before anything deeper asks for their transitions.
+ */
+int	ft_acmatch_build(t_acmatch *ac)
+{
+	t_acbuild	b;
+	size_t		size;
+
+	if (!ac || ac->built)
+		return (ac != NULL);
+	size = ac->nodes->len * sizeof(uint32_t);
+	b.ac = ac;
+	b.list = ac->edges;
+	b.queue = malloc(size);
+	ac->edges = ft_vec_new(sizeof(t_acedge), b.list->len);
+	if (!b.queue || !ac->edges)
+		return (build_abort(&b));
+	b.head = 0;
+	b.tail = 1;
+	b.queue[0] = 0;
+	while (b.head < b.tail)
+		expand(&b);
+	ft_vec_free(b.list);
+	free(b.queue);
+	ac->built = 1;
+	return (1);
+}
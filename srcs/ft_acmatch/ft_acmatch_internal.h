@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_acmatch_internal.h                              :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:38:19 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:38:19 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_ACMATCH_INTERNAL_H
+# define FT_ACMATCH_INTERNAL_H
+
+# include "libft.h"
+
+/**
+ * @brief Trie node.
+ *
+ * @param edge Before build: head of the child edge list (0 ends it).
+ *        After build: first of nedges contiguous edges.
+ * @param nedges Number of children (valid after build).
+ * @param fail Longest proper suffix of this node that is also in the
+ *        trie.
+ * @param dict Nearest node on the fail chain that ends a pattern (0 if
+ *        none).
+ * @param out Id + 1 of the pattern ending here, 0 if none.
+ * @param depth Length of the string spelled by this node.
+ */
+typedef struct s_acnode
+{
+	uint32_t	edge;
+	uint32_t	nedges;
+	uint32_t	fail;
+	uint32_t	dict;
+	uint32_t	out;
+	uint32_t	depth;
+}	t_acnode;
+
+/**
+ * @brief Trie edge; next links siblings before build and is unused
+ *        after.
+ */
+typedef struct s_acedge
+{
+	uint32_t		child;
+	uint32_t		next;
+	unsigned char	byte;
+}	t_acedge;
+
+/**
+ * @brief Breadth-first state of ft_acmatch_build.
+ */
+typedef struct s_acbuild
+{
+	t_acmatch	*ac;
+	t_vec		*list;
+	uint32_t	*queue;
+	size_t		head;
+	size_t		tail;
+}	t_acbuild;
+
+t_acnode	*ft_acmatch_node(const t_acmatch *ac, uint32_t s);
+
+/**
+ * @brief Automaton transition from state s on byte c (after build, or
+ *        during build for states already laid out).
+ */
+uint32_t	ft_acmatch_step(const t_acmatch *ac, uint32_t s, unsigned char c);
+
+#endif
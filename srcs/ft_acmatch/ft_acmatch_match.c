@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_acmatch_match.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:40:05 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:40:05 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_acmatch_internal.h"
+
+static uint32_t	child_of(const t_acmatch *ac, uint32_t s, unsigned char c)
+{
+	const t_acnode	*node;
+	const t_acedge	*edge;
+	uint32_t		i;
+
+	node = ft_acmatch_node(ac, s);
+	edge = (const t_acedge *)ac->edges->data + node->edge;
+	i = 0;
+	while (i < node->nedges)
+	{
+		if (edge[i].byte == c)
+			return (edge[i].child);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * Follows failure links until a node has an edge on c; the root's dense
+ * table ends every chain in one lookup.
+ */
+uint32_t	ft_acmatch_step(const t_acmatch *ac, uint32_t s, unsigned char c)
+{
+	uint32_t	t;
+
+	while (s)
+	{
+		t = child_of(ac, s, c);
+		if (t)
+			return (t);
+		s = ft_acmatch_node(ac, s)->fail;
+	}
+	return (ac->root[c]);
+}
+
+/**
+ * @brief Push the matches ending at state s (text offset end) onto out.
+ */
+static int	report(const t_acmatch *ac, uint32_t s, size_t end, t_vec *out)
+{
+	const t_acnode	*node;
+	t_achit			hit;
+
+	if (!ft_acmatch_node(ac, s)->out)
+		s = ft_acmatch_node(ac, s)->dict;
+	while (s)
+	{
+		node = ft_acmatch_node(ac, s);
+		hit.id = node->out - 1;
+		hit.offset = end - node->depth;
+		if (!ft_vec_push(out, &hit))
+			return (0);
+		s = node->dict;
+	}
+	return (1);
+}
+
+int	ft_acmatch_all(const t_acmatch *ac, const char *text, size_t len,
+		t_vec *out)
+{
+	uint32_t	s;
+	size_t		i;
+
+	if (!ac || !ac->built || !out || (!text && len))
+		return (0);
+	s = 0;
+	i = 0;
+	while (i < len)
+	{
+		s = ft_acmatch_step(ac, s, (unsigned char)text[i++]);
+		if (!report(ac, s, i, out))
+			return (0);
+	}
+	return (1);
+}
+
+int	ft_acmatch_first(const t_acmatch *ac, const char *text, size_t len,
+		t_achit *hit)
+{
+	const t_acnode	*node;
+	uint32_t		s;
+	size_t			i;
+
+	if (!ac || !ac->built || (!text && len))
+		return (0);
+	s = 0;
+	i = 0;
+	while (i < len)
+	{
+		s = ft_acmatch_step(ac, s, (unsigned char)text[i++]);
+		node = ft_acmatch_node(ac, s);
+		if (!node->out && node->dict)
+			node = ft_acmatch_node(ac, node->dict);
+		if (node->out)
+		{
+			hit->id = node->out - 1;
+			hit->offset = i - node->depth;
+			return (1);
+		}
+	}
+	return (0);
+}
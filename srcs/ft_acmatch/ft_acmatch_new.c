@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_acmatch_new.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:41:37 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:41:37 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_acmatch_internal.h"
+
+/**
+ * Node 0 is the root and edge 0 a sentinel, so index 0 can mean "none"
+ * in edge lists and transitions.
+ */
+t_acmatch	*ft_acmatch_new(void)
+{
+	t_acmatch	*ac;
+	t_acnode	root;
+	t_acedge	sentinel;
+
+	ac = ft_allocator_calloc(NULL, 1, sizeof(t_acmatch));
+	if (!ac)
+		return (NULL);
+	ac->nodes = ft_vec_new(sizeof(t_acnode), 64);
+	ac->edges = ft_vec_new(sizeof(t_acedge), 64);
+	ft_bzero(&root, sizeof(root));
+	ft_bzero(&sentinel, sizeof(sentinel));
+	if (!ac->nodes || !ac->edges || !ft_vec_push(ac->nodes, &root)
+		|| !ft_vec_push(ac->edges, &sentinel))
+	{
+		ft_vec_free(ac->nodes);
+		ft_vec_free(ac->edges);
+		free(ac);
+		return (NULL);
+	}
+	ft_memstats_record("ft_acmatch_new", 0, sizeof(t_acmatch));
+	return (ac);
+}
+
+void	ft_acmatch_free(t_acmatch *ac)
+{
+	if (!ac)
+		return ;
+	ft_memstats_record("ft_acmatch_free", sizeof(t_acmatch), 0);
+	ft_vec_free(ac->nodes);
+	ft_vec_free(ac->edges);
+	free(ac);
+}
+
+t_acnode	*ft_acmatch_node(const t_acmatch *ac, uint32_t s)
+{
+	return ((t_acnode *)ac->nodes->data + s);
+}
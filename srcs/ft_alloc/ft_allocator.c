@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_allocator.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 18:24:14 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:22:01 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Allocate through an allocator.
+ * @param a Allocator, or NULL for the heap. A NULL alloc slot also
+ *          means the heap.
+ * @param size Bytes to allocate.
+ * @return New memory (not zeroed), or NULL on failure.
+ */
+void	*ft_allocator_alloc(const t_allocator *a, size_t size)
+{
+	if (!a || !a->alloc)
+		return (malloc(size));
+	return (a->alloc(a->ctx, size));
+}
+
+/**
+ * @brief Resize a block through an allocator.
+ *
+ * Allocators without a realloc slot get alloc + copy + free.
+ *
+ * @param a Allocator, or NULL for the heap.
+ * @param ptr Block to resize (NULL behaves like ft_allocator_alloc).
+ * @param old_size Current size of the block.
+ * @param new_size Requested size.
+ * @return Resized block, or NULL on failure (ptr is then untouched).
+ */
+void	*ft_allocator_realloc(const t_allocator *a, void *ptr, size_t old_size,
+		size_t new_size)
+{
+	void	*new_ptr;
+
+	if (!a || (!a->alloc && !a->realloc))
+		return (realloc(ptr, new_size));
+	if (a->realloc)
+		return (a->realloc(a->ctx, ptr, old_size, new_size));
+	new_ptr = a->alloc(a->ctx, new_size);
+	if (!new_ptr || !ptr)
+		return (new_ptr);
+	if (old_size > new_size)
+		old_size = new_size;
+	ft_memcpy(new_ptr, ptr, old_size);
+	ft_allocator_free(a, ptr, old_size);
+	return (new_ptr);
+}
+
+/**
+ * @brief Release a block through an allocator.
+ * @param a Allocator, or NULL for the heap.
+ * @param ptr Block to release (NULL is ignored).
+ * @param size Size the block was allocated or last resized with.
+ */
+void	ft_allocator_free(const t_allocator *a, void *ptr, size_t size)
+{
+	if (!ptr)
+		return ;
+	if (!a || (!a->alloc && !a->free))
+	{
+		free(ptr);
+		return ;
+	}
+	if (a->free)
+		a->free(a->ctx, ptr, size);
+}
+
+/**
+ * @brief Allocate zeroed memory for count elements through an allocator.
+ * @return Zeroed memory, or NULL on overflow or failure.
+ */
+void	*ft_allocator_calloc(const t_allocator *a, size_t count, size_t size)
+{
+	void	*ptr;
+
+	if (!a || !a->alloc)
+		return (calloc(count, size));
+	if (size != 0 && count > SIZE_MAX / size)
+		return (NULL);
+	ptr = a->alloc(a->ctx, count * size);
+	if (ptr)
+		ft_bzero(ptr, count * size);
+	return (ptr);
+}
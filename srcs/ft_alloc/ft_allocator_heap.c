@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_allocator_heap.c                                :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 18:25:28 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 18:25:28 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+static void	*heap_alloc(void *ctx, size_t size)
+{
+	(void)ctx;
+	return (malloc(size));
+}
+
+static void	*heap_realloc(void *ctx, void *ptr, size_t old_size,
+		size_t new_size)
+{
+	(void)ctx;
+	(void)old_size;
+	return (realloc(ptr, new_size));
+}
+
+static void	heap_free(void *ctx, void *ptr, size_t size)
+{
+	(void)ctx;
+	(void)size;
+	free(ptr);
+}
+
+/**
+ * @brief The default allocator: malloc, realloc and free.
+ *
+ * A zeroed t_allocator behaves the same; this one is handy as a base
+ * for wrappers that forward to the heap.
+ */
+t_allocator	ft_allocator_heap(void)
+{
+	t_allocator	a;
+
+	a.alloc = heap_alloc;
+	a.realloc = heap_realloc;
+	a.free = heap_free;
+	a.ctx = NULL;
+	return (a);
+}
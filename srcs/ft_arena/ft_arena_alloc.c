@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_arena_alloc.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:41:13 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:28:34 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_arena_internal.h"
+
+static uintptr_t	align_up(uintptr_t n)
+{
+	return ((n + FT_ARENA_ALIGN - 1) & ~(uintptr_t)(FT_ARENA_ALIGN - 1));
+}
+
+/**
+ * @brief Open a new block able to hold at least size bytes.
+ *
+ * The header sits at the start of the malloc'd chunk and data follows
+ * it, rounded up to FT_ARENA_ALIGN.
+ */
+static t_arena_block	*arena_grow(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+	size_t			cap;
+
+	cap = arena->block_size;
+	if (size > cap)
+		cap = size;
+	if (cap > SIZE_MAX - sizeof(t_arena_block) - FT_ARENA_ALIGN)
+		return (NULL);
+	block = malloc(sizeof(t_arena_block) + FT_ARENA_ALIGN + cap);
+	if (!block)
+		return (NULL);
+	ft_memstats_record("ft_arena_alloc", 0,
+		sizeof(t_arena_block) + FT_ARENA_ALIGN + cap);
+	block->data = (unsigned char *)align_up((uintptr_t)(block + 1));
+	block->cap = cap;
+	block->used = 0;
+	block->prev = arena->head;
+	arena->head = block;
+	return (block);
+}
+
+/**
+ * @brief Free the newest block (reset, rewind and free all go through
+ *        here).
+ */
+void	ft_arena_pop_block(t_arena *arena)
+{
+	t_arena_block	*block;
+
+	block = arena->head;
+	arena->head = block->prev;
+	ft_memstats_record("ft_arena_free",
+		sizeof(t_arena_block) + FT_ARENA_ALIGN + block->cap, 0);
+	free(block);
+}
+
+/**
+ * @brief Allocate size bytes from the arena.
+ *
+ * Bumps a pointer in the newest block; only a block that is full costs
+ * a malloc. The memory is not zeroed.
+ *
+ * @param arena Arena to allocate from.
+ * @param size Bytes to allocate (0 is treated as 1).
+ * @return Pointer aligned to 16 bytes, or NULL on failure.
+ * @note Never free the result; it lives until rewind, reset or free.
+ */
+void	*ft_arena_alloc(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+	size_t			off;
+
+	if (!arena)
+		return (NULL);
+	if (size == 0)
+		size = 1;
+	block = arena->head;
+	if (block)
+	{
+		off = align_up(block->used);
+		if (off <= block->cap && size <= block->cap - off)
+		{
+			block->used = off + size;
+			return (block->data + off);
+		}
+	}
+	block = arena_grow(arena, size);
+	if (!block)
+		return (NULL);
+	block->used = size;
+	return (block->data);
+}
+
+/**
+ * @brief Allocate zeroed memory for count elements of size bytes.
+ * @return Pointer to zeroed memory, or NULL on overflow or failure.
+ */
+void	*ft_arena_calloc(t_arena *arena, size_t count, size_t size)
+{
+	void	*ptr;
+
+	if (size != 0 && count > SIZE_MAX / size)
+		return (NULL);
+	ptr = ft_arena_alloc(arena, count * size);
+	if (ptr)
+		ft_bzero(ptr, count * size);
+	return (ptr);
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_arena_allocator.c                               :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 18:27:51 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 18:27:51 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_arena_internal.h"
+
+static void	*arena_alloc(void *ctx, size_t size)
+{
+	return (ft_arena_alloc(ctx, size));
+}
+
+/**
+ * @brief Grow in place when ptr is the newest allocation, copy otherwise.
+ */
+static void	*arena_realloc(void *ctx, void *ptr, size_t old_size,
+		size_t new_size)
+{
+	t_arena_block	*block;
+	void			*new_ptr;
+
+	block = ((t_arena *)ctx)->head;
+	if (ptr && block && (unsigned char *)ptr + old_size
+		== block->data + block->used
+		&& new_size <= block->cap - ((unsigned char *)ptr - block->data))
+	{
+		block->used = ((unsigned char *)ptr - block->data) + new_size;
+		return (ptr);
+	}
+	new_ptr = ft_arena_alloc(ctx, new_size);
+	if (!new_ptr || !ptr)
+		return (new_ptr);
+	if (old_size > new_size)
+		old_size = new_size;
+	ft_memcpy(new_ptr, ptr, old_size);
+	return (new_ptr);
+}
+
+/**
+ * @brief Allocator that takes memory from an arena.
+ *
+ * Its free slot is NULL, so releasing a block is a no-op: the memory
+ * goes back with ft_arena_rewind, ft_arena_reset or ft_arena_free.
+ *
+ * @param arena Arena to allocate from; must outlive every user.
+ */
+t_allocator	ft_allocator_arena(t_arena *arena)
+{
+	t_allocator	a;
+
+	a.alloc = arena_alloc;
+	a.realloc = arena_realloc;
+	a.free = NULL;
+	a.ctx = arena;
+	return (a);
+}
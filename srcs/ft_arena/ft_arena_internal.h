@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_arena_internal.h                                :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:44:32 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:30:13 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_ARENA_INTERNAL_H
+# define FT_ARENA_INTERNAL_H
+
+# include "libft.h"
+
+/* Every allocation is aligned to this many bytes. */
+# define FT_ARENA_ALIGN 16
+
+/* Block size used when ft_arena_new is given 0. */
+# define FT_ARENA_DEFAULT_BLOCK 65536
+
+/**
+ * @brief One malloc'd chunk of arena memory.
+ *
+ * Blocks form a list from newest to oldest. Allocation only ever bumps
+ * `used` in the newest block; a request that does not fit opens a new
+ * block of at least the arena's block size.
+ *
+ * @param prev Next older block, or NULL for the first one.
+ * @param data Start of usable memory (aligned to FT_ARENA_ALIGN).
+ * @param cap Usable bytes at data.
+ * @param used Bytes handed out so far.
+ */
+typedef struct s_arena_block
+{
+	struct s_arena_block	*prev;
+	unsigned char			*data;
+	size_t					cap;
+	size_t					used;
+}	t_arena_block;
+
+void	ft_arena_pop_block(t_arena *arena);
+
+#endif
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_arena_mark.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:45:25 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:36:40 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_arena_internal.h"
+
+/**
+ * @brief Record the arena's current fill level.
+ * @param arena Arena to mark.
+ * @return Mark to pass to ft_arena_rewind.
+ */
+t_arena_mark	ft_arena_mark(t_arena *arena)
+{
+	t_arena_mark	mark;
+
+	mark.block = NULL;
+	mark.used = 0;
+	if (arena && arena->head)
+	{
+		mark.block = arena->head;
+		mark.used = arena->head->used;
+	}
+	return (mark);
+}
+
+/**
+ * @brief Release everything allocated since mark was taken.
+ *
+ * Blocks opened after the mark are freed; the marked block goes back to
+ * its recorded fill level. Marks taken after this one become invalid.
+ *
+ * @param arena Arena to rewind. Safe to call with NULL.
+ * @param mark Mark taken earlier from the same arena.
+ */
+void	ft_arena_rewind(t_arena *arena, t_arena_mark mark)
+{
+	if (!arena)
+		return ;
+	while (arena->head && arena->head != mark.block)
+		ft_arena_pop_block(arena);
+	if (arena->head)
+		arena->head->used = mark.used;
+}
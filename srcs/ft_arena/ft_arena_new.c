@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_arena_new.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:47:34 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:39:53 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_arena_internal.h"
+
+/**
+ * @brief Create an empty arena.
+ *
+ * No memory is reserved until the first allocation.
+ *
+ * @param block_size Bytes per block (0 for a default of 64 KiB).
+ * @return New arena, or NULL on allocation failure.
+ */
+t_arena	*ft_arena_new(size_t block_size)
+{
+	t_arena	*arena;
+
+	arena = malloc(sizeof(t_arena));
+	if (!arena)
+		return (NULL);
+	ft_memstats_record("ft_arena_new", 0, sizeof(t_arena));
+	if (block_size == 0)
+		block_size = FT_ARENA_DEFAULT_BLOCK;
+	arena->head = NULL;
+	arena->block_size = block_size;
+	return (arena);
+}
+
+/**
+ * @brief Release every allocation but keep the oldest block for reuse.
+ *
+ * A reset arena serves the next batch of allocations from memory it
+ * already owns, so a steady request loop stops calling malloc.
+ *
+ * @param arena Arena to reset. Safe to call with NULL.
+ */
+void	ft_arena_reset(t_arena *arena)
+{
+	if (!arena || !arena->head)
+		return ;
+	while (arena->head->prev)
+		ft_arena_pop_block(arena);
+	arena->head->used = 0;
+}
+
+/**
+ * @brief Free an arena and every allocation made from it.
+ * @param arena Arena to free. Safe to call with NULL.
+ */
+void	ft_arena_free(t_arena *arena)
+{
+	if (!arena)
+		return ;
+	while (arena->head)
+		ft_arena_pop_block(arena);
+	ft_memstats_record("ft_arena_free", sizeof(t_arena), 0);
+	free(arena);
+}
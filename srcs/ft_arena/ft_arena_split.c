@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_arena_split.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:54:11 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 16:54:11 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_arena_internal.h"
+
+static size_t	count_words(char const *s, char c)
+{
+	size_t	count;
+
+	count = 0;
+	while (*s)
+	{
+		while (*s == c)
+			s++;
+		if (*s)
+			count++;
+		while (*s && *s != c)
+			s++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Copy the next word of *s into the arena and move *s past it.
+ */
+static char	*next_word(t_arena *arena, char const **s, char c)
+{
+	char	*word;
+	size_t	len;
+
+	while (**s == c)
+		(*s)++;
+	len = 0;
+	while ((*s)[len] && (*s)[len] != c)
+		len++;
+	word = ft_arena_alloc(arena, len + 1);
+	if (!word)
+		return (NULL);
+	ft_memcpy(word, *s, len);
+	word[len] = '\0';
+	*s += len;
+	return (word);
+}
+
+/**
+ * @brief Arena version of ft_split.
+ *
+ * The array and every word come from the arena, so there is nothing to
+ * free word by word; the result goes away with the arena.
+ *
+ * @param arena Arena to allocate from.
+ * @param s String to split.
+ * @param c Delimiter character.
+ * @return NULL-terminated array of words, or NULL on failure.
+ */
+char	**ft_arena_split(t_arena *arena, char const *s, char c)
+{
+	char	**split;
+	size_t	words;
+	size_t	j;
+
+	if (!s)
+		return (NULL);
+	words = count_words(s, c);
+	split = ft_arena_alloc(arena, (words + 1) * sizeof(char *));
+	if (!split)
+		return (NULL);
+	j = 0;
+	while (j < words)
+	{
+		split[j] = next_word(arena, &s, c);
+		if (!split[j++])
+			return (NULL);
+	}
+	split[j] = NULL;
+	return (split);
+}
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_arena_str.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:58:54 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 16:58:54 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_arena_internal.h"
+
+/**
+ * @brief Duplicate a string into the arena.
+ * @param arena Arena to allocate from.
+ * @param s String to copy.
+ * @return Arena-owned copy, or NULL on failure.
+ */
+char	*ft_arena_strdup(t_arena *arena, const char *s)
+{
+	char	*dup;
+	size_t	len;
+
+	if (!s)
+		return (NULL);
+	len = ft_strlen(s);
+	dup = ft_arena_alloc(arena, len + 1);
+	if (!dup)
+		return (NULL);
+	ft_memcpy(dup, s, len + 1);
+	return (dup);
+}
+
+/**
+ * @brief Arena version of ft_substr.
+ * @param arena Arena to allocate from.
+ * @param s Source string.
+ * @param start Start index in s.
+ * @param len Maximum length of the substring.
+ * @return Arena-owned substring, or NULL on failure.
+ */
+char	*ft_arena_substr(t_arena *arena, char const *s, unsigned int start,
+		size_t len)
+{
+	char	*sub;
+	size_t	slen;
+
+	if (!s)
+		return (NULL);
+	slen = ft_strlen(s);
+	if (start >= slen)
+		len = 0;
+	else if (len > slen - start)
+		len = slen - start;
+	sub = ft_arena_alloc(arena, len + 1);
+	if (!sub)
+		return (NULL);
+	if (len)
+		ft_memcpy(sub, s + start, len);
+	sub[len] = '\0';
+	return (sub);
+}
@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_charset.c                                       :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:51:55 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:51:55 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+t_charset	ft_charset_from(const char *chars)
+{
+	t_charset	set;
+
+	ft_bzero(&set, sizeof(set));
+	if (!chars)
+		return (set);
+	while (*chars)
+		ft_charset_add(&set, (unsigned char)*chars++);
+	return (set);
+}
+
+/**
+ * The list only tracks non-NUL bytes: every scan stops at the terminator
+ * anyway, and pcmpistri treats a NUL in the set operand as its end.
+ */
+void	ft_charset_add(t_charset *set, unsigned char c)
+{
+	uint64_t	bit;
+
+	bit = (uint64_t)1 << (c & 63);
+	if (set->bits[c >> 6] & bit)
+		return ;
+	set->bits[c >> 6] |= bit;
+	if (!c)
+		return ;
+	if (set->count < FT_CHARSET_SMALL)
+		set->list[set->count] = c;
+	set->count++;
+}
+
+int	ft_charset_has(const t_charset *set, unsigned char c)
+{
+	return ((int)((set->bits[c >> 6] >> (c & 63)) & 1));
+}
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_charset_span.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:55:31 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:48:19 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+/**
+ * @brief Walk s while membership in the set equals in (0 or 1).
+ */
+size_t	ft_charset_span_scalar(const char *s, const t_charset *set, int in)
+{
+	const unsigned char	*p;
+
+	p = (const unsigned char *)s;
+	while (*p && (int)((set->bits[*p >> 6] >> (*p & 63)) & 1) == in)
+		p++;
+	return ((size_t)(p - (const unsigned char *)s));
+}
+
+static size_t	span(const char *s, const t_charset *set, int in)
+{
+	if (!g_simd.charset_span)
+		ft_simd_init();
+	return (g_simd.charset_span(s, set, in));
+}
+
+size_t	ft_charset_span(const char *s, const t_charset *set)
+{
+	return (span(s, set, 1));
+}
+
+size_t	ft_charset_cspan(const char *s, const t_charset *set)
+{
+	return (span(s, set, 0));
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_charset_span_sse42.c                            :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 02:01:33 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:53:12 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+#if defined(__SSE4_2__)
+
+/*
+ * pcmpistri compares 16 string bytes against every byte of the set list
+ * at once. Both operands are implicit-length: the list ends at its first
+ * zero pad and the string chunk at its terminator. Chunks are aligned, so
+ * a load may start before s or run past the terminator but never crosses
+ * into another page.
+ */
+
+/**
+ * @brief First byte at or after the aligned p that is not in the list.
+ *
+ * With negative polarity the terminator counts as a hit, so the index is
+ * below 16 as soon as the chunk holds a NUL.
+ */
+static FT_NO_ASAN const char	*skip_in(const char *p, __m128i list)
+{
+	int	i;
+
+	i = _mm_cmpistri(list, _mm_load_si128((const __m128i *)p),
+			FT_PCMP_NOT_ANY);
+	while (i == 16)
+	{
+		p += 16;
+		i = _mm_cmpistri(list, _mm_load_si128((const __m128i *)p),
+				FT_PCMP_NOT_ANY);
+	}
+	return (p + i);
+}
+
+/**
+ * @brief First byte at or after the aligned p that is in the list, or the
+ *        terminator.
+ */
+static FT_NO_ASAN const char	*skip_out(const char *p, __m128i list)
+{
+	__m128i	x;
+
+	x = _mm_load_si128((const __m128i *)p);
+	while (_mm_cmpistri(list, x, FT_PCMP_ANY) == 16
+		&& !_mm_cmpistrz(list, x, FT_PCMP_ANY))
+	{
+		p += 16;
+		x = _mm_load_si128((const __m128i *)p);
+	}
+	if (_mm_cmpistri(list, x, FT_PCMP_ANY) < 16)
+		return (p + _mm_cmpistri(list, x, FT_PCMP_ANY));
+	while (*p)
+		p++;
+	return (p);
+}
+
+/**
+ * Large sets fall back to the bitmap loop; small ones run bytewise up to
+ * the first 16-byte boundary and then a chunk per pcmpistri.
+ */
+FT_NO_ASAN size_t	ft_charset_span_sse42(const char *s, const t_charset *set,
+		int in)
+{
+	const char	*p;
+	__m128i		list;
+
+	if (!set->count && !in)
+		return (ft_strlen(s));
+	if (!set->count || set->count > FT_CHARSET_SMALL)
+		return (ft_charset_span_scalar(s, set, in));
+	p = s;
+	while (((uintptr_t)p & 15) && *p
+		&& ft_charset_has(set, (unsigned char)*p) == in)
+		p++;
+	if (((uintptr_t)p & 15) || !*p)
+		return ((size_t)(p - s));
+	list = _mm_loadu_si128((const __m128i *)set->list);
+	if (in)
+		return ((size_t)(skip_in(p, list) - s));
+	return ((size_t)(skip_out(p, list) - s));
+}
+
+#endif
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_bignum.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:02:04 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:02:04 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+void	ft_big_set(t_bignum *b, uint64_t v)
+{
+	b->len = 0;
+	while (v)
+	{
+		b->limb[b->len++] = (uint32_t)v;
+		v >>= 32;
+	}
+}
+
+void	ft_big_shl(t_bignum *b, unsigned int bits)
+{
+	size_t		words;
+	size_t		i;
+	uint64_t	carry;
+
+	if (!b->len)
+		return ;
+	words = bits / 32;
+	bits %= 32;
+	ft_memmove(b->limb + words, b->limb, b->len * sizeof(uint32_t));
+	ft_bzero(b->limb, words * sizeof(uint32_t));
+	b->len += words;
+	carry = 0;
+	i = words;
+	while (bits && i < b->len)
+	{
+		carry |= (uint64_t)b->limb[i] << bits;
+		b->limb[i++] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	if (carry)
+		b->limb[b->len++] = (uint32_t)carry;
+}
+
+void	ft_big_mul_small(t_bignum *b, uint32_t m)
+{
+	size_t		i;
+	uint64_t	carry;
+
+	carry = 0;
+	i = 0;
+	while (i < b->len)
+	{
+		carry += (uint64_t)b->limb[i] * m;
+		b->limb[i++] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	if (carry)
+		b->limb[b->len++] = (uint32_t)carry;
+}
+
+/**
+ * Nine decimal places per limb multiply, then the remainder.
+ */
+void	ft_big_mul_pow10(t_bignum *b, unsigned int n)
+{
+	uint32_t	rest;
+
+	while (n >= 9)
+	{
+		ft_big_mul_small(b, 1000000000);
+		n -= 9;
+	}
+	rest = 1;
+	while (n--)
+		rest *= 10;
+	if (rest > 1)
+		ft_big_mul_small(b, rest);
+}
+
+int	ft_big_cmp(const t_bignum *a, const t_bignum *b)
+{
+	size_t	i;
+
+	if (a->len != b->len)
+		return ((a->len > b->len) - (a->len < b->len));
+	i = a->len;
+	while (i--)
+	{
+		if (a->limb[i] != b->limb[i])
+			return ((a->limb[i] > b->limb[i]) - (a->limb[i] < b->limb[i]));
+	}
+	return (0);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_bignum_dec.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:47:09 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:47:09 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * Schoolbook division from the top limb, carrying the remainder down.
+ */
+uint32_t	ft_big_div_small(t_bignum *b, uint32_t d)
+{
+	uint64_t	rem;
+	size_t		i;
+
+	rem = 0;
+	i = b->len;
+	while (i--)
+	{
+		rem = (rem << 32) | b->limb[i];
+		b->limb[i] = (uint32_t)(rem / d);
+		rem %= d;
+	}
+	while (b->len && !b->limb[b->len - 1])
+		b->len--;
+	return ((uint32_t)rem);
+}
+
+/**
+ * Nine digits per division by 10^9; the chunks come out lowest first and
+ * are written back in order, all but the leading one zero-padded.
+ */
+size_t	ft_big_to_dec(t_bignum *b, char *out)
+{
+	uint32_t	chunk[FT_BIGNUM_DEC_CHUNKS];
+	size_t		count;
+	size_t		n;
+	char		tmp[FT_ITOA_BUFSZ];
+	size_t		len;
+
+	count = 0;
+	while (b->len)
+		chunk[count++] = ft_big_div_small(b, 1000000000);
+	if (!count)
+		chunk[count++] = 0;
+	n = ft_utoa_buf(chunk[--count], out);
+	while (count--)
+	{
+		len = ft_utoa_buf(chunk[count], tmp);
+		ft_memset(out + n, '0', 9 - len);
+		ft_memcpy(out + n + 9 - len, tmp, len);
+		n += 9;
+	}
+	out[n] = '\0';
+	return (n);
+}
+
+void	ft_big_mul_add(t_bignum *b, uint32_t m, uint32_t add)
+{
+	size_t		i;
+	uint64_t	carry;
+
+	carry = add;
+	i = 0;
+	while (i < b->len)
+	{
+		carry += (uint64_t)b->limb[i] * m;
+		b->limb[i++] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	if (carry)
+		b->limb[b->len++] = (uint32_t)carry;
+}
+
+uint64_t	ft_big_low64(const t_bignum *b)
+{
+	uint64_t	v;
+
+	v = 0;
+	if (b->len > 1)
+		v = (uint64_t)b->limb[1] << 32;
+	if (b->len)
+		v |= b->limb[0];
+	return (v);
+}
+
+/**
+ * Binary long division with the denominator parked 63 bits up: each round
+ * compares, subtracts and doubles the remainder instead of shifting the
+ * denominator back down.
+ */
+int	ft_big_div_u64(t_bignum *num, const t_bignum *den, uint64_t *out)
+{
+	t_bignum	top;
+	int			bit;
+
+	top = *den;
+	ft_big_shl(&top, 63);
+	*out = 0;
+	bit = 63;
+	while (bit >= 0)
+	{
+		if (ft_big_cmp(num, &top) >= 0)
+		{
+			ft_big_sub(num, &top);
+			*out |= 1ULL << bit;
+		}
+		ft_big_shl(num, 1);
+		bit--;
+	}
+	return (num->len != 0);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_bignum_sub.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:04:00 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:04:00 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * a must be at least b.
+ */
+void	ft_big_sub(t_bignum *a, const t_bignum *b)
+{
+	size_t		i;
+	int64_t		borrow;
+
+	borrow = 0;
+	i = 0;
+	while (i < a->len)
+	{
+		borrow += (int64_t)a->limb[i];
+		if (i < b->len)
+			borrow -= b->limb[i];
+		a->limb[i++] = (uint32_t)borrow;
+		borrow >>= 32;
+	}
+	while (a->len && !a->limb[a->len - 1])
+		a->len--;
+}
+
+size_t	ft_big_bitlen(const t_bignum *b)
+{
+	if (!b->len)
+		return (0);
+	return (b->len * 32 - __builtin_clz(b->limb[b->len - 1]));
+}
+
+/**
+ * Repeated subtraction: the callers keep the quotient below 10.
+ */
+uint32_t	ft_big_div_digit(t_bignum *num, const t_bignum *den)
+{
+	uint32_t	d;
+
+	d = 0;
+	while (ft_big_cmp(num, den) >= 0)
+	{
+		ft_big_sub(num, den);
+		d++;
+	}
+	return (d);
+}
+
+static void	shr_limbs(t_bignum *b, size_t bits)
+{
+	size_t	words;
+	size_t	i;
+
+	words = bits / 32;
+	bits %= 32;
+	i = 0;
+	while (i + words < b->len)
+	{
+		b->limb[i] = b->limb[i + words] >> bits;
+		if (bits && i + words + 1 < b->len)
+			b->limb[i] |= b->limb[i + words + 1] << (32 - bits);
+		i++;
+	}
+	b->len -= words;
+	while (b->len && !b->limb[b->len - 1])
+		b->len--;
+}
+
+/**
+ * Returns where the dropped bits fell: 0 nothing dropped, 1 below half,
+ * 2 exactly half, 3 above half.
+ */
+int	ft_big_shr_round(t_bignum *b, size_t bits)
+{
+	size_t	i;
+	int		half;
+	int		rest;
+
+	if (!bits)
+		return (0);
+	if (bits > b->len * 32)
+	{
+		rest = (b->len != 0);
+		b->len = 0;
+		return (rest);
+	}
+	i = (bits - 1) / 32;
+	half = (b->limb[i] >> ((bits - 1) % 32)) & 1;
+	rest = (b->limb[i] & ((1U << ((bits - 1) % 32)) - 1)) != 0;
+	while (!rest && i)
+		rest = (b->limb[--i] != 0);
+	shr_limbs(b, bits);
+	return (half * 2 + rest);
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_conv_digits.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 02:36:19 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:59:17 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+#include "ft_simd_internal.h"
+
+static int	next_digit(const char *p, const char *lim, int base)
+{
+	int	d;
+
+	if (lim && p >= lim)
+		return (-1);
+	d = ft_conv_digit(*p);
+	if (d >= base)
+		return (-1);
+	return (d);
+}
+
+/**
+ * A byte is a digit iff its high nibble is 3 and stays 3 after adding 6.
+ * Three multiply-shifts then fold the digits pairwise into 2-, 4- and
+ * finally one 8-digit value.
+ *
+ * Bounded input needs 8 bytes left. A C string may end anywhere in the
+ * word, so the load must merely stay inside p's page; ASan would flag
+ * the bytes past the terminator, hence FT_NO_ASAN.
+ */
+FT_NO_ASAN int	ft_conv_load8(const char *p, const char *lim, uint64_t *v)
+{
+	uint64_t	w;
+
+	if (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+		return (0);
+	if ((lim && lim - p < 8) || (!lim && ((uintptr_t)p & 4095) > 4096 - 8))
+		return (0);
+	__builtin_memcpy(&w, p, 8);
+	if (((w & 0xF0F0F0F0F0F0F0F0ULL)
+			| (((w + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+		!= 0x3333333333333333ULL)
+		return (0);
+	w = ((w & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+	w = ((w & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+	*v = ((w & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+	return (1);
+}
+
+static void	add_digit(t_numscan *ns, int d, int base)
+{
+	if (ns->mag > (UINT64_MAX - d) / (unsigned int)base)
+	{
+		ns->mag = UINT64_MAX;
+		ns->err = FT_CONV_RANGE;
+	}
+	else
+		ns->mag = ns->mag * base + d;
+}
+
+/**
+ * Decimal runs take 8 digits per step while the accumulator cannot
+ * overflow; the rest, other bases and the last few digits of huge values
+ * go one digit at a time with an exact overflow check.
+ */
+const char	*ft_conv_digits(const char *p, const char *lim, int base,
+		t_numscan *ns)
+{
+	uint64_t	eight;
+	int			d;
+
+	d = next_digit(p, lim, base);
+	while (d >= 0)
+	{
+		if (base == 10 && ns->mag < FT_CONV_SWAR_MAX
+			&& ft_conv_load8(p, lim, &eight))
+		{
+			ns->mag = ns->mag * 100000000 + eight;
+			p += 8;
+		}
+		else
+		{
+			add_digit(ns, d, base);
+			p++;
+		}
+		d = next_digit(p, lim, base);
+	}
+	return (p);
+}
@@ -0,0 +1,322 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_conv_internal.h                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 02:42:01 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 03:20:51 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_CONV_INTERNAL_H
+# define FT_CONV_INTERNAL_H
+
+# include "libft.h"
+# include <limits.h>
+
+/*
+ * Largest accumulator that can take 8 more decimal digits in one step:
+ * (UINT64_MAX / 10^8) rounded down, exclusive.
+ */
+# define FT_CONV_SWAR_MAX 184467440737ULL
+
+/**
+ * @brief One number as read by ft_conv_scan.
+ *
+ * mag is the magnitude, saturated at UINT64_MAX when err is
+ * FT_CONV_RANGE; end points past the last digit, or at the start of the
+ * input when err is FT_CONV_EMPTY.
+ */
+typedef struct s_numscan
+{
+	uint64_t	mag;
+	const char	*end;
+	int			neg;
+	int			err;
+}	t_numscan;
+
+/**
+ * @brief Value of c as a digit in bases up to 36, or 36 if it is none.
+ */
+int			ft_conv_digit(char c);
+
+/**
+ * @brief Read 8 ASCII decimal digits at p as one value (SWAR).
+ * @param lim End of the input, or NULL for a NUL-terminated string.
+ * @return 1 with the value in *v, or 0 if the 8 bytes are not all
+ *         digits or cannot be loaded.
+ */
+int			ft_conv_load8(const char *p, const char *lim, uint64_t *v);
+
+/**
+ * @brief Accumulate the digits of base at p into ns->mag.
+ * @param lim End of the input, or NULL for a NUL-terminated string.
+ * @return Pointer past the last digit.
+ */
+const char	*ft_conv_digits(const char *p, const char *lim, int base,
+				t_numscan *ns);
+
+/**
+ * @brief Skip the bytes isspace() accepts, stopping at lim (if not NULL).
+ */
+const char	*ft_conv_skip_space(const char *p, const char *lim);
+
+/**
+ * @brief Read [space][+-][0x]digits, strtol style.
+ * @param lim End of the input, or NULL for a NUL-terminated string.
+ */
+void		ft_conv_scan(const char *s, const char *lim, int base,
+				t_numscan *ns);
+
+/**
+ * @brief Signed value of ns clamped to [-max - 1, max]; sets
+ *        FT_CONV_RANGE in ns->err when it had to clamp.
+ */
+int64_t		ft_conv_signed(t_numscan *ns, uint64_t max);
+
+/**
+ * @brief Number of decimal digits of n (1 for 0).
+ */
+size_t		ft_conv_dec_len(uint64_t n);
+
+/* ************************************************************************** */
+/*                                 Bignums                                    */
+/* ************************************************************************** */
+
+/*
+ * 128 limbs of 32 bits hold every intermediate of the exact double
+ * conversions: at worst 2^53 * 10^1074 (about 3620 bits).
+ */
+# define FT_BIGNUM_LIMBS 128
+
+/* Base 10^9 chunks of a full bignum (4096 bits, 1234 digits) */
+# define FT_BIGNUM_DEC_CHUNKS 138
+
+/**
+ * @brief Unsigned integer of len little-endian limbs (no leading zero
+ *        limb, so 0 has len 0).
+ */
+typedef struct s_bignum
+{
+	uint32_t	limb[FT_BIGNUM_LIMBS];
+	size_t		len;
+}	t_bignum;
+
+void		ft_big_set(t_bignum *b, uint64_t v);
+void		ft_big_shl(t_bignum *b, unsigned int bits);
+void		ft_big_mul_small(t_bignum *b, uint32_t m);
+void		ft_big_mul_pow10(t_bignum *b, unsigned int n);
+int			ft_big_cmp(const t_bignum *a, const t_bignum *b);
+void		ft_big_sub(t_bignum *a, const t_bignum *b);
+size_t		ft_big_bitlen(const t_bignum *b);
+
+/**
+ * @brief num / den when the quotient is a single digit; num keeps the
+ *        remainder.
+ */
+uint32_t	ft_big_div_digit(t_bignum *num, const t_bignum *den);
+
+/**
+ * @brief b >>= bits.
+ * @return Dropped part: 0 none, 1 below half, 2 half, 3 above half.
+ */
+int			ft_big_shr_round(t_bignum *b, size_t bits);
+
+/**
+ * @brief b /= d.
+ * @return The remainder.
+ */
+uint32_t	ft_big_div_small(t_bignum *b, uint32_t d);
+
+/**
+ * @brief Decimal digits of b into out, NUL-terminated; b is consumed.
+ * @return Number of digits ("0" for zero).
+ */
+size_t		ft_big_to_dec(t_bignum *b, char *out);
+
+/**
+ * @brief b = b * m + add.
+ */
+void		ft_big_mul_add(t_bignum *b, uint32_t m, uint32_t add);
+
+/**
+ * @brief Low 64 bits of b.
+ */
+uint64_t	ft_big_low64(const t_bignum *b);
+
+/**
+ * @brief floor(num / den) into *out when it is below 2^64; num is
+ *        consumed.
+ * @return 1 if the division left a remainder.
+ */
+int			ft_big_div_u64(t_bignum *num, const t_bignum *den, uint64_t *out);
+
+/**
+ * @brief nd[0] / nd[1] = cx * 2^q / 10^k with both sides integers.
+ */
+void		ft_big_load_ratio(uint64_t cx, int q, int k, t_bignum *nd);
+
+/* ************************************************************************** */
+/*                              Double to text                                */
+/* ************************************************************************** */
+
+typedef unsigned __int128	t_u128;
+
+/* Classes returned by ft_dtoa_decode */
+# define FT_DTOA_FINITE 0
+# define FT_DTOA_INF 1
+# define FT_DTOA_NAN 2
+
+/*
+ * ft_dtoa_shortest switches to exponent form from 1e17 up, where the 17
+ * significant digits a double can need no longer cover the integer part.
+ */
+# define FT_DTOA_SHORTEST_EXP 17
+
+/* Decades covered by the 128-bit power of ten table */
+# define FT_DTOA_POW10_MIN -350
+# define FT_DTOA_POW10_MAX 350
+
+/**
+ * @brief A finite double split as |x| = c * 2^q.
+ */
+typedef struct s_dfp
+{
+	uint64_t	c;
+	int			q;
+	int			neg;
+}	t_dfp;
+
+int			ft_dtoa_decode(double x, t_dfp *fp);
+
+/**
+ * @brief Write "nan", "inf" or "-inf" for class cls into buf.
+ */
+size_t		ft_dtoa_special(int cls, int neg, char *buf);
+
+/**
+ * @brief floor(log10(2^e)), exact for |e| < 5000.
+ */
+int			ft_flog10pow2(int e);
+
+/**
+ * @brief floor(cx * 2^q / 10^k) into *out; the caller guarantees it fits
+ *        in 64 bits.
+ * @return 1 if the division was inexact, 0 otherwise.
+ */
+int			ft_dtoa_scale(uint64_t cx, int q, int k, uint64_t *out);
+int			ft_dtoa_scale_table(uint64_t cx, int q, int k, uint64_t *out);
+
+/**
+ * @brief {hi, lo} of the 128 leading bits of 10^j, rounded up, for j in
+ *        [FT_DTOA_POW10_MIN, FT_DTOA_POW10_MAX]: 10^j lies in
+ *        ((g - 1) * 2^(e - 127), g * 2^(e - 127)] with e = ft_flog2pow10(j).
+ */
+const uint64_t	*ft_dtoa_pow10_128(int j);
+
+/**
+ * @brief floor(log2(10^j)), exact for |j| < 1233.
+ */
+int			ft_flog2pow10(int j);
+int			ft_dtoa_scale_big(uint64_t cx, int q, int k, uint64_t *out);
+
+/**
+ * @brief Decimal digits of round-half-even(|x| * 10^s) into out.
+ * @return Number of digits written ("0" for zero).
+ */
+size_t		ft_dtoa_round(const t_dfp *fp, int s, char *out);
+size_t		ft_dtoa_round_big(const t_dfp *fp, int s, char *out);
+
+/**
+ * @brief prec + 1 significant digits of |x|, correctly rounded, into out.
+ * @return Decimal exponent of the first digit.
+ */
+int			ft_dtoa_exp_digits(const t_dfp *fp, int prec, char *out);
+
+/**
+ * @brief Shortest digits that round-trip to |x| (x not 0).
+ * @return Number of digits; *e10 gets the exponent of the first one.
+ */
+size_t		ft_dtoa_shortest_digits(const t_dfp *fp, char *out, int *e10);
+
+/**
+ * @brief Lay out the n digits of round(|x| * 10^prec) as %.*f, in place.
+ * @return Length of the result.
+ */
+size_t		ft_dtoa_put_fixed(char *d, size_t n, int prec);
+
+/**
+ * @brief Lay out n digits with first-digit exponent e as
+ *        d[.ddd]e+XX, in place.
+ * @return Length of the result.
+ */
+size_t		ft_dtoa_put_exp(char *d, size_t n, int e);
+
+/**
+ * @brief %g-style layout of n digits in place: trailing zeros dropped,
+ *        exponent form when e < -4 or e >= limit.
+ */
+size_t		ft_dtoa_put_general(char *d, size_t n, int e, int limit);
+
+/* ************************************************************************** */
+/*                              Text to double                                */
+/* ************************************************************************** */
+
+/*
+ * Significant digits the bignum fallback keeps. A halfway point between
+ * two doubles never needs more than 767, so anything past 780 only
+ * matters as "zero or not".
+ */
+# define FT_STRTOD_DIGITS 780
+
+/**
+ * @brief A scanned decimal: all its significant digits, as one integer,
+ *        times 10^exp10.
+ */
+typedef struct s_decimal
+{
+	uint64_t	w;
+	int64_t		exp10;
+	int64_t		nd;
+	int			trunc;
+	int			neg;
+	const char	*first;
+	const char	*end;
+}	t_decimal;
+
+/*
+ * w holds the first min(nd, 19) digits and trunc is set when a nonzero
+ * digit past them was dropped. first points at the first significant
+ * digit for the bignum rescan, end past the whole number (the string
+ * itself when there was no digit).
+ */
+
+void		ft_strtod_scan(const char *s, t_decimal *d);
+
+/**
+ * @brief w * 10^q in one rounding when both are exact doubles.
+ */
+int			ft_strtod_clinger(uint64_t w, int q, double *out);
+
+/**
+ * @brief Eisel-Lemire: w * 10^q (w not 0, q within the table) from one
+ *        192-bit product.
+ * @return 1 with the IEEE bits (sign excluded) in *bits, 0 if the product
+ *         cannot settle the rounding.
+ */
+int			ft_strtod_lemire(uint64_t w, int q, uint64_t *bits);
+
+/**
+ * @brief IEEE bits of v * 2^b, rounded to nearest even; lost says that
+ *        nonzero bits below v were already dropped.
+ */
+uint64_t	ft_strtod_round_pack(uint64_t v, int b, int lost);
+
+/**
+ * @brief Exact conversion of d with bignums.
+ */
+uint64_t	ft_strtod_big(const t_decimal *d);
+
+#endif
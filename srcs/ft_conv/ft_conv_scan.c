@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_conv_scan.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 02:46:42 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 02:46:42 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+int	ft_conv_digit(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + 10);
+	return (36);
+}
+
+const char	*ft_conv_skip_space(const char *p, const char *lim)
+{
+	while ((!lim || p < lim) && (*p == ' ' || (*p >= '\t' && *p <= '\r')))
+		p++;
+	return (p);
+}
+
+/**
+ * @brief Resolve base 0 and consume a "0x" prefix for bases 0 and 16.
+ *
+ * The prefix is only taken when a hex digit follows, so "0x" alone
+ * parses as 0 with end at the 'x'.
+ */
+static int	read_base(const char **p, const char *lim, int base)
+{
+	const char	*s;
+
+	s = *p;
+	if ((base == 0 || base == 16) && (!lim || lim - s >= 3) && s[0] == '0'
+		&& (s[1] == 'x' || s[1] == 'X') && ft_conv_digit(s[2]) < 16)
+	{
+		*p = s + 2;
+		return (16);
+	}
+	if (base != 0)
+		return (base);
+	if ((!lim || s < lim) && s[0] == '0')
+		return (8);
+	return (10);
+}
+
+void	ft_conv_scan(const char *s, const char *lim, int base, t_numscan *ns)
+{
+	const char	*p;
+	const char	*end;
+
+	ft_bzero(ns, sizeof(*ns));
+	ns->end = s;
+	ns->err = FT_CONV_EMPTY;
+	if (base < 0 || base == 1 || base > 36)
+		return ;
+	p = ft_conv_skip_space(s, lim);
+	if ((!lim || p < lim) && (*p == '-' || *p == '+'))
+		ns->neg = (*p++ == '-');
+	base = read_base(&p, lim, base);
+	ns->err = FT_CONV_OK;
+	end = ft_conv_digits(p, lim, base, ns);
+	if (end == p)
+	{
+		ns->err = FT_CONV_EMPTY;
+		ns->neg = 0;
+		return ;
+	}
+	ns->end = end;
+}
+
+int64_t	ft_conv_signed(t_numscan *ns, uint64_t max)
+{
+	if (!ns->neg && ns->mag > max)
+	{
+		ns->err = FT_CONV_RANGE;
+		return ((int64_t)max);
+	}
+	if (ns->neg && ns->mag > max + 1)
+	{
+		ns->err = FT_CONV_RANGE;
+		return (-(int64_t)max - 1);
+	}
+	if (ns->neg)
+		return ((int64_t)(0 - ns->mag));
+	return ((int64_t)ns->mag);
+}
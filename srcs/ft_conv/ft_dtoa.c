@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_dtoa.c                                          :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:05:59 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:05:59 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+size_t	ft_dtoa_shortest(double x, char *buf)
+{
+	t_dfp	fp;
+	int		cls;
+	int		e;
+	size_t	n;
+
+	cls = ft_dtoa_decode(x, &fp);
+	if (cls != FT_DTOA_FINITE)
+		return (ft_dtoa_special(cls, fp.neg, buf));
+	buf[0] = '-';
+	if (!fp.c)
+	{
+		ft_memcpy(buf + fp.neg, "0", 2);
+		return (fp.neg + 1);
+	}
+	n = ft_dtoa_shortest_digits(&fp, buf + fp.neg, &e);
+	return (fp.neg + ft_dtoa_put_general(buf + fp.neg, n, e,
+			FT_DTOA_SHORTEST_EXP));
+}
+
+size_t	ft_dtoa_fixed(double x, int prec, char *buf)
+{
+	t_dfp	fp;
+	int		cls;
+	char	*d;
+	size_t	n;
+
+	cls = ft_dtoa_decode(x, &fp);
+	if (cls != FT_DTOA_FINITE)
+		return (ft_dtoa_special(cls, fp.neg, buf));
+	if (prec < 0)
+		prec = 6;
+	buf[0] = '-';
+	d = buf + fp.neg;
+	n = ft_dtoa_round(&fp, prec, d);
+	return (fp.neg + ft_dtoa_put_fixed(d, n, prec));
+}
+
+size_t	ft_dtoa_exp(double x, int prec, char *buf)
+{
+	t_dfp	fp;
+	int		cls;
+	int		e;
+
+	cls = ft_dtoa_decode(x, &fp);
+	if (cls != FT_DTOA_FINITE)
+		return (ft_dtoa_special(cls, fp.neg, buf));
+	if (prec < 0)
+		prec = 6;
+	buf[0] = '-';
+	e = 0;
+	if (fp.c)
+		e = ft_dtoa_exp_digits(&fp, prec, buf + fp.neg);
+	else
+		ft_memset(buf + fp.neg, '0', (size_t)prec + 1);
+	return (fp.neg + ft_dtoa_put_exp(buf + fp.neg, (size_t)prec + 1, e));
+}
+
+/**
+ * C's %g rule: with P significant digits and X the exponent %e would
+ * print, positional when -4 <= X < P, trailing zeros removed either way.
+ */
+size_t	ft_dtoa_general(double x, int prec, char *buf)
+{
+	t_dfp	fp;
+	int		cls;
+	int		e;
+
+	cls = ft_dtoa_decode(x, &fp);
+	if (cls != FT_DTOA_FINITE)
+		return (ft_dtoa_special(cls, fp.neg, buf));
+	if (prec < 0)
+		prec = 6;
+	if (prec == 0)
+		prec = 1;
+	buf[0] = '-';
+	e = 0;
+	if (fp.c)
+		e = ft_dtoa_exp_digits(&fp, prec - 1, buf + fp.neg);
+	else
+		ft_memset(buf + fp.neg, '0', (size_t)prec);
+	return (fp.neg + ft_dtoa_put_general(buf + fp.neg, (size_t)prec, e,
+			prec));
+}
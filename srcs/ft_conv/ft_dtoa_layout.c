@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_dtoa_layout.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:08:47 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:08:47 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * The first estimate of the exponent may be one low, which shows as an
+ * extra digit; a carry out of the rounding (9.99 -> 10.0) adds one more
+ * and only ever leaves a trailing zero behind.
+ */
+int	ft_dtoa_exp_digits(const t_dfp *fp, int prec, char *out)
+{
+	int		e;
+	size_t	n;
+
+	e = ft_flog10pow2(fp->q + 63 - __builtin_clzll(fp->c));
+	n = ft_dtoa_round(fp, prec - e, out);
+	if (n > (size_t)prec + 1)
+	{
+		e++;
+		n = ft_dtoa_round(fp, prec - e, out);
+	}
+	if (n > (size_t)prec + 1)
+		e++;
+	out[prec + 1] = '\0';
+	return (e);
+}
+
+/**
+ * The integer is padded to at least prec + 1 digits so there is a digit
+ * before the point, which then goes in prec digits from the end.
+ */
+size_t	ft_dtoa_put_fixed(char *d, size_t n, int prec)
+{
+	if (n < (size_t)prec + 1)
+	{
+		ft_memmove(d + prec + 1 - n, d, n);
+		ft_memset(d, '0', prec + 1 - n);
+		n = (size_t)prec + 1;
+	}
+	if (prec)
+	{
+		ft_memmove(d + n - prec + 1, d + n - prec, prec);
+		d[n - prec] = '.';
+		n++;
+	}
+	d[n] = '\0';
+	return (n);
+}
+
+size_t	ft_dtoa_put_exp(char *d, size_t n, int e)
+{
+	size_t	len;
+
+	len = 1;
+	if (n > 1)
+	{
+		ft_memmove(d + 2, d + 1, n - 1);
+		d[1] = '.';
+		len = n + 1;
+	}
+	d[len++] = 'e';
+	d[len++] = '+';
+	if (e < 0)
+		d[len - 1] = '-';
+	if (e < 0)
+		e = -e;
+	if (e < 10)
+		d[len++] = '0';
+	return (len + ft_utoa_buf((unsigned int)e, d + len));
+}
+
+/**
+ * @brief Positional layout of n significant digits whose first digit has
+ *        exponent e.
+ */
+static size_t	put_plain(char *d, size_t n, int e)
+{
+	size_t	z;
+
+	if (e < 0)
+	{
+		z = (size_t)(-e - 1);
+		ft_memmove(d + 2 + z, d, n);
+		ft_memcpy(d, "0.", 2);
+		ft_memset(d + 2, '0', z);
+		n += 2 + z;
+	}
+	else if (n <= (size_t)e + 1)
+	{
+		ft_memset(d + n, '0', (size_t)e + 1 - n);
+		n = (size_t)e + 1;
+	}
+	else
+	{
+		ft_memmove(d + e + 2, d + e + 1, n - e - 1);
+		d[e + 1] = '.';
+		n++;
+	}
+	d[n] = '\0';
+	return (n);
+}
+
+size_t	ft_dtoa_put_general(char *d, size_t n, int e, int limit)
+{
+	while (n > 1 && d[n - 1] == '0')
+		n--;
+	if (e < -4 || e >= limit)
+		return (ft_dtoa_put_exp(d, n, e));
+	return (put_plain(d, n, e));
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_dtoa_round.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:13:45 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:13:45 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * @brief Whole result below 10^18: one scaled integer with a spare low bit
+ *        for the half, plus the inexact flag as the sticky bit.
+ */
+static size_t	fast_round(const t_dfp *fp, int s, char *out)
+{
+	uint64_t	t;
+	uint64_t	r;
+	int			lost;
+
+	lost = ft_dtoa_scale(fp->c << 1, fp->q, -s, &t);
+	r = t >> 1;
+	if ((t & 1) && (lost || (r & 1)))
+		r++;
+	return (ft_u64toa_buf(r, out));
+}
+
+/**
+ * Places past the last nonzero binary fraction digit (10^s beyond 2^-q)
+ * are zeros; they are appended instead of carried through the bignums.
+ */
+size_t	ft_dtoa_round(const t_dfp *fp, int s, char *out)
+{
+	int		pad;
+	int		lim;
+	size_t	n;
+
+	lim = 0;
+	if (fp->q < 0)
+		lim = -fp->q;
+	pad = 0;
+	if (s > lim)
+		pad = s - lim;
+	s -= pad;
+	if (!fp->c)
+		n = ft_u64toa_buf(0, out);
+	else if (ft_flog10pow2(fp->q + 64 - __builtin_clzll(fp->c)) + s + 1 <= 18)
+		n = fast_round(fp, s, out);
+	else
+		n = ft_dtoa_round_big(fp, s, out);
+	if (fp->c && pad)
+		ft_memset(out + n, '0', pad);
+	if (fp->c)
+		n += pad;
+	out[n] = '\0';
+	return (n);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_dtoa_round.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:13:45 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:43:17 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * @brief Add one to the last of n digits, growing to n + 1 on a carry out.
+ */
+static size_t	round_up(char *out, size_t n)
+{
+	size_t	i;
+
+	i = n;
+	while (i && out[i - 1] == '9')
+		out[--i] = '0';
+	if (i)
+	{
+		out[i - 1]++;
+		return (n);
+	}
+	ft_memmove(out + 1, out, n);
+	out[0] = '1';
+	return (n + 1);
+}
+
+/**
+ * @brief Scale den up to the leading decade of num / den.
+ * @return Index of the last integer digit (digits to generate minus one).
+ */
+static size_t	big_align(t_bignum *num, t_bignum *den)
+{
+	int			j;
+	t_bignum	ten;
+
+	j = ft_flog10pow2((int)ft_big_bitlen(num) - (int)ft_big_bitlen(den) - 1);
+	if (j < 0)
+		j = 0;
+	ft_big_mul_pow10(den, j);
+	ten = *den;
+	ft_big_mul_small(&ten, 10);
+	if (ft_big_cmp(num, &ten) >= 0)
+	{
+		*den = ten;
+		j++;
+	}
+	return ((size_t)j);
+}
+
+/**
+ * @brief Digits by repeated subtraction, for a power of ten divisor.
+ */
+static size_t	by_division(const t_dfp *fp, int s, char *out)
+{
+	t_bignum	nd[2];
+	size_t		last;
+	size_t		i;
+	int			cmp;
+
+	ft_big_load_ratio(fp->c, fp->q, -s, nd);
+	last = big_align(&nd[0], &nd[1]);
+	i = 0;
+	while (i <= last)
+	{
+		out[i] = (char)('0' + ft_big_div_digit(&nd[0], &nd[1]));
+		if (i < last)
+			ft_big_mul_small(&nd[0], 10);
+		i++;
+	}
+	ft_big_shl(&nd[0], 1);
+	cmp = ft_big_cmp(&nd[0], &nd[1]);
+	if (cmp > 0 || (cmp == 0 && (out[last] & 1)))
+		return (round_up(out, last + 1));
+	return (last + 1);
+}
+
+/**
+ * @brief c * 10^s / 2^-q: the division is a shift, whose dropped bits
+ *        decide the rounding, and the quotient is printed by ft_big_to_dec.
+ */
+static size_t	by_shift(const t_dfp *fp, int s, char *out)
+{
+	t_bignum	num;
+	int			dropped;
+	size_t		n;
+
+	ft_big_set(&num, fp->c);
+	if (fp->q > 0)
+		ft_big_shl(&num, fp->q);
+	ft_big_mul_pow10(&num, s);
+	dropped = 0;
+	if (fp->q < 0)
+		dropped = ft_big_shr_round(&num, -fp->q);
+	n = ft_big_to_dec(&num, out);
+	if (dropped == 3 || (dropped == 2 && (out[n - 1] & 1)))
+		return (round_up(out, n));
+	return (n);
+}
+
+/**
+ * Exact digits for results too wide for a 64-bit integer.
+ */
+size_t	ft_dtoa_round_big(const t_dfp *fp, int s, char *out)
+{
+	size_t	n;
+
+	if (s >= 0)
+		n = by_shift(fp, s, out);
+	else
+		n = by_division(fp, s, out);
+	out[n] = '\0';
+	return (n);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_dtoa_scale.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:15:08 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:15:08 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+static const uint64_t	g_dtoa_pow10[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+	10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+	100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL,
+	10000000000000000000ULL
+};
+
+/**
+ * @brief w = a * 10^k (k <= 38) as three 64-bit words, least significant
+ *        first.
+ */
+static void	mul192(uint64_t a, int k, uint64_t *w)
+{
+	t_u128	b;
+	t_u128	lo;
+	t_u128	hi;
+	t_u128	mid;
+
+	b = (t_u128)g_dtoa_pow10[k / 2] * g_dtoa_pow10[k - k / 2];
+	lo = (t_u128)a * (uint64_t)b;
+	hi = (t_u128)a * (uint64_t)(b >> 64);
+	mid = (lo >> 64) + (uint64_t)hi;
+	w[0] = (uint64_t)lo;
+	w[1] = (uint64_t)mid;
+	w[2] = (uint64_t)(hi >> 64) + (uint64_t)(mid >> 64);
+}
+
+/**
+ * @brief Low 64 bits of w >> s.
+ * @return 1 if a shifted-out bit was set.
+ */
+static int	shr192(const uint64_t *w, unsigned int s, uint64_t *out)
+{
+	unsigned int	idx;
+	unsigned int	bits;
+	unsigned int	i;
+	int				lost;
+
+	idx = s / 64;
+	bits = s % 64;
+	*out = 0;
+	lost = 0;
+	i = 0;
+	while (i < idx && i < 3)
+		lost |= (w[i++] != 0);
+	if (idx >= 3)
+		return (lost);
+	*out = w[idx] >> bits;
+	if (bits && idx < 2)
+		*out |= w[idx + 1] << (64 - bits);
+	if (bits)
+		lost |= ((w[idx] << (64 - bits)) != 0);
+	return (lost);
+}
+
+/**
+ * @brief floor(n / 10^k) for k <= 38.
+ */
+static int	scale_div(t_u128 n, int k, uint64_t *out, int lost)
+{
+	t_u128	p;
+
+	p = (t_u128)g_dtoa_pow10[k / 2] * g_dtoa_pow10[k - k / 2];
+	*out = (uint64_t)(n / p);
+	return (lost || (n % p) != 0);
+}
+
+/**
+ * @brief ft_dtoa_scale for 0 < k <= 38.
+ */
+static int	scale_down(uint64_t cx, int q, int k, uint64_t *out)
+{
+	if (q <= -64)
+	{
+		*out = 0;
+		return (cx != 0);
+	}
+	if (q < 0)
+		return (scale_div(cx >> -q, k, out, (cx << (64 + q)) != 0));
+	if (q <= 63 + __builtin_clzll(cx | 1))
+		return (scale_div((t_u128)cx << q, k, out, 0));
+	return (ft_dtoa_scale_table(cx, q, k, out));
+}
+
+/**
+ * Within 38 decades 10^k fits 128 bits and the result is exact from one
+ * 192-bit product or a 128-bit division. Further out the rounded-up table
+ * of ft_dtoa_scale_table is used.
+ */
+int	ft_dtoa_scale(uint64_t cx, int q, int k, uint64_t *out)
+{
+	uint64_t	w[3];
+
+	if (k > 0 && k <= 38)
+		return (scale_down(cx, q, k, out));
+	if (k > 0 || k < -38 || q >= 64)
+		return (ft_dtoa_scale_table(cx, q, k, out));
+	mul192(cx, -k, w);
+	if (q >= 0)
+	{
+		*out = w[0] << q;
+		return (0);
+	}
+	return (shr192(w, -q, out));
+}
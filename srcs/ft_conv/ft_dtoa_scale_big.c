@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_dtoa_scale_big.c                                :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:21:05 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:21:05 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * The larger power of each base goes to whichever side keeps both
+ * integers.
+ */
+void	ft_big_load_ratio(uint64_t cx, int q, int k, t_bignum *nd)
+{
+	ft_big_set(&nd[0], cx);
+	ft_big_set(&nd[1], 1);
+	if (q > 0)
+		ft_big_shl(&nd[0], q);
+	else
+		ft_big_shl(&nd[1], -q);
+	if (k < 0)
+		ft_big_mul_pow10(&nd[0], -k);
+	else
+		ft_big_mul_pow10(&nd[1], k);
+}
+
+int	ft_dtoa_scale_big(uint64_t cx, int q, int k, uint64_t *out)
+{
+	t_bignum	nd[2];
+
+	ft_big_load_ratio(cx, q, k, nd);
+	return (ft_big_div_u64(&nd[0], &nd[1], out));
+}
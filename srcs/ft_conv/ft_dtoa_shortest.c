@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_dtoa_shortest.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:26:22 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:26:22 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * @brief cx * 2^q / 10^k rounded to odd: the floor with its low bit set
+ *        when anything was cut off.
+ */
+static uint64_t	round_odd(uint64_t cx, int q, int k)
+{
+	uint64_t	v;
+
+	if (ft_dtoa_scale(cx, q, k, &v))
+		v |= 1;
+	return (v);
+}
+
+/**
+ * @brief Pick among s, s + 1 and the multiples of ten around them.
+ *
+ * vb, vbl and vbr are 4 * x, 4 * (x - ulp / 2) and 4 * (x + ulp / 2) in
+ * units of 10^k, rounded to odd. A candidate wins when it lies inside the
+ * rounding interval, which is closed for even significands.
+ */
+static uint64_t	pick(const uint64_t *v, uint64_t out)
+{
+	uint64_t	s;
+	uint64_t	sp10;
+	int			uin;
+	int			win;
+
+	s = v[0] >> 2;
+	sp10 = s / 10 * 10;
+	uin = (v[1] + out <= sp10 << 2);
+	win = (((sp10 + 10) << 2) + out <= v[2]);
+	if (s >= 100 && uin != win)
+		return (sp10 + 10 * win);
+	uin = (v[1] + out <= s << 2);
+	win = (((s + 1) << 2) + out <= v[2]);
+	if (uin != win)
+		return (s + win);
+	if (v[0] < (s << 2) + 2 || (v[0] == (s << 2) + 2 && !(s & 1)))
+		return (s);
+	return (s + 1);
+}
+
+/**
+ * Schubfach (R. Giulietti): the candidates come from one decade k chosen
+ * from the binary exponent, so no digit loop or retry is needed. Instead
+ * of a table of 128-bit powers of ten the three bounds are scaled exactly
+ * by ft_dtoa_scale, which only falls back to bignums beyond 10^+-38.
+ */
+size_t	ft_dtoa_shortest_digits(const t_dfp *fp, char *out, int *e10)
+{
+	uint64_t	v[3];
+	uint64_t	cb;
+	int			k;
+	size_t		n;
+
+	cb = fp->c << 2;
+	if (fp->c == 1ULL << 52 && fp->q > -1074)
+	{
+		k = (int)(((int64_t)fp->q * 661971961083LL - 274743187321LL) >> 41);
+		v[1] = round_odd(cb - 1, fp->q, k);
+	}
+	else
+	{
+		k = ft_flog10pow2(fp->q);
+		v[1] = round_odd(cb - 2, fp->q, k);
+	}
+	v[0] = round_odd(cb, fp->q, k);
+	v[2] = round_odd(cb + 2, fp->q, k);
+	n = ft_u64toa_buf(pick(v, fp->c & 1), out);
+	*e10 = k + (int)n - 1;
+	while (n > 1 && out[n - 1] == '0')
+		n--;
+	out[n] = '\0';
+	return (n);
+}
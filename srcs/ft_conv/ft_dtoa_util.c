@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_dtoa_util.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:31:15 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:31:15 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * 661971961083 / 2^41 is log10(2) to within 2^-41, close enough for the
+ * floor to be exact over every double exponent.
+ */
+int	ft_flog10pow2(int e)
+{
+	return ((int)(((int64_t)e * 661971961083LL) >> 41));
+}
+
+int	ft_dtoa_decode(double x, t_dfp *fp)
+{
+	uint64_t	bits;
+	int			biased;
+
+	__builtin_memcpy(&bits, &x, sizeof(bits));
+	fp->neg = (int)(bits >> 63);
+	biased = (int)((bits >> 52) & 0x7FF);
+	fp->c = bits & ((1ULL << 52) - 1);
+	if (biased == 0x7FF && fp->c)
+		return (FT_DTOA_NAN);
+	if (biased == 0x7FF)
+		return (FT_DTOA_INF);
+	fp->q = -1074;
+	if (biased)
+	{
+		fp->c |= 1ULL << 52;
+		fp->q = biased - 1075;
+	}
+	return (FT_DTOA_FINITE);
+}
+
+/**
+ * The sign is kept for NaN too ("-nan"), as glibc prints it.
+ */
+size_t	ft_dtoa_special(int cls, int neg, char *buf)
+{
+	size_t	len;
+
+	len = 0;
+	if (neg)
+		buf[len++] = '-';
+	if (cls == FT_DTOA_NAN)
+		ft_memcpy(buf + len, "nan", 4);
+	else
+		ft_memcpy(buf + len, "inf", 4);
+	return (len + 3);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_parse_ints.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 02:50:53 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 02:50:53 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * @brief Append v, storing in place while the vector has room.
+ */
+static int	append(t_vec *out, int64_t v)
+{
+	if (out->len < out->cap)
+	{
+		((int64_t *)out->data)[out->len++] = v;
+		return (1);
+	}
+	return (ft_vec_push(out, &v));
+}
+
+static int	at_separator(const char *p, const char *lim)
+{
+	return (p == lim || *p == ' ' || (*p >= '\t' && *p <= '\r'));
+}
+
+/**
+ * Every number is scanned in place with the bounded decimal kernel, so
+ * the buffer needs no terminator and nothing is copied.
+ */
+int	ft_parse_ints(const char *buf, size_t len, t_vec *out)
+{
+	const char	*p;
+	const char	*lim;
+	t_numscan	ns;
+	int64_t		v;
+
+	if (!buf || !out || out->elem_size != sizeof(int64_t))
+		return (0);
+	lim = buf + len;
+	p = ft_conv_skip_space(buf, lim);
+	while (p < lim)
+	{
+		ft_conv_scan(p, lim, 10, &ns);
+		v = ft_conv_signed(&ns, INT64_MAX);
+		if (ns.err != FT_CONV_OK || !at_separator(ns.end, lim)
+			|| !append(out, v))
+			return (0);
+		p = ft_conv_skip_space(ns.end, lim);
+	}
+	return (1);
+}
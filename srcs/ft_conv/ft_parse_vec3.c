@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_parse_vec3.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:28:35 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:28:35 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * @brief One double, then the ',' before the next one unless last.
+ */
+static int	read_component(const char **p, double *v, int last)
+{
+	char	*end;
+	int		err;
+
+	*v = ft_strtod(*p, &end, &err);
+	if (err != FT_CONV_OK)
+		return (0);
+	*p = end;
+	if (last)
+		return (1);
+	while (**p == ' ' || **p == '\t')
+		(*p)++;
+	if (**p != ',')
+		return (0);
+	(*p)++;
+	return (1);
+}
+
+int	ft_parse_vec3(const char *s, char **end, t_vec3 *out)
+{
+	t_vec3		v;
+	const char	*p;
+
+	p = s;
+	if (!read_component(&p, &v.x, 0) || !read_component(&p, &v.y, 0)
+		|| !read_component(&p, &v.z, 1))
+	{
+		if (end)
+			*end = (char *)s;
+		return (0);
+	}
+	*out = v;
+	if (end)
+		*end = (char *)p;
+	return (1);
+}
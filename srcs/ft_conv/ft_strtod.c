@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strtod.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:13:30 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:13:30 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+static int	match_word(const char *p, const char *word)
+{
+	while (*word)
+	{
+		if (ft_tolower((unsigned char)*p) != *word)
+			return (0);
+		p++;
+		word++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Skip the optional "(n-char-sequence)" after "nan".
+ */
+static const char	*skip_nan_tag(const char *p)
+{
+	const char	*q;
+
+	if (*p != '(')
+		return (p);
+	q = p + 1;
+	while (ft_isalnum((unsigned char)*q) || *q == '_')
+		q++;
+	if (*q != ')')
+		return (p);
+	return (q + 1);
+}
+
+/**
+ * @brief "inf", "infinity" or "nan[(tag)]" in any case, after the space
+ *        and sign the scan already skipped.
+ * @return 1 with the bits in *bits and d->end set, 0 if none matches.
+ */
+static int	parse_special(const char *s, t_decimal *d, uint64_t *bits)
+{
+	const char	*p;
+
+	p = ft_conv_skip_space(s, NULL);
+	p += (*p == '-' || *p == '+');
+	if (match_word(p, "inf"))
+	{
+		d->end = p + 3;
+		if (match_word(p + 3, "inity"))
+			d->end = p + 8;
+		*bits = 0x7FF0000000000000ULL;
+		return (1);
+	}
+	if (!match_word(p, "nan"))
+		return (0);
+	d->end = skip_nan_tag(p + 3);
+	*bits = 0x7FF8000000000000ULL;
+	return (1);
+}
+
+/**
+ * Clinger's exact product first, then Eisel-Lemire. With more than 19
+ * digits the true value lies between w and w + 1 units, so it is settled
+ * when both ends round alike; otherwise the bignums decide.
+ */
+static uint64_t	to_bits(const t_decimal *d, int *err)
+{
+	int64_t		q;
+	double		x;
+	uint64_t	bits;
+	uint64_t	upper;
+
+	q = d->exp10;
+	if (d->nd > 19)
+		q += d->nd - 19;
+	if (!d->w || q < -342)
+		return (0);
+	if (q > 308)
+		bits = 0x7FF0000000000000ULL;
+	else if (!d->trunc && ft_strtod_clinger(d->w, (int)q, &x))
+		__builtin_memcpy(&bits, &x, sizeof(bits));
+	else if (!ft_strtod_lemire(d->w, (int)q, &bits) || (d->trunc
+			&& (!ft_strtod_lemire(d->w + 1, (int)q, &upper) || upper != bits)))
+		bits = ft_strtod_big(d);
+	if (bits == 0x7FF0000000000000ULL)
+		*err = FT_CONV_RANGE;
+	return (bits);
+}
+
+double	ft_strtod(const char *s, char **end, int *err)
+{
+	t_decimal	d;
+	uint64_t	bits;
+	int			e;
+	double		x;
+
+	ft_strtod_scan(s, &d);
+	e = FT_CONV_OK;
+	bits = 0;
+	if (d.end != s)
+		bits = to_bits(&d, &e);
+	else if (!parse_special(s, &d, &bits))
+	{
+		e = FT_CONV_EMPTY;
+		d.neg = 0;
+	}
+	if (end)
+		*end = (char *)d.end;
+	if (err)
+		*err = e;
+	bits |= (uint64_t)d.neg << 63;
+	__builtin_memcpy(&x, &bits, sizeof(x));
+	return (x);
+}
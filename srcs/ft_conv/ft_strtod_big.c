@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strtod_big.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:16:59 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:16:59 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * @brief Up to FT_STRTOD_DIGITS significant digits of d into b, nine per
+ *        limb pass, with a final 1 standing in for any nonzero rest.
+ * @return Number of digits b holds.
+ */
+static int64_t	load_digits(const t_decimal *d, t_bignum *b)
+{
+	const char	*p;
+	int64_t		used;
+	uint32_t	chunk;
+	uint32_t	scale;
+
+	ft_big_set(b, 0);
+	p = d->first;
+	used = 0;
+	while (used < d->nd && used < FT_STRTOD_DIGITS)
+	{
+		chunk = 0;
+		scale = 1;
+		while (scale < 1000000000 && used < d->nd && used < FT_STRTOD_DIGITS)
+		{
+			p += (*p == '.');
+			chunk = chunk * 10 + (uint32_t)(*p++ - '0');
+			scale *= 10;
+			used++;
+		}
+		ft_big_mul_add(b, scale, chunk);
+	}
+	return (used);
+}
+
+/**
+ * @brief 1 if a digit past the first FT_STRTOD_DIGITS is nonzero.
+ */
+static int	rest_nonzero(const t_decimal *d)
+{
+	const char	*p;
+	int64_t		i;
+
+	p = d->first;
+	i = 0;
+	while (i < d->nd)
+	{
+		p += (*p == '.');
+		if (i >= FT_STRTOD_DIGITS && *p != '0')
+			return (1);
+		p++;
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief num * 10^q as IEEE bits: 64 leading bits and a sticky flag for
+ *        the rest, from a shift when q >= 0 or from a 64-bit quotient.
+ */
+static uint64_t	big_bits(t_bignum *num, int q)
+{
+	t_bignum	den;
+	uint64_t	v;
+	int			s;
+	int			lost;
+
+	if (q >= 0)
+	{
+		ft_big_mul_pow10(num, q);
+		s = (int)ft_big_bitlen(num) - 64;
+		if (s < 0)
+			s = 0;
+		lost = (ft_big_shr_round(num, s) != 0);
+		return (ft_strtod_round_pack(ft_big_low64(num), s, lost));
+	}
+	ft_big_set(&den, 1);
+	ft_big_mul_pow10(&den, -q);
+	s = 63 - (int)ft_big_bitlen(num) + (int)ft_big_bitlen(&den);
+	if (s > 0)
+		ft_big_shl(num, s);
+	else
+		ft_big_shl(&den, -s);
+	lost = ft_big_div_u64(num, &den, &v);
+	return (ft_strtod_round_pack(v, -s, lost));
+}
+
+/**
+ * Inputs whose leading digit is past 10^308 or below 10^-325 never get
+ * here (the caller saturates them), which keeps every bignum within
+ * FT_BIGNUM_LIMBS.
+ */
+uint64_t	ft_strtod_big(const t_decimal *d)
+{
+	t_bignum	num;
+	int64_t		used;
+
+	used = load_digits(d, &num);
+	if (d->nd > used && rest_nonzero(d))
+	{
+		ft_big_mul_add(&num, 10, 1);
+		used++;
+	}
+	return (big_bits(&num, (int)(d->exp10 + d->nd - used)));
+}
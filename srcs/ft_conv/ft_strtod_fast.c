@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strtod_fast.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:22:57 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:22:57 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+static const double	g_exact_pow10[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+	1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief Significand bits a double keeps for a value whose leading bit
+ *        is 2^e2: 53, fewer for subnormals, 0 or less when even the
+ *        smallest subnormal is out of reach.
+ */
+static int	keep_bits(int e2)
+{
+	if (e2 >= -1022)
+		return (53);
+	return (e2 + 1075);
+}
+
+/**
+ * Exponents past the top binade saturate to infinity. For subnormals the
+ * exponent field stays 0, and a carry out of the significand moves into
+ * it by plain addition.
+ */
+uint64_t	ft_strtod_round_pack(uint64_t v, int b, int lost)
+{
+	int			n;
+	int			e2;
+	int			shift;
+	uint64_t	m;
+
+	n = 64 - __builtin_clzll(v | 1);
+	e2 = n - 1 + b;
+	if (!v || e2 > 1023)
+		return ((uint64_t)(v != 0) * 0x7FF0000000000000ULL);
+	shift = n - keep_bits(e2);
+	if (shift > 64)
+		return (0);
+	if (shift <= 0)
+		m = v << -shift;
+	else
+	{
+		m = (v >> (shift - 1)) >> 1;
+		lost |= ((v & ((1ULL << (shift - 1)) - 1)) != 0);
+		if (((v >> (shift - 1)) & 1) && (lost || (m & 1)))
+			m++;
+	}
+	if (e2 < -1022)
+		return (m);
+	return (((uint64_t)(e2 + 1022) << 52) + m);
+}
+
+/**
+ * Both operands are exact doubles, so the single multiply or divide is
+ * the correctly rounded result.
+ */
+int	ft_strtod_clinger(uint64_t w, int q, double *out)
+{
+	if (w > (1ULL << 53) || q < -22 || q > 22)
+		return (0);
+	*out = (double)w;
+	if (q < 0)
+		*out /= g_exact_pow10[-q];
+	else
+		*out *= g_exact_pow10[q];
+	return (1);
+}
+
+/**
+ * @brief 1 if some rounding boundary lies within wn below the product,
+ *        whose top word p[2] is worth 2^b per unit.
+ *
+ * The table overshoots, so the exact product is in [p - wn, p). Every
+ * multiple of half an ulp changes the rounding; when one falls in that
+ * range (the bits under the round bit are at most wn) p cannot decide.
+ */
+static int	undecided(const uint64_t *p, int b, uint64_t wn)
+{
+	int	n;
+	int	shift;
+
+	n = 64 - __builtin_clzll(p[2]);
+	shift = n - keep_bits(n - 1 + b);
+	if (shift > 63)
+		return (1);
+	return (!((p[2] & ((1ULL << (shift - 1)) - 1)) || p[1] || p[0] > wn));
+}
+
+/**
+ * Eisel-Lemire with the rounded-up table of ft_dtoa_pow10_128: instead of
+ * the usual "low bits all ones" heuristic, the exact error bound of the
+ * product decides when to give up.
+ */
+int	ft_strtod_lemire(uint64_t w, int q, uint64_t *bits)
+{
+	const uint64_t	*g;
+	uint64_t		p[3];
+	t_u128			lo;
+	t_u128			hi;
+	int				lz;
+
+	lz = __builtin_clzll(w);
+	w <<= lz;
+	g = ft_dtoa_pow10_128(q);
+	lo = (t_u128)w * g[1];
+	hi = (t_u128)w * g[0] + (uint64_t)(lo >> 64);
+	p[0] = (uint64_t)lo;
+	p[1] = (uint64_t)hi;
+	p[2] = (uint64_t)(hi >> 64);
+	lz = ft_flog2pow10(q) + 1 - lz;
+	if (undecided(p, lz, w))
+		return (0);
+	*bits = ft_strtod_round_pack(p[2], lz, 1);
+	return (1);
+}
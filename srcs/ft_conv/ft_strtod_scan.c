@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strtod_scan.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:25:46 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:32:03 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+static void	add_digit(t_decimal *d, const char *p)
+{
+	int	digit;
+
+	digit = *p - '0';
+	if (!d->nd && !digit)
+		return ;
+	if (!d->nd)
+		d->first = p;
+	if (d->nd < 19)
+		d->w = d->w * 10 + digit;
+	else
+		d->trunc |= (digit != 0);
+	d->nd++;
+}
+
+/**
+ * @brief Take 8 digits at once: into w while it has room for all of them,
+ *        or only as "zero or not" once it is full.
+ */
+static void	add_eight(t_decimal *d, const char *p, uint64_t v)
+{
+	if (d->nd >= 19)
+		d->trunc |= (v != 0);
+	else if (d->nd)
+		d->w = d->w * 100000000 + v;
+	if (d->nd)
+	{
+		d->nd += 8;
+		return ;
+	}
+	if (!v)
+		return ;
+	d->nd = (int64_t)ft_conv_dec_len(v);
+	d->first = p + 8 - d->nd;
+	d->w = v;
+}
+
+static const char	*scan_digits(const char *p, t_decimal *d)
+{
+	uint64_t	v;
+
+	while ((unsigned char)(*p - '0') < 10)
+	{
+		if ((d->nd <= 11 || d->nd >= 19) && ft_conv_load8(p, NULL, &v))
+		{
+			add_eight(d, p, v);
+			p += 8;
+		}
+		else
+			add_digit(d, p++);
+	}
+	return (p);
+}
+
+/**
+ * @brief Consume "e[+-]digits" if a digit follows; the magnitude
+ *        saturates far beyond any double.
+ */
+static const char	*scan_exponent(const char *p, t_decimal *d)
+{
+	const char	*q;
+	int64_t		e;
+	int			neg;
+
+	if (*p != 'e' && *p != 'E')
+		return (p);
+	q = p + 1;
+	neg = 0;
+	if (*q == '+' || *q == '-')
+		neg = (*q++ == '-');
+	if (!ft_isdigit(*q))
+		return (p);
+	e = 0;
+	while (ft_isdigit(*q))
+	{
+		if (e < 100000000)
+			e = e * 10 + (*q - '0');
+		q++;
+	}
+	if (neg)
+		e = -e;
+	d->exp10 += e;
+	return (q);
+}
+
+void	ft_strtod_scan(const char *s, t_decimal *d)
+{
+	const char	*p;
+	const char	*digits;
+	const char	*frac;
+
+	ft_bzero(d, sizeof(*d));
+	d->end = s;
+	p = ft_conv_skip_space(s, NULL);
+	if (*p == '-' || *p == '+')
+		d->neg = (*p++ == '-');
+	digits = p;
+	p = scan_digits(p, d);
+	if (*p == '.')
+	{
+		frac = p + 1;
+		p = scan_digits(frac, d);
+		d->exp10 = -(p - frac);
+		if (p == frac && frac == digits + 1)
+			return ;
+	}
+	if (p == digits)
+		return ;
+	d->end = scan_exponent(p, d);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strtol.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 02:54:33 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 02:54:33 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+static void	finish(const t_numscan *ns, char **end, int *err)
+{
+	if (end)
+		*end = (char *)ns->end;
+	if (err)
+		*err = ns->err;
+}
+
+/**
+ * Like strtoull, a leading '-' negates the value modulo 2^64.
+ */
+unsigned long long	ft_strtoull(const char *s, char **end, int base,
+		int *err)
+{
+	t_numscan	ns;
+
+	ft_conv_scan(s, NULL, base, &ns);
+	finish(&ns, end, err);
+	if (ns.neg && ns.err == FT_CONV_OK)
+		return (0 - ns.mag);
+	return (ns.mag);
+}
+
+long long	ft_strtoll(const char *s, char **end, int base, int *err)
+{
+	t_numscan	ns;
+	long long	v;
+
+	ft_conv_scan(s, NULL, base, &ns);
+	v = ft_conv_signed(&ns, LLONG_MAX);
+	finish(&ns, end, err);
+	return (v);
+}
+
+long	ft_strtol(const char *s, char **end, int base, int *err)
+{
+	t_numscan	ns;
+	long		v;
+
+	ft_conv_scan(s, NULL, base, &ns);
+	v = ft_conv_signed(&ns, LONG_MAX);
+	finish(&ns, end, err);
+	return (v);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_u64toa.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 03:13:37 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 03:13:37 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+static const char		g_digit_pairs[201]
+	= "00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+/*
+ * Entry t is the smallest value with t + 1 digits, except entry 0, which
+ * is 0 so that 0 itself counts as one digit.
+ */
+static const uint64_t	g_pow10[20] = {
+	0ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+	10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+	100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL,
+	10000000000000000000ULL
+};
+
+/**
+ * The bit length of n gives its digit count to within one:
+ * bits * 1233 / 4096 approximates bits * log10(2). One table compare
+ * settles the rest.
+ */
+size_t	ft_conv_dec_len(uint64_t n)
+{
+	size_t	t;
+
+	t = ((64 - __builtin_clzll(n | 1)) * 1233) >> 12;
+	return (t + (n >= g_pow10[t]));
+}
+
+/**
+ * Digits are written from the end two at a time, one division by 100
+ * and one table copy per pair.
+ */
+size_t	ft_u64toa_buf(uint64_t n, char *buf)
+{
+	size_t	len;
+	size_t	i;
+
+	len = ft_conv_dec_len(n);
+	buf[len] = '\0';
+	i = len;
+	while (n >= 100)
+	{
+		i -= 2;
+		__builtin_memcpy(buf + i, g_digit_pairs + (n % 100) * 2, 2);
+		n /= 100;
+	}
+	if (n >= 10)
+		__builtin_memcpy(buf, g_digit_pairs + n * 2, 2);
+	else
+		buf[0] = '0' + n;
+	return (len);
+}
+
+size_t	ft_i64toa_buf(int64_t n, char *buf)
+{
+	if (n < 0)
+	{
+		buf[0] = '-';
+		return (1 + ft_u64toa_buf(0 - (uint64_t)n, buf + 1));
+	}
+	return (ft_u64toa_buf((uint64_t)n, buf));
+}
+
+size_t	ft_utoa_buf(unsigned int n, char *buf)
+{
+	return (ft_u64toa_buf(n, buf));
+}
+
+size_t	ft_itoa_buf(int n, char *buf)
+{
+	return (ft_i64toa_buf(n, buf));
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_u64toa_base.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 03:19:00 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 03:19:00 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_conv_internal.h"
+
+/**
+ * @brief Power-of-two bases: the digit count comes from the bit length
+ *        and each digit is a mask and a shift.
+ */
+static size_t	to_pow2(uint64_t n, const char *digits, unsigned int shift,
+		char *buf)
+{
+	size_t		len;
+	size_t		i;
+	uint64_t	mask;
+
+	len = (64 - __builtin_clzll(n | 1) + shift - 1) / shift;
+	mask = ((uint64_t)1 << shift) - 1;
+	buf[len] = '\0';
+	i = len;
+	while (i > 0)
+	{
+		buf[--i] = digits[n & mask];
+		n >>= shift;
+	}
+	return (len);
+}
+
+/**
+ * @brief Other bases: digits are produced backwards into a local buffer
+ *        and copied out once.
+ */
+static size_t	to_base(uint64_t n, const char *digits, size_t base, char *buf)
+{
+	char	tmp[64];
+	size_t	i;
+
+	i = sizeof(tmp);
+	tmp[--i] = digits[n % base];
+	n /= base;
+	while (n)
+	{
+		tmp[--i] = digits[n % base];
+		n /= base;
+	}
+	ft_memcpy(buf, tmp + i, sizeof(tmp) - i);
+	buf[sizeof(tmp) - i] = '\0';
+	return (sizeof(tmp) - i);
+}
+
+size_t	ft_u64toa_base_buf(uint64_t n, const char *digits, char *buf)
+{
+	size_t	base;
+
+	base = ft_strlen(digits);
+	if (base < 2)
+	{
+		buf[0] = '\0';
+		return (0);
+	}
+	if (base == 10 && !ft_strncmp(digits, "0123456789", 10))
+		return (ft_u64toa_buf(n, buf));
+	if ((base & (base - 1)) == 0)
+		return (to_pow2(n, digits, __builtin_ctzll(base), buf));
+	return (to_base(n, digits, base, buf));
+}
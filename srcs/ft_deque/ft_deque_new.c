@@ -6,31 +6,41 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/12/14 15:44:23 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/14 16:28:26 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 20:42:37 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
 t_deque	*ft_deque_new(size_t elem_size, size_t init_cap)
+{
+	return (ft_deque_new_with_alloc(elem_size, init_cap, NULL));
+}
+
+t_deque	*ft_deque_new_with_alloc(size_t elem_size, size_t init_cap,
+		const t_allocator *alloc)
 {
 	t_deque	*d;
 
 	if (elem_size == 0)
 		return (NULL);
-	d = ft_calloc(1, sizeof(t_deque));
+	d = ft_allocator_calloc(alloc, 1, sizeof(t_deque));
 	if (!d)
 		return (NULL);
+	if (alloc)
+		d->alloc = *alloc;
 	if (init_cap == 0)
 		init_cap = 8;
-	d->data = ft_calloc(init_cap, elem_size);
+	d->data = ft_allocator_calloc(alloc, init_cap, elem_size);
 	if (!d->data)
-		return (free(d), NULL);
+		return (ft_allocator_free(alloc, d, sizeof(t_deque)), NULL);
 	d->elem_size = elem_size;
 	d->cap = init_cap;
 	d->head = 0;
 	d->tail = 0;
 	d->len = 0;
+	ft_memstats_alloc(alloc, "ft_deque_new", 0,
+		sizeof(t_deque) + init_cap * elem_size);
 	return (d);
 }
 
@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/12/14 16:35:33 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/15 17:38:10 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 20:48:01 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -36,11 +36,13 @@ static int	ft_deque_grow(t_deque *d)
 	new_cap = d->cap * 2;
 	if (new_cap < d->cap)
 		return (0);
-	new_data = ft_calloc(new_cap, d->elem_size);
+	new_data = ft_allocator_calloc(&d->alloc, new_cap, d->elem_size);
 	if (!new_data)
 		return (0);
 	copy_linearized(d, new_data);
-	free(d->data);
+	ft_memstats_alloc(&d->alloc, "ft_deque_grow", d->cap * d->elem_size,
+		new_cap * d->elem_size);
+	ft_allocator_free(&d->alloc, d->data, d->cap * d->elem_size);
 	d->data = new_data;
 	d->cap = new_cap;
 	d->head = 0;
@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/12/15 18:02:23 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/15 18:02:55 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 20:49:49 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,11 +14,15 @@
 
 void	ft_deque_free(t_deque *d)
 {
+	t_allocator	alloc;
+
 	if (!d)
 		return ;
-	if (d->data)
-		free(d->data);
-	free(d);
+	alloc = d->alloc;
+	ft_memstats_alloc(&alloc, "ft_deque_free",
+		sizeof(t_deque) + d->cap * d->elem_size, 0);
+	ft_allocator_free(&alloc, d->data, d->cap * d->elem_size);
+	ft_allocator_free(&alloc, d, sizeof(t_deque));
 }
 
 int	ft_deque_is_empty(t_deque *d)
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_hashmap_alloc.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 17:01:54 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:50:10 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hashmap_internal.h"
+
+t_vec	**ft_hashmap_buckets_new(t_hashmap *map, size_t cap)
+{
+	return (ft_allocator_calloc(&map->alloc, cap, sizeof(t_vec *)));
+}
+
+void	ft_hashmap_buckets_free(t_hashmap *map, t_vec **buckets, size_t cap)
+{
+	ft_allocator_free(&map->alloc, buckets, cap * sizeof(t_vec *));
+}
+
+char	*ft_hashmap_key_dup(t_hashmap *map, const char *key)
+{
+	char	*dup;
+	size_t	len;
+
+	if (map->keys)
+		return ((char *)key);
+	len = ft_strlen(key);
+	dup = ft_allocator_alloc(&map->alloc, len + 1);
+	if (!dup)
+		return (NULL);
+	ft_memcpy(dup, key, len + 1);
+	ft_memstats_alloc(&map->alloc, "ft_hashmap_key", 0, len + 1);
+	return (dup);
+}
+
+void	ft_hashmap_key_free(t_hashmap *map, char *key)
+{
+	size_t	size;
+
+	if (!key || map->keys)
+		return ;
+	size = ft_strlen(key) + 1;
+	ft_memstats_alloc(&map->alloc, "ft_hashmap_key", size, 0);
+	ft_allocator_free(&map->alloc, key, size);
+}
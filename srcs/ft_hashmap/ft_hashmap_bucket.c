@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_hashmap_bucket.c                                :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 18:04:32 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:54:57 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hashmap_internal.h"
+
+/**
+ * @brief Carve a bucket from the map's pool.
+ *
+ * The t_vec header and FT_HASHMAP_BUCKET_INLINE entries share the pool
+ * object: data points right behind the header.
+ */
+static t_vec	*pooled_bucket_new(t_pool *pool)
+{
+	t_vec	*bucket;
+
+	bucket = ft_pool_alloc(pool);
+	if (!bucket)
+		return (NULL);
+	ft_bzero(bucket, sizeof(t_vec));
+	bucket->data = bucket + 1;
+	bucket->cap = FT_HASHMAP_BUCKET_INLINE;
+	bucket->elem_size = sizeof(t_hashmap_entry);
+	return (bucket);
+}
+
+t_vec	*ft_hashmap_bucket_new(t_hashmap *map)
+{
+	if (map->pool)
+		return (pooled_bucket_new(map->pool));
+	return (ft_vec_new_with_alloc(sizeof(t_hashmap_entry), 4, &map->alloc));
+}
+
+/**
+ * @brief Append an entry to a bucket.
+ *
+ * A pooled bucket that outgrows its inline entries moves them to a heap
+ * buffer first; from then on it grows like any heap vector.
+ */
+int	ft_hashmap_bucket_push(t_hashmap *map, t_vec *bucket,
+		t_hashmap_entry *entry)
+{
+	void	*data;
+
+	if (map->pool && bucket->data == (void *)(bucket + 1)
+		&& bucket->len == bucket->cap)
+	{
+		data = ft_allocator_calloc(NULL, bucket->cap * 2, bucket->elem_size);
+		if (!data)
+			return (0);
+		ft_memstats_record("ft_hashmap_bucket", 0,
+			bucket->cap * 2 * bucket->elem_size);
+		ft_memcpy(data, bucket->data, bucket->len * bucket->elem_size);
+		bucket->data = data;
+		bucket->cap *= 2;
+	}
+	return (ft_vec_push(bucket, entry));
+}
+
+void	ft_hashmap_bucket_free(t_hashmap *map, t_vec *bucket)
+{
+	if (!map->pool)
+	{
+		ft_vec_free(bucket);
+		return ;
+	}
+	if (bucket->data != (void *)(bucket + 1))
+	{
+		ft_memstats_record("ft_hashmap_bucket",
+			bucket->cap * bucket->elem_size, 0);
+		free(bucket->data);
+	}
+	ft_pool_release(map->pool, bucket);
+}
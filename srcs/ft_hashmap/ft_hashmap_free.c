@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_hashmap_free.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/03/20 15:47:00 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:56:29 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hashmap_internal.h"
+
+/**
+ * @brief Free a single bucket and all its entries.
+ *
+ * Iterates through all entries in the bucket, freeing keys and
+ * calling the del function on values if provided.
+ *
+ * @param map Hashmap owning the bucket.
+ * @param bucket The bucket vector to free.
+ */
+static void	free_bucket(t_hashmap *map, t_vec *bucket)
+{
+	size_t			i;
+	t_hashmap_entry	*entry;
+
+	if (!bucket)
+		return ;
+	i = 0;
+	while (i < bucket->len)
+	{
+		entry = ft_vec_get(bucket, i);
+		ft_hashmap_key_free(map, entry->key);
+		if (map->del && entry->value)
+			map->del(entry->value);
+		i++;
+	}
+	ft_hashmap_bucket_free(map, bucket);
+}
+
+/**
+ * @brief Remove all entries without freeing the hashmap.
+ *
+ * Frees all buckets and their entries, then resets the bucket
+ * array to all NULLs. The hashmap can be reused after clearing.
+ *
+ * @param map Hashmap to clear. Safe to call with NULL.
+ */
+void	ft_hashmap_clear(t_hashmap *map)
+{
+	size_t	i;
+
+	if (!map)
+		return ;
+	i = 0;
+	while (i < map->cap)
+	{
+		free_bucket(map, map->buckets[i]);
+		map->buckets[i] = NULL;
+		i++;
+	}
+	map->size = 0;
+}
+
+/**
+ * @brief Free a hashmap and all its contents.
+ *
+ * Frees all entries, all buckets, the bucket array, and the
+ * hashmap struct itself. Safe to call with NULL.
+ *
+ * @param map Hashmap to free.
+ */
+void	ft_hashmap_free(t_hashmap *map)
+{
+	t_allocator	alloc;
+
+	if (!map)
+		return ;
+	ft_hashmap_clear(map);
+	alloc = map->alloc;
+	ft_memstats_alloc(&alloc, "ft_hashmap_free",
+		sizeof(t_hashmap) + map->cap * sizeof(t_vec *), 0);
+	ft_allocator_free(&alloc, map->buckets, map->cap * sizeof(t_vec *));
+	ft_allocator_free(&alloc, map, sizeof(t_hashmap));
+}
@@ -6,18 +6,22 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2026/03/22 15:31:32 by yiyuli           #+#      #+#            */
-/*   Updated: 2026/03/22 16:14:47 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 05:45:15 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_hashmap_internal.h"
-#include <cstdint>
 
-static size_t	hashmap_hash(const char *key)
+/**
+ * @brief djb2 of key, or the hash cached in front of an interned key.
+ */
+size_t	ft_hashmap_hash(const t_hashmap *map, const char *key)
 {
 	size_t			hash;
 	unsigned char	*str;
 
+	if (map->keys)
+		return (ft_strpool_hash(key));
 	hash = 5381;
 	str = (unsigned char *)key;
 	while (*str)
@@ -28,27 +32,29 @@ static size_t	hashmap_hash(const char *key)
 	return (hash);
 }
 
-static int	rehash_insert(t_vec **buckets, size_t cap, t_hashmap_entry *entry)
+static int	rehash_insert(t_hashmap *map, t_vec **buckets, size_t cap,
+		t_hashmap_entry *entry)
 {
 	size_t	idx;
 
-	idx = hashmap_hash(entry->key) % cap;
+	idx = ft_hashmap_hash(map, entry->key) % cap;
 	if (!buckets[idx])
-		buckets[idx] = ft_vec_new(sizeof(t_hashmap_entry), 4);
+		buckets[idx] = ft_hashmap_bucket_new(map);
 	if (!buckets[idx])
 		return (0);
-	return (ft_vec_push(buckets[idx], entry));
+	return (ft_hashmap_bucket_push(map, buckets[idx], entry));
 }
 
-static int	rehash_all(t_vec **new_b, size_t new_cap, t_vec **old_b,
-		size_t old_cap)
+static int	rehash_all(t_hashmap *map, t_vec **new_b, size_t new_cap)
 {
 	size_t			i;
 	size_t			j;
+	t_vec			**old_b;
 	t_hashmap_entry	*entry;
 
+	old_b = map->buckets;
 	i = 0;
-	while (i < old_cap)
+	while (i < map->cap)
 	{
 		if (old_b[i])
 		{
@@ -56,7 +62,7 @@ static int	rehash_all(t_vec **new_b, size_t new_cap, t_vec **old_b,
 			while (j < old_b[i]->len)
 			{
 				entry = ft_vec_get(old_b[i], j);
-				if (!rehash_insert(new_b, new_cap, entry))
+				if (!rehash_insert(map, new_b, new_cap, entry))
 					return (0);
 				j++;
 			}
@@ -66,7 +72,7 @@ static int	rehash_all(t_vec **new_b, size_t new_cap, t_vec **old_b,
 	return (1);
 }
 
-static void	free_bucket_shells(t_vec **buckets, size_t cap)
+static void	free_bucket_shells(t_hashmap *map, t_vec **buckets, size_t cap)
 {
 	size_t	i;
 
@@ -74,7 +80,7 @@ static void	free_bucket_shells(t_vec **buckets, size_t cap)
 	while (i < cap)
 	{
 		if (buckets[i])
-			ft_vec_free(buckets[i]);
+			ft_hashmap_bucket_free(map, buckets[i]);
 		i++;
 	}
 }
@@ -87,16 +93,18 @@ int	ft_hashmap_grow(t_hashmap *map)
 	if (map->cap > SIZE_MAX / 2)
 		return (0);
 	new_cap = map->cap * 2;
-	new_buckets = ft_calloc(new_cap, sizeof(t_vec *));
+	new_buckets = ft_hashmap_buckets_new(map, new_cap);
 	if (!new_buckets)
 		return (0);
-	if (!rehash_all(new_buckets, new_cap, map->buckets, map->cap))
+	if (!rehash_all(map, new_buckets, new_cap))
 	{
-		free_bucket_shells(new_buckets, new_cap);
-		return (free(new_buckets), 0);
+		free_bucket_shells(map, new_buckets, new_cap);
+		return (ft_hashmap_buckets_free(map, new_buckets, new_cap), 0);
 	}
-	free_bucket_shells(map->buckets, map->cap);
-	free(map->buckets);
+	free_bucket_shells(map, map->buckets, map->cap);
+	ft_hashmap_buckets_free(map, map->buckets, map->cap);
+	ft_memstats_alloc(&map->alloc, "ft_hashmap_grow",
+		map->cap * sizeof(t_vec *), new_cap * sizeof(t_vec *));
 	map->buckets = new_buckets;
 	map->cap = new_cap;
 	return (1);
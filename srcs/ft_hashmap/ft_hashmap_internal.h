@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2026/02/08 00:00:00 by yiyuli           #+#      #+#            */
-/*   Updated: 2026/03/21 01:05:46 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 05:51:46 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,12 +15,40 @@
 
 # include "libft.h"
 
+/* Entries stored next to the t_vec header of a pooled bucket. */
+# define FT_HASHMAP_BUCKET_INLINE 4
+
 typedef struct s_hashmap_entry
 {
 	char	*key;
 	void	*value;
 }	t_hashmap_entry;
 
-int	ft_hashmap_grow(t_hashmap *map);
+int				ft_hashmap_grow(t_hashmap *map);
+size_t			ft_hashmap_hash(const t_hashmap *map, const char *key);
+t_hashmap_entry	*ft_hashmap_find(const t_hashmap *map, t_vec *bucket,
+					const char *key);
+int				ft_hashmap_put(t_hashmap *map, const char *key, size_t hash,
+					void *value);
+
+/*
+ * Bucket arrays and key copies, through map->alloc. With map->keys set
+ * the "copy" is the interned key itself and freeing it is a no-op.
+ */
+t_vec			**ft_hashmap_buckets_new(t_hashmap *map, size_t cap);
+void			ft_hashmap_buckets_free(t_hashmap *map, t_vec **buckets,
+					size_t cap);
+char			*ft_hashmap_key_dup(t_hashmap *map, const char *key);
+void			ft_hashmap_key_free(t_hashmap *map, char *key);
+
+/*
+ * Buckets: always create, fill and drop buckets through these so pooled
+ * buckets (map->pool) keep their inline entries out of ft_vec_reserve
+ * and ft_vec_free, which only know heap buffers.
+ */
+t_vec			*ft_hashmap_bucket_new(t_hashmap *map);
+int				ft_hashmap_bucket_push(t_hashmap *map, t_vec *bucket,
+					t_hashmap_entry *entry);
+void			ft_hashmap_bucket_free(t_hashmap *map, t_vec *bucket);
 
 #endif
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_hashmap_interned.c                              :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:43:29 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:43:29 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hashmap_internal.h"
+
+/**
+ * @brief Create a hash table whose keys are interned in a string pool.
+ *
+ * Works like ft_hashmap_new, but ft_hashmap_set stores the canonical
+ * copy from keys instead of duplicating the key per map, and freeing the
+ * map leaves the strings to the pool.
+ *
+ * @param keys Pool to intern keys in (not owned by the map).
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @return New hashmap, or NULL on failure or a NULL pool.
+ */
+t_hashmap	*ft_hashmap_new_interned(t_strpool *keys, size_t init_cap,
+		void (*del)(void *))
+{
+	t_hashmap	*map;
+
+	if (!keys)
+		return (NULL);
+	map = ft_hashmap_new(init_cap, del);
+	if (!map)
+		return (NULL);
+	map->keys = keys;
+	return (map);
+}
+
+/**
+ * @brief ft_hashmap_set for a key already interned in map->keys.
+ *
+ * Nothing is hashed or copied: the bucket comes from the cached hash and
+ * an existing entry is found by pointer.
+ *
+ * @return 1 on success, 0 on failure or if map has no string pool.
+ */
+int	ft_hashmap_set_interned(t_hashmap *map, const char *ikey, void *value)
+{
+	if (!map || !map->keys || !ikey)
+		return (0);
+	return (ft_hashmap_put(map, ikey, ft_strpool_hash(ikey), value));
+}
+
+/**
+ * @brief Value stored under an interned key, compared by pointer only.
+ * @return The value, or NULL if absent or map has no string pool.
+ */
+void	*ft_hashmap_get_interned(t_hashmap *map, const char *ikey)
+{
+	t_hashmap_entry	*entry;
+
+	if (!map || !map->keys || !ikey)
+		return (NULL);
+	entry = ft_hashmap_find(map,
+			map->buckets[ft_strpool_hash(ikey) % map->cap], ikey);
+	if (!entry)
+		return (NULL);
+	return (entry->value);
+}
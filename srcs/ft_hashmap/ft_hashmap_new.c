@@ -6,106 +6,79 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2026/03/20 15:47:00 by yiyuli           #+#      #+#            */
-/*   Updated: 2026/03/21 01:06:51 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:03:45 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_hashmap_internal.h"
 
 /**
- * @brief Free a single bucket and all its entries.
+ * @brief Create a new hash table.
  *
- * Iterates through all entries in the bucket, freeing keys and
- * calling the del function on values if provided.
+ * Allocates a hash table with the specified initial bucket count.
+ * If init_cap is 0, defaults to 16 buckets. The del function is
+ * called on values during removal/clear/free operations.
  *
- * @param bucket The bucket vector to free.
- * @param del Value destructor function (can be NULL).
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @return New hashmap, or NULL on allocation failure.
  */
-static void	free_bucket(t_vec *bucket, void (*del)(void *))
+t_hashmap	*ft_hashmap_new(size_t init_cap, void (*del)(void *))
 {
-	size_t			i;
-	t_hashmap_entry	*entry;
-
-	if (!bucket)
-		return ;
-	i = 0;
-	while (i < bucket->len)
-	{
-		entry = ft_vec_get(bucket, i);
-		free(entry->key);
-		if (del && entry->value)
-			del(entry->value);
-		i++;
-	}
-	ft_vec_free(bucket);
+	return (ft_hashmap_new_with_alloc(init_cap, del, NULL));
 }
 
 /**
- * @brief Create a new hash table.
+ * @brief Create a hash table that allocates through alloc.
  *
- * Allocates a hash table with the specified initial bucket count.
- * If init_cap is 0, defaults to 16 buckets. The del function is
- * called on values during removal/clear/free operations.
+ * The struct, bucket array, buckets and key copies all go through the
+ * allocator, which is copied into the map.
  *
  * @param init_cap Initial number of buckets (0 for default of 16).
  * @param del Value destructor function (NULL if values not owned).
+ * @param alloc Allocator to use (NULL for the heap).
  * @return New hashmap, or NULL on allocation failure.
  */
-t_hashmap	*ft_hashmap_new(size_t init_cap, void (*del)(void *))
+t_hashmap	*ft_hashmap_new_with_alloc(size_t init_cap, void (*del)(void *),
+		const t_allocator *alloc)
 {
 	t_hashmap	*map;
 
-	map = ft_calloc(1, sizeof(t_hashmap));
+	map = ft_allocator_calloc(alloc, 1, sizeof(t_hashmap));
 	if (!map)
 		return (NULL);
+	if (alloc)
+		map->alloc = *alloc;
 	if (init_cap == 0)
 		init_cap = 16;
-	map->buckets = ft_calloc(init_cap, sizeof(t_vec *));
+	map->buckets = ft_allocator_calloc(alloc, init_cap, sizeof(t_vec *));
 	if (!map->buckets)
-		return (free(map), NULL);
+		return (ft_allocator_free(alloc, map, sizeof(t_hashmap)), NULL);
 	map->cap = init_cap;
 	map->size = 0;
 	map->del = del;
+	ft_memstats_alloc(alloc, "ft_hashmap_new", 0,
+		sizeof(t_hashmap) + init_cap * sizeof(t_vec *));
 	return (map);
 }
 
 /**
- * @brief Remove all entries without freeing the hashmap.
+ * @brief Create a hash table whose buckets and keys live in an arena.
  *
- * Frees all buckets and their entries, then resets the bucket
- * array to all NULLs. The hashmap can be reused after clearing.
+ * Shorthand for ft_hashmap_new_with_alloc with ft_allocator_arena(arena).
+ * del is still called on values; everything else is released with the
+ * arena.
  *
- * @param map Hashmap to clear. Safe to call with NULL.
+ * @param arena Arena to allocate from.
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @return New hashmap, or NULL on allocation failure.
  */
-void	ft_hashmap_clear(t_hashmap *map)
+t_hashmap	*ft_arena_hashmap_new(t_arena *arena, size_t init_cap,
+		void (*del)(void *))
 {
-	size_t	i;
-
-	if (!map)
-		return ;
-	i = 0;
-	while (i < map->cap)
-	{
-		free_bucket(map->buckets[i], map->del);
-		map->buckets[i] = NULL;
-		i++;
-	}
-	map->size = 0;
-}
+	t_allocator	alloc;
 
-/**
- * @brief Free a hashmap and all its contents.
- *
- * Frees all entries, all buckets, the bucket array, and the
- * hashmap struct itself. Safe to call with NULL.
- *
- * @param map Hashmap to free.
- */
-void	ft_hashmap_free(t_hashmap *map)
-{
-	if (!map)
-		return ;
-	ft_hashmap_clear(map);
-	free(map->buckets);
-	free(map);
+	alloc = ft_allocator_arena(arena);
+	return (ft_hashmap_new_with_alloc(init_cap, del, &alloc));
 }
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_hashmap_pool.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 18:17:03 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 18:56:02 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hashmap_internal.h"
+
+/**
+ * @brief Create a pool sized for hashmap buckets.
+ *
+ * Each object holds a bucket's t_vec header plus its first
+ * FT_HASHMAP_BUCKET_INLINE entries. Share one such pool between many
+ * maps to keep their buckets packed in a few pages.
+ *
+ * @return New pool, or NULL on failure. Free it with ft_pool_free once
+ *         every map using it is freed.
+ */
+t_pool	*ft_hashmap_pool_new(void)
+{
+	return (ft_pool_new(sizeof(t_vec)
+			+ FT_HASHMAP_BUCKET_INLINE * sizeof(t_hashmap_entry)));
+}
+
+/**
+ * @brief Create a hash table whose buckets come from a bucket pool.
+ *
+ * Works like ft_hashmap_new. Buckets and their first few entries live in
+ * pool objects, so a bucket costs no malloc until it outgrows them.
+ *
+ * @param pool Pool from ft_hashmap_pool_new (not owned by the map).
+ * @param init_cap Initial number of buckets (0 for default of 16).
+ * @param del Value destructor function (NULL if values not owned).
+ * @return New hashmap, or NULL on failure or an unsuitable pool.
+ */
+t_hashmap	*ft_pool_hashmap_new(t_pool *pool, size_t init_cap,
+		void (*del)(void *))
+{
+	t_hashmap	*map;
+
+	if (!pool || pool->obj_size < sizeof(t_vec)
+		+ FT_HASHMAP_BUCKET_INLINE * sizeof(t_hashmap_entry))
+		return (NULL);
+	map = ft_hashmap_new(init_cap, del);
+	if (!map)
+		return (NULL);
+	map->pool = pool;
+	return (map);
+}
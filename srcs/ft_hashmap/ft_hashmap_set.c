@@ -6,28 +6,18 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2026/03/22 16:20:03 by yiyuli           #+#      #+#            */
-/*   Updated: 2026/03/22 16:30:03 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 08:56:35 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_hashmap_internal.h"
 
-static size_t	hashmap_hash(const char *key)
-{
-	size_t			hash;
-	unsigned char	*str;
-
-	hash = 5381;
-	str = (unsigned char *)key;
-	while (*str)
-	{
-		hash = ((hash << 5) + hash) + *str;
-		str++;
-	}
-	return (hash);
-}
-
-static t_hashmap_entry	*find_entry(t_vec *bucket, const char *key)
+/**
+ * @brief Entry for key in bucket, or NULL. Interned keys are canonical,
+ *        so they match by pointer alone.
+ */
+t_hashmap_entry	*ft_hashmap_find(const t_hashmap *map, t_vec *bucket,
+		const char *key)
 {
 	size_t			i;
 	t_hashmap_entry	*entry;
@@ -38,7 +28,8 @@ static t_hashmap_entry	*find_entry(t_vec *bucket, const char *key)
 	while (i < bucket->len)
 	{
 		entry = ft_vec_get(bucket, i);
-		if (ft_strcmp(entry->key, key) == 0)
+		if (entry->key == key
+			|| (!map->keys && ft_strcmp(entry->key, key) == 0))
 			return (entry);
 		i++;
 	}
@@ -54,29 +45,43 @@ static void	update_entry(t_hashmap *map, t_hashmap_entry *existing, void *value)
 	existing->value = value;
 }
 
-int	ft_hashmap_set(t_hashmap *map, const char *key, void *value)
+/**
+ * @brief Insert or update key, whose hash the caller already has.
+ *
+ * A failed grow leaves a valid map that is just over-full.
+ */
+int	ft_hashmap_put(t_hashmap *map, const char *key, size_t hash,
+		void *value)
 {
 	size_t			idx;
 	t_hashmap_entry	*existing;
 	t_hashmap_entry	new_entry;
 
-	if (!map || !key)
-		return (0);
-	idx = hashmap_hash(key) % map->cap;
-	existing = find_entry(map->buckets[idx], key);
+	idx = hash % map->cap;
+	existing = ft_hashmap_find(map, map->buckets[idx], key);
 	if (existing)
 		return (update_entry(map, existing, value), 1);
 	if (!map->buckets[idx])
-		map->buckets[idx] = ft_vec_new(sizeof(t_hashmap_entry), 4);
+		map->buckets[idx] = ft_hashmap_bucket_new(map);
 	if (!map->buckets[idx])
 		return (0);
-	new_entry.key = ft_strdup(key);
+	new_entry.key = ft_hashmap_key_dup(map, key);
 	new_entry.value = value;
-	if (!new_entry.key || !ft_vec_push(map->buckets[idx], &new_entry))
-		return (free(new_entry.key), 0);
+	if (!new_entry.key || !ft_hashmap_bucket_push(map, map->buckets[idx],
+			&new_entry))
+		return (ft_hashmap_key_free(map, new_entry.key), 0);
 	map->size++;
 	if (map->size * 4 > map->cap * 3)
-		if (!ft_hashmap_grow(map))
-			return (1);
+		ft_hashmap_grow(map);
 	return (1);
 }
+
+int	ft_hashmap_set(t_hashmap *map, const char *key, void *value)
+{
+	if (!map || !key)
+		return (0);
+	if (map->keys)
+		return (ft_hashmap_set_interned(map,
+				ft_strpool_intern(map->keys, key), value));
+	return (ft_hashmap_put(map, key, ft_hashmap_hash(map, key), value));
+}
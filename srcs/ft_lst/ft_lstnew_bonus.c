@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:50:14 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 14:50:15 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:05:53 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,6 +19,7 @@ t_list	*ft_lstnew(void *content)
 	new_node = (t_list *)malloc(sizeof(t_list));
 	if (new_node == NULL)
 		return (NULL);
+	ft_memstats_note("ft_lstnew", sizeof(t_list));
 	new_node->content = content;
 	new_node->next = NULL;
 	return (new_node);
@@ -6,12 +6,18 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 13:43:09 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 13:53:14 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:10:33 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_mem_internal.h"
 
+/**
+ * Large blocks go to the system calloc: allocators serve them from fresh
+ * mmap'd pages that the kernel has already zeroed and skip the memset,
+ * so the pages are only faulted in when first touched. Small blocks
+ * come from recycled heap memory and are cleared here.
+ */
 void	*ft_calloc(size_t count, size_t size)
 {
 	void	*ptr;
@@ -20,8 +26,13 @@ void	*ft_calloc(size_t count, size_t size)
 	total_size = count * size;
 	if (count != 0 && total_size / count != size)
 		return (NULL);
-	ptr = malloc(total_size);
+	if (total_size >= FT_CALLOC_LARGE_MIN)
+		ptr = calloc(count, size);
+	else
+		ptr = malloc(total_size);
+	if (ptr && total_size < FT_CALLOC_LARGE_MIN)
+		ft_bzero(ptr, total_size);
 	if (ptr)
-		ft_bzero(ptr, count * size);
+		ft_memstats_note("ft_calloc", total_size);
 	return (ptr);
 }
@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_mem_internal.h                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 14:36:37 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:02:25 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_MEM_INTERNAL_H
+# define FT_MEM_INTERNAL_H
+
+# include "ft_simd_internal.h"
+
+/* Copies and fills of at least this many bytes use the bulk kernels. */
+# define FT_MEM_BULK_MIN 64
+
+/* Overlapping moves of at least this many bytes use the bulk kernels. */
+# define FT_MEMMOVE_BULK_MIN 32
+
+/*
+ * ft_calloc hands blocks of at least this many bytes to the system
+ * calloc. Matches glibc's default mmap threshold, above which calloc
+ * returns untouched zero pages instead of clearing recycled memory.
+ */
+# define FT_CALLOC_LARGE_MIN 131072
+
+/*
+ * Fills of at least this many bytes bypass the cache with streaming
+ * (non-temporal) stores: the buffer would not fit in cache anyway, and
+ * streaming it keeps the caller's working set resident.
+ */
+# define FT_MEMSET_NT_MIN 4194304
+
+#endif
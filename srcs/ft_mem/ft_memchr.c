@@ -6,22 +6,68 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:05:18 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 14:05:19 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 16:03:03 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_mem_internal.h"
 
-void	*ft_memchr(const void *str, int c, size_t n)
+static void	*memchr_bytes(const unsigned char *p, unsigned char c, size_t n)
 {
-	const unsigned char	*p;
-
-	p = str;
 	while (n-- != 0)
 	{
-		if (*p == (unsigned char)c)
+		if (*p == c)
 			return ((void *)p);
 		p++;
 	}
 	return (NULL);
 }
+
+/**
+ * @brief Skip whole 8-byte words that do not contain the byte in pat.
+ */
+static const unsigned char	*skip_words(const unsigned char *p,
+		uint64_t pat, size_t *n)
+{
+	uint64_t	w;
+
+	while (*n >= 8)
+	{
+		__builtin_memcpy(&w, p, 8);
+		w ^= pat;
+		if ((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS)
+			break ;
+		p += 8;
+		*n -= 8;
+	}
+	return (p);
+}
+
+/**
+ * @brief Portable kernel: bytes up to an 8-byte boundary, then one
+ *        word per step until a word holds the byte.
+ */
+void	*ft_memchr_scalar(const void *str, int c, size_t n)
+{
+	const unsigned char	*p;
+	size_t				head;
+	void				*hit;
+
+	p = str;
+	head = (8 - ((uintptr_t)p & 7)) & 7;
+	if (head > n)
+		head = n;
+	hit = memchr_bytes(p, (unsigned char)c, head);
+	if (hit)
+		return (hit);
+	n -= head;
+	p = skip_words(p + head, (uint64_t)(unsigned char)c * FT_SWAR_ONES, &n);
+	return (memchr_bytes(p, (unsigned char)c, n));
+}
+
+void	*ft_memchr(const void *s, int c, size_t n)
+{
+	if (!g_simd.memchr)
+		ft_simd_init();
+	return (g_simd.memchr(s, c, n));
+}
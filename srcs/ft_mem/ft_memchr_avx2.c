@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memchr_avx2.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:08:33 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:01:26 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__AVX2__)
+
+static void	*first_hit(const unsigned char *p, unsigned int mask, size_t n)
+{
+	size_t	i;
+
+	if (mask == 0)
+		return (NULL);
+	i = __builtin_ctz(mask);
+	if (i >= n)
+		return (NULL);
+	return ((void *)(p + i));
+}
+
+static FT_NO_ASAN __m256i	eq32(const unsigned char *p, __m256i v)
+{
+	return (_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p), v));
+}
+
+static FT_NO_ASAN unsigned int	match32(const unsigned char *p, __m256i v)
+{
+	return ((unsigned int)_mm256_movemask_epi8(eq32(p, v)));
+}
+
+/**
+ * @brief Skip 128-byte blocks without a match while more than 128 bytes
+ *        remain. Returns the block holding the first match, if any.
+ */
+static FT_NO_ASAN const unsigned char	*skip128(const unsigned char *p,
+		__m256i v, size_t *n)
+{
+	__m256i	any;
+
+	while (*n > 128)
+	{
+		any = _mm256_or_si256(_mm256_or_si256(eq32(p, v), eq32(p + 32, v)),
+				_mm256_or_si256(eq32(p + 64, v), eq32(p + 96, v)));
+		if (_mm256_movemask_epi8(any))
+			return (p);
+		p += 128;
+		*n -= 128;
+	}
+	return (p);
+}
+
+/**
+ * Only aligned 32-byte loads are issued: the first one starts below s
+ * and the last one may end past s + n, but an aligned block never
+ * crosses a page, so no load can fault. Matches outside [s, s + n) are
+ * masked off.
+ */
+FT_NO_ASAN void	*ft_memchr_avx2(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+	__m256i				v;
+	unsigned int		mask;
+	size_t				off;
+
+	if (n == 0)
+		return (NULL);
+	v = _mm256_set1_epi8((char)c);
+	off = (uintptr_t)s & 31;
+	p = (const unsigned char *)s - off;
+	mask = match32(p, v) >> off;
+	if (mask || n <= 32 - off)
+		return (first_hit(s, mask, n));
+	n -= 32 - off;
+	p = skip128(p + 32, v, &n);
+	while (n > 32)
+	{
+		mask = match32(p, v);
+		if (mask)
+			return ((void *)(p + __builtin_ctz(mask)));
+		p += 32;
+		n -= 32;
+	}
+	return (first_hit(p, match32(p, v), n));
+}
+
+#endif
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memchr_sse2.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:12:38 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 06:56:18 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__SSE2__)
+
+static void	*first_hit(const unsigned char *p, unsigned int mask, size_t n)
+{
+	size_t	i;
+
+	if (mask == 0)
+		return (NULL);
+	i = __builtin_ctz(mask);
+	if (i >= n)
+		return (NULL);
+	return ((void *)(p + i));
+}
+
+static FT_NO_ASAN __m128i	eq16(const unsigned char *p, __m128i v)
+{
+	return (_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), v));
+}
+
+static FT_NO_ASAN unsigned int	match16(const unsigned char *p, __m128i v)
+{
+	return ((unsigned int)_mm_movemask_epi8(eq16(p, v)));
+}
+
+/**
+ * @brief Skip 64-byte blocks without a match while more than 64 bytes
+ *        remain. Returns the block holding the first match, if any.
+ */
+static FT_NO_ASAN const unsigned char	*skip64(const unsigned char *p,
+		__m128i v, size_t *n)
+{
+	__m128i	any;
+
+	while (*n > 64)
+	{
+		any = _mm_or_si128(_mm_or_si128(eq16(p, v), eq16(p + 16, v)),
+				_mm_or_si128(eq16(p + 32, v), eq16(p + 48, v)));
+		if (_mm_movemask_epi8(any))
+			return (p);
+		p += 64;
+		*n -= 64;
+	}
+	return (p);
+}
+
+/**
+ * Only aligned 16-byte loads are issued: the first one starts below s
+ * and the last one may end past s + n, but an aligned block never
+ * crosses a page, so no load can fault. Matches outside [s, s + n) are
+ * masked off.
+ */
+FT_NO_ASAN void	*ft_memchr_sse2(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+	__m128i				v;
+	unsigned int		mask;
+	size_t				off;
+
+	if (n == 0)
+		return (NULL);
+	v = _mm_set1_epi8((char)c);
+	off = (uintptr_t)s & 15;
+	p = (const unsigned char *)s - off;
+	mask = match16(p, v) >> off;
+	if (mask || n <= 16 - off)
+		return (first_hit(s, mask, n));
+	n -= 16 - off;
+	p = skip64(p + 16, v, &n);
+	while (n > 16)
+	{
+		mask = match16(p, v);
+		if (mask)
+			return ((void *)(p + __builtin_ctz(mask)));
+		p += 16;
+		n -= 16;
+	}
+	return (first_hit(p, match16(p, v), n));
+}
+
+#endif
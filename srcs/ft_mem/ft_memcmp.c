@@ -6,26 +6,55 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:05:34 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 14:05:43 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 16:16:03 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_mem_internal.h"
 
-int	ft_memcmp(const void *s1, const void *s2, size_t n)
+static int	cmp_bytes(const unsigned char *a, const unsigned char *b, size_t n)
 {
-	const unsigned char	*p1;
-	const unsigned char	*p2;
-	size_t				i;
+	size_t	i;
 
-	p1 = (const unsigned char *)s1;
-	p2 = (const unsigned char *)s2;
 	i = 0;
 	while (i < n)
 	{
-		if (p1[i] != p2[i])
-			return (p1[i] - p2[i]);
+		if (a[i] != b[i])
+			return (a[i] - b[i]);
 		i++;
 	}
 	return (0);
 }
+
+/**
+ * @brief Portable kernel: skip equal 8-byte words, then settle the first
+ *        differing word byte by byte.
+ */
+int	ft_memcmp_scalar(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	uint64_t			wa;
+	uint64_t			wb;
+
+	a = (const unsigned char *)s1;
+	b = (const unsigned char *)s2;
+	while (n >= 8)
+	{
+		__builtin_memcpy(&wa, a, 8);
+		__builtin_memcpy(&wb, b, 8);
+		if (wa != wb)
+			break ;
+		a += 8;
+		b += 8;
+		n -= 8;
+	}
+	return (cmp_bytes(a, b, n));
+}
+
+int	ft_memcmp(const void *s1, const void *s2, size_t n)
+{
+	if (!g_simd.memcmp)
+		ft_simd_init();
+	return (g_simd.memcmp(s1, s2, n));
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memcmp_avx2.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:16:46 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 16:16:46 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__AVX2__)
+
+static unsigned int	eq32(const unsigned char *a, const unsigned char *b)
+{
+	__m256i	eq;
+
+	eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)a),
+			_mm256_loadu_si256((const __m256i *)b));
+	return ((unsigned int)_mm256_movemask_epi8(eq));
+}
+
+/**
+ * Same scheme as ft_memcmp_sse2 with 32-byte blocks; shorter ranges go
+ * to the SSE2 kernel.
+ */
+int	ft_memcmp_avx2(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	unsigned int		ne;
+	size_t				i;
+
+	if (n < 32)
+		return (ft_memcmp_sse2(s1, s2, n));
+	a = (const unsigned char *)s1;
+	b = (const unsigned char *)s2;
+	i = 0;
+	while (i + 32 < n)
+	{
+		ne = ~eq32(a + i, b + i);
+		if (ne)
+			break ;
+		i += 32;
+	}
+	if (i + 32 >= n)
+		i = n - 32;
+	ne = ~eq32(a + i, b + i);
+	if (!ne)
+		return (0);
+	i += __builtin_ctz(ne);
+	return (a[i] - b[i]);
+}
+
+#endif
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memcmp_sse2.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:19:44 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 16:19:44 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__SSE2__)
+
+static unsigned int	eq16(const unsigned char *a, const unsigned char *b)
+{
+	__m128i	eq;
+
+	eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)a),
+			_mm_loadu_si128((const __m128i *)b));
+	return ((unsigned int)_mm_movemask_epi8(eq));
+}
+
+/**
+ * Loads stay inside [s, s + n): whole blocks from the front, then one
+ * block ending exactly at n that overlaps the last full one. Bytes in
+ * the overlap are already known equal, so the first set bit of the
+ * inequality mask is still the first difference.
+ */
+int	ft_memcmp_sse2(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	unsigned int		ne;
+	size_t				i;
+
+	if (n < 16)
+		return (ft_memcmp_scalar(s1, s2, n));
+	a = (const unsigned char *)s1;
+	b = (const unsigned char *)s2;
+	i = 0;
+	while (i + 16 < n)
+	{
+		ne = eq16(a + i, b + i) ^ 0xFFFF;
+		if (ne)
+			break ;
+		i += 16;
+	}
+	if (i + 16 >= n)
+		i = n - 16;
+	ne = eq16(a + i, b + i) ^ 0xFFFF;
+	if (!ne)
+		return (0);
+	i += __builtin_ctz(ne);
+	return (a[i] - b[i]);
+}
+
+#endif
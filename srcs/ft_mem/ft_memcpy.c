@@ -6,22 +6,109 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:06:31 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 14:07:02 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 15:35:05 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_mem_internal.h"
+
+/**
+ * @brief Copy fewer than 16 bytes.
+ *
+ * Loads the first and last word of the range before storing either of
+ * them, so two overlapping moves cover every length in [4, 15] without
+ * a byte loop.
+ */
+static void	copy_small(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	head;
+	uint64_t	tail;
+	uint32_t	head32;
+	uint32_t	tail32;
+
+	if (n >= 8)
+	{
+		__builtin_memcpy(&head, s, 8);
+		__builtin_memcpy(&tail, s + n - 8, 8);
+		__builtin_memcpy(d, &head, 8);
+		__builtin_memcpy(d + n - 8, &tail, 8);
+	}
+	else if (n >= 4)
+	{
+		__builtin_memcpy(&head32, s, 4);
+		__builtin_memcpy(&tail32, s + n - 4, 4);
+		__builtin_memcpy(d, &head32, 4);
+		__builtin_memcpy(d + n - 4, &tail32, 4);
+	}
+	else
+	{
+		while (n--)
+			d[n] = s[n];
+	}
+}
+
+/**
+ * @brief Copy 16 bytes or more one 64-bit word at a time.
+ *
+ * The first word is stored unaligned, then the loop runs on 8-byte
+ * aligned destination addresses and the last word is stored unaligned
+ * again, overlapping whatever the loop already wrote.
+ */
+static void	copy_words(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	w;
+	size_t		i;
+
+	__builtin_memcpy(&w, s, 8);
+	__builtin_memcpy(d, &w, 8);
+	i = 8 - ((uintptr_t)d & 7);
+	while (i + 8 <= n)
+	{
+		__builtin_memcpy(&w, s + i, 8);
+		__builtin_memcpy(d + i, &w, 8);
+		i += 8;
+	}
+	__builtin_memcpy(&w, s + n - 8, 8);
+	__builtin_memcpy(d + n - 8, &w, 8);
+}
+
+size_t	ft_memcpy_bulk_scalar(unsigned char *d, const unsigned char *s,
+		size_t n)
+{
+	(void)d;
+	(void)s;
+	(void)n;
+	return (0);
+}
+
+static size_t	copy_bulk(unsigned char *d, const unsigned char *s, size_t n)
+{
+	if (!g_simd.memcpy_bulk)
+		ft_simd_init();
+	return (g_simd.memcpy_bulk(d, s, n));
+}
 
 void	*ft_memcpy(void *dest, const void *src, size_t n)
 {
 	const unsigned char	*s;
 	unsigned char		*d;
+	size_t				done;
 
 	if (!src && !dest)
 		return (NULL);
 	d = (unsigned char *)dest;
 	s = (const unsigned char *)src;
-	while (n--)
-		*d++ = *s++;
+	if (n < 16)
+	{
+		copy_small(d, s, n);
+		return (dest);
+	}
+	done = 0;
+	if (n >= FT_MEM_BULK_MIN)
+		done = copy_bulk(d, s, n);
+	if (n - done >= 16)
+		copy_words(d + done, s + done, n - done);
+	else if (done < n)
+		copy_words(d + n - 16, s + n - 16, 16);
 	return (dest);
 }
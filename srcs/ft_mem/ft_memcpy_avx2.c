@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memcpy_avx2.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 15:13:38 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 15:13:38 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__AVX2__)
+
+size_t	ft_memcpy_bulk_avx2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	size_t	i;
+
+	_mm256_storeu_si256((__m256i *)d, _mm256_loadu_si256((const __m256i *)s));
+	i = 32 - ((uintptr_t)d & 31);
+	while (i + 128 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i),
+			_mm256_loadu_si256((const __m256i *)(s + i)));
+		_mm256_store_si256((__m256i *)(d + i + 32),
+			_mm256_loadu_si256((const __m256i *)(s + i + 32)));
+		_mm256_store_si256((__m256i *)(d + i + 64),
+			_mm256_loadu_si256((const __m256i *)(s + i + 64)));
+		_mm256_store_si256((__m256i *)(d + i + 96),
+			_mm256_loadu_si256((const __m256i *)(s + i + 96)));
+		i += 128;
+	}
+	while (i + 32 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i),
+			_mm256_loadu_si256((const __m256i *)(s + i)));
+		i += 32;
+	}
+	return (i);
+}
+
+#endif
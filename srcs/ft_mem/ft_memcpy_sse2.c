@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memcpy_sse2.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 15:07:28 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 15:07:28 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__SSE2__)
+
+size_t	ft_memcpy_bulk_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	size_t	i;
+
+	_mm_storeu_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+	i = 16 - ((uintptr_t)d & 15);
+	while (i + 64 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i),
+			_mm_loadu_si128((const __m128i *)(s + i)));
+		_mm_store_si128((__m128i *)(d + i + 16),
+			_mm_loadu_si128((const __m128i *)(s + i + 16)));
+		_mm_store_si128((__m128i *)(d + i + 32),
+			_mm_loadu_si128((const __m128i *)(s + i + 32)));
+		_mm_store_si128((__m128i *)(d + i + 48),
+			_mm_loadu_si128((const __m128i *)(s + i + 48)));
+		i += 64;
+	}
+	while (i + 16 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i),
+			_mm_loadu_si128((const __m128i *)(s + i)));
+		i += 16;
+	}
+	return (i);
+}
+
+#endif
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memmem.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:38:41 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 19:38:41 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+void	*ft_memmem(const void *hay, size_t n, const void *needle, size_t m)
+{
+	t_twoway	tw;
+	size_t		j;
+
+	if (m == 0)
+		return ((void *)hay);
+	if (m > n)
+		return (NULL);
+	if (m == 1)
+		return (ft_memchr(hay, *(const unsigned char *)needle, n));
+	ft_twoway_init(&tw, needle, m, 1);
+	j = ft_twoway_find(&tw, hay, n);
+	if (j == SIZE_MAX)
+		return (NULL);
+	return ((unsigned char *)hay + j);
+}
+
+/**
+ * @note The needle and haystack are walked from their last bytes with a
+ *       negative step, so the first backward match is the last one.
+ */
+void	*ft_memmem_r(const void *hay, size_t n, const void *needle, size_t m)
+{
+	t_twoway	tw;
+	size_t		j;
+
+	if (m == 0)
+		return ((unsigned char *)hay + n);
+	if (m > n)
+		return (NULL);
+	if (m == 1)
+		return (ft_memrchr(hay, *(const unsigned char *)needle, n));
+	ft_twoway_init(&tw, (const unsigned char *)needle + m - 1, m, -1);
+	j = ft_twoway_find(&tw, (const unsigned char *)hay + n - 1, n);
+	if (j == SIZE_MAX)
+		return (NULL);
+	return ((unsigned char *)hay + n - j - m);
+}
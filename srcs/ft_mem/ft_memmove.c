@@ -6,11 +6,91 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:07:19 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 14:07:37 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 15:40:14 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_mem_internal.h"
+
+/**
+ * @brief Move 1 to 3 bytes: first, middle and last byte cover them all.
+ */
+static void	move_tiny(unsigned char *d, const unsigned char *s, size_t n)
+{
+	unsigned char	first;
+	unsigned char	mid;
+	unsigned char	last;
+
+	first = s[0];
+	mid = s[n >> 1];
+	last = s[n - 1];
+	d[0] = first;
+	d[n >> 1] = mid;
+	d[n - 1] = last;
+}
+
+/**
+ * @brief Move fewer than 16 bytes.
+ *
+ * Every byte is loaded into a register before the first store, so the
+ * result is correct whichever way the two ranges overlap.
+ */
+static void	move_small(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	head;
+	uint64_t	tail;
+
+	if (n >= 8)
+	{
+		__builtin_memcpy(&head, s, 8);
+		__builtin_memcpy(&tail, s + n - 8, 8);
+		__builtin_memcpy(d, &head, 8);
+		__builtin_memcpy(d + n - 8, &tail, 8);
+	}
+	else if (n >= 4)
+	{
+		__builtin_memcpy(&head, s, 4);
+		__builtin_memcpy(&tail, s + n - 4, 4);
+		__builtin_memcpy(d, &head, 4);
+		__builtin_memcpy(d + n - 4, &tail, 4);
+	}
+	else if (n > 0)
+		move_tiny(d, s, n);
+}
+
+/**
+ * @brief Move 16 to 31 bytes with four overlapping word loads.
+ */
+static void	move_medium(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	a;
+	uint64_t	b;
+	uint64_t	c;
+	uint64_t	e;
+
+	__builtin_memcpy(&a, s, 8);
+	__builtin_memcpy(&b, s + 8, 8);
+	__builtin_memcpy(&c, s + n - 16, 8);
+	__builtin_memcpy(&e, s + n - 8, 8);
+	__builtin_memcpy(d, &a, 8);
+	__builtin_memcpy(d + 8, &b, 8);
+	__builtin_memcpy(d + n - 16, &c, 8);
+	__builtin_memcpy(d + n - 8, &e, 8);
+}
+
+/**
+ * @brief Move an overlapping range of at least FT_MEMMOVE_BULK_MIN bytes
+ *        with the bound forward or backward kernel.
+ */
+static void	move_bulk(unsigned char *d, const unsigned char *s, size_t n)
+{
+	if (!g_simd.memmove_fwd)
+		ft_simd_init();
+	if (d < s)
+		g_simd.memmove_fwd(d, s, n);
+	else
+		g_simd.memmove_bwd(d, s, n);
+}
 
 void	*ft_memmove(void *dst, const void *src, size_t len)
 {
@@ -21,17 +101,15 @@ void	*ft_memmove(void *dst, const void *src, size_t len)
 		return (NULL);
 	d = (unsigned char *)dst;
 	s = (const unsigned char *)src;
-	if (dst < src)
-	{
-		while (len--)
-			*d++ = *s++;
-	}
+	if (d == s)
+		return (dst);
+	if (len < 16)
+		move_small(d, s, len);
+	else if (len < FT_MEMMOVE_BULK_MIN)
+		move_medium(d, s, len);
+	else if (d + len <= s || s + len <= d)
+		ft_memcpy(d, s, len);
 	else
-	{
-		d += len;
-		s += len;
-		while (len--)
-			*--d = *--s;
-	}
+		move_bulk(d, s, len);
 	return (dst);
 }
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memmove_avx2.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 15:20:18 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 15:20:18 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__AVX2__)
+
+void	ft_memmove_fwd_avx2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m256i	head;
+	__m256i	tail;
+	__m256i	a;
+	__m256i	b;
+	size_t	i;
+
+	head = _mm256_loadu_si256((const __m256i *)s);
+	tail = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+	i = 32 - ((uintptr_t)d & 31);
+	while (i + 64 <= n)
+	{
+		a = _mm256_loadu_si256((const __m256i *)(s + i));
+		b = _mm256_loadu_si256((const __m256i *)(s + i + 32));
+		_mm256_store_si256((__m256i *)(d + i), a);
+		_mm256_store_si256((__m256i *)(d + i + 32), b);
+		i += 64;
+	}
+	if (i + 32 <= n)
+	{
+		a = _mm256_loadu_si256((const __m256i *)(s + i));
+		_mm256_store_si256((__m256i *)(d + i), a);
+	}
+	_mm256_storeu_si256((__m256i *)(d + n - 32), tail);
+	_mm256_storeu_si256((__m256i *)d, head);
+}
+
+void	ft_memmove_bwd_avx2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m256i	head;
+	__m256i	tail;
+	__m256i	a;
+	__m256i	b;
+	size_t	i;
+
+	head = _mm256_loadu_si256((const __m256i *)s);
+	tail = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+	i = n - ((uintptr_t)(d + n) & 31);
+	while (i >= 64)
+	{
+		i -= 64;
+		a = _mm256_loadu_si256((const __m256i *)(s + i + 32));
+		b = _mm256_loadu_si256((const __m256i *)(s + i));
+		_mm256_store_si256((__m256i *)(d + i + 32), a);
+		_mm256_store_si256((__m256i *)(d + i), b);
+	}
+	if (i >= 32)
+	{
+		a = _mm256_loadu_si256((const __m256i *)(s + i - 32));
+		_mm256_store_si256((__m256i *)(d + i - 32), a);
+	}
+	_mm256_storeu_si256((__m256i *)d, head);
+	_mm256_storeu_si256((__m256i *)(d + n - 32), tail);
+}
+
+#endif
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memmove_scalar.c                                :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 15:28:29 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 15:28:29 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+void	ft_memmove_fwd_scalar(unsigned char *d, const unsigned char *s,
+		size_t n)
+{
+	uint64_t	head;
+	uint64_t	tail;
+	uint64_t	w;
+	size_t		i;
+
+	__builtin_memcpy(&head, s, 8);
+	__builtin_memcpy(&tail, s + n - 8, 8);
+	i = 8 - ((uintptr_t)d & 7);
+	while (i + 8 <= n)
+	{
+		__builtin_memcpy(&w, s + i, 8);
+		__builtin_memcpy(d + i, &w, 8);
+		i += 8;
+	}
+	__builtin_memcpy(d + n - 8, &tail, 8);
+	__builtin_memcpy(d, &head, 8);
+}
+
+void	ft_memmove_bwd_scalar(unsigned char *d, const unsigned char *s,
+		size_t n)
+{
+	uint64_t	head;
+	uint64_t	tail;
+	uint64_t	w;
+	size_t		i;
+
+	__builtin_memcpy(&head, s, 8);
+	__builtin_memcpy(&tail, s + n - 8, 8);
+	i = n - ((uintptr_t)(d + n) & 7);
+	while (i >= 8)
+	{
+		i -= 8;
+		__builtin_memcpy(&w, s + i, 8);
+		__builtin_memcpy(d + i, &w, 8);
+	}
+	__builtin_memcpy(d, &head, 8);
+	__builtin_memcpy(d + n - 8, &tail, 8);
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memmove_sse2.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 15:09:33 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 15:09:33 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__SSE2__)
+
+void	ft_memmove_fwd_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m128i	head;
+	__m128i	tail;
+	__m128i	a;
+	__m128i	b;
+	size_t	i;
+
+	head = _mm_loadu_si128((const __m128i *)s);
+	tail = _mm_loadu_si128((const __m128i *)(s + n - 16));
+	i = 16 - ((uintptr_t)d & 15);
+	while (i + 32 <= n)
+	{
+		a = _mm_loadu_si128((const __m128i *)(s + i));
+		b = _mm_loadu_si128((const __m128i *)(s + i + 16));
+		_mm_store_si128((__m128i *)(d + i), a);
+		_mm_store_si128((__m128i *)(d + i + 16), b);
+		i += 32;
+	}
+	if (i + 16 <= n)
+	{
+		a = _mm_loadu_si128((const __m128i *)(s + i));
+		_mm_store_si128((__m128i *)(d + i), a);
+	}
+	_mm_storeu_si128((__m128i *)(d + n - 16), tail);
+	_mm_storeu_si128((__m128i *)d, head);
+}
+
+void	ft_memmove_bwd_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m128i	head;
+	__m128i	tail;
+	__m128i	a;
+	__m128i	b;
+	size_t	i;
+
+	head = _mm_loadu_si128((const __m128i *)s);
+	tail = _mm_loadu_si128((const __m128i *)(s + n - 16));
+	i = n - ((uintptr_t)(d + n) & 15);
+	while (i >= 32)
+	{
+		i -= 32;
+		a = _mm_loadu_si128((const __m128i *)(s + i + 16));
+		b = _mm_loadu_si128((const __m128i *)(s + i));
+		_mm_store_si128((__m128i *)(d + i + 16), a);
+		_mm_store_si128((__m128i *)(d + i), b);
+	}
+	if (i >= 16)
+	{
+		a = _mm_loadu_si128((const __m128i *)(s + i - 16));
+		_mm_store_si128((__m128i *)(d + i - 16), a);
+	}
+	_mm_storeu_si128((__m128i *)d, head);
+	_mm_storeu_si128((__m128i *)(d + n - 16), tail);
+}
+
+#endif
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memrchr.c                                       :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:40:19 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 19:40:19 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+/**
+ * @brief Scan the bytes [0, n) from the end for c.
+ */
+static void	*memrchr_bytes(const unsigned char *p, unsigned char c, size_t n)
+{
+	while (n--)
+	{
+		if (p[n] == c)
+			return ((void *)(p + n));
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Skip whole 8-byte words from the end that hold no c byte.
+ *
+ * @return Number of leading bytes still to scan; the word ending there
+ *         (if any) contains a match.
+ */
+static size_t	skip_words_back(const unsigned char *p, uint64_t pattern,
+		size_t n)
+{
+	uint64_t	w;
+
+	while (n >= 8)
+	{
+		__builtin_memcpy(&w, p + n - 8, 8);
+		w ^= pattern;
+		if ((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS)
+			return (n);
+		n -= 8;
+	}
+	return (n);
+}
+
+void	*ft_memrchr(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+	unsigned char		uc;
+	size_t				tail;
+	void				*hit;
+
+	p = (const unsigned char *)s;
+	uc = (unsigned char)c;
+	if (n < 16)
+		return (memrchr_bytes(p, uc, n));
+	tail = ((uintptr_t)(p + n)) & 7;
+	hit = memrchr_bytes(p + n - tail, uc, tail);
+	if (hit)
+		return (hit);
+	n = skip_words_back(p, uc * FT_SWAR_ONES, n - tail);
+	return (memrchr_bytes(p, uc, n));
+}
@@ -6,18 +6,88 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:08:52 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 14:08:53 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 09:18:58 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_mem_internal.h"
+
+/**
+ * @brief Fill fewer than 16 bytes with two overlapping stores.
+ */
+static void	set_small(unsigned char *d, uint64_t word, size_t n)
+{
+	if (n >= 8)
+	{
+		__builtin_memcpy(d, &word, 8);
+		__builtin_memcpy(d + n - 8, &word, 8);
+	}
+	else if (n >= 4)
+	{
+		__builtin_memcpy(d, &word, 4);
+		__builtin_memcpy(d + n - 4, &word, 4);
+	}
+	else
+	{
+		while (n--)
+			d[n] = (unsigned char)word;
+	}
+}
+
+/**
+ * @brief Fill 16 bytes or more with 64-bit stores.
+ *
+ * One unaligned store covers the head, the loop runs on 8-byte aligned
+ * addresses and a last unaligned store covers the tail.
+ */
+static void	set_words(unsigned char *d, uint64_t word, size_t n)
+{
+	size_t	i;
+
+	__builtin_memcpy(d, &word, 8);
+	i = 8 - ((uintptr_t)d & 7);
+	while (i + 8 <= n)
+	{
+		__builtin_memcpy(d + i, &word, 8);
+		i += 8;
+	}
+	__builtin_memcpy(d + n - 8, &word, 8);
+}
+
+size_t	ft_memset_bulk_scalar(unsigned char *d, unsigned char c, size_t n)
+{
+	(void)d;
+	(void)c;
+	(void)n;
+	return (0);
+}
+
+static size_t	set_bulk(unsigned char *d, unsigned char c, size_t n)
+{
+	if (!g_simd.memset_bulk)
+		ft_simd_init();
+	return (g_simd.memset_bulk(d, c, n));
+}
 
 void	*ft_memset(void *b, int v, size_t len)
 {
-	unsigned char	*ptr;
+	unsigned char	*d;
+	uint64_t		word;
+	size_t			done;
 
-	ptr = (unsigned char *)b;
-	while (len--)
-		*ptr++ = (unsigned char)v;
+	d = (unsigned char *)b;
+	word = (uint64_t)(unsigned char)v * 0x0101010101010101ULL;
+	if (len < 16)
+	{
+		set_small(d, word, len);
+		return (b);
+	}
+	done = 0;
+	if (len >= FT_MEM_BULK_MIN)
+		done = set_bulk(d, (unsigned char)v, len);
+	if (len - done >= 16)
+		set_words(d + done, word, len - done);
+	else if (done < len)
+		set_words(d + len - 16, word, 16);
 	return (b);
 }
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memset_avx2.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 15:24:57 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 15:24:57 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__AVX2__)
+
+static size_t	set_stream(unsigned char *d, __m256i v, size_t i, size_t n)
+{
+	while (i + 128 <= n)
+	{
+		_mm256_stream_si256((__m256i *)(d + i), v);
+		_mm256_stream_si256((__m256i *)(d + i + 32), v);
+		_mm256_stream_si256((__m256i *)(d + i + 64), v);
+		_mm256_stream_si256((__m256i *)(d + i + 96), v);
+		i += 128;
+	}
+	_mm_sfence();
+	return (i);
+}
+
+size_t	ft_memset_bulk_avx2(unsigned char *d, unsigned char c, size_t n)
+{
+	__m256i	v;
+	size_t	i;
+
+	v = _mm256_set1_epi8((char)c);
+	_mm256_storeu_si256((__m256i *)d, v);
+	i = 32 - ((uintptr_t)d & 31);
+	if (n >= FT_MEMSET_NT_MIN)
+		i = set_stream(d, v, i, n);
+	while (i + 128 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i), v);
+		_mm256_store_si256((__m256i *)(d + i + 32), v);
+		_mm256_store_si256((__m256i *)(d + i + 64), v);
+		_mm256_store_si256((__m256i *)(d + i + 96), v);
+		i += 128;
+	}
+	while (i + 32 <= n)
+	{
+		_mm256_store_si256((__m256i *)(d + i), v);
+		i += 32;
+	}
+	return (i);
+}
+
+#endif
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memset_sse2.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 15:12:06 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 15:12:06 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__SSE2__)
+
+static size_t	set_stream(unsigned char *d, __m128i v, size_t i, size_t n)
+{
+	while (i + 64 <= n)
+	{
+		_mm_stream_si128((__m128i *)(d + i), v);
+		_mm_stream_si128((__m128i *)(d + i + 16), v);
+		_mm_stream_si128((__m128i *)(d + i + 32), v);
+		_mm_stream_si128((__m128i *)(d + i + 48), v);
+		i += 64;
+	}
+	_mm_sfence();
+	return (i);
+}
+
+size_t	ft_memset_bulk_sse2(unsigned char *d, unsigned char c, size_t n)
+{
+	__m128i	v;
+	size_t	i;
+
+	v = _mm_set1_epi8((char)c);
+	_mm_storeu_si128((__m128i *)d, v);
+	i = 16 - ((uintptr_t)d & 15);
+	if (n >= FT_MEMSET_NT_MIN)
+		i = set_stream(d, v, i, n);
+	while (i + 64 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i), v);
+		_mm_store_si128((__m128i *)(d + i + 16), v);
+		_mm_store_si128((__m128i *)(d + i + 32), v);
+		_mm_store_si128((__m128i *)(d + i + 48), v);
+		i += 64;
+	}
+	while (i + 16 <= n)
+	{
+		_mm_store_si128((__m128i *)(d + i), v);
+		i += 16;
+	}
+	return (i);
+}
+
+#endif
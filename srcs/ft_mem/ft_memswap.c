@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memswap.c                                       :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:03:17 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 22:03:17 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+/**
+ * @brief Swap whole 8-byte words, then the last few bytes one by one.
+ */
+static void	swap_words(unsigned char *a, unsigned char *b, size_t n)
+{
+	uint64_t		wa;
+	uint64_t		wb;
+	unsigned char	c;
+
+	while (n >= 8)
+	{
+		__builtin_memcpy(&wa, a, 8);
+		__builtin_memcpy(&wb, b, 8);
+		__builtin_memcpy(a, &wb, 8);
+		__builtin_memcpy(b, &wa, 8);
+		a += 8;
+		b += 8;
+		n -= 8;
+	}
+	while (n--)
+	{
+		c = a[n];
+		a[n] = b[n];
+		b[n] = c;
+	}
+}
+
+size_t	ft_memswap_bulk_scalar(unsigned char *a, unsigned char *b, size_t n)
+{
+	(void)a;
+	(void)b;
+	(void)n;
+	return (0);
+}
+
+static size_t	swap_bulk(unsigned char *a, unsigned char *b, size_t n)
+{
+	if (!g_simd.memswap_bulk)
+		ft_simd_init();
+	return (g_simd.memswap_bulk(a, b, n));
+}
+
+/**
+ * Elements of any size are swapped in registers: vector blocks from
+ * FT_MEM_BULK_MIN bytes, 8-byte words below that. No temporary buffer,
+ * on the stack or the heap, is ever needed.
+ */
+void	ft_memswap(void *a, void *b, size_t n)
+{
+	unsigned char	*pa;
+	unsigned char	*pb;
+	size_t			done;
+
+	if (a == b)
+		return ;
+	pa = (unsigned char *)a;
+	pb = (unsigned char *)b;
+	done = 0;
+	if (n >= FT_MEM_BULK_MIN)
+		done = swap_bulk(pa, pb, n);
+	swap_words(pa + done, pb + done, n - done);
+}
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memswap_avx2.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:08:50 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 22:08:50 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__AVX2__)
+
+size_t	ft_memswap_bulk_avx2(unsigned char *a, unsigned char *b, size_t n)
+{
+	size_t	i;
+	__m256i	va[2];
+	__m256i	vb[2];
+
+	i = 0;
+	while (i + 64 <= n)
+	{
+		va[0] = _mm256_loadu_si256((const __m256i *)(a + i));
+		va[1] = _mm256_loadu_si256((const __m256i *)(a + i + 32));
+		vb[0] = _mm256_loadu_si256((const __m256i *)(b + i));
+		vb[1] = _mm256_loadu_si256((const __m256i *)(b + i + 32));
+		_mm256_storeu_si256((__m256i *)(a + i), vb[0]);
+		_mm256_storeu_si256((__m256i *)(a + i + 32), vb[1]);
+		_mm256_storeu_si256((__m256i *)(b + i), va[0]);
+		_mm256_storeu_si256((__m256i *)(b + i + 32), va[1]);
+		i += 64;
+	}
+	return (i);
+}
+
+#endif
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memswap_sse2.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:04:25 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 22:04:25 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+#if defined(__SSE2__)
+
+size_t	ft_memswap_bulk_sse2(unsigned char *a, unsigned char *b, size_t n)
+{
+	size_t	i;
+	__m128i	va[2];
+	__m128i	vb[2];
+
+	i = 0;
+	while (i + 32 <= n)
+	{
+		va[0] = _mm_loadu_si128((const __m128i *)(a + i));
+		va[1] = _mm_loadu_si128((const __m128i *)(a + i + 16));
+		vb[0] = _mm_loadu_si128((const __m128i *)(b + i));
+		vb[1] = _mm_loadu_si128((const __m128i *)(b + i + 16));
+		_mm_storeu_si128((__m128i *)(a + i), vb[0]);
+		_mm_storeu_si128((__m128i *)(a + i + 16), vb[1]);
+		_mm_storeu_si128((__m128i *)(b + i), va[0]);
+		_mm_storeu_si128((__m128i *)(b + i + 16), va[1]);
+		i += 32;
+	}
+	return (i);
+}
+
+#endif
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_twoway.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:36:09 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:06:44 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+static int	byte_at(const t_twoway *tw, size_t i)
+{
+	return (tw->needle[(ptrdiff_t)i * tw->step]);
+}
+
+/**
+ * @brief One step of the maximal-suffix scan.
+ *
+ * s holds {ms, j, k, p}: the current maximal suffix start minus one, the
+ * candidate start, the offset being compared and the suffix period.
+ */
+static void	suffix_step(size_t *s, int cmp)
+{
+	if (cmp < 0)
+	{
+		s[1] += s[2];
+		s[2] = 1;
+		s[3] = s[1] - s[0];
+	}
+	else if (cmp == 0 && s[2]++ == s[3])
+	{
+		s[1] += s[3];
+		s[2] = 1;
+	}
+	else if (cmp > 0)
+	{
+		s[0] = s[1]++;
+		s[2] = 1;
+		s[3] = 1;
+	}
+}
+
+/**
+ * @brief Start of the maximal suffix of the needle for one byte order.
+ * @param order 1 for the natural order, -1 for the reversed one.
+ * @param period Receives the period of that suffix.
+ */
+static size_t	maximal_suffix(const t_twoway *tw, int order, size_t *period)
+{
+	size_t	s[4];
+
+	s[0] = SIZE_MAX;
+	s[1] = 0;
+	s[2] = 1;
+	s[3] = 1;
+	while (s[1] + s[2] < tw->m)
+		suffix_step(s, order * (byte_at(tw, s[1] + s[2])
+				- byte_at(tw, s[0] + s[2])));
+	*period = s[3];
+	return (s[0] + 1);
+}
+
+/**
+ * @brief Whether needle[0..ms) equals needle[period..period + ms).
+ *
+ * Both ranges are compared as forward byte ranges; for a backward needle
+ * they are the mirrored ranges, which are equal exactly when the
+ * reversed sequences are.
+ */
+static int	is_periodic(const t_twoway *tw)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+
+	a = tw->needle;
+	b = tw->needle + tw->step * (ptrdiff_t)tw->period;
+	if (tw->step < 0 && tw->ms > 0)
+	{
+		a -= tw->ms - 1;
+		b -= tw->ms - 1;
+	}
+	return (ft_memcmp(a, b, tw->ms) == 0);
+}
+
+void	ft_twoway_init(t_twoway *tw, const unsigned char *needle, size_t m,
+		ptrdiff_t step)
+{
+	size_t	ms_rev;
+	size_t	p_rev;
+
+	tw->needle = needle;
+	tw->step = step;
+	tw->m = m;
+	tw->shift = NULL;
+	tw->ms = maximal_suffix(tw, 1, &tw->period);
+	ms_rev = maximal_suffix(tw, -1, &p_rev);
+	if (ms_rev > tw->ms)
+	{
+		tw->ms = ms_rev;
+		tw->period = p_rev;
+	}
+	tw->periodic = is_periodic(tw);
+	if (!tw->periodic && tw->ms > tw->m - tw->ms)
+		tw->period = tw->ms + 1;
+	else if (!tw->periodic)
+		tw->period = tw->m - tw->ms + 1;
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_twoway_find.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:37:05 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:09:13 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_mem_internal.h"
+
+/**
+ * @brief Match the right part needle[ms..m) at window j.
+ * @return Index of the first mismatching needle byte, or m.
+ */
+static size_t	match_right(const t_twoway *tw, const unsigned char *h,
+		size_t j, size_t mem)
+{
+	size_t	i;
+
+	i = tw->ms;
+	if (mem > i)
+		i = mem;
+	while (i < tw->m && tw->needle[(ptrdiff_t)i * tw->step]
+		== h[(ptrdiff_t)(i + j) * tw->step])
+		i++;
+	return (i);
+}
+
+/**
+ * @brief Match the left part needle[mem..ms) at window j, right to left.
+ */
+static int	match_left(const t_twoway *tw, const unsigned char *h,
+		size_t j, size_t mem)
+{
+	size_t	i;
+
+	i = tw->ms;
+	while (i > mem && tw->needle[(ptrdiff_t)(i - 1) * tw->step]
+		== h[(ptrdiff_t)(i - 1 + j) * tw->step])
+		i--;
+	return (i <= mem);
+}
+
+/**
+ * @brief Horspool skip: slide by the shift of each window's last byte
+ *        until that byte equals the needle's last byte (forward only).
+ */
+static size_t	shift_windows(const t_twoway *tw, const unsigned char *h,
+		size_t j, size_t n)
+{
+	unsigned char	s;
+
+	while (j <= n - tw->m)
+	{
+		s = tw->shift[h[j + tw->m - 1]];
+		if (!s)
+			return (j);
+		j += s;
+	}
+	return (n);
+}
+
+/**
+ * @brief Jump to the next window whose byte at ms equals needle[ms].
+ *
+ * Only used when no match memory is held, so no window that could match
+ * is skipped. The scan is a vectorised ft_memchr (or ft_memrchr going
+ * backwards), which is where most of the haystack is consumed, unless a
+ * Horspool table is attached.
+ *
+ * @return The new window, or n when none is left.
+ */
+static size_t	skip_windows(const t_twoway *tw, const unsigned char *h,
+		size_t j, size_t n)
+{
+	const unsigned char	*hit;
+	unsigned char		c;
+	size_t				last;
+
+	if (tw->shift)
+		return (shift_windows(tw, h, j, n));
+	c = tw->needle[(ptrdiff_t)tw->ms * tw->step];
+	last = n - tw->m;
+	if (tw->step > 0)
+		hit = ft_memchr(h + j + tw->ms, c, last - j + 1);
+	else
+		hit = ft_memrchr(h - (last + tw->ms), c, last - j + 1);
+	if (!hit)
+		return (n);
+	if (tw->step > 0)
+		return ((size_t)(hit - h) - tw->ms);
+	return ((size_t)(h - hit) - tw->ms);
+}
+
+/**
+ * @brief Run a prepared Two-Way search over n >= tw->m bytes.
+ * @return Offset of the first match in search direction, or SIZE_MAX.
+ */
+size_t	ft_twoway_find(const t_twoway *tw, const unsigned char *h, size_t n)
+{
+	size_t	j;
+	size_t	i;
+	size_t	mem;
+
+	j = 0;
+	mem = 0;
+	while (j <= n - tw->m)
+	{
+		if (mem == 0)
+			j = skip_windows(tw, h, j, n);
+		if (j > n - tw->m)
+			break ;
+		i = match_right(tw, h, j, mem);
+		if (i < tw->m)
+			j += i - tw->ms + 1;
+		else if (match_left(tw, h, j, mem))
+			return (j);
+		else
+			j += tw->period;
+		mem = 0;
+		if (i == tw->m && tw->periodic)
+			mem = tw->m - tw->period;
+	}
+	return (SIZE_MAX);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memstats_dump.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:55:14 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 19:55:14 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_memstats_internal.h"
+
+static void	put_size(int fd, size_t n)
+{
+	char	buf[24];
+	size_t	i;
+
+	i = sizeof(buf);
+	buf[--i] = '\0';
+	buf[--i] = (char)('0' + n % 10);
+	while (n >= 10)
+	{
+		n /= 10;
+		buf[--i] = (char)('0' + n % 10);
+	}
+	ft_putstr_fd(buf + i, fd);
+}
+
+static void	put_field(int fd, char *label, size_t n)
+{
+	ft_putstr_fd(label, fd);
+	put_size(fd, n);
+}
+
+/**
+ * @brief One line per site: totals, then the non-empty histogram buckets
+ *        as "<=bytes:count" (">bytes:count" for the overflow bucket).
+ */
+static void	dump_site(int fd, const t_memsite *site)
+{
+	size_t	b;
+
+	ft_putstr_fd("  ", fd);
+	ft_putstr_fd((char *)site->name, fd);
+	put_field(fd, " calls=", site->calls);
+	put_field(fd, " bytes=", site->bytes);
+	put_field(fd, " max=", site->max_request);
+	b = 0;
+	while (b < FT_MEMSTATS_BUCKETS)
+	{
+		if (site->hist[b] && b + 1 < FT_MEMSTATS_BUCKETS)
+			put_field(fd, " <=", (size_t)16 << b);
+		else if (site->hist[b])
+			put_field(fd, " >", (size_t)16 << (b - 1));
+		if (site->hist[b])
+			put_field(fd, ":", site->hist[b]);
+		b++;
+	}
+	ft_putchar_fd('\n', fd);
+}
+
+void	ft_memstats_dump(int fd)
+{
+	size_t	i;
+
+	if (!g_memstats.enabled)
+	{
+		ft_putstr_fd("memstats: disabled (build libft with MEMSTATS=1)\n",
+			fd);
+		return ;
+	}
+	put_field(fd, "memstats: allocs=", g_memstats.allocs);
+	put_field(fd, " reallocs=", g_memstats.reallocs);
+	put_field(fd, " frees=", g_memstats.frees);
+	put_field(fd, " total=", g_memstats.bytes_total);
+	put_field(fd, " live=", g_memstats.bytes_live);
+	put_field(fd, " peak=", g_memstats.bytes_peak);
+	ft_putchar_fd('\n', fd);
+	i = 0;
+	while (i < g_memstats.nsites)
+		dump_site(fd, &g_memstats.sites[i++]);
+}
@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memstats_get.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:56:20 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:13:20 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_memstats_internal.h"
+
+t_memstats	g_memstats = {.enabled = FT_MEMSTATS_ENABLED,
+	.sites[FT_MEMSTATS_SITES - 1].name = FT_MEMSTATS_OTHER};
+
+const t_memstats	*ft_memstats_get(void)
+{
+	return (&g_memstats);
+}
+
+void	ft_memstats_reset(void)
+{
+	ft_bzero(&g_memstats, sizeof(g_memstats));
+	g_memstats.enabled = FT_MEMSTATS_ENABLED;
+	g_memstats.sites[FT_MEMSTATS_SITES - 1].name = FT_MEMSTATS_OTHER;
+}
@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memstats_internal.h                             :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:58:32 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:15:20 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_MEMSTATS_INTERNAL_H
+# define FT_MEMSTATS_INTERNAL_H
+
+# include "libft.h"
+
+# ifdef FT_MEMSTATS
+#  define FT_MEMSTATS_ENABLED 1
+# else
+#  define FT_MEMSTATS_ENABLED 0
+# endif
+
+/*
+ * Name of the last site slot, preset at load time and on reset. Every
+ * site past the first FT_MEMSTATS_SITES - 1 is counted there.
+ */
+# define FT_MEMSTATS_OTHER "(other)"
+
+extern t_memstats	g_memstats;
+
+void	ft_memstats_site_hit(const char *site, size_t size);
+
+#endif
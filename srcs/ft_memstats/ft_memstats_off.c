@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memstats_off.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 20:04:02 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:04:02 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_memstats_internal.h"
+
+#ifndef FT_MEMSTATS
+
+void	ft_memstats_record(const char *site, size_t old_size, size_t new_size)
+{
+	(void)site;
+	(void)old_size;
+	(void)new_size;
+}
+
+void	ft_memstats_note(const char *site, size_t size)
+{
+	(void)site;
+	(void)size;
+}
+
+void	ft_memstats_alloc(const t_allocator *a, const char *site,
+		size_t old_size, size_t new_size)
+{
+	(void)a;
+	(void)site;
+	(void)old_size;
+	(void)new_size;
+}
+
+#endif
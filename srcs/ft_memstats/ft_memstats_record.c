@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memstats_record.c                               :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 20:06:11 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 20:06:11 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_memstats_internal.h"
+
+#ifdef FT_MEMSTATS
+
+void	ft_memstats_record(const char *site, size_t old_size, size_t new_size)
+{
+	if (old_size == 0 && new_size == 0)
+		return ;
+	if (old_size == 0)
+		g_memstats.allocs++;
+	else if (new_size == 0)
+		g_memstats.frees++;
+	else
+		g_memstats.reallocs++;
+	g_memstats.bytes_total += new_size;
+	g_memstats.bytes_live += new_size;
+	g_memstats.bytes_live -= old_size;
+	if (g_memstats.bytes_live > g_memstats.bytes_peak)
+		g_memstats.bytes_peak = g_memstats.bytes_live;
+	ft_memstats_site_hit(site, new_size);
+}
+
+void	ft_memstats_note(const char *site, size_t size)
+{
+	g_memstats.allocs++;
+	g_memstats.bytes_total += size;
+	ft_memstats_site_hit(site, size);
+}
+
+void	ft_memstats_alloc(const t_allocator *a, const char *site,
+		size_t old_size, size_t new_size)
+{
+	if (a && a->alloc && a->alloc != ft_allocator_heap().alloc)
+		return ;
+	ft_memstats_record(site, old_size, new_size);
+}
+
+#endif
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_memstats_site.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 20:09:33 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:59:16 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_memstats_internal.h"
+
+#ifdef FT_MEMSTATS
+
+/**
+ * @brief Histogram bucket of a request: sizes up to 16 << b bytes.
+ */
+static size_t	bucket_of(size_t size)
+{
+	size_t	b;
+
+	if (size <= 16)
+		return (0);
+	b = (size_t)(64 - __builtin_clzll((unsigned long long)(size - 1))) - 4;
+	if (b >= FT_MEMSTATS_BUCKETS)
+		b = FT_MEMSTATS_BUCKETS - 1;
+	return (b);
+}
+
+/**
+ * @brief Find the slot for site, adding it if new.
+ *
+ * Sites are compared by pointer first and by content second, so the same
+ * literal from two translation units lands in one slot. The last slot is
+ * reserved: once the other FT_MEMSTATS_SITES - 1 are named, new sites all
+ * land in "(other)", which then counts in nsites.
+ */
+static t_memsite	*site_slot(const char *site)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < g_memstats.nsites)
+	{
+		if (g_memstats.sites[i].name == site
+			|| !ft_strcmp(g_memstats.sites[i].name, site))
+			return (&g_memstats.sites[i]);
+		i++;
+	}
+	if (g_memstats.nsites >= FT_MEMSTATS_SITES - 1)
+	{
+		g_memstats.nsites = FT_MEMSTATS_SITES;
+		return (&g_memstats.sites[FT_MEMSTATS_SITES - 1]);
+	}
+	g_memstats.sites[g_memstats.nsites].name = site;
+	return (&g_memstats.sites[g_memstats.nsites++]);
+}
+
+/**
+ * @brief Count one event at site; size 0 is a release.
+ */
+void	ft_memstats_site_hit(const char *site, size_t size)
+{
+	t_memsite	*slot;
+
+	slot = site_slot(site);
+	slot->calls++;
+	if (size == 0)
+		return ;
+	slot->bytes += size;
+	if (size > slot->max_request)
+		slot->max_request = size;
+	slot->hist[bucket_of(size)]++;
+}
+
+#endif
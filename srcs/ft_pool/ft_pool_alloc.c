@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_pool_alloc.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 17:44:22 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 21:15:14 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_pool_internal.h"
+
+/**
+ * @brief Add a chunk and make its objects available for carving.
+ */
+static int	pool_grow(t_pool *pool)
+{
+	unsigned char	*chunk;
+
+	chunk = malloc(pool->chunk_size);
+	if (!chunk)
+		return (0);
+	ft_memstats_record("ft_pool_alloc", 0, pool->chunk_size);
+	*(void **)chunk = pool->chunks;
+	pool->chunks = chunk;
+	pool->next = chunk + FT_POOL_ALIGN;
+	pool->left = (pool->chunk_size - FT_POOL_ALIGN) / pool->obj_size;
+	return (1);
+}
+
+/**
+ * @brief Take one object from the pool.
+ *
+ * Recycled objects come first; otherwise the next object is carved from
+ * the newest chunk, and a new chunk is malloc'd only when that is used
+ * up. The memory is not zeroed.
+ *
+ * @param pool Pool to allocate from.
+ * @return Object aligned to 16 bytes, or NULL on failure.
+ */
+void	*ft_pool_alloc(t_pool *pool)
+{
+	void	*obj;
+
+	if (!pool)
+		return (NULL);
+	if (pool->free_list)
+	{
+		obj = pool->free_list;
+		pool->free_list = *(void **)obj;
+		return (obj);
+	}
+	if (pool->left == 0 && !pool_grow(pool))
+		return (NULL);
+	obj = pool->next;
+	pool->next += pool->obj_size;
+	pool->left--;
+	return (obj);
+}
+
+/**
+ * @brief Return an object to the pool for reuse.
+ * @param pool Pool the object came from.
+ * @param obj Object to recycle. Safe to pass NULL.
+ * @note Chunk memory is kept until ft_pool_free.
+ */
+void	ft_pool_release(t_pool *pool, void *obj)
+{
+	if (!pool || !obj)
+		return ;
+	*(void **)obj = pool->free_list;
+	pool->free_list = obj;
+}
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_pool_allocator.c                                :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 18:32:26 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 18:32:26 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_pool_internal.h"
+
+static void	*pool_alloc(void *ctx, size_t size)
+{
+	if (size > ((t_pool *)ctx)->obj_size)
+		return (NULL);
+	return (ft_pool_alloc(ctx));
+}
+
+static void	*pool_realloc(void *ctx, void *ptr, size_t old_size,
+		size_t new_size)
+{
+	(void)old_size;
+	if (new_size > ((t_pool *)ctx)->obj_size)
+		return (NULL);
+	if (ptr)
+		return (ptr);
+	return (ft_pool_alloc(ctx));
+}
+
+static void	pool_free(void *ctx, void *ptr, size_t size)
+{
+	(void)size;
+	ft_pool_release(ctx, ptr);
+}
+
+/**
+ * @brief Allocator that serves blocks of up to obj_size from a pool.
+ *
+ * Larger requests fail, so it suits containers whose every allocation
+ * is bounded (a t_vec with a fixed capacity, list nodes, small structs).
+ *
+ * @param pool Pool to allocate from; must outlive every user.
+ */
+t_allocator	ft_allocator_pool(t_pool *pool)
+{
+	t_allocator	a;
+
+	a.alloc = pool_alloc;
+	a.realloc = pool_realloc;
+	a.free = pool_free;
+	a.ctx = pool;
+	return (a);
+}
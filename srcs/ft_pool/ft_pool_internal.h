@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_pool_internal.h                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 17:49:33 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 17:49:33 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_POOL_INTERNAL_H
+# define FT_POOL_INTERNAL_H
+
+# include "libft.h"
+
+/* Object sizes are rounded up to this, so every object is aligned. */
+# define FT_POOL_ALIGN 16
+
+/* Bytes per chunk: one page, unless objects are too large to fit 8. */
+# define FT_POOL_CHUNK 4096
+
+/* Minimum number of objects per chunk. */
+# define FT_POOL_MIN_OBJS 8
+
+/*
+ * Chunk layout: the first FT_POOL_ALIGN bytes hold the pointer to the
+ * previous chunk, objects follow back to back. A free object stores the
+ * next free object in its first bytes.
+ */
+
+#endif
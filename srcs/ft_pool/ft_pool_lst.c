@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_pool_lst.c                                      :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 17:53:08 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 17:53:08 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_pool_internal.h"
+
+/**
+ * @brief Pool version of ft_lstnew.
+ * @param pool Pool created with an object size of at least sizeof(t_list).
+ * @param content Pointer to content for the new node.
+ * @return Pointer to the new node, or NULL on failure.
+ */
+t_list	*ft_pool_lstnew(t_pool *pool, void *content)
+{
+	t_list	*node;
+
+	if (!pool || pool->obj_size < sizeof(t_list))
+		return (NULL);
+	node = ft_pool_alloc(pool);
+	if (!node)
+		return (NULL);
+	node->content = content;
+	node->next = NULL;
+	return (node);
+}
+
+/**
+ * @brief Pool version of ft_lstdelone: the node goes back to the pool.
+ * @param pool Pool the node came from.
+ * @param lst Node to delete.
+ * @param del Content destructor (can be NULL).
+ */
+void	ft_pool_lstdelone(t_pool *pool, t_list *lst, void (*del)(void *))
+{
+	if (!lst)
+		return ;
+	if (del)
+		del(lst->content);
+	ft_pool_release(pool, lst);
+}
+
+/**
+ * @brief Pool version of ft_lstclear.
+ * @param pool Pool the nodes came from.
+ * @param lst Address of the first node; set to NULL.
+ * @param del Content destructor (can be NULL).
+ */
+void	ft_pool_lstclear(t_pool *pool, t_list **lst, void (*del)(void *))
+{
+	t_list	*next;
+
+	if (!lst)
+		return ;
+	while (*lst)
+	{
+		next = (*lst)->next;
+		ft_pool_lstdelone(pool, *lst, del);
+		*lst = next;
+	}
+}
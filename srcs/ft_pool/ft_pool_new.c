@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_pool_new.c                                      :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 17:54:06 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 21:20:12 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_pool_internal.h"
+
+/**
+ * @brief Create a pool of fixed-size objects.
+ *
+ * No memory is reserved until the first allocation.
+ *
+ * @param obj_size Size of every object (must be > 0).
+ * @return New pool, or NULL on failure or absurd sizes.
+ */
+t_pool	*ft_pool_new(size_t obj_size)
+{
+	t_pool	*pool;
+
+	if (obj_size == 0 || obj_size > (SIZE_MAX - FT_POOL_ALIGN)
+		/ (FT_POOL_MIN_OBJS + 1))
+		return (NULL);
+	pool = ft_allocator_calloc(NULL, 1, sizeof(t_pool));
+	if (!pool)
+		return (NULL);
+	ft_memstats_record("ft_pool_new", 0, sizeof(t_pool));
+	pool->obj_size = (obj_size + FT_POOL_ALIGN - 1)
+		& ~(size_t)(FT_POOL_ALIGN - 1);
+	pool->chunk_size = FT_POOL_CHUNK;
+	if (pool->obj_size * FT_POOL_MIN_OBJS > FT_POOL_CHUNK - FT_POOL_ALIGN)
+		pool->chunk_size = FT_POOL_ALIGN + pool->obj_size * FT_POOL_MIN_OBJS;
+	return (pool);
+}
+
+/**
+ * @brief Free a pool and every object in it, live or not.
+ * @param pool Pool to free. Safe to call with NULL.
+ */
+void	ft_pool_free(t_pool *pool)
+{
+	void	*prev;
+
+	if (!pool)
+		return ;
+	while (pool->chunks)
+	{
+		prev = *(void **)pool->chunks;
+		ft_memstats_record("ft_pool_free", pool->chunk_size, 0);
+		free(pool->chunks);
+		pool->chunks = prev;
+	}
+	ft_memstats_record("ft_pool_free", sizeof(t_pool), 0);
+	free(pool);
+}
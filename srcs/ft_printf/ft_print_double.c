@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_print_double.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 04:49:24 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 04:49:24 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+static size_t	format_double(double x, char spec, int prec, char *buf)
+{
+	if (spec == 'e')
+		return (ft_dtoa_exp(x, prec, buf));
+	if (spec == 'g')
+		return (ft_dtoa_general(x, prec, buf));
+	return (ft_dtoa_fixed(x, prec, buf));
+}
+
+/**
+ * Everyday precisions format on the stack; only a very long one borrows
+ * a heap buffer for the call.
+ */
+int	ft_print_double(double x, char spec, int prec)
+{
+	char	stack[FT_DTOA_BUFSZ + FT_PRINT_DOUBLE_PREC];
+	char	*buf;
+	size_t	size;
+	size_t	len;
+	int		ret;
+
+	buf = stack;
+	size = 0;
+	if (prec > FT_PRINT_DOUBLE_PREC)
+	{
+		size = FT_DTOA_BUFSZ + (size_t)prec;
+		buf = ft_allocator_alloc(NULL, size);
+		if (!buf)
+			return (-1);
+	}
+	len = format_double(x, spec, prec, buf);
+	ret = (int)len;
+	if (write(1, buf, len) == -1)
+		ret = -1;
+	if (size)
+		ft_allocator_free(NULL, buf, size);
+	return (ret);
+}
@@ -6,34 +6,22 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/12/01 13:17:39 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/01 13:27:51 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 03:43:05 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-static int	print_hex_rec(unsigned int n, char *base)
-{
-	int	len;
-	int	check;
-
-	len = 0;
-	if (n >= 16)
-	{
-		check = print_hex_rec(n / 16, base);
-		if (check == -1)
-			return (-1);
-		len += check;
-	}
-	if (write(1, &base[n % 16], 1) == -1)
-		return (-1);
-	return (len + 1);
-}
-
 int	ft_print_hex(unsigned int n, int uppercase)
 {
+	char	buf[FT_U64TOA_BASE_BUFSZ];
+	size_t	len;
+
 	if (uppercase == 1)
-		return (print_hex_rec(n, "0123456789ABCDEF"));
+		len = ft_u64toa_base_buf(n, "0123456789ABCDEF", buf);
 	else
-		return (print_hex_rec(n, "0123456789abcdef"));
+		len = ft_u64toa_base_buf(n, "0123456789abcdef", buf);
+	if (write(1, buf, len) == -1)
+		return (-1);
+	return ((int)len);
 }
@@ -6,40 +6,23 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/29 23:14:41 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/29 23:37:52 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 03:48:03 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-static int	ft_putptr_recursive(unsigned long n)
-{
-	int	len;
-	int	check;
-
-	len = 0;
-	if (n >= 16)
-	{
-		check = ft_putptr_recursive(n / 16);
-		if (check == -1)
-			return (-1);
-		len += check;
-	}
-	if (write(1, &"0123456789abcdef"[n % 16], 1) == -1)
-		return (-1);
-	return (len + 1);
-}
-
 int	ft_print_ptr(void *ptr)
 {
-	int	len;
+	char	buf[FT_U64TOA_BASE_BUFSZ + 2];
+	size_t	len;
 
 	if (!ptr)
 		return (write(1, "(nil)", 5));
-	if (write(1, "0x", 2) == -1)
-		return (-1);
-	len = ft_putptr_recursive((unsigned long)ptr);
-	if (len == -1)
+	buf[0] = '0';
+	buf[1] = 'x';
+	len = 2 + ft_u64toa_base_buf((uintptr_t)ptr, "0123456789abcdef", buf + 2);
+	if (write(1, buf, len) == -1)
 		return (-1);
-	return (len + 2);
+	return ((int)len);
 }
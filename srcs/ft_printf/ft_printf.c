@@ -6,14 +6,16 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/28 18:01:26 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/01 13:55:28 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 06:09:27 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-static int	ft_handle_format(va_list *args, char specifier)
+static int	ft_handle_format(va_list *args, char specifier, int prec)
 {
+	if (specifier == 'f' || specifier == 'e' || specifier == 'g')
+		return (ft_print_double(va_arg(*args, double), specifier, prec));
 	if (specifier == 'c')
 		return (ft_print_char(va_arg(*args, int)));
 	else if (specifier == 's')
@@ -33,13 +35,23 @@ static int	ft_handle_format(va_list *args, char specifier)
 	return (0);
 }
 
+/**
+ * A ".digits" precision may sit between '%' and the conversion. If the
+ * string ends inside it, format is left on the last byte read so the
+ * caller's step lands on the terminator.
+ */
 static int	ft_print_format(va_list *args, const char **format)
 {
-	int	result;
+	int	prec;
 
 	(*format)++;
-	result = ft_handle_format(args, **format);
-	return (result);
+	prec = ft_printf_parse_prec(format);
+	if (!**format)
+	{
+		(*format)--;
+		return (0);
+	}
+	return (ft_handle_format(args, **format, prec));
 }
 
 static int	ft_parse_format(va_list *args, const char *format)
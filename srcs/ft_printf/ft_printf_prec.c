@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_printf_prec.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 06:03:34 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 06:03:34 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Read an optional ".digits" precision and step past it.
+ *
+ * Digits keep being consumed past FT_PRINTF_PREC_MAX, but the value
+ * stops growing there, so no digit string can overflow it.
+ *
+ * @param fmt Cursor on the byte after '%'.
+ * @return The precision (at most FT_PRINTF_PREC_MAX), or -1 if *fmt
+ *         does not start with '.'.
+ */
+int	ft_printf_parse_prec(const char **fmt)
+{
+	int	prec;
+
+	if (**fmt != '.')
+		return (-1);
+	prec = 0;
+	(*fmt)++;
+	while (ft_isdigit(**fmt))
+	{
+		prec = prec * 10 + (**fmt - '0');
+		if (prec > FT_PRINTF_PREC_MAX)
+			prec = FT_PRINTF_PREC_MAX;
+		(*fmt)++;
+	}
+	return (prec);
+}
@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_simd_bind.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 14:56:13 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:03:51 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+t_simd_kernels	g_simd;
+
+static t_simd	g_simd_bound = FT_SIMD_SCALAR;
+
+static void	bind_scalar(void)
+{
+	g_simd.memcpy_bulk = ft_memcpy_bulk_scalar;
+	g_simd.memset_bulk = ft_memset_bulk_scalar;
+	g_simd.memmove_fwd = ft_memmove_fwd_scalar;
+	g_simd.memmove_bwd = ft_memmove_bwd_scalar;
+	g_simd.memchr = ft_memchr_scalar;
+	g_simd.memcmp = ft_memcmp_scalar;
+	g_simd.memswap_bulk = ft_memswap_bulk_scalar;
+	g_simd.strlen = ft_strlen_scalar;
+	g_simd.strchr = ft_strchr_scalar;
+	g_simd.strrchr = ft_strrchr_scalar;
+	g_simd.charset_span = ft_charset_span_scalar;
+}
+
+int	ft_simd_force(t_simd level)
+{
+	if (level > ft_simd_detect())
+		return (0);
+	bind_scalar();
+	ft_simd_bind_x86(level);
+	g_simd_bound = level;
+	return (1);
+}
+
+t_simd	ft_simd_level(void)
+{
+	if (!g_simd.memcpy_bulk)
+		ft_simd_init();
+	return (g_simd_bound);
+}
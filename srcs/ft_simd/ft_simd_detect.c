@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_simd_detect.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 14:57:59 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:08:24 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+static int	g_simd_detected = -1;
+
+#if defined(__x86_64__) || defined(__i386__)
+
+static t_simd	probe_cpu(void)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")
+		&& __builtin_cpu_supports("avx512bw"))
+		return (FT_SIMD_AVX512);
+	if (__builtin_cpu_supports("avx2"))
+		return (FT_SIMD_AVX2);
+	if (__builtin_cpu_supports("sse4.2"))
+		return (FT_SIMD_SSE42);
+	if (__builtin_cpu_supports("sse2"))
+		return (FT_SIMD_SSE2);
+	return (FT_SIMD_SCALAR);
+}
+
+#else
+
+static t_simd	probe_cpu(void)
+{
+	return (FT_SIMD_SCALAR);
+}
+
+#endif
+
+t_simd	ft_simd_detect(void)
+{
+	if (g_simd_detected < 0)
+		g_simd_detected = probe_cpu();
+	return ((t_simd)g_simd_detected);
+}
+
+void	ft_simd_init(void)
+{
+	ft_simd_force(ft_simd_detect());
+}
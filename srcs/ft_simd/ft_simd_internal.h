@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_simd_internal.h                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 15:00:51 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:50:12 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_SIMD_INTERNAL_H
+# define FT_SIMD_INTERNAL_H
+
+# include "libft.h"
+
+# if defined(__AVX2__)
+#  include <immintrin.h>
+# elif defined(__SSE4_2__)
+#  include <nmmintrin.h>
+# elif defined(__SSE2__)
+#  include <emmintrin.h>
+# endif
+
+/*
+ * Word-sized moves go through __builtin_memcpy with a constant size.
+ * The compiler lowers those to a single (possibly unaligned) load or
+ * store; they never turn into a libc call.
+ */
+
+/*
+ * SWAR (SIMD within a register) constants: a byte of ones and a byte of
+ * high bits in every lane. (w - ONES) & ~w & HIGHS is non-zero exactly
+ * when some byte of w is zero.
+ */
+# define FT_SWAR_ONES 0x0101010101010101ULL
+# define FT_SWAR_HIGHS 0x8080808080808080ULL
+
+/*
+ * The memchr, strlen/strchr/strrchr and charset_span kernels read whole
+ * aligned words or vectors, so they may touch bytes before the range or
+ * past its end or terminator. Such a load never crosses a page, so it
+ * cannot fault, but AddressSanitizer reports it. FT_NO_ASAN builds a
+ * function without ASan checks; put it on every function that does such
+ * a load, static helpers included (GCC does not inline across a sanitizer
+ * mismatch).
+ */
+# if defined(__SANITIZE_ADDRESS__)
+#  define FT_NO_ASAN __attribute__((no_sanitize_address))
+# elif defined(__has_feature)
+#  if __has_feature(address_sanitizer)
+#   define FT_NO_ASAN __attribute__((no_sanitize_address))
+#  endif
+# endif
+# ifndef FT_NO_ASAN
+#  define FT_NO_ASAN
+# endif
+
+/*
+ * pcmpistri modes for the charset kernels: unsigned bytes compared for
+ * "equal any", index of the first hit. NOT_ANY negates the result, so the
+ * first byte outside the set, or the terminator, is the hit.
+ */
+# define FT_PCMP_ANY 0x00
+# define FT_PCMP_NOT_ANY 0x10
+
+/**
+ * @brief Kernel table behind the dispatched mem/str functions.
+ *
+ * Every slot starts out NULL. The first public call that finds its slot
+ * empty runs ft_simd_init(), which binds the whole table to the best
+ * kernels the CPU supports. ft_simd_force() rebinds it to a lower level.
+ *
+ * Bulk kernels only handle the long middle of a buffer; the public
+ * functions keep short sizes inline so small copies never pay for an
+ * indirect call.
+ */
+typedef struct s_simd_kernels
+{
+	size_t	(*memcpy_bulk)(unsigned char *, const unsigned char *, size_t);
+	size_t	(*memset_bulk)(unsigned char *, unsigned char, size_t);
+	void	(*memmove_fwd)(unsigned char *, const unsigned char *, size_t);
+	void	(*memmove_bwd)(unsigned char *, const unsigned char *, size_t);
+	void	*(*memchr)(const void *, int, size_t);
+	int		(*memcmp)(const void *, const void *, size_t);
+	size_t	(*memswap_bulk)(unsigned char *, unsigned char *, size_t);
+	size_t	(*strlen)(const char *);
+	char	*(*strchr)(const char *, int);
+	char	*(*strrchr)(const char *, int);
+	size_t	(*charset_span)(const char *, const t_charset *, int);
+}	t_simd_kernels;
+
+extern t_simd_kernels	g_simd;
+
+/**
+ * @brief Bind every kernel slot for the detected CPU level.
+ * @note Not thread-safe: it rewrites every slot (scalar kernels first,
+ *       then the SIMD ones). It must run before other threads start,
+ *       through ft_simd_level() or any dispatched call.
+ */
+void	ft_simd_init(void);
+
+/**
+ * @brief Overlay the SSE2/SSE4.2/AVX2 kernels up to level on the bound table
+ *        (no-op on targets without SSE2).
+ */
+void	ft_simd_bind_x86(t_simd level);
+
+/* ************************************************************************** */
+/*                                 Kernels                                    */
+/* ************************************************************************** */
+
+/*
+ * memcpy_bulk / memset_bulk: n >= FT_MEM_BULK_MIN. Store one unaligned
+ * vector at the start, then whole aligned blocks of dst, and return how
+ * many leading bytes are done. The caller finishes the short tail.
+ *
+ * memmove_fwd / memmove_bwd: n >= FT_MEMMOVE_BULK_MIN, ranges overlap,
+ * fwd for dst < src and bwd for dst > src. The first and last vector
+ * are loaded before anything is stored and written back last, so the
+ * aligned loop never reads a source byte an earlier store touched.
+ *
+ * memswap_bulk: n >= FT_MEM_BULK_MIN, a and b disjoint. Swap whole
+ * unaligned vector blocks and return how many leading bytes are done.
+ *
+ * memchr / memcmp: full public contract, any n. memchr kernels may read
+ * past either end of the range but only within an aligned vector, so
+ * never into another page; memcmp kernels stay inside the range.
+ *
+ * strlen / strchr / strrchr: full public contract. Reads are aligned
+ * words or aligned 64-byte chunks, which may extend before the string or
+ * past its terminator but never into another page.
+ *
+ * charset_span: length of the prefix of s whose bytes are all in the set
+ * (in = 1) or all outside it (in = 0). The SSE4.2 kernel reads aligned
+ * 16-byte chunks under the same page rule.
+ */
+
+size_t	ft_memcpy_bulk_scalar(unsigned char *d, const unsigned char *s,
+			size_t n);
+size_t	ft_memset_bulk_scalar(unsigned char *d, unsigned char c, size_t n);
+void	ft_memmove_fwd_scalar(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	ft_memmove_bwd_scalar(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	*ft_memchr_scalar(const void *s, int c, size_t n);
+int		ft_memcmp_scalar(const void *s1, const void *s2, size_t n);
+size_t	ft_memswap_bulk_scalar(unsigned char *a, unsigned char *b, size_t n);
+size_t	ft_strlen_scalar(const char *s);
+char	*ft_strchr_scalar(const char *s, int c);
+char	*ft_strrchr_scalar(const char *s, int c);
+size_t	ft_charset_span_scalar(const char *s, const t_charset *set, int in);
+
+size_t	ft_memcpy_bulk_sse2(unsigned char *d, const unsigned char *s,
+			size_t n);
+size_t	ft_memset_bulk_sse2(unsigned char *d, unsigned char c, size_t n);
+void	ft_memmove_fwd_sse2(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	ft_memmove_bwd_sse2(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	*ft_memchr_sse2(const void *s, int c, size_t n);
+int		ft_memcmp_sse2(const void *s1, const void *s2, size_t n);
+size_t	ft_memswap_bulk_sse2(unsigned char *a, unsigned char *b, size_t n);
+size_t	ft_strlen_sse2(const char *s);
+char	*ft_strchr_sse2(const char *s, int c);
+char	*ft_strrchr_sse2(const char *s, int c);
+
+size_t	ft_charset_span_sse42(const char *s, const t_charset *set, int in);
+
+size_t	ft_memcpy_bulk_avx2(unsigned char *d, const unsigned char *s,
+			size_t n);
+size_t	ft_memset_bulk_avx2(unsigned char *d, unsigned char c, size_t n);
+void	ft_memmove_fwd_avx2(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	ft_memmove_bwd_avx2(unsigned char *d, const unsigned char *s,
+			size_t n);
+void	*ft_memchr_avx2(const void *s, int c, size_t n);
+int		ft_memcmp_avx2(const void *s1, const void *s2, size_t n);
+size_t	ft_memswap_bulk_avx2(unsigned char *a, unsigned char *b, size_t n);
+size_t	ft_strlen_avx2(const char *s);
+char	*ft_strchr_avx2(const char *s, int c);
+char	*ft_strrchr_avx2(const char *s, int c);
+
+#endif
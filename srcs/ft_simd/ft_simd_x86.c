@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_simd_x86.c                                      :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:32:05 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:14:49 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+#if defined(__SSE2__)
+
+static void	bind_sse2(void)
+{
+	g_simd.memcpy_bulk = ft_memcpy_bulk_sse2;
+	g_simd.memset_bulk = ft_memset_bulk_sse2;
+	g_simd.memmove_fwd = ft_memmove_fwd_sse2;
+	g_simd.memmove_bwd = ft_memmove_bwd_sse2;
+	g_simd.memchr = ft_memchr_sse2;
+	g_simd.memcmp = ft_memcmp_sse2;
+	g_simd.memswap_bulk = ft_memswap_bulk_sse2;
+	g_simd.strlen = ft_strlen_sse2;
+	g_simd.strchr = ft_strchr_sse2;
+	g_simd.strrchr = ft_strrchr_sse2;
+}
+
+static void	bind_sse42(void)
+{
+	g_simd.charset_span = ft_charset_span_sse42;
+}
+
+static void	bind_avx2(void)
+{
+	g_simd.memcpy_bulk = ft_memcpy_bulk_avx2;
+	g_simd.memset_bulk = ft_memset_bulk_avx2;
+	g_simd.memmove_fwd = ft_memmove_fwd_avx2;
+	g_simd.memmove_bwd = ft_memmove_bwd_avx2;
+	g_simd.memchr = ft_memchr_avx2;
+	g_simd.memcmp = ft_memcmp_avx2;
+	g_simd.memswap_bulk = ft_memswap_bulk_avx2;
+	g_simd.strlen = ft_strlen_avx2;
+	g_simd.strchr = ft_strchr_avx2;
+	g_simd.strrchr = ft_strrchr_avx2;
+}
+
+/**
+ * @brief Overlay the vector kernels a level can use on the scalar table.
+ *
+ * SSE4.2 only adds the pcmpistri charset kernel and AVX2 keeps it; AVX-512
+ * uses the AVX2 kernels. The Makefile builds the *_sse42.c and *_avx2.c
+ * files with -msse4.2 / -mavx2 on every x86 target, so they exist
+ * whenever SSE2 does.
+ */
+void	ft_simd_bind_x86(t_simd level)
+{
+	if (level >= FT_SIMD_SSE2)
+		bind_sse2();
+	if (level >= FT_SIMD_SSE42)
+		bind_sse42();
+	if (level >= FT_SIMD_AVX2)
+		bind_avx2();
+}
+
+#else
+
+void	ft_simd_bind_x86(t_simd level)
+{
+	(void)level;
+}
+
+#endif
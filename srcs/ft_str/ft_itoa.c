@@ -6,53 +6,23 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:33:58 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 16:52:47 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 03:30:24 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-static int	ft_numlen(long n)
-{
-	int	len;
-
-	len = 0;
-	if (n <= 0)
-	{
-		len++;
-		n = -n;
-	}
-	while (n > 0)
-	{
-		n /= 10;
-		len++;
-	}
-	return (len);
-}
-
 char	*ft_itoa(int n)
 {
+	char	buf[FT_ITOA_BUFSZ];
 	char	*str;
-	int		len;
-	long	nbr;
+	size_t	len;
 
-	nbr = n;
-	len = ft_numlen(n);
-	str = malloc(sizeof(char) * (len + 1));
+	len = ft_itoa_buf(n, buf);
+	str = malloc(len + 1);
 	if (!str)
 		return (NULL);
-	str[len--] = '\0';
-	if (nbr == 0)
-		str[0] = '0';
-	if (nbr < 0)
-	{
-		str[0] = '-';
-		nbr = -nbr;
-	}
-	while (nbr > 0)
-	{
-		str[len--] = (nbr % 10) + '0';
-		nbr /= 10;
-	}
+	ft_memstats_note("ft_itoa", len + 1);
+	ft_memcpy(str, buf, len + 1);
 	return (str);
 }
@@ -6,85 +6,97 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:46:37 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 15:59:40 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 23:16:58 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-static int	count_words(char const *s, char c)
+/**
+ * @brief Length of the word at s, which ends at c or the terminator.
+ */
+static size_t	word_len(char const *s, char c)
 {
-	int	count;
-	int	i;
+	size_t	len;
+
+	len = 0;
+	while (s[len] && s[len] != c)
+		len++;
+	return (len);
+}
+
+/**
+ * @brief Count the words of s and their total length in one pass.
+ */
+static size_t	count_words(char const *s, char c, size_t *bytes)
+{
+	size_t	count;
+	size_t	len;
 
 	count = 0;
-	i = 0;
-	while (s[i])
+	*bytes = 0;
+	while (*s)
 	{
-		while (s[i] == c)
-			i++;
-		if (s[i])
+		while (*s == c)
+			s++;
+		len = word_len(s, c);
+		if (len)
 			count++;
-		while (s[i] && s[i] != c)
-			i++;
+		*bytes += len;
+		s += len;
 	}
 	return (count);
 }
 
-static char	*word_dup(char const *s, int start, int end)
-{
-	char	*word;
-	int		i;
-
-	word = malloc((end - start + 1) * sizeof(char));
-	if (!word)
-		return (NULL);
-	i = 0;
-	while (start < end)
-		word[i++] = s[start++];
-	word[i] = '\0';
-	return (word);
-}
-
-static void	*free_split(char **split, int size)
+/**
+ * @brief Copy every word of s into dst, one after the other, and point
+ *        the entries of split at them.
+ */
+static void	fill_words(char **split, char *dst, char const *s, char c)
 {
-	int	i;
+	size_t	len;
 
-	i = 0;
-	while (i < size)
+	while (*s)
 	{
-		free(split[i]);
-		i++;
+		while (*s == c)
+			s++;
+		len = word_len(s, c);
+		if (len)
+		{
+			*split++ = dst;
+			ft_memcpy(dst, s, len);
+			dst[len] = '\0';
+			dst += len + 1;
+		}
+		s += len;
 	}
-	free(split);
-	return (NULL);
+	*split = NULL;
 }
 
+/**
+ * One counting pass sizes a single block holding the pointer array
+ * followed by every word, and one copy pass fills it.
+ */
 char	**ft_split(char const *s, char c)
 {
 	char	**split;
-	int		i;
-	int		j;
-	int		start;
+	size_t	words;
+	size_t	bytes;
+	size_t	size;
 
 	if (!s)
 		return (NULL);
-	split = malloc((count_words(s, c) + 1) * sizeof(char *));
+	words = count_words(s, c, &bytes);
+	size = (words + 1) * sizeof(char *) + bytes + words;
+	split = malloc(size);
 	if (!split)
 		return (NULL);
-	i = 0;
-	j = 0;
-	while (j < count_words(s, c))
-	{
-		while (s[i] == c)
-			i++;
-		start = i;
-		while (s[i] && s[i] != c)
-			i++;
-		split[j] = word_dup(s, start, i);
-		if (!split[j++])
-			return (free_split(split, j - 1));
-	}
-	split[j] = NULL;
+	ft_memstats_note("ft_split", size);
+	fill_words(split, (char *)(split + words + 1), s, c);
 	return (split);
 }
+
+void	ft_split_free(char **split)
+{
+	free(split);
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_split_set.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:51:02 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:51:02 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Count the words of s and their total length in one pass.
+ */
+static size_t	count_words(const char *s, const t_charset *set,
+		size_t *bytes)
+{
+	size_t	count;
+	size_t	len;
+
+	count = 0;
+	*bytes = 0;
+	s += ft_charset_span(s, set);
+	while (*s)
+	{
+		len = ft_charset_cspan(s, set);
+		count++;
+		*bytes += len;
+		s += len;
+		s += ft_charset_span(s, set);
+	}
+	return (count);
+}
+
+/**
+ * @brief Copy every word of s into dst and point the entries of split at
+ *        them.
+ */
+static void	fill_words(char **split, char *dst, const char *s,
+		const t_charset *set)
+{
+	size_t	len;
+
+	s += ft_charset_span(s, set);
+	while (*s)
+	{
+		len = ft_charset_cspan(s, set);
+		*split++ = dst;
+		ft_memcpy(dst, s, len);
+		dst[len] = '\0';
+		dst += len + 1;
+		s += len;
+		s += ft_charset_span(s, set);
+	}
+	*split = NULL;
+}
+
+/**
+ * Same single-block layout as ft_split: the pointer array followed by
+ * every word.
+ */
+char	**ft_split_set(const char *s, const t_charset *set)
+{
+	char	**split;
+	size_t	words;
+	size_t	bytes;
+	size_t	size;
+
+	if (!s || !set)
+		return (NULL);
+	words = count_words(s, set, &bytes);
+	size = (words + 1) * sizeof(char *) + bytes + words;
+	split = malloc(size);
+	if (!split)
+		return (NULL);
+	ft_memstats_note("ft_split_set", size);
+	fill_words(split, (char *)(split + words + 1), s, set);
+	return (split);
+}
@@ -6,24 +6,53 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 14:57:15 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 14:57:19 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 08:20:06 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_simd_internal.h"
 
-char	*ft_strchr(const char *s, int c)
+static uint64_t	has_zero(uint64_t w)
+{
+	return ((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS);
+}
+
+/**
+ * Same word walk as ft_strlen_scalar, stopping at the first aligned word
+ * that holds either the terminator or c.
+ */
+FT_NO_ASAN char	*ft_strchr_scalar(const char *s, int c)
 {
-	char	ch;
+	uint64_t	pattern;
+	uint64_t	w;
+	char		ch;
 
-	ch = (unsigned char)c;
-	while (*s != '\0')
+	ch = (char)c;
+	while ((uintptr_t)s & 7)
 	{
 		if (*s == ch)
 			return ((char *)s);
+		if (!*s)
+			return (NULL);
 		s++;
 	}
-	if (ch == '\0')
+	pattern = (unsigned char)ch * FT_SWAR_ONES;
+	__builtin_memcpy(&w, s, 8);
+	while (!has_zero(w) && !has_zero(w ^ pattern))
+	{
+		s += 8;
+		__builtin_memcpy(&w, s, 8);
+	}
+	while (*s && *s != ch)
+		s++;
+	if (*s == ch)
 		return ((char *)s);
 	return (NULL);
 }
+
+char	*ft_strchr(const char *s, int c)
+{
+	if (!g_simd.strchr)
+		ft_simd_init();
+	return (g_simd.strchr(s, c));
+}
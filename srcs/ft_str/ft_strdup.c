@@ -6,7 +6,7 @@
 /*   By: yiyli <etherealdt@gmail.com>               +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/04/16 17:37:14 by yiyli             #+#    #+#             */
-/*   Updated: 2025/11/20 14:58:48 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:29:41 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,6 +24,7 @@ char	*ft_strdup(const char *s)
 	dup = malloc(len + 1);
 	if (!dup)
 		return (NULL);
+	ft_memstats_note("ft_strdup", len + 1);
 	temp = dup;
 	while (*s)
 		*temp++ = *s++;
@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 15:02:48 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 15:04:35 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 00:33:58 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,23 +14,22 @@
 
 char	*ft_strjoin(char const *s1, char const *s2)
 {
-	size_t	i;
-	size_t	j;
+	size_t	len1;
+	size_t	len2;
 	char	*str;
 
-	i = ft_strlen(s1) + ft_strlen(s2) + 1;
-	str = (char *)malloc(sizeof(char) * i);
-	if (!str)
-		return (NULL);
-	i = 0;
-	j = 0;
+	len1 = 0;
 	if (s1)
-		while (s1[j])
-			str[i++] = s1[j++];
-	j = 0;
+		len1 = ft_strlen(s1);
+	len2 = 0;
 	if (s2)
-		while (s2[j])
-			str[i++] = s2[j++];
-	str[i] = '\0';
+		len2 = ft_strlen(s2);
+	str = (char *)malloc(len1 + len2 + 1);
+	if (!str)
+		return (NULL);
+	ft_memstats_note("ft_strjoin", len1 + len2 + 1);
+	ft_memcpy(str, s1, len1);
+	ft_memcpy(str + len1, s2, len2);
+	str[len1 + len2] = '\0';
 	return (str);
 }
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strjoin_arr.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 00:43:03 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 00:43:03 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Length of the joined string, or SIZE_MAX on overflow.
+ */
+static size_t	joined_len(char **parts, size_t sep_len)
+{
+	size_t	total;
+	size_t	len;
+	size_t	i;
+
+	total = 0;
+	i = 0;
+	while (parts[i])
+	{
+		len = ft_strlen(parts[i]);
+		if (i > 0)
+			len += sep_len;
+		if (len < sep_len || len >= SIZE_MAX - total)
+			return (SIZE_MAX);
+		total += len;
+		i++;
+	}
+	return (total);
+}
+
+static void	copy_joined(char *dst, char **parts, const char *sep,
+		size_t sep_len)
+{
+	size_t	len;
+	size_t	i;
+
+	i = 0;
+	while (parts[i])
+	{
+		if (i > 0)
+		{
+			ft_memcpy(dst, sep, sep_len);
+			dst += sep_len;
+		}
+		len = ft_strlen(parts[i]);
+		ft_memcpy(dst, parts[i], len);
+		dst += len;
+		i++;
+	}
+	*dst = '\0';
+}
+
+/**
+ * The inverse of splitting: ft_strjoin_arr(ft_split(s, ','), ",") gives
+ * s back without its empty fields. One length pass, one allocation, one
+ * copy pass.
+ */
+char	*ft_strjoin_arr(char **parts, const char *sep)
+{
+	size_t	sep_len;
+	size_t	total;
+	char	*str;
+
+	if (!parts)
+		return (NULL);
+	if (!sep)
+		sep = "";
+	sep_len = ft_strlen(sep);
+	total = joined_len(parts, sep_len);
+	if (total == SIZE_MAX)
+		return (NULL);
+	str = malloc(total + 1);
+	if (!str)
+		return (NULL);
+	ft_memstats_note("ft_strjoin_arr", total + 1);
+	copy_joined(str, parts, sep, sep_len);
+	return (str);
+}
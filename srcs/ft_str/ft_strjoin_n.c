@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strjoin_n.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 00:36:33 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 00:36:33 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Sum of the lengths of the next count strings of ap (NULL counts
+ *        as empty), or SIZE_MAX if it would not fit with a terminator.
+ */
+static size_t	total_len(size_t count, va_list *ap)
+{
+	const char	*part;
+	size_t		total;
+	size_t		len;
+
+	total = 0;
+	while (count--)
+	{
+		part = va_arg(*ap, const char *);
+		len = 0;
+		if (part)
+			len = ft_strlen(part);
+		if (len >= SIZE_MAX - total)
+			return (SIZE_MAX);
+		total += len;
+	}
+	return (total);
+}
+
+/**
+ * @brief Copy the next count strings of ap back to back into dst and
+ *        terminate it.
+ */
+static void	copy_parts(char *dst, size_t count, va_list *ap)
+{
+	const char	*part;
+	size_t		len;
+
+	while (count--)
+	{
+		part = va_arg(*ap, const char *);
+		if (part)
+		{
+			len = ft_strlen(part);
+			ft_memcpy(dst, part, len);
+			dst += len;
+		}
+	}
+	*dst = '\0';
+}
+
+/**
+ * The arguments are walked twice: once to size a single allocation and
+ * once to copy, so joining N strings costs O(total) instead of the
+ * O(N * total) of chained ft_strjoin calls.
+ */
+char	*ft_strjoin_n(size_t count, ...)
+{
+	va_list	ap;
+	size_t	total;
+	char	*str;
+
+	va_start(ap, count);
+	total = total_len(count, &ap);
+	va_end(ap);
+	if (total == SIZE_MAX)
+		return (NULL);
+	str = malloc(total + 1);
+	if (!str)
+		return (NULL);
+	ft_memstats_note("ft_strjoin_n", total + 1);
+	va_start(ap, count);
+	copy_parts(str, count, &ap);
+	va_end(ap);
+	return (str);
+}
@@ -6,18 +6,43 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 15:06:44 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 15:06:45 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 08:25:26 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_simd_internal.h"
 
-size_t	ft_strlen(const char *s)
+/**
+ * Bytes are checked one by one up to an 8-byte boundary, then a whole
+ * aligned word at a time. An aligned word never straddles a page, so the
+ * bytes read past the terminator in the last word cannot fault.
+ */
+FT_NO_ASAN size_t	ft_strlen_scalar(const char *s)
 {
-	size_t	i;
+	const char	*p;
+	uint64_t	w;
+
+	p = s;
+	while ((uintptr_t)p & 7)
+	{
+		if (!*p)
+			return ((size_t)(p - s));
+		p++;
+	}
+	__builtin_memcpy(&w, p, 8);
+	while (!((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS))
+	{
+		p += 8;
+		__builtin_memcpy(&w, p, 8);
+	}
+	while (*p)
+		p++;
+	return ((size_t)(p - s));
+}
 
-	i = 0;
-	while (s[i])
-		i++;
-	return (i);
+size_t	ft_strlen(const char *s)
+{
+	if (!g_simd.strlen)
+		ft_simd_init();
+	return (g_simd.strlen(s));
 }
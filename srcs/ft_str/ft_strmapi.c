@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 15:06:56 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 15:06:58 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:35:59 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,6 +24,7 @@ char	*ft_strmapi(char const *s, char (*f)(unsigned int, char))
 	str_new = (char *)malloc(sizeof(char) * (s_len + 1));
 	if (str_new == NULL)
 		return (NULL);
+	ft_memstats_note("ft_strmapi", s_len + 1);
 	i = 0;
 	while (i < s_len)
 	{
@@ -6,19 +6,17 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 15:09:55 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 15:11:23 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 01:01:25 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-char	*ft_strnstr(const char *haystack, const char *needle, size_t len)
+static char	*scan_short(const char *haystack, const char *needle, size_t len)
 {
 	size_t	i;
 	size_t	j;
 
-	if (*needle == '\0')
-		return ((char *)haystack);
 	i = 0;
 	while (haystack[i] && i < len)
 	{
@@ -31,3 +29,27 @@ char	*ft_strnstr(const char *haystack, const char *needle, size_t len)
 	}
 	return (NULL);
 }
+
+/**
+ * Short needles keep the plain scan, which is at most
+ * FT_STRNSTR_LONG * len compares. Longer ones bound the haystack at its
+ * terminator with a vectorised ft_memchr and run ft_memmem on the rest.
+ */
+char	*ft_strnstr(const char *haystack, const char *needle, size_t len)
+{
+	const char	*end;
+	size_t		m;
+
+	if (*needle == '\0')
+		return ((char *)haystack);
+	m = 0;
+	while (m < FT_STRNSTR_LONG && needle[m])
+		m++;
+	if (m < FT_STRNSTR_LONG)
+		return (scan_short(haystack, needle, len));
+	m += ft_strlen(needle + m);
+	end = ft_memchr(haystack, '\0', len);
+	if (end)
+		len = (size_t)(end - haystack);
+	return (ft_memmem(haystack, len, needle, m));
+}
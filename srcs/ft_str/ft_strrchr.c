@@ -6,24 +6,67 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 15:13:38 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 15:13:39 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 08:31:02 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
+#include "ft_simd_internal.h"
 
-char	*ft_strrchr(const char *str, int c)
+static uint64_t	has_zero(uint64_t w)
 {
-	const char	*last_occurrence;
+	return ((w - FT_SWAR_ONES) & ~w & FT_SWAR_HIGHS);
+}
 
-	last_occurrence = NULL;
-	while (*str != '\0')
+/**
+ * @brief Last ch among the n bytes at s, or last if there is none.
+ */
+static const char	*last_in(const char *s, size_t n, char ch,
+		const char *last)
+{
+	while (n--)
 	{
-		if (*str == (char)c)
-			last_occurrence = str;
-		str++;
+		if (s[n] == ch)
+			return (s + n);
 	}
-	if ((char)c == '\0')
-		return ((char *)str);
-	return ((char *)last_occurrence);
+	return (last);
+}
+
+/**
+ * Single forward pass: aligned words without a terminator are tested for
+ * ch as a whole, and only a word that holds ch is searched byte by byte.
+ */
+FT_NO_ASAN char	*ft_strrchr_scalar(const char *s, int c)
+{
+	const char	*last;
+	uint64_t	pattern;
+	uint64_t	w;
+	char		ch;
+
+	ch = (char)c;
+	if (!ch)
+		return ((char *)s + ft_strlen(s));
+	last = NULL;
+	while (((uintptr_t)s & 7) && *s)
+		last = last_in(s++, 1, ch, last);
+	if (!*s)
+		return ((char *)last);
+	pattern = (unsigned char)ch * FT_SWAR_ONES;
+	__builtin_memcpy(&w, s, 8);
+	while (!has_zero(w))
+	{
+		if (has_zero(w ^ pattern))
+			last = last_in(s, 8, ch, last);
+		s += 8;
+		__builtin_memcpy(&w, s, 8);
+	}
+	while (*s)
+		last = last_in(s++, 1, ch, last);
+	return ((char *)last);
+}
+
+char	*ft_strrchr(const char *str, int c)
+{
+	if (!g_simd.strrchr)
+		ft_simd_init();
+	return (g_simd.strrchr(str, c));
 }
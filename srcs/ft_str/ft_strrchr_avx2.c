@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strrchr_avx2.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:46:38 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:37:13 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+#if defined(__AVX2__)
+
+static FT_NO_ASAN uint64_t	eq64(const char *p, __m256i v)
+{
+	uint64_t	m;
+	int			i;
+
+	m = 0;
+	i = 0;
+	while (i < 64)
+	{
+		m |= (uint64_t)(unsigned int)_mm256_movemask_epi8(
+				_mm256_cmpeq_epi8(
+					_mm256_load_si256((const __m256i *)(p + i)), v)) << i;
+		i += 32;
+	}
+	return (m);
+}
+
+/**
+ * Single forward pass over aligned 64-byte chunks (page-safe like
+ * ft_strlen_avx2). The newest chunk holding c is remembered; at the
+ * chunk with the terminator, matches past it are masked off.
+ */
+FT_NO_ASAN char	*ft_strrchr_avx2(const char *s, int c)
+{
+	const char	*p;
+	const char	*last;
+	uint64_t	z;
+	uint64_t	m;
+	__m256i		v;
+
+	if ((char)c == '\0')
+		return ((char *)s + ft_strlen_avx2(s));
+	v = _mm256_set1_epi8((char)c);
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)63);
+	z = eq64(p, _mm256_setzero_si256()) & (~0ULL << ((uintptr_t)s & 63));
+	m = eq64(p, v) & (~0ULL << ((uintptr_t)s & 63));
+	last = NULL;
+	while (!z)
+	{
+		if (m)
+			last = p + 63 - __builtin_clzll(m);
+		p += 64;
+		z = eq64(p, _mm256_setzero_si256());
+		m = eq64(p, v);
+	}
+	m &= z ^ (z - 1);
+	if (m)
+		return ((char *)p + 63 - __builtin_clzll(m));
+	return ((char *)last);
+}
+
+#endif
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strrchr_sse2.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:43:40 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:38:10 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+#if defined(__SSE2__)
+
+static FT_NO_ASAN uint64_t	eq64(const char *p, __m128i v)
+{
+	uint64_t	m;
+	int			i;
+
+	m = 0;
+	i = 0;
+	while (i < 64)
+	{
+		m |= (uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_load_si128((const __m128i *)(p + i)), v)) << i;
+		i += 16;
+	}
+	return (m);
+}
+
+/**
+ * Single forward pass over aligned 64-byte chunks (page-safe like
+ * ft_strlen_sse2). The newest chunk holding c is remembered; at the
+ * chunk with the terminator, matches past it are masked off.
+ */
+FT_NO_ASAN char	*ft_strrchr_sse2(const char *s, int c)
+{
+	const char	*p;
+	const char	*last;
+	uint64_t	z;
+	uint64_t	m;
+	__m128i		v;
+
+	if ((char)c == '\0')
+		return ((char *)s + ft_strlen_sse2(s));
+	v = _mm_set1_epi8((char)c);
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)63);
+	z = eq64(p, _mm_setzero_si128()) & (~0ULL << ((uintptr_t)s & 63));
+	m = eq64(p, v) & (~0ULL << ((uintptr_t)s & 63));
+	last = NULL;
+	while (!z)
+	{
+		if (m)
+			last = p + 63 - __builtin_clzll(m);
+		p += 64;
+		z = eq64(p, _mm_setzero_si128());
+		m = eq64(p, v);
+	}
+	m &= z ^ (z - 1);
+	if (m)
+		return ((char *)p + 63 - __builtin_clzll(m));
+	return ((char *)last);
+}
+
+#endif
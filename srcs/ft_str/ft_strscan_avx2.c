@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strscan_avx2.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:39:29 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:44:50 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+#if defined(__AVX2__)
+
+/**
+ * @brief Bit i set when byte i of the aligned block at p is zero or equal
+ *        to the byte broadcast in v.
+ *
+ * min(x, x ^ v) is zero exactly for those bytes, so both tests cost one
+ * compare; with v zero it is the plain terminator test.
+ */
+static FT_NO_ASAN unsigned int	hit32(const char *p, __m256i v)
+{
+	__m256i	x;
+
+	x = _mm256_load_si256((const __m256i *)p);
+	x = _mm256_min_epu8(x, _mm256_xor_si256(x, v));
+	return ((unsigned int)_mm256_movemask_epi8(
+			_mm256_cmpeq_epi8(x, _mm256_setzero_si256())));
+}
+
+static FT_NO_ASAN uint64_t	hits64(const char *p, __m256i v)
+{
+	return ((uint64_t)hit32(p, v) | (uint64_t)hit32(p + 32, v) << 32);
+}
+
+/**
+ * @brief First byte at or after s that is the terminator or matches v.
+ *
+ * Reads whole aligned 64-byte chunks: the first starts below s (those
+ * bits are shifted out) and the last may run past the terminator, but a
+ * 64-byte aligned chunk never crosses a page.
+ */
+static FT_NO_ASAN const char	*scan(const char *s, __m256i v)
+{
+	const char	*p;
+	uint64_t	m;
+
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)63);
+	m = hits64(p, v) >> ((uintptr_t)s & 63);
+	if (m)
+		return (s + __builtin_ctzll(m));
+	p += 64;
+	m = hits64(p, v);
+	while (!m)
+	{
+		p += 64;
+		m = hits64(p, v);
+	}
+	return (p + __builtin_ctzll(m));
+}
+
+FT_NO_ASAN size_t	ft_strlen_avx2(const char *s)
+{
+	return ((size_t)(scan(s, _mm256_setzero_si256()) - s));
+}
+
+FT_NO_ASAN char	*ft_strchr_avx2(const char *s, int c)
+{
+	const char	*p;
+
+	p = scan(s, _mm256_set1_epi8((char)c));
+	if (*p == (char)c)
+		return ((char *)p);
+	return (NULL);
+}
+
+#endif
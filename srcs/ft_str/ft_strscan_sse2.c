@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strscan_sse2.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:33:58 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 08:47:25 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd_internal.h"
+
+#if defined(__SSE2__)
+
+/**
+ * @brief Bit i set when byte i of the aligned block at p is zero or equal
+ *        to the byte broadcast in v.
+ *
+ * min(x, x ^ v) is zero exactly for those bytes, so both tests cost one
+ * compare; with v zero it is the plain terminator test.
+ */
+static FT_NO_ASAN unsigned int	hit16(const char *p, __m128i v)
+{
+	__m128i	x;
+
+	x = _mm_load_si128((const __m128i *)p);
+	x = _mm_min_epu8(x, _mm_xor_si128(x, v));
+	return ((unsigned int)_mm_movemask_epi8(
+			_mm_cmpeq_epi8(x, _mm_setzero_si128())));
+}
+
+static FT_NO_ASAN uint64_t	hits64(const char *p, __m128i v)
+{
+	return ((uint64_t)hit16(p, v) | (uint64_t)hit16(p + 16, v) << 16
+		| (uint64_t)hit16(p + 32, v) << 32
+		| (uint64_t)hit16(p + 48, v) << 48);
+}
+
+/**
+ * @brief First byte at or after s that is the terminator or matches v.
+ *
+ * Reads whole aligned 64-byte chunks: the first starts below s (those
+ * bits are shifted out) and the last may run past the terminator, but a
+ * 64-byte aligned chunk never crosses a page.
+ */
+static FT_NO_ASAN const char	*scan(const char *s, __m128i v)
+{
+	const char	*p;
+	uint64_t	m;
+
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)63);
+	m = hits64(p, v) >> ((uintptr_t)s & 63);
+	if (m)
+		return (s + __builtin_ctzll(m));
+	p += 64;
+	m = hits64(p, v);
+	while (!m)
+	{
+		p += 64;
+		m = hits64(p, v);
+	}
+	return (p + __builtin_ctzll(m));
+}
+
+FT_NO_ASAN size_t	ft_strlen_sse2(const char *s)
+{
+	return ((size_t)(scan(s, _mm_setzero_si128()) - s));
+}
+
+FT_NO_ASAN char	*ft_strchr_sse2(const char *s, int c)
+{
+	const char	*p;
+
+	p = scan(s, _mm_set1_epi8((char)c));
+	if (*p == (char)c)
+		return ((char *)p);
+	return (NULL);
+}
+
+#endif
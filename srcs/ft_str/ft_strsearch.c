@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strsearch.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 00:56:45 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:28:13 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * Every byte starts with the full window shift (capped at 255); bytes of
+ * needle[0..m-1) get their distance to the end, and the last byte gets 0
+ * so the scan stops on every window that could match.
+ */
+static void	build_shift(unsigned char *shift, const unsigned char *needle,
+		size_t m)
+{
+	size_t	i;
+	size_t	d;
+
+	d = m;
+	if (d > 255)
+		d = 255;
+	ft_memset(shift, (int)d, 256);
+	i = 0;
+	if (m > 256)
+		i = m - 256;
+	while (i + 1 < m)
+	{
+		shift[needle[i]] = (unsigned char)(m - 1 - i);
+		i++;
+	}
+	shift[needle[m - 1]] = 0;
+}
+
+void	ft_strsearch_init(t_strsearch *s, const char *needle, size_t m)
+{
+	s->tw.needle = (const unsigned char *)needle;
+	s->tw.m = m;
+	if (m < 2)
+		return ;
+	ft_twoway_init(&s->tw, (const unsigned char *)needle, m, 1);
+	build_shift(s->shift, (const unsigned char *)needle, m);
+}
+
+/**
+ * The searcher holds no pointer into itself, so it may be copied by value;
+ * the shift table is attached to a local copy of the Two-Way state.
+ */
+char	*ft_strsearch_next(const t_strsearch *s, const char *hay, size_t len)
+{
+	t_twoway	tw;
+	size_t		j;
+
+	if (s->tw.m == 0)
+		return ((char *)hay);
+	if (s->tw.m > len)
+		return (NULL);
+	if (s->tw.m == 1)
+		return (ft_memchr(hay, *s->tw.needle, len));
+	tw = s->tw;
+	tw.shift = s->shift;
+	j = ft_twoway_find(&tw, (const unsigned char *)hay, len);
+	if (j == SIZE_MAX)
+		return (NULL);
+	return ((char *)hay + j);
+}
@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strspn.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:46:10 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:46:10 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+size_t	ft_strspn(const char *s, const char *accept)
+{
+	t_charset	set;
+
+	set = ft_charset_from(accept);
+	return (ft_charset_span(s, &set));
+}
+
+size_t	ft_strcspn(const char *s, const char *reject)
+{
+	t_charset	set;
+
+	set = ft_charset_from(reject);
+	return (ft_charset_cspan(s, &set));
+}
+
+char	*ft_strpbrk(const char *s, const char *accept)
+{
+	t_charset	set;
+
+	set = ft_charset_from(accept);
+	s += ft_charset_cspan(s, &set);
+	if (*s)
+		return ((char *)s);
+	return (NULL);
+}
@@ -6,43 +6,51 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 15:14:54 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 15:14:55 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/18 02:02:55 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-static int	ft_checkset(char c, const char *set)
-{
-	while (*set)
-	{
-		if (c == *set)
-			return (1);
-		set++;
-	}
-	return (0);
-}
-
-char	*ft_strtrim(char const *s1, char const *set)
+/**
+ * @brief Copy s without the leading and trailing bytes in set.
+ */
+static char	*trim_copy(const char *s, const t_charset *set, const char *site)
 {
 	size_t	start;
 	size_t	end;
-	size_t	len;
 	char	*trimmed;
 
-	if (!s1 || !set)
-		return (NULL);
-	start = 0;
-	while (s1[start] && ft_checkset(s1[start], set))
-		start++;
-	end = ft_strlen(s1);
-	while (end > start && ft_checkset(s1[end - 1], set))
+	start = ft_charset_span(s, set);
+	end = start + ft_strlen(s + start);
+	while (end > start && ft_charset_has(set, (unsigned char)s[end - 1]))
 		end--;
-	len = end - start;
-	trimmed = (char *)malloc(sizeof(char) * (len + 1));
+	trimmed = (char *)malloc(end - start + 1);
 	if (!trimmed)
 		return (NULL);
-	ft_strlcpy(trimmed, s1 + start, len + 1);
-	trimmed[len] = '\0';
+	ft_memstats_note(site, end - start + 1);
+	ft_memcpy(trimmed, s + start, end - start);
+	trimmed[end - start] = '\0';
 	return (trimmed);
 }
+
+/**
+ * set is turned into a bitmap once, so each byte of s1 costs one lookup
+ * however long set is.
+ */
+char	*ft_strtrim(char const *s1, char const *set)
+{
+	t_charset	bits;
+
+	if (!s1 || !set)
+		return (NULL);
+	bits = ft_charset_from(set);
+	return (trim_copy(s1, &bits, "ft_strtrim"));
+}
+
+char	*ft_strtrim_set(const char *s, const t_charset *set)
+{
+	if (!s || !set)
+		return (NULL);
+	return (trim_copy(s, set, "ft_strtrim_set"));
+}
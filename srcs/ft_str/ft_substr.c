@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/11/20 15:14:59 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/11/20 15:36:16 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:45:11 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,6 +27,7 @@ char	*ft_substr(char const *s, unsigned int start, size_t len)
 	substr = (char *)malloc(len + 1);
 	if (!substr)
 		return (NULL);
+	ft_memstats_note("ft_substr", len + 1);
 	ft_memcpy(substr, s + start, len);
 	substr[len] = '\0';
 	return (substr);
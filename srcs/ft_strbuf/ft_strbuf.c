@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strbuf.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 00:01:29 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 00:01:29 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+void	ft_strbuf_init(t_strbuf *sb)
+{
+	sb->data = sb->small;
+	sb->len = 0;
+	sb->cap = FT_STRBUF_INLINE;
+	sb->small[0] = '\0';
+}
+
+/**
+ * @brief Move to a heap block of at least need bytes, twice the old
+ *        capacity when that is larger.
+ */
+static int	strbuf_grow(t_strbuf *sb, size_t need)
+{
+	size_t	cap;
+	char	*data;
+
+	cap = need;
+	if (sb->cap <= SIZE_MAX / 2 && sb->cap * 2 > need)
+		cap = sb->cap * 2;
+	if (sb->data == sb->small)
+	{
+		data = ft_allocator_alloc(NULL, cap);
+		if (data)
+			ft_memcpy(data, sb->small, sb->len + 1);
+	}
+	else
+		data = ft_allocator_realloc(NULL, sb->data, sb->cap, cap);
+	if (!data)
+		return (0);
+	if (sb->data == sb->small)
+		ft_memstats_record("ft_strbuf_reserve", 0, cap);
+	else
+		ft_memstats_record("ft_strbuf_reserve", sb->cap, cap);
+	sb->data = data;
+	sb->cap = cap;
+	return (1);
+}
+
+int	ft_strbuf_reserve(t_strbuf *sb, size_t extra)
+{
+	if (extra > SIZE_MAX - sb->len - 1)
+		return (0);
+	if (sb->len + extra + 1 <= sb->cap)
+		return (1);
+	return (strbuf_grow(sb, sb->len + extra + 1));
+}
+
+/**
+ * A heap buffer is handed over as is; inline contents are copied into a
+ * block of exactly len + 1 bytes.
+ */
+char	*ft_strbuf_detach(t_strbuf *sb)
+{
+	char	*s;
+
+	if (sb->data == sb->small)
+	{
+		s = malloc(sb->len + 1);
+		if (!s)
+			return (NULL);
+		ft_memstats_note("ft_strbuf_detach", sb->len + 1);
+		ft_memcpy(s, sb->small, sb->len + 1);
+	}
+	else
+	{
+		s = sb->data;
+		ft_memstats_record("ft_strbuf_detach", sb->cap, 0);
+	}
+	ft_strbuf_init(sb);
+	return (s);
+}
+
+void	ft_strbuf_free(t_strbuf *sb)
+{
+	if (!sb)
+		return ;
+	if (sb->data != sb->small)
+	{
+		free(sb->data);
+		ft_memstats_record("ft_strbuf_free", sb->cap, 0);
+	}
+	ft_strbuf_init(sb);
+}
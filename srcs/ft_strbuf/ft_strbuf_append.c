@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strbuf_append.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 00:07:51 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 00:07:51 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+int	ft_strbuf_append_n(t_strbuf *sb, const char *s, size_t n)
+{
+	if (!ft_strbuf_reserve(sb, n))
+		return (0);
+	ft_memcpy(sb->data + sb->len, s, n);
+	sb->len += n;
+	sb->data[sb->len] = '\0';
+	return (1);
+}
+
+int	ft_strbuf_append(t_strbuf *sb, const char *s)
+{
+	if (!s)
+		return (1);
+	return (ft_strbuf_append_n(sb, s, ft_strlen(s)));
+}
+
+int	ft_strbuf_push_char(t_strbuf *sb, char c)
+{
+	if (sb->len + 2 > sb->cap && !ft_strbuf_reserve(sb, 1))
+		return (0);
+	sb->data[sb->len++] = c;
+	sb->data[sb->len] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Empty the buffer but keep its capacity for reuse.
+ */
+void	ft_strbuf_clear(t_strbuf *sb)
+{
+	sb->len = 0;
+	sb->data[0] = '\0';
+}
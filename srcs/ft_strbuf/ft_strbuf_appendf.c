@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strbuf_appendf.c                                :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 00:11:23 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 06:18:27 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_strbuf_internal.h"
+
+static int	put_spec(t_strbuf *sb, char spec, int prec, va_list *ap)
+{
+	if (spec == 'f' || spec == 'e' || spec == 'g')
+		return (ft_strbuf_put_double(sb, va_arg(*ap, double), spec, prec));
+	if (spec == 'c')
+		return (ft_strbuf_push_char(sb, (char)va_arg(*ap, int)));
+	if (spec == 's')
+		return (ft_strbuf_put_str(sb, va_arg(*ap, char *)));
+	if (spec == 'p')
+		return (ft_strbuf_put_ptr(sb, va_arg(*ap, void *)));
+	if (spec == 'd' || spec == 'i')
+		return (ft_strbuf_put_nbr(sb, va_arg(*ap, int)));
+	if (spec == 'u')
+		return (ft_strbuf_put_base(sb, va_arg(*ap, unsigned int),
+				"0123456789"));
+	if (spec == 'x')
+		return (ft_strbuf_put_base(sb, va_arg(*ap, unsigned int),
+				"0123456789abcdef"));
+	if (spec == 'X')
+		return (ft_strbuf_put_base(sb, va_arg(*ap, unsigned int),
+				"0123456789ABCDEF"));
+	if (spec == '%')
+		return (ft_strbuf_push_char(sb, '%'));
+	return (1);
+}
+
+/**
+ * @brief Copy each literal run up to the next '%' in one append, then
+ *        convert the argument. Unknown conversions and a lone trailing
+ *        '%' produce nothing, as in ft_printf.
+ */
+static int	format_all(t_strbuf *sb, const char *fmt, va_list *ap)
+{
+	const char	*pct;
+	int			prec;
+
+	while (*fmt)
+	{
+		pct = ft_strchr(fmt, '%');
+		if (!pct)
+			return (ft_strbuf_append(sb, fmt));
+		if (!ft_strbuf_append_n(sb, fmt, (size_t)(pct - fmt)))
+			return (0);
+		fmt = pct + 1;
+		prec = ft_printf_parse_prec(&fmt);
+		if (!*fmt)
+			return (1);
+		if (!put_spec(sb, *fmt++, prec, ap))
+			return (0);
+	}
+	return (1);
+}
+
+int	ft_strbuf_vappendf(t_strbuf *sb, const char *fmt, va_list ap)
+{
+	va_list	args;
+	size_t	start;
+	int		ok;
+
+	if (!fmt)
+		return (-1);
+	start = sb->len;
+	va_copy(args, ap);
+	ok = format_all(sb, fmt, &args);
+	va_end(args);
+	if (!ok)
+	{
+		sb->len = start;
+		sb->data[start] = '\0';
+		return (-1);
+	}
+	return ((int)(sb->len - start));
+}
+
+int	ft_strbuf_appendf(t_strbuf *sb, const char *fmt, ...)
+{
+	va_list	ap;
+	int		n;
+
+	va_start(ap, fmt);
+	n = ft_strbuf_vappendf(sb, fmt, ap);
+	va_end(ap);
+	return (n);
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strbuf_fmt.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 00:12:21 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:00:31 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_strbuf_internal.h"
+
+/**
+ * @brief Append n in the base given by the length of digits.
+ *
+ * The digits are formatted straight into the reserved tail of the buffer.
+ */
+int	ft_strbuf_put_base(t_strbuf *sb, unsigned long n, const char *digits)
+{
+	if (!ft_strbuf_reserve(sb, FT_U64TOA_BASE_BUFSZ - 1))
+		return (0);
+	sb->len += ft_u64toa_base_buf(n, digits, sb->data + sb->len);
+	return (1);
+}
+
+int	ft_strbuf_put_nbr(t_strbuf *sb, int n)
+{
+	if (!ft_strbuf_reserve(sb, FT_ITOA_BUFSZ - 1))
+		return (0);
+	sb->len += ft_itoa_buf(n, sb->data + sb->len);
+	return (1);
+}
+
+int	ft_strbuf_put_str(t_strbuf *sb, const char *s)
+{
+	if (!s)
+		s = "(null)";
+	return (ft_strbuf_append(sb, s));
+}
+
+int	ft_strbuf_put_ptr(t_strbuf *sb, void *ptr)
+{
+	if (!ptr)
+		return (ft_strbuf_append_n(sb, "(nil)", 5));
+	if (!ft_strbuf_append_n(sb, "0x", 2))
+		return (0);
+	return (ft_strbuf_put_base(sb, (unsigned long)ptr, "0123456789abcdef"));
+}
+
+/**
+ * @brief Append x as %f, %e or %g, formatted in place like put_base.
+ */
+int	ft_strbuf_put_double(t_strbuf *sb, double x, char spec, int prec)
+{
+	if (!ft_strbuf_reserve(sb, FT_DTOA_BUFSZ - 1 + (prec > 0) * (size_t)prec))
+		return (0);
+	if (spec == 'e')
+		sb->len += ft_dtoa_exp(x, prec, sb->data + sb->len);
+	else if (spec == 'g')
+		sb->len += ft_dtoa_general(x, prec, sb->data + sb->len);
+	else
+		sb->len += ft_dtoa_fixed(x, prec, sb->data + sb->len);
+	return (1);
+}
@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strbuf_internal.h                               :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 00:18:17 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:03:59 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_STRBUF_INTERNAL_H
+# define FT_STRBUF_INTERNAL_H
+
+# include "libft.h"
+
+/*
+ * Conversion helpers behind ft_strbuf_vappendf. Each returns 1 on
+ * success and 0 on allocation failure.
+ */
+int	ft_strbuf_put_base(t_strbuf *sb, unsigned long n, const char *digits);
+int	ft_strbuf_put_nbr(t_strbuf *sb, int n);
+int	ft_strbuf_put_str(t_strbuf *sb, const char *s);
+int	ft_strbuf_put_ptr(t_strbuf *sb, void *ptr);
+int	ft_strbuf_put_double(t_strbuf *sb, double x, char spec, int prec);
+
+#endif
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strpool_hash.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:34:33 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:34:33 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_strpool_internal.h"
+
+/**
+ * @brief djb2 over len bytes; the same value ft_hashmap computes for a
+ *        NUL-terminated key.
+ */
+size_t	ft_strpool_hash_bytes(const char *s, size_t len)
+{
+	size_t				hash;
+	const unsigned char	*p;
+
+	hash = 5381;
+	p = (const unsigned char *)s;
+	while (len--)
+		hash = ((hash << 5) + hash) + *p++;
+	return (hash);
+}
+
+/**
+ * @brief Home slot of hash in the pool's table.
+ */
+size_t	ft_strpool_index(const t_strpool *pool, size_t hash)
+{
+	return ((size_t)(((uint64_t)hash * FT_STRPOOL_MIX) >> 32)
+		& (pool->cap - 1));
+}
+
+/**
+ * @brief Cached hash of an interned string: O(1), no byte is read.
+ * @param istr String returned by ft_strpool_intern (any pool).
+ */
+size_t	ft_strpool_hash(const char *istr)
+{
+	return (((const t_strpool_head *)istr - 1)->hash);
+}
+
+/**
+ * @brief Cached length of an interned string: O(1).
+ * @param istr String returned by ft_strpool_intern (any pool).
+ */
+size_t	ft_strpool_len(const char *istr)
+{
+	return (((const t_strpool_head *)istr - 1)->len);
+}
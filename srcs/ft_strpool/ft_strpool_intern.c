@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strpool_intern.c                                :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:35:13 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:35:13 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_strpool_internal.h"
+
+/**
+ * @brief Linear probe for s from its home slot.
+ * @return The slot holding s, or the empty slot that ends its run.
+ */
+t_strpool_slot	*ft_strpool_probe(const t_strpool *pool, const char *s,
+		size_t len, size_t hash)
+{
+	t_strpool_slot	*slot;
+	size_t			i;
+
+	i = ft_strpool_index(pool, hash);
+	while (1)
+	{
+		slot = pool->slots + i;
+		if (!slot->str || (slot->hash == hash
+				&& ft_strpool_len(slot->str) == len
+				&& ft_memcmp(slot->str, s, len) == 0))
+			return (slot);
+		i = (i + 1) & (pool->cap - 1);
+	}
+}
+
+/**
+ * @brief Copy s behind its header into the arena.
+ */
+static const char	*store(t_strpool *pool, const char *s, size_t len,
+		size_t hash)
+{
+	t_strpool_head	*head;
+	char			*str;
+
+	if (len > SIZE_MAX - sizeof(t_strpool_head) - 1)
+		return (NULL);
+	head = ft_arena_alloc(pool->strings, sizeof(t_strpool_head) + len + 1);
+	if (!head)
+		return (NULL);
+	head->hash = hash;
+	head->len = len;
+	str = (char *)(head + 1);
+	ft_memcpy(str, s, len);
+	str[len] = '\0';
+	return (str);
+}
+
+/**
+ * @brief Canonical copy of the len bytes at s (which need not be
+ *        NUL-terminated), added on first sight.
+ *
+ * Equal byte strings always yield the same pointer, so interned strings
+ * compare with ==.
+ *
+ * @return The interned string, or NULL on allocation failure.
+ */
+const char	*ft_strpool_intern_len(t_strpool *pool, const char *s,
+		size_t len)
+{
+	t_strpool_slot	*slot;
+	size_t			hash;
+
+	if (!pool || (!s && len))
+		return (NULL);
+	hash = ft_strpool_hash_bytes(s, len);
+	slot = ft_strpool_probe(pool, s, len, hash);
+	if (slot->str)
+		return (slot->str);
+	if ((pool->count + 1) * 2 > pool->cap)
+	{
+		if (!ft_strpool_grow(pool))
+			return (NULL);
+		slot = ft_strpool_probe(pool, s, len, hash);
+	}
+	slot->str = store(pool, s, len, hash);
+	if (!slot->str)
+		return (NULL);
+	slot->hash = hash;
+	pool->count++;
+	return (slot->str);
+}
+
+/**
+ * @brief ft_strpool_intern_len for a NUL-terminated string.
+ */
+const char	*ft_strpool_intern(t_strpool *pool, const char *s)
+{
+	if (!s)
+		return (NULL);
+	return (ft_strpool_intern_len(pool, s, ft_strlen(s)));
+}
+
+/**
+ * @brief Canonical copy of s if it was interned, without adding it.
+ * @return The interned string, or NULL if s is not in the pool.
+ */
+const char	*ft_strpool_find(const t_strpool *pool, const char *s)
+{
+	size_t	len;
+
+	if (!pool || !s)
+		return (NULL);
+	len = ft_strlen(s);
+	return (ft_strpool_probe(pool, s, len,
+			ft_strpool_hash_bytes(s, len))->str);
+}
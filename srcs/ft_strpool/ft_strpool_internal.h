@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strpool_internal.h                              :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:39:37 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:39:37 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_STRPOOL_INTERNAL_H
+# define FT_STRPOOL_INTERNAL_H
+
+# include "libft.h"
+
+/* Slots in a new table (a power of two). */
+# define FT_STRPOOL_INIT_CAP 64
+
+/* Arena block size for the interned bytes. */
+# define FT_STRPOOL_BLOCK 16384
+
+/* Fibonacci multiplier: spreads djb2's weak low bits over the index. */
+# define FT_STRPOOL_MIX 0x9E3779B97F4A7C15ULL
+
+/**
+ * @brief Table slot: the string's hash, kept inline so a probe that
+ *        misses never touches the string itself.
+ * @param str Canonical string, NULL for an empty slot.
+ */
+typedef struct s_strpool_slot
+{
+	size_t		hash;
+	const char	*str;
+}	t_strpool_slot;
+
+/**
+ * @brief Header stored in the arena right before each canonical string.
+ */
+typedef struct s_strpool_head
+{
+	size_t	hash;
+	size_t	len;
+}	t_strpool_head;
+
+size_t			ft_strpool_hash_bytes(const char *s, size_t len);
+size_t			ft_strpool_index(const t_strpool *pool, size_t hash);
+t_strpool_slot	*ft_strpool_probe(const t_strpool *pool, const char *s,
+					size_t len, size_t hash);
+int				ft_strpool_grow(t_strpool *pool);
+
+#endif
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_strpool_new.c                                   :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 05:38:30 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 05:38:30 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_strpool_internal.h"
+
+static t_strpool_slot	*slots_new(size_t cap)
+{
+	t_strpool_slot	*slots;
+
+	slots = ft_allocator_calloc(NULL, cap, sizeof(t_strpool_slot));
+	if (slots)
+		ft_memstats_record("ft_strpool_slots", 0,
+			cap * sizeof(t_strpool_slot));
+	return (slots);
+}
+
+/**
+ * @brief Create an empty interning pool.
+ *
+ * Strings are copied into an arena owned by the pool and stay there,
+ * at a fixed address, until ft_strpool_free.
+ *
+ * @return New pool, or NULL on allocation failure.
+ */
+t_strpool	*ft_strpool_new(void)
+{
+	t_strpool	*pool;
+
+	pool = ft_allocator_calloc(NULL, 1, sizeof(t_strpool));
+	if (!pool)
+		return (NULL);
+	pool->strings = ft_arena_new(FT_STRPOOL_BLOCK);
+	pool->slots = slots_new(FT_STRPOOL_INIT_CAP);
+	if (!pool->strings || !pool->slots)
+	{
+		ft_arena_free(pool->strings);
+		free(pool->slots);
+		free(pool);
+		return (NULL);
+	}
+	pool->cap = FT_STRPOOL_INIT_CAP;
+	ft_memstats_record("ft_strpool_new", 0, sizeof(t_strpool));
+	return (pool);
+}
+
+/**
+ * @brief Free a pool and every string interned in it.
+ * @param pool Pool to free. Safe to call with NULL.
+ * @note Maps created with ft_hashmap_new_interned on this pool must be
+ *       freed first.
+ */
+void	ft_strpool_free(t_strpool *pool)
+{
+	if (!pool)
+		return ;
+	ft_memstats_record("ft_strpool_slots",
+		pool->cap * sizeof(t_strpool_slot), 0);
+	ft_memstats_record("ft_strpool_free", sizeof(t_strpool), 0);
+	ft_arena_free(pool->strings);
+	free(pool->slots);
+	free(pool);
+}
+
+static void	place(t_strpool *pool, const t_strpool_slot *slot)
+{
+	size_t	i;
+
+	i = ft_strpool_index(pool, slot->hash);
+	while (pool->slots[i].str)
+		i = (i + 1) & (pool->cap - 1);
+	pool->slots[i] = *slot;
+}
+
+/**
+ * @brief Double the table. Slots carry their hash, so moving them reads
+ *        no string.
+ */
+int	ft_strpool_grow(t_strpool *pool)
+{
+	t_strpool	next;
+	size_t		i;
+
+	if (pool->cap > SIZE_MAX / 2 / sizeof(t_strpool_slot))
+		return (0);
+	next.cap = pool->cap * 2;
+	next.slots = slots_new(next.cap);
+	if (!next.slots)
+		return (0);
+	i = 0;
+	while (i < pool->cap)
+	{
+		if (pool->slots[i].str)
+			place(&next, pool->slots + i);
+		i++;
+	}
+	ft_memstats_record("ft_strpool_slots",
+		pool->cap * sizeof(t_strpool_slot), 0);
+	free(pool->slots);
+	pool->slots = next.slots;
+	pool->cap = next.cap;
+	return (1);
+}
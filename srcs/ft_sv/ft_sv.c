@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_sv.c                                            :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 23:27:04 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 23:27:04 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+t_strview	ft_sv_new(const char *ptr, size_t len)
+{
+	t_strview	sv;
+
+	sv.ptr = ptr;
+	sv.len = len;
+	return (sv);
+}
+
+/**
+ * @brief View of a C string, without its terminator (empty for NULL).
+ */
+t_strview	ft_sv_from(const char *s)
+{
+	if (!s)
+		return (ft_sv_new("", 0));
+	return (ft_sv_new(s, ft_strlen(s)));
+}
+
+/**
+ * @brief Up to len bytes from start, clamped to the view like ft_substr.
+ */
+t_strview	ft_sv_sub(t_strview sv, size_t start, size_t len)
+{
+	if (start > sv.len)
+		start = sv.len;
+	if (len > sv.len - start)
+		len = sv.len - start;
+	return (ft_sv_new(sv.ptr + start, len));
+}
@@ -0,0 +1,26 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_sv_dup.c                                        :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 23:28:36 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 23:28:36 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+char	*ft_sv_dup(t_strview sv)
+{
+	char	*dup;
+
+	dup = malloc(sv.len + 1);
+	if (!dup)
+		return (NULL);
+	ft_memstats_note("ft_sv_dup", sv.len + 1);
+	ft_memcpy(dup, sv.ptr, sv.len);
+	dup[sv.len] = '\0';
+	return (dup);
+}
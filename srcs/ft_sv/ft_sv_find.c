@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_sv_find.c                                       :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 23:31:41 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 23:31:41 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+size_t	ft_sv_find(t_strview hay, t_strview needle)
+{
+	const char	*hit;
+
+	hit = ft_memmem(hay.ptr, hay.len, needle.ptr, needle.len);
+	if (!hit)
+		return (FT_SV_NPOS);
+	return ((size_t)(hit - hay.ptr));
+}
+
+int	ft_sv_eq(t_strview a, t_strview b)
+{
+	if (a.len != b.len)
+		return (0);
+	return (a.ptr == b.ptr || ft_memcmp(a.ptr, b.ptr, a.len) == 0);
+}
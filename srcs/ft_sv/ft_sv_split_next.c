@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_sv_split_next.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 23:38:10 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 23:38:10 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * The word end is found with ft_memchr, so long fields are scanned a
+ * vector at a time.
+ */
+int	ft_sv_split_next(t_strview *rest, char c, t_strview *tok)
+{
+	const char	*end;
+
+	while (rest->len && *rest->ptr == c)
+	{
+		rest->ptr++;
+		rest->len--;
+	}
+	if (!rest->len)
+		return (0);
+	end = ft_memchr(rest->ptr, c, rest->len);
+	if (!end)
+		end = rest->ptr + rest->len;
+	*tok = ft_sv_new(rest->ptr, (size_t)(end - rest->ptr));
+	rest->ptr = end;
+	rest->len -= tok->len;
+	return (1);
+}
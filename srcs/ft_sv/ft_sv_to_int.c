@@ -0,0 +1,42 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_sv_to_int.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 23:41:34 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 23:41:34 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * The value is built in a long and checked after every digit, so it can
+ * never pass INT_MAX + 1 (the magnitude of INT_MIN) unnoticed.
+ */
+int	ft_sv_to_int(t_strview sv, int *out)
+{
+	long	acc;
+	int		neg;
+	size_t	i;
+
+	neg = (sv.len && sv.ptr[0] == '-');
+	i = (sv.len && (sv.ptr[0] == '-' || sv.ptr[0] == '+'));
+	if (i == sv.len)
+		return (0);
+	acc = 0;
+	while (i < sv.len)
+	{
+		if (!ft_isdigit((unsigned char)sv.ptr[i]))
+			return (0);
+		acc = acc * 10 + (sv.ptr[i++] - '0');
+		if (acc > 2147483647L + neg)
+			return (0);
+	}
+	if (neg)
+		acc = -acc;
+	*out = (int)acc;
+	return (1);
+}
@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_sv_trim.c                                       :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 23:47:39 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 02:25:56 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+t_strview	ft_sv_trim(t_strview sv, const char *set)
+{
+	t_charset	bits;
+
+	if (!set)
+		return (sv);
+	bits = ft_charset_from(set);
+	while (sv.len && ft_charset_has(&bits, (unsigned char)*sv.ptr))
+	{
+		sv.ptr++;
+		sv.len--;
+	}
+	while (sv.len && ft_charset_has(&bits, (unsigned char)sv.ptr[sv.len - 1]))
+		sv.len--;
+	return (sv);
+}
@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/12/14 14:07:05 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/14 14:07:25 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:50:09 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,15 +17,20 @@
  *
  * Frees both the internal data buffer and the vector struct itself.
  * Safe to call with NULL. Does not free heap-allocated elements
- * stored within the vector (user responsibility).
+ * stored within the vector (user responsibility). Memory goes back
+ * through the vector's allocator (a no-op for arenas).
  *
  * @param vec Pointer to the vector to free (can be NULL).
  */
 void	ft_vec_free(t_vec *vec)
 {
+	t_allocator	alloc;
+
 	if (!vec)
 		return ;
-	if (vec->data)
-		free(vec->data);
-	free(vec);
+	alloc = vec->alloc;
+	ft_memstats_alloc(&alloc, "ft_vec_free",
+		sizeof(t_vec) + vec->cap * vec->elem_size, 0);
+	ft_allocator_free(&alloc, vec->data, vec->cap * vec->elem_size);
+	ft_allocator_free(&alloc, vec, sizeof(t_vec));
 }
@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/12/14 13:40:27 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/14 13:44:06 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:51:21 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,21 +23,63 @@
  * @return Pointer to newly allocated t_vec, or NULL on failure.
  */
 t_vec	*ft_vec_new(size_t elem_size, size_t init_cap)
+{
+	return (ft_vec_new_with_alloc(elem_size, init_cap, NULL));
+}
+
+/**
+ * @brief Create a new vector that allocates through alloc.
+ *
+ * The allocator is copied into the vector; the struct, the data buffer
+ * and every later regrowth go through it, and ft_vec_free hands them
+ * back to it.
+ *
+ * @param elem_size Size of each element in bytes (must be > 0).
+ * @param init_cap Initial capacity (0 for default of 8).
+ * @param alloc Allocator to use (NULL for the heap).
+ * @return Pointer to newly allocated t_vec, or NULL on failure.
+ */
+t_vec	*ft_vec_new_with_alloc(size_t elem_size, size_t init_cap,
+		const t_allocator *alloc)
 {
 	t_vec	*vec;
 
 	if (elem_size == 0)
 		return (NULL);
-	vec = ft_calloc(1, sizeof(t_vec));
+	vec = ft_allocator_calloc(alloc, 1, sizeof(t_vec));
 	if (!vec)
 		return (NULL);
+	if (alloc)
+		vec->alloc = *alloc;
 	if (init_cap == 0)
 		init_cap = 8;
-	vec->data = ft_calloc(init_cap, elem_size);
+	vec->data = ft_allocator_calloc(alloc, init_cap, elem_size);
 	if (!vec->data)
-		return (free(vec), NULL);
+		return (ft_allocator_free(alloc, vec, sizeof(t_vec)), NULL);
 	vec->elem_size = elem_size;
 	vec->cap = init_cap;
 	vec->len = 0;
+	ft_memstats_alloc(alloc, "ft_vec_new", 0,
+		sizeof(t_vec) + init_cap * elem_size);
 	return (vec);
 }
+
+/**
+ * @brief Create a vector that lives entirely in an arena.
+ *
+ * Shorthand for ft_vec_new_with_alloc with ft_allocator_arena(arena):
+ * ft_vec_free on it is a no-op and the memory is released with the
+ * arena.
+ *
+ * @param arena Arena to allocate from.
+ * @param elem_size Size of each element in bytes (must be > 0).
+ * @param init_cap Initial capacity (0 for default of 8).
+ * @return Pointer to arena-owned t_vec, or NULL on failure.
+ */
+t_vec	*ft_arena_vec_new(t_arena *arena, size_t elem_size, size_t init_cap)
+{
+	t_allocator	alloc;
+
+	alloc = ft_allocator_arena(arena);
+	return (ft_vec_new_with_alloc(elem_size, init_cap, &alloc));
+}
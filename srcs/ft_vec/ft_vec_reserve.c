@@ -6,7 +6,7 @@
 /*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
 /*                                              +#+#+#+#+#+      +#+          */
 /*   Created: 2025/12/14 14:30:00 by yiyuli           #+#      #+#            */
-/*   Updated: 2025/12/14 14:30:00 by yiyuli         ###      ########.fr      */
+/*   Updated: 2026/10/17 21:53:36 by yiyuli         ###      ########.fr      */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,7 +17,8 @@
  *
  * If new_cap is greater than current capacity, reallocates the
  * internal buffer. Existing elements are preserved. Does nothing
- * if new_cap <= current capacity.
+ * if new_cap <= current capacity. The buffer is resized through the
+ * vector's allocator and the new slots are zeroed.
  *
  * @param vec Pointer to the vector.
  * @param new_cap Minimum required capacity.
@@ -33,11 +34,14 @@ int	ft_vec_reserve(t_vec *vec, size_t new_cap)
 		return (1);
 	if (new_cap > SIZE_MAX / vec->elem_size)
 		return (0);
-	new_data = ft_calloc(new_cap, vec->elem_size);
+	new_data = ft_allocator_realloc(&vec->alloc, vec->data,
+			vec->cap * vec->elem_size, new_cap * vec->elem_size);
 	if (!new_data)
 		return (0);
-	ft_memcpy(new_data, vec->data, vec->len * vec->elem_size);
-	free(vec->data);
+	ft_memstats_alloc(&vec->alloc, "ft_vec_reserve",
+		vec->cap * vec->elem_size, new_cap * vec->elem_size);
+	ft_bzero((char *)new_data + vec->len * vec->elem_size,
+		(new_cap - vec->len) * vec->elem_size);
 	vec->data = new_data;
 	vec->cap = new_cap;
 	return (1);
@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   ft_vec_swap.c                                      :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 22:14:37 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 22:14:37 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Swap two elements of the vector in place.
+ *
+ * The elements are exchanged with ft_memswap, in registers, so even very
+ * large elements need no temporary buffer. Swapping an element with
+ * itself is a no-op.
+ *
+ * @param vec Pointer to the vector.
+ * @param i Zero-based index of the first element.
+ * @param j Zero-based index of the second element.
+ * @return 1 on success, 0 if out of bounds or NULL vec.
+ */
+int	ft_vec_swap(t_vec *vec, size_t i, size_t j)
+{
+	if (!vec || i >= vec->len || j >= vec->len)
+		return (0);
+	ft_memswap((char *)vec->data + i * vec->elem_size,
+		(char *)vec->data + j * vec->elem_size, vec->elem_size);
+	return (1);
+}
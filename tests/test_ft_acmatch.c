@@ -0,0 +1,256 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_acmatch.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 01:43:20 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 01:43:20 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(a) ASSERT((a) == NULL)
+
+/* ==================== Helpers ==================== */
+
+static t_acmatch *build(const char **pats, size_t n)
+{
+    t_acmatch *ac = ft_acmatch_new();
+    size_t i;
+
+    if (!ac)
+        return (NULL);
+    for (i = 0; i < n; i++)
+        if (!ft_acmatch_add(ac, pats[i], strlen(pats[i])))
+            return (ft_acmatch_free(ac), NULL);
+    if (!ft_acmatch_build(ac))
+        return (ft_acmatch_free(ac), NULL);
+    return (ac);
+}
+
+static int has_hit(t_vec *hits, size_t id, size_t offset)
+{
+    t_achit *h;
+    size_t i;
+
+    for (i = 0; i < hits->len; i++)
+    {
+        h = ft_vec_get(hits, i);
+        if (h->id == id && h->offset == offset)
+            return (1);
+    }
+    return (0);
+}
+
+/* ==================== Core tests ==================== */
+
+TEST(test_acmatch_classic_dictionary)
+{
+    const char *pats[] = {"he", "she", "his", "hers"};
+    t_acmatch *ac = build(pats, 4);
+    t_vec *hits = ft_vec_new(sizeof(t_achit), 4);
+    t_achit *h;
+
+    ASSERT(ac && hits);
+    ASSERT(ft_acmatch_all(ac, "ushers", 6, hits));
+    ASSERT_EQ(hits->len, 3);
+    h = ft_vec_get(hits, 0);
+    ASSERT(h->id == 1 && h->offset == 1);
+    h = ft_vec_get(hits, 1);
+    ASSERT(h->id == 0 && h->offset == 2);
+    h = ft_vec_get(hits, 2);
+    ASSERT(h->id == 3 && h->offset == 2);
+    ft_vec_free(hits);
+    ft_acmatch_free(ac);
+}
+
+TEST(test_acmatch_first)
+{
+    const char *pats[] = {"error", "warn", "fatal error", "err"};
+    t_acmatch *ac = build(pats, 4);
+    t_achit hit;
+
+    ASSERT(ac);
+    ASSERT(ft_acmatch_first(ac, "[warn] disk", 11, &hit));
+    ASSERT(hit.id == 1 && hit.offset == 1);
+    ASSERT(ft_acmatch_first(ac, "a fatal error", 13, &hit));
+    ASSERT(hit.id == 3 && hit.offset == 8);
+    ASSERT(!ft_acmatch_first(ac, "all good", 8, &hit));
+    ASSERT(!ft_acmatch_first(ac, "", 0, &hit));
+    ft_acmatch_free(ac);
+}
+
+TEST(test_acmatch_overlaps_and_duplicates)
+{
+    const char *pats[] = {"aa", "a", "aaa", "a"};
+    t_acmatch *ac = build(pats, 4);
+    t_vec *hits = ft_vec_new(sizeof(t_achit), 4);
+
+    ASSERT(ac && hits && ac->npatterns == 4);
+    ASSERT(ft_acmatch_all(ac, "aaa", 3, hits));
+    ASSERT_EQ(hits->len, 6);
+    ASSERT(has_hit(hits, 1, 0) && has_hit(hits, 1, 1) && has_hit(hits, 1, 2));
+    ASSERT(has_hit(hits, 0, 0) && has_hit(hits, 0, 1));
+    ASSERT(has_hit(hits, 2, 0));
+    ASSERT(!has_hit(hits, 3, 0));
+    ft_vec_free(hits);
+    ft_acmatch_free(ac);
+}
+
+TEST(test_acmatch_add_rules)
+{
+    t_acmatch *ac = ft_acmatch_new();
+    t_vec *hits = ft_vec_new(sizeof(t_achit), 4);
+
+    ASSERT(ac && hits);
+    ASSERT(!ft_acmatch_add(ac, "", 0));
+    ASSERT(!ft_acmatch_all(ac, "x", 1, hits));
+    ASSERT(ft_acmatch_add(ac, "a\0b", 3));
+    ASSERT(ft_acmatch_build(ac));
+    ASSERT(ft_acmatch_build(ac));
+    ASSERT(!ft_acmatch_add(ac, "late", 4));
+    ASSERT(ft_acmatch_all(ac, "xa\0b", 4, hits));
+    ASSERT(hits->len == 1 && has_hit(hits, 0, 1));
+    ft_vec_free(hits);
+    ft_acmatch_free(ac);
+    ac = ft_acmatch_new();
+    ASSERT(ac && ft_acmatch_build(ac));
+    ASSERT(!ft_acmatch_first(ac, "abc", 3, NULL));
+    ft_acmatch_free(ac);
+    ft_acmatch_free(NULL);
+}
+
+static size_t first_id(char pats[][8], size_t id)
+{
+    size_t k;
+
+    for (k = 0; k < id; k++)
+        if (strcmp(pats[k], pats[id]) == 0)
+            return (k);
+    return (id);
+}
+
+TEST(test_acmatch_matches_naive)
+{
+    static char pats[300][8];
+    const char *ptr[300];
+    char text[4000];
+    t_acmatch *ac;
+    t_vec *hits = ft_vec_new(sizeof(t_achit), 64);
+    t_achit *h;
+    size_t expect = 0;
+    size_t i;
+    size_t j;
+    size_t m;
+
+    srand(19);
+    for (i = 0; i < 300; i++)
+    {
+        m = 1 + (size_t)rand() % 7;
+        for (j = 0; j < m; j++)
+            pats[i][j] = (char)('a' + rand() % 3);
+        pats[i][m] = '\0';
+        ptr[i] = pats[i];
+    }
+    for (i = 0; i < sizeof(text); i++)
+        text[i] = (char)('a' + rand() % 3);
+    ac = build(ptr, 300);
+    ASSERT(ac && hits);
+    ASSERT(ft_acmatch_all(ac, text, sizeof(text), hits));
+    for (i = 0; i < 300; i++)
+    {
+        m = strlen(pats[i]);
+        for (j = 0; first_id(pats, i) == i && j + m <= sizeof(text); j++)
+            expect += (memcmp(text + j, pats[i], m) == 0);
+    }
+    ASSERT_EQ(hits->len, expect);
+    for (i = 0; i < hits->len; i++)
+    {
+        h = ft_vec_get(hits, i);
+        ASSERT(first_id(pats, h->id) == h->id);
+        ASSERT(memcmp(text + h->offset, pats[h->id], strlen(pats[h->id])) == 0);
+    }
+    ft_vec_free(hits);
+    ft_acmatch_free(ac);
+}
+
+TEST(test_acmatch_large_dictionary)
+{
+    static char pats[2000][16];
+    const char *ptr[2000];
+    char line[256];
+    t_acmatch *ac;
+    t_achit hit;
+    size_t i;
+
+    for (i = 0; i < 2000; i++)
+    {
+        snprintf(pats[i], sizeof(pats[i]), "key%zu=", i);
+        ptr[i] = pats[i];
+    }
+    ac = build(ptr, 2000);
+    ASSERT(ac);
+    snprintf(line, sizeof(line), "ts=1 level=info key1999=on");
+    ASSERT(ft_acmatch_first(ac, line, strlen(line), &hit));
+    ASSERT(hit.id == 1999 && hit.offset == 16);
+    snprintf(line, sizeof(line), "ts=1 key=value key20 = x");
+    ASSERT(!ft_acmatch_first(ac, line, strlen(line), &hit));
+    ft_acmatch_free(ac);
+}
+
+/* ==================== Test Runner ==================== */
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║      ft_acmatch Unit Test Suite      ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    printf("\n\033[1m=== Core tests ===\033[0m\n");
+    RUN_TEST(test_acmatch_classic_dictionary);
+    RUN_TEST(test_acmatch_first);
+    RUN_TEST(test_acmatch_overlaps_and_duplicates);
+    RUN_TEST(test_acmatch_add_rules);
+
+    printf("\n\033[1m=== Stress tests ===\033[0m\n");
+    RUN_TEST(test_acmatch_matches_naive);
+    RUN_TEST(test_acmatch_large_dictionary);
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
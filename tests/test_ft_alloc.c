@@ -0,0 +1,317 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_alloc.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:34:00 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 19:34:00 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(a) ASSERT((a) == NULL)
+
+/* ==================== Counting allocator ==================== */
+
+typedef struct s_counts
+{
+    size_t allocs;
+    size_t frees;
+    size_t reallocs;
+    long   live_bytes;
+}   t_counts;
+
+static void *count_alloc(void *ctx, size_t size)
+{
+    t_counts *c = ctx;
+
+    c->allocs++;
+    c->live_bytes += (long)size;
+    return (malloc(size));
+}
+
+static void *count_realloc(void *ctx, void *ptr, size_t old_size,
+                           size_t new_size)
+{
+    t_counts *c = ctx;
+    void *p = realloc(ptr, new_size);
+
+    c->reallocs++;
+    if (p)
+        c->live_bytes += (long)new_size - (long)old_size;
+    return (p);
+}
+
+static void count_free(void *ctx, void *ptr, size_t size)
+{
+    t_counts *c = ctx;
+
+    c->frees++;
+    c->live_bytes -= (long)size;
+    free(ptr);
+}
+
+static t_allocator counting(t_counts *c, int with_realloc)
+{
+    t_allocator a;
+
+    memset(c, 0, sizeof(*c));
+    a.alloc = count_alloc;
+    a.realloc = with_realloc ? count_realloc : NULL;
+    a.free = count_free;
+    a.ctx = c;
+    return (a);
+}
+
+/* ==================== Core tests ==================== */
+
+TEST(test_allocator_null_is_heap)
+{
+    t_allocator zero;
+    char *p;
+
+    memset(&zero, 0, sizeof(zero));
+    p = ft_allocator_alloc(NULL, 10);
+    ASSERT(p);
+    p = ft_allocator_realloc(&zero, p, 10, 100);
+    ASSERT(p);
+    ft_allocator_free(&zero, p, 100);
+    p = ft_allocator_calloc(NULL, 4, 4);
+    ASSERT(p && p[0] == 0 && p[15] == 0);
+    ft_allocator_free(NULL, p, 16);
+    ft_allocator_free(NULL, NULL, 0);
+    ASSERT_NULL(ft_allocator_calloc(&zero, SIZE_MAX / 2, 4));
+}
+
+TEST(test_allocator_heap_vtable)
+{
+    t_allocator h = ft_allocator_heap();
+    char *p;
+
+    ASSERT(h.alloc && h.realloc && h.free);
+    p = ft_allocator_alloc(&h, 8);
+    ASSERT(p);
+    memcpy(p, "abcdefg", 8);
+    p = ft_allocator_realloc(&h, p, 8, 4096);
+    ASSERT(p && strcmp(p, "abcdefg") == 0);
+    ft_allocator_free(&h, p, 4096);
+}
+
+TEST(test_allocator_realloc_fallback_copies)
+{
+    t_counts c;
+    t_allocator a = counting(&c, 0);
+    char *p;
+
+    p = ft_allocator_alloc(&a, 6);
+    memcpy(p, "hello", 6);
+    p = ft_allocator_realloc(&a, p, 6, 64);
+    ASSERT(p && strcmp(p, "hello") == 0);
+    ASSERT(c.allocs == 2 && c.frees == 1);
+    ft_allocator_free(&a, p, 64);
+    ASSERT_EQ(c.live_bytes, 0);
+}
+
+/* ==================== Container tests ==================== */
+
+TEST(test_vec_with_alloc_balanced)
+{
+    t_counts c;
+    t_allocator a = counting(&c, 1);
+    t_vec *v;
+    int i;
+
+    v = ft_vec_new_with_alloc(sizeof(int), 2, &a);
+    ASSERT(v && v->alloc.ctx == &c);
+    for (i = 0; i < 1000; i++)
+        ASSERT(ft_vec_push(v, &i));
+    ASSERT(ft_vec_insert(v, 0, &i));
+    ASSERT_EQ(*(int *)ft_vec_get(v, 0), 1000);
+    ASSERT_EQ(*(int *)ft_vec_get(v, 1000), 999);
+    ASSERT(c.reallocs > 0);
+    ft_vec_free(v);
+    ASSERT_EQ(c.live_bytes, 0);
+    ASSERT_EQ(c.allocs, c.frees);
+}
+
+TEST(test_deque_with_alloc_balanced)
+{
+    t_counts c;
+    t_allocator a = counting(&c, 1);
+    t_deque *d;
+    int i;
+    int out;
+
+    d = ft_deque_new_with_alloc(sizeof(int), 1, &a);
+    ASSERT(d);
+    for (i = 0; i < 500; i++)
+    {
+        ASSERT(ft_deque_push_back(d, &i));
+        ASSERT(ft_deque_push_front(d, &i));
+    }
+    ASSERT(ft_deque_pop_front(d, &out) && out == 499);
+    ASSERT(ft_deque_pop_back(d, &out) && out == 499);
+    ft_deque_free(d);
+    ASSERT_EQ(c.live_bytes, 0);
+    ASSERT_EQ(c.allocs, c.frees);
+}
+
+TEST(test_hashmap_with_alloc_balanced)
+{
+    t_counts c;
+    t_allocator a = counting(&c, 1);
+    t_hashmap *m;
+    char key[32];
+    int i;
+
+    m = ft_hashmap_new_with_alloc(2, NULL, &a);
+    ASSERT(m);
+    for (i = 0; i < 300; i++)
+    {
+        snprintf(key, sizeof(key), "key%d", i);
+        ASSERT(ft_hashmap_set(m, key, (void *)(intptr_t)(i + 1)));
+    }
+    ASSERT_EQ(m->size, 300);
+    ft_hashmap_clear(m);
+    ASSERT(ft_hashmap_set(m, "again", (void *)1));
+    ft_hashmap_free(m);
+    ASSERT_EQ(c.live_bytes, 0);
+    ASSERT_EQ(c.allocs, c.frees);
+}
+
+TEST(test_default_constructors_unchanged)
+{
+    t_vec *v = ft_vec_new(sizeof(int), 0);
+    t_deque *d = ft_deque_new(sizeof(int), 0);
+    t_hashmap *m = ft_hashmap_new(0, NULL);
+
+    ASSERT(v && d && m);
+    ASSERT(v->alloc.alloc == NULL && v->alloc.free == NULL);
+    ASSERT(d->alloc.alloc == NULL && m->alloc.alloc == NULL);
+    ASSERT_EQ(v->cap, 8);
+    ASSERT_EQ(d->cap, 8);
+    ASSERT_EQ(m->cap, 16);
+    ft_vec_free(v);
+    ft_deque_free(d);
+    ft_hashmap_free(m);
+}
+
+/* ==================== Arena / pool allocators ==================== */
+
+TEST(test_arena_allocator_grows_in_place)
+{
+    t_arena *ar = ft_arena_new(4096);
+    t_allocator a = ft_allocator_arena(ar);
+    char *p;
+    char *q;
+
+    ASSERT(ar);
+    p = ft_allocator_alloc(&a, 16);
+    memcpy(p, "arena", 6);
+    q = ft_allocator_realloc(&a, p, 16, 256);
+    ASSERT(q == p);
+    ft_allocator_alloc(&a, 8);
+    q = ft_allocator_realloc(&a, p, 256, 512);
+    ASSERT(q && q != p && strcmp(q, "arena") == 0);
+    ft_allocator_free(&a, q, 512);
+    ft_arena_free(ar);
+}
+
+TEST(test_arena_allocator_deque)
+{
+    t_arena *ar = ft_arena_new(0);
+    t_allocator a = ft_allocator_arena(ar);
+    t_deque *d;
+    int i;
+
+    ASSERT(ar);
+    d = ft_deque_new_with_alloc(sizeof(int), 0, &a);
+    ASSERT(d);
+    for (i = 0; i < 100; i++)
+        ASSERT(ft_deque_push_back(d, &i));
+    ASSERT_EQ(*(int *)ft_deque_back(d), 99);
+    ft_deque_free(d);
+    ft_arena_free(ar);
+}
+
+TEST(test_pool_allocator_bounded)
+{
+    t_pool *p = ft_pool_new(64);
+    t_allocator a = ft_allocator_pool(p);
+    t_vec *v;
+    int i;
+
+    ASSERT(p);
+    ASSERT_NULL(ft_allocator_alloc(&a, 65));
+    v = ft_vec_new_with_alloc(sizeof(int), 16, &a);
+    ASSERT(v);
+    for (i = 0; i < 16; i++)
+        ASSERT(ft_vec_push(v, &i));
+    ASSERT(!ft_vec_push(v, &i));
+    ASSERT_EQ(v->len, 16);
+    ft_vec_free(v);
+    ft_pool_free(p);
+}
+
+/* ==================== Test Runner ==================== */
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║    ft_allocator Unit Test Suite      ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    printf("\n\033[1m=== Core tests ===\033[0m\n");
+    RUN_TEST(test_allocator_null_is_heap);
+    RUN_TEST(test_allocator_heap_vtable);
+    RUN_TEST(test_allocator_realloc_fallback_copies);
+
+    printf("\n\033[1m=== Container tests ===\033[0m\n");
+    RUN_TEST(test_vec_with_alloc_balanced);
+    RUN_TEST(test_deque_with_alloc_balanced);
+    RUN_TEST(test_hashmap_with_alloc_balanced);
+    RUN_TEST(test_default_constructors_unchanged);
+
+    printf("\n\033[1m=== Arena / pool allocators ===\033[0m\n");
+    RUN_TEST(test_arena_allocator_grows_in_place);
+    RUN_TEST(test_arena_allocator_deque);
+    RUN_TEST(test_pool_allocator_bounded);
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
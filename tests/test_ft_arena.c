@@ -0,0 +1,293 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_arena.c                                    :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 16:01:16 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 16:01:16 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(a) ASSERT((a) == NULL)
+
+/* ==================== Core tests ==================== */
+
+TEST(test_arena_alloc_aligned_and_distinct)
+{
+    t_arena *a = ft_arena_new(256);
+    unsigned char *p[64];
+    size_t i;
+
+    ASSERT(a);
+    for (i = 0; i < 64; i++)
+    {
+        p[i] = ft_arena_alloc(a, i + 1);
+        ASSERT(p[i]);
+        ASSERT_EQ((uintptr_t)p[i] % 16, 0);
+        memset(p[i], (int)i, i + 1);
+    }
+    for (i = 0; i < 64; i++)
+        ASSERT(p[i][i] == (unsigned char)i && p[i][0] == (unsigned char)i);
+    ft_arena_free(a);
+}
+
+TEST(test_arena_oversized_allocation)
+{
+    t_arena *a = ft_arena_new(64);
+    char *small;
+    char *big;
+
+    ASSERT(a);
+    small = ft_arena_alloc(a, 8);
+    big = ft_arena_alloc(a, 10000);
+    ASSERT(small && big);
+    memset(big, 'b', 10000);
+    ASSERT_EQ(big[9999], 'b');
+    ASSERT_NULL(ft_arena_alloc(a, SIZE_MAX - 8));
+    ASSERT_NULL(ft_arena_calloc(a, SIZE_MAX / 2, 4));
+    ft_arena_free(a);
+}
+
+TEST(test_arena_calloc_zeroed)
+{
+    t_arena *a = ft_arena_new(0);
+    unsigned char *p;
+    size_t i;
+
+    ASSERT(a);
+    p = ft_arena_alloc(a, 100);
+    memset(p, 0xCC, 100);
+    ft_arena_reset(a);
+    p = ft_arena_calloc(a, 25, 4);
+    ASSERT(p);
+    for (i = 0; i < 100; i++)
+        ASSERT_EQ(p[i], 0);
+    ft_arena_free(a);
+}
+
+TEST(test_arena_mark_rewind)
+{
+    t_arena *a = ft_arena_new(128);
+    t_arena_mark m;
+    void *before;
+    void *after;
+    int i;
+
+    ASSERT(a);
+    ft_arena_alloc(a, 40);
+    m = ft_arena_mark(a);
+    before = ft_arena_alloc(a, 16);
+    for (i = 0; i < 50; i++)
+        ASSERT(ft_arena_alloc(a, 100));
+    ft_arena_rewind(a, m);
+    after = ft_arena_alloc(a, 16);
+    ASSERT(before == after);
+    ft_arena_free(a);
+}
+
+TEST(test_arena_mark_on_empty_arena)
+{
+    t_arena *a = ft_arena_new(64);
+    t_arena_mark m;
+
+    ASSERT(a);
+    m = ft_arena_mark(a);
+    ASSERT(ft_arena_alloc(a, 500));
+    ASSERT(ft_arena_alloc(a, 10));
+    ft_arena_rewind(a, m);
+    ASSERT_NULL(a->head);
+    ASSERT(ft_arena_alloc(a, 10));
+    ft_arena_free(a);
+}
+
+TEST(test_arena_reset_reuses_first_block)
+{
+    t_arena *a = ft_arena_new(1024);
+    void *first;
+    int i;
+
+    ASSERT(a);
+    first = ft_arena_alloc(a, 32);
+    for (i = 0; i < 100; i++)
+        ft_arena_alloc(a, 200);
+    ft_arena_reset(a);
+    ASSERT(ft_arena_alloc(a, 32) == first);
+    ft_arena_reset(NULL);
+    ft_arena_free(a);
+    ft_arena_free(NULL);
+}
+
+/* ==================== String tests ==================== */
+
+TEST(test_arena_strdup_substr)
+{
+    t_arena *a = ft_arena_new(0);
+    char *s;
+
+    ASSERT(a);
+    s = ft_arena_strdup(a, "hello world");
+    ASSERT(s && strcmp(s, "hello world") == 0);
+    s = ft_arena_substr(a, "hello world", 6, 100);
+    ASSERT(s && strcmp(s, "world") == 0);
+    s = ft_arena_substr(a, "hello", 10, 3);
+    ASSERT(s && s[0] == '\0');
+    s = ft_arena_substr(a, "hello", 1, 3);
+    ASSERT(s && strcmp(s, "ell") == 0);
+    ASSERT_NULL(ft_arena_strdup(a, NULL));
+    ft_arena_free(a);
+}
+
+TEST(test_arena_split)
+{
+    t_arena *a = ft_arena_new(64);
+    char **w;
+
+    ASSERT(a);
+    w = ft_arena_split(a, "  GET /index.html  HTTP/1.1 ", ' ');
+    ASSERT(w);
+    ASSERT(strcmp(w[0], "GET") == 0);
+    ASSERT(strcmp(w[1], "/index.html") == 0);
+    ASSERT(strcmp(w[2], "HTTP/1.1") == 0);
+    ASSERT_NULL(w[3]);
+    w = ft_arena_split(a, "", ',');
+    ASSERT(w && w[0] == NULL);
+    w = ft_arena_split(a, ",,,", ',');
+    ASSERT(w && w[0] == NULL);
+    ft_arena_free(a);
+}
+
+/* ==================== Container tests ==================== */
+
+TEST(test_arena_vec_grows_in_arena)
+{
+    t_arena *a = ft_arena_new(256);
+    t_vec *v;
+    int i;
+    int *x;
+
+    ASSERT(a);
+    v = ft_arena_vec_new(a, sizeof(int), 2);
+    ASSERT(v && v->alloc.ctx == a);
+    for (i = 0; i < 1000; i++)
+        ASSERT(ft_vec_push(v, &i));
+    for (i = 0; i < 1000; i++)
+    {
+        x = ft_vec_get(v, i);
+        ASSERT(x && *x == i);
+    }
+    ft_vec_free(v);
+    ft_arena_free(a);
+}
+
+TEST(test_arena_hashmap_set_and_grow)
+{
+    t_arena *a = ft_arena_new(0);
+    t_hashmap *m;
+    char key[32];
+    int i;
+
+    ASSERT(a);
+    m = ft_arena_hashmap_new(a, 4, NULL);
+    ASSERT(m && m->alloc.ctx == a);
+    for (i = 0; i < 500; i++)
+    {
+        snprintf(key, sizeof(key), "key-%d", i);
+        ASSERT(ft_hashmap_set(m, key, (void *)(intptr_t)(i + 1)));
+    }
+    ASSERT(ft_hashmap_set(m, "key-7", (void *)1));
+    ASSERT_EQ(m->size, 500);
+    ASSERT(m->cap > 4);
+    ft_hashmap_free(m);
+    ft_arena_free(a);
+}
+
+TEST(test_arena_request_loop)
+{
+    t_arena *a = ft_arena_new(4096);
+    int round;
+    char **w;
+    char **first;
+    t_vec *v;
+
+    ASSERT(a);
+    first = NULL;
+    for (round = 0; round < 200; round++)
+    {
+        w = ft_arena_split(a, "a b c d e f g", ' ');
+        v = ft_arena_vec_new(a, sizeof(char *), 0);
+        ASSERT(w && v);
+        if (!first)
+            first = w;
+        ASSERT(w == first);
+        while (*w)
+            ASSERT(ft_vec_push(v, w++));
+        ASSERT_EQ(v->len, 7);
+        ft_arena_reset(a);
+    }
+    ft_arena_free(a);
+}
+
+/* ==================== Test Runner ==================== */
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║      ft_arena Unit Test Suite        ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    printf("\n\033[1m=== Core tests ===\033[0m\n");
+    RUN_TEST(test_arena_alloc_aligned_and_distinct);
+    RUN_TEST(test_arena_oversized_allocation);
+    RUN_TEST(test_arena_calloc_zeroed);
+    RUN_TEST(test_arena_mark_rewind);
+    RUN_TEST(test_arena_mark_on_empty_arena);
+    RUN_TEST(test_arena_reset_reuses_first_block);
+
+    printf("\n\033[1m=== String tests ===\033[0m\n");
+    RUN_TEST(test_arena_strdup_substr);
+    RUN_TEST(test_arena_split);
+
+    printf("\n\033[1m=== Container tests ===\033[0m\n");
+    RUN_TEST(test_arena_vec_grows_in_arena);
+    RUN_TEST(test_arena_hashmap_set_and_grow);
+    RUN_TEST(test_arena_request_loop);
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
@@ -0,0 +1,777 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_conv.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 03:09:00 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 03:58:07 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <float.h>
+#include <math.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+
+/* ==================== Helpers ==================== */
+
+static const char *g_inputs[] = {
+    "0", "42", "  -42", "+7", "\t\n\v\f\r 13x", "-", "+", "", "abc",
+    "0x1f", "0X1Fg", "0x", "0xg", "017", "08", "-0", "z", "Zz",
+    "1010", "123456789", "12345678901234567", "-12345678", "  +99999999",
+    "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+    "-9223372036854775809", "18446744073709551615", "18446744073709551616",
+    "99999999999999999999999999", "-99999999999999999999999999",
+    "000000000000000000000000001", "1234567a", "12345678a", "  - 5",
+};
+
+static unsigned long g_rand = 88172645463325252UL;
+
+static unsigned long next_rand(void)
+{
+    g_rand ^= g_rand << 13;
+    g_rand ^= g_rand >> 7;
+    g_rand ^= g_rand << 17;
+    return (g_rand);
+}
+
+/* ==================== ft_strto* tests ==================== */
+
+TEST(test_strtol_matches_libc)
+{
+    static const int bases[] = {0, 2, 8, 10, 16, 36};
+    char *end;
+    char *lend;
+    long long v;
+    unsigned long long u;
+    size_t i;
+    size_t b;
+    int err;
+
+    for (i = 0; i < sizeof(g_inputs) / sizeof(*g_inputs); i++)
+    {
+        for (b = 0; b < sizeof(bases) / sizeof(*bases); b++)
+        {
+            errno = 0;
+            v = ft_strtoll(g_inputs[i], &end, bases[b], &err);
+            ASSERT_EQ(v, strtoll(g_inputs[i], &lend, bases[b]));
+            ASSERT_EQ(end, lend);
+            ASSERT_EQ(err == FT_CONV_RANGE, errno == ERANGE);
+            ASSERT_EQ(err == FT_CONV_EMPTY, end == g_inputs[i]);
+            errno = 0;
+            u = ft_strtoull(g_inputs[i], &end, bases[b], &err);
+            ASSERT_EQ(u, strtoull(g_inputs[i], &lend, bases[b]));
+            ASSERT_EQ(end, lend);
+            ASSERT_EQ(err == FT_CONV_RANGE, errno == ERANGE);
+            ASSERT_EQ(ft_strtol(g_inputs[i], NULL, bases[b], NULL),
+                strtol(g_inputs[i], NULL, bases[b]));
+        }
+    }
+}
+
+TEST(test_strtol_edges)
+{
+    char *end;
+    int err;
+
+    ASSERT_EQ(ft_strtoll("-9223372036854775808", &end, 10, &err), LLONG_MIN);
+    ASSERT_EQ(err, FT_CONV_OK);
+    ASSERT_EQ(ft_strtoll("1e9", &end, 10, &err), 1);
+    ASSERT_EQ(*end, 'e');
+    ASSERT_EQ(ft_strtoull("ffffffffffffffff", NULL, 16, &err), ULLONG_MAX);
+    ASSERT_EQ(err, FT_CONV_OK);
+    ASSERT_EQ(ft_strtoull("1ffffffffffffffff", NULL, 16, &err), ULLONG_MAX);
+    ASSERT_EQ(err, FT_CONV_RANGE);
+    ASSERT_EQ(ft_strtol("12", &end, 1, &err), 0);
+    ASSERT_EQ(err, FT_CONV_EMPTY);
+    ASSERT_EQ(ft_strtol("12", &end, 37, &err), 0);
+    ASSERT_EQ(err, FT_CONV_EMPTY);
+    ASSERT_EQ(ft_strtol("  -", &end, 10, NULL), 0);
+    ASSERT_EQ(ft_atoi("  -2147483648"), INT_MIN);
+    ASSERT_EQ(ft_atoi("+2147483647z"), INT_MAX);
+    ASSERT_EQ(ft_atoi("--1"), 0);
+}
+
+TEST(test_strtoll_random_offsets)
+{
+    char buf[64];
+    long long want;
+    char *end;
+    int off;
+    int i;
+
+    for (i = 0; i < 20000; i++)
+    {
+        off = (int)(next_rand() % 16);
+        want = (long long)next_rand() >> (next_rand() % 63);
+        if (next_rand() & 1)
+            want = -want;
+        snprintf(buf + off, sizeof(buf) - off, "%lld;", want);
+        ASSERT_EQ(ft_strtoll(buf + off, &end, 10, NULL), want);
+        ASSERT_EQ(*end, ';');
+    }
+}
+
+TEST(test_strtol_page_boundary)
+{
+    long page;
+    char *map;
+    char *s;
+    int len;
+
+    page = sysconf(_SC_PAGESIZE);
+    map = mmap(NULL, page * 2, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT(map != MAP_FAILED);
+    ASSERT_EQ(mprotect(map + page, page, PROT_NONE), 0);
+    for (len = 1; len <= 20; len++)
+    {
+        s = map + page - len - 1;
+        memset(s, '9', len);
+        s[len] = '\0';
+        s[0] = '1';
+        ASSERT_EQ(ft_strtoull(s, NULL, 10, NULL), strtoull(s, NULL, 10));
+    }
+    munmap(map, page * 2);
+}
+
+/* ==================== ft_parse_ints tests ==================== */
+
+TEST(test_parse_ints_basic)
+{
+    const char *text = "  1 -2\t+3\n4000000000\r\n-9223372036854775808 ";
+    t_vec *v;
+    int64_t *d;
+
+    v = ft_vec_new(sizeof(int64_t), 0);
+    ASSERT(v != NULL);
+    ASSERT_EQ(ft_parse_ints(text, strlen(text), v), 1);
+    ASSERT_EQ(v->len, 5);
+    d = v->data;
+    ASSERT(d[0] == 1 && d[1] == -2 && d[2] == 3);
+    ASSERT(d[3] == 4000000000LL && d[4] == INT64_MIN);
+    ft_vec_clear(v);
+    ASSERT_EQ(ft_parse_ints("", 0, v), 1);
+    ASSERT_EQ(ft_parse_ints(" \n ", 3, v), 1);
+    ASSERT_EQ(v->len, 0);
+    ASSERT_EQ(ft_parse_ints("1 2x 3", 6, v), 0);
+    ASSERT_EQ(v->len, 1);
+    ASSERT_EQ(ft_parse_ints("9223372036854775808", 19, v), 0);
+    ASSERT_EQ(ft_parse_ints("1 - 2", 5, v), 0);
+    ft_vec_free(v);
+    v = ft_vec_new(sizeof(int), 0);
+    ASSERT_EQ(ft_parse_ints("1", 1, v), 0);
+    ft_vec_free(v);
+}
+
+TEST(test_parse_ints_unterminated)
+{
+    const char *text = "12345678 1234567890123456789";
+    t_vec *v;
+
+    v = ft_vec_new(sizeof(int64_t), 0);
+    ASSERT_EQ(ft_parse_ints(text, 4, v), 1);
+    ASSERT_EQ(((int64_t *)v->data)[0], 1234);
+    ft_vec_clear(v);
+    ASSERT_EQ(ft_parse_ints(text, 20, v), 1);
+    ASSERT_EQ(((int64_t *)v->data)[0], 12345678);
+    ASSERT_EQ(((int64_t *)v->data)[1], 12345678901LL);
+    ft_vec_free(v);
+}
+
+TEST(test_parse_ints_large)
+{
+    char *text;
+    int64_t *want;
+    t_vec *v;
+    size_t pos;
+    int i;
+
+    text = malloc(100000 * 22);
+    want = malloc(100000 * sizeof(int64_t));
+    ASSERT(text && want);
+    pos = 0;
+    for (i = 0; i < 100000; i++)
+    {
+        want[i] = (int64_t)next_rand() >> (next_rand() % 63);
+        pos += sprintf(text + pos, "%lld%c", (long long)want[i],
+            " \n\t"[i % 3]);
+    }
+    v = ft_vec_new(sizeof(int64_t), 0);
+    ASSERT_EQ(ft_parse_ints(text, pos, v), 1);
+    ASSERT_EQ(v->len, 100000);
+    ASSERT(memcmp(v->data, want, 100000 * sizeof(int64_t)) == 0);
+    ft_vec_free(v);
+    free(text);
+    free(want);
+}
+
+/* ==================== Integer formatting tests ==================== */
+
+TEST(test_itoa_buf_edges)
+{
+    static const int64_t vals[] = {0, 1, -1, 9, 10, 99, 100, -100, 12345,
+        INT_MAX, INT_MIN, 1000000000, 999999999, INT64_MAX, INT64_MIN,
+        10000000000000000LL, 9999999999999999LL};
+    char buf[FT_I64TOA_BUFSZ];
+    char want[32];
+    size_t i;
+    size_t len;
+
+    for (i = 0; i < sizeof(vals) / sizeof(*vals); i++)
+    {
+        len = ft_i64toa_buf(vals[i], buf);
+        snprintf(want, sizeof(want), "%lld", (long long)vals[i]);
+        ASSERT_EQ(len, strlen(want));
+        ASSERT(strcmp(buf, want) == 0);
+    }
+    ASSERT_EQ(ft_u64toa_buf(UINT64_MAX, buf), 20);
+    ASSERT(strcmp(buf, "18446744073709551615") == 0);
+    ASSERT_EQ(ft_itoa_buf(INT_MIN, buf), 11);
+    ASSERT(strcmp(buf, "-2147483648") == 0);
+    ASSERT_EQ(ft_utoa_buf(UINT_MAX, buf), 10);
+    ASSERT(strcmp(buf, "4294967295") == 0);
+}
+
+TEST(test_itoa_buf_powers_and_random)
+{
+    char buf[FT_I64TOA_BUFSZ];
+    char want[32];
+    uint64_t p;
+    uint64_t n;
+    int i;
+
+    for (p = 1; p && p <= UINT64_MAX / 10; p *= 10)
+    {
+        ft_u64toa_buf(p - 1, buf);
+        snprintf(want, sizeof(want), "%llu", (unsigned long long)(p - 1));
+        ASSERT(strcmp(buf, want) == 0);
+        ft_u64toa_buf(p, buf);
+        snprintf(want, sizeof(want), "%llu", (unsigned long long)p);
+        ASSERT(strcmp(buf, want) == 0);
+    }
+    for (i = 0; i < 100000; i++)
+    {
+        n = next_rand() >> (next_rand() % 64);
+        ASSERT_EQ(ft_u64toa_buf(n, buf),
+            (size_t)snprintf(want, sizeof(want), "%llu", (unsigned long long)n));
+        ASSERT(strcmp(buf, want) == 0);
+    }
+}
+
+TEST(test_u64toa_base_buf)
+{
+    char buf[FT_U64TOA_BASE_BUFSZ];
+    char want[80];
+    uint64_t n;
+    int i;
+
+    ASSERT_EQ(ft_u64toa_base_buf(0, "01", buf), 1);
+    ASSERT(strcmp(buf, "0") == 0);
+    ASSERT_EQ(ft_u64toa_base_buf(UINT64_MAX, "01", buf), 64);
+    ASSERT_EQ(ft_u64toa_base_buf(255, "0123456789ABCDEF", buf), 2);
+    ASSERT(strcmp(buf, "FF") == 0);
+    ASSERT_EQ(ft_u64toa_base_buf(8, "01234567", buf), 2);
+    ASSERT(strcmp(buf, "10") == 0);
+    ASSERT_EQ(ft_u64toa_base_buf(35, "0123456789abcdefghijklmnopqrstuvwxyz",
+        buf), 1);
+    ASSERT(strcmp(buf, "z") == 0);
+    ASSERT_EQ(ft_u64toa_base_buf(5, "ab", buf), 3);
+    ASSERT(strcmp(buf, "bab") == 0);
+    ASSERT_EQ(ft_u64toa_base_buf(42, "x", buf), 0);
+    ASSERT(buf[0] == '\0');
+    for (i = 0; i < 10000; i++)
+    {
+        n = next_rand() >> (next_rand() % 64);
+        ft_u64toa_base_buf(n, "0123456789abcdef", buf);
+        snprintf(want, sizeof(want), "%llx", (unsigned long long)n);
+        ASSERT(strcmp(buf, want) == 0);
+        ft_u64toa_base_buf(n, "01234567", buf);
+        snprintf(want, sizeof(want), "%llo", (unsigned long long)n);
+        ASSERT(strcmp(buf, want) == 0);
+        ft_u64toa_base_buf(n, "0123456789", buf);
+        snprintf(want, sizeof(want), "%llu", (unsigned long long)n);
+        ASSERT(strcmp(buf, want) == 0);
+    }
+}
+
+TEST(test_itoa_and_putnbr)
+{
+    char *s;
+    char out[64];
+    int fds[2];
+    ssize_t n;
+
+    s = ft_itoa(INT_MIN);
+    ASSERT(s && strcmp(s, "-2147483648") == 0);
+    free(s);
+    s = ft_itoa(0);
+    ASSERT(s && strcmp(s, "0") == 0);
+    free(s);
+    ASSERT_EQ(pipe(fds), 0);
+    ft_putnbr_fd(-42, fds[1]);
+    ft_putnbr_fd(INT_MAX, fds[1]);
+    close(fds[1]);
+    n = read(fds[0], out, sizeof(out) - 1);
+    close(fds[0]);
+    ASSERT(n > 0);
+    out[n] = '\0';
+    ASSERT(strcmp(out, "-422147483647") == 0);
+}
+
+TEST(test_printf_numbers)
+{
+    char out[256];
+    int fds[2];
+    int saved;
+    int ret;
+    ssize_t n;
+
+    fflush(stdout);
+    saved = dup(1);
+    ASSERT_EQ(pipe(fds), 0);
+    dup2(fds[1], 1);
+    ret = ft_printf("%d|%i|%u|%x|%X|%p|%p", INT_MIN, 0, UINT_MAX, 0xbeefu,
+        0xbeefu, (void *)0x1234, NULL);
+    dup2(saved, 1);
+    close(saved);
+    close(fds[1]);
+    n = read(fds[0], out, sizeof(out) - 1);
+    close(fds[0]);
+    ASSERT(n > 0);
+    out[n] = '\0';
+    ASSERT(strcmp(out, "-2147483648|0|4294967295|beef|BEEF|0x1234|(nil)") == 0);
+    ASSERT_EQ(ret, (int)n);
+}
+
+static double bits_to_double(unsigned long bits)
+{
+    double x;
+
+    memcpy(&x, &bits, sizeof(x));
+    return (x);
+}
+
+/* Random finite double: raw bit patterns or coordinate-like values */
+static double next_double(void)
+{
+    unsigned long r;
+    double x;
+
+    r = next_rand();
+    if (r & 1)
+        x = bits_to_double(next_rand());
+    else
+        x = (double)(long)(r >> 24) / (double)(1L << (r % 40));
+    if (x != x || x - x != x - x)
+        x = 0.5;
+    return (x);
+}
+
+static int check_dtoa(double x, int prec)
+{
+    static char got[FT_DTOA_BUFSZ + 128];
+    static char want[FT_DTOA_BUFSZ + 128];
+    size_t n;
+
+    n = ft_dtoa_fixed(x, prec, got);
+    snprintf(want, sizeof(want), "%.*f", prec, x);
+    if (strcmp(got, want) != 0 || n != strlen(want))
+        return (printf("\n    %%.%df: %s vs %s ", prec, got, want), 0);
+    n = ft_dtoa_exp(x, prec, got);
+    snprintf(want, sizeof(want), "%.*e", prec, x);
+    if (strcmp(got, want) != 0 || n != strlen(want))
+        return (printf("\n    %%.%de: %s vs %s ", prec, got, want), 0);
+    n = ft_dtoa_general(x, prec, got);
+    snprintf(want, sizeof(want), "%.*g", prec, x);
+    if (strcmp(got, want) != 0 || n != strlen(want))
+        return (printf("\n    %%.%dg: %s vs %s ", prec, got, want), 0);
+    return (1);
+}
+
+TEST(test_dtoa_edges_match_libc)
+{
+    const double values[] = {
+        0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.05, 0.1, 0.3, 9.5, 99.95,
+        4.35, 1e-5, 1e-4, 123456.5, 1e15, 1e16, 1e17, 1e22, 1e23, 1e-300,
+        5e-324, -5e-324, DBL_MIN, 2.2250738585072009e-308, DBL_MAX,
+        -DBL_MAX, 9007199254740993.0, 0.1 + 0.2, 999999.5, 0.000095
+    };
+    int prec;
+    size_t i;
+
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        for (prec = 0; prec <= 40; prec++)
+            ASSERT(check_dtoa(values[i], prec));
+        ASSERT(check_dtoa(values[i], 100));
+    }
+}
+
+TEST(test_dtoa_random_match_libc)
+{
+    int i;
+
+    for (i = 0; i < 100000; i++)
+        ASSERT(check_dtoa(next_double(), (int)(next_rand() % 24)));
+}
+
+TEST(test_dtoa_defaults_and_specials)
+{
+    char buf[FT_DTOA_BUFSZ];
+
+    ASSERT_EQ(ft_dtoa_fixed(3.14159265, -1, buf), 8u);
+    ASSERT(strcmp(buf, "3.141593") == 0);
+    ft_dtoa_exp(-1234.5, -1, buf);
+    ASSERT(strcmp(buf, "-1.234500e+03") == 0);
+    ft_dtoa_general(1234567.0, -1, buf);
+    ASSERT(strcmp(buf, "1.23457e+06") == 0);
+    ft_dtoa_general(0.5, 0, buf);
+    ASSERT(strcmp(buf, "0.5") == 0);
+    ASSERT_EQ(ft_dtoa_fixed(__builtin_inf(), 2, buf), 3u);
+    ASSERT(strcmp(buf, "inf") == 0);
+    ft_dtoa_exp(-__builtin_inf(), 2, buf);
+    ASSERT(strcmp(buf, "-inf") == 0);
+    ft_dtoa_shortest(__builtin_nan(""), buf);
+    ASSERT(strcmp(buf, "nan") == 0);
+}
+
+TEST(test_dtoa_wide_output)
+{
+    static char got[FT_DTOA_BUFSZ + 1200];
+    static char want[FT_DTOA_BUFSZ + 1200];
+
+    ft_dtoa_fixed(5e-324, 1100, got);
+    snprintf(want, sizeof(want), "%.1100f", 5e-324);
+    ASSERT(strcmp(got, want) == 0);
+    ft_dtoa_fixed(DBL_MAX, 20, got);
+    snprintf(want, sizeof(want), "%.20f", DBL_MAX);
+    ASSERT(strcmp(got, want) == 0);
+    ft_dtoa_exp(DBL_MIN, 800, got);
+    snprintf(want, sizeof(want), "%.800e", DBL_MIN);
+    ASSERT(strcmp(got, want) == 0);
+    ft_dtoa_general(1.0 / 3.0, 700, got);
+    snprintf(want, sizeof(want), "%.700g", 1.0 / 3.0);
+    ASSERT(strcmp(got, want) == 0);
+}
+
+TEST(test_dtoa_shortest_known)
+{
+    const double values[] = {0.1, 5e-324, 1e23, -0.0, DBL_MAX, 100.0,
+        1e16, 1e17, 1e-5, 0.0001, 0.3, 2.0 / 3.0, 123.456, 0.0};
+    const char *want[] = {"0.1", "5e-324", "1e+23", "-0",
+        "1.7976931348623157e+308", "100", "10000000000000000", "1e+17",
+        "1e-05", "0.0001", "0.3", "0.6666666666666666", "123.456", "0"};
+    char buf[FT_DTOA_BUFSZ];
+    size_t i;
+
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        ASSERT_EQ(ft_dtoa_shortest(values[i], buf), strlen(want[i]));
+        ASSERT(strcmp(buf, want[i]) == 0);
+    }
+}
+
+TEST(test_dtoa_shortest_roundtrip)
+{
+    char buf[FT_DTOA_BUFSZ];
+    char ref[64];
+    double x;
+    double back;
+    int i;
+
+    for (i = 0; i < 200000; i++)
+    {
+        x = next_double();
+        if (i < 1000)
+            x = bits_to_double((unsigned long)i * 4503599627370496UL
+                    + (next_rand() & 3));
+        ASSERT_EQ(ft_dtoa_shortest(x, buf), strlen(buf));
+        back = strtod(buf, NULL);
+        ASSERT(memcmp(&back, &x, sizeof(x)) == 0);
+        snprintf(ref, sizeof(ref), "%.17g", x);
+        ASSERT(strlen(buf) <= strlen(ref));
+    }
+}
+
+TEST(test_printf_doubles)
+{
+    char out[512];
+    char want[512];
+    int fds[2];
+    int saved;
+    int ret;
+    ssize_t n;
+
+    fflush(stdout);
+    saved = dup(1);
+    ASSERT_EQ(pipe(fds), 0);
+    dup2(fds[1], 1);
+    ret = ft_printf("(%.1f, %.1f, %.1f) %f %.0f %e %.2e %g %.10g %.f|%.",
+        1.25, -0.05, 3.0, 3.14159265, 2.5, 6.02214076e23, -1e-7, 1e-5,
+        2.0 / 3.0, 0.5);
+    dup2(saved, 1);
+    close(saved);
+    close(fds[1]);
+    n = read(fds[0], out, sizeof(out) - 1);
+    close(fds[0]);
+    ASSERT(n > 0);
+    out[n] = '\0';
+    snprintf(want, sizeof(want),
+        "(%.1f, %.1f, %.1f) %f %.0f %e %.2e %g %.10g %.f|",
+        1.25, -0.05, 3.0, 3.14159265, 2.5, 6.02214076e23, -1e-7, 1e-5,
+        2.0 / 3.0, 0.5);
+    ASSERT(strcmp(out, want) == 0);
+    ASSERT_EQ(ret, (int)n);
+}
+
+TEST(test_printf_huge_precision)
+{
+    static char out[2 * FT_PRINTF_PREC_MAX + 64];
+    static char want[2 * FT_PRINTF_PREC_MAX + 64];
+    int fds[2];
+    int saved;
+    int ret;
+    ssize_t n;
+    ssize_t got;
+
+    fflush(stdout);
+    saved = dup(1);
+    ASSERT_EQ(pipe(fds), 0);
+    dup2(fds[1], 1);
+    ret = ft_printf("%.99999999999f|%.2147483648e", 1.5, 0.25);
+    dup2(saved, 1);
+    close(saved);
+    close(fds[1]);
+    n = 0;
+    while ((got = read(fds[0], out + n, sizeof(out) - 1 - n)) > 0)
+        n += got;
+    close(fds[0]);
+    out[n] = '\0';
+    snprintf(want, sizeof(want), "%.*f|%.*e", FT_PRINTF_PREC_MAX, 1.5,
+        FT_PRINTF_PREC_MAX, 0.25);
+    ASSERT(strcmp(out, want) == 0);
+    ASSERT_EQ(ret, (int)n);
+}
+
+/* ==================== Double parsing tests ==================== */
+
+static int check_strtod(const char *s)
+{
+    char *got_end;
+    char *want_end;
+    double got;
+    double want;
+
+    got = ft_strtod(s, &got_end, NULL);
+    want = strtod(s, &want_end);
+    if (got_end != want_end || (memcmp(&got, &want, sizeof(got)) != 0
+            && !(got != got && want != want)))
+        return (printf("\n    \"%.60s\": %a vs %a ", s, got, want), 0);
+    return (1);
+}
+
+TEST(test_strtod_edges_match_libc)
+{
+    const char *inputs[] = {
+        "0", "-0", "1", "  +3.25e2x", ".5", "5.", "-.5e-3", "1e", "1e+",
+        "1E-5", "00000000000000000000001.5", "123456789012345678901234567890",
+        "1e23", "8.98846567431158e307", "9007199254740993",
+        "9007199254740992.5", "7.2057594037927933e16",
+        "4.9406564584124654e-324", "2.4703282292062327e-324",
+        "2.4703282292062328e-324", "2.2250738585072011e-308",
+        "2.2250738585072012e-308", "1.7976931348623157e308",
+        "1.7976931348623158e308", "1.7976931348623159e308", "1e-400",
+        "1e400", "-1e400", "1e-2147483649", "1e2147483648", "3.0e-324",
+        "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124",
+        "1.00000000000000011102230246251565404236316680908203126",
+        "0.000000000000000000000000000000000000000000000000000001e40",
+        "inf", "-Infinity", "INFx", "nan", "-NaN(abc_1)", "nan(", "nan(a b)"
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+        ASSERT(check_strtod(inputs[i]));
+}
+
+TEST(test_strtod_random_match_libc)
+{
+    char buf[128];
+    double x;
+    int i;
+
+    for (i = 0; i < 200000; i++)
+    {
+        x = next_double();
+        if (i % 3 == 0)
+            snprintf(buf, sizeof(buf), "%.17g", x);
+        else if (i % 3 == 1)
+            snprintf(buf, sizeof(buf), "%.*g", (int)(next_rand() % 17) + 1, x);
+        else
+            snprintf(buf, sizeof(buf), "%.*e", (int)(next_rand() % 40) + 17,
+                x);
+        ASSERT(check_strtod(buf));
+        ASSERT(ft_strtod(buf, NULL, NULL) == strtod(buf, NULL));
+    }
+}
+
+/* Midpoints between neighbouring doubles, spelled out to 780+ digits */
+TEST(test_strtod_long_halfway)
+{
+    char buf[1200];
+    char *e;
+    double lo;
+    long double mid;
+    int i;
+
+    for (i = 0; i < 2000; i++)
+    {
+        lo = fabs(next_double());
+        if (lo == DBL_MAX)
+            continue ;
+        mid = (long double)lo + (long double)(nextafter(lo, INFINITY) - lo) / 2;
+        snprintf(buf, sizeof(buf), "%.790Le", mid);
+        ASSERT(check_strtod(buf));
+        e = strchr(buf, 'e');
+        memmove(e + 30, e, strlen(e) + 1);
+        memset(e, '0', 29);
+        e[29] = '1';
+        ASSERT(check_strtod(buf));
+    }
+}
+
+TEST(test_strtod_end_and_err)
+{
+    const char *s;
+    char *end;
+    int err;
+    double x;
+
+    s = " \t-.e5";
+    x = ft_strtod(s, &end, &err);
+    ASSERT(x == 0.0 && !signbit(x) && end == s && err == FT_CONV_EMPTY);
+    s = "e5";
+    ASSERT(ft_strtod(s, &end, &err) == 0.0 && end == s);
+    ASSERT_EQ(err, FT_CONV_EMPTY);
+    s = "12.5e+x";
+    ASSERT(ft_strtod(s, &end, &err) == 12.5 && end == s + 4);
+    ASSERT_EQ(err, FT_CONV_OK);
+    ASSERT(ft_strtod("-1e309", NULL, &err) == -INFINITY);
+    ASSERT_EQ(err, FT_CONV_RANGE);
+    ASSERT(ft_strtod("1e-330", NULL, &err) == 0.0);
+    ASSERT_EQ(err, FT_CONV_OK);
+    ASSERT(ft_strtod("infinity", NULL, &err) == INFINITY);
+    ASSERT_EQ(err, FT_CONV_OK);
+    ASSERT(ft_atof("  -2.5abc") == -2.5);
+    ASSERT(ft_atof("abc") == 0.0);
+    ASSERT(ft_atof("0.1") == 0.1);
+}
+
+TEST(test_parse_vec3)
+{
+    const char *s;
+    char *end;
+    t_vec3 v;
+
+    s = "1.5,-2,3e2 rest";
+    ASSERT_EQ(ft_parse_vec3(s, &end, &v), 1);
+    ASSERT(v.x == 1.5 && v.y == -2.0 && v.z == 300.0);
+    ASSERT(end == s + 10);
+    s = " 0.1 , 0.2\t,0.3";
+    ASSERT_EQ(ft_parse_vec3(s, &end, &v), 1);
+    ASSERT(v.x == 0.1 && v.y == 0.2 && v.z == 0.3 && *end == '\0');
+    v.x = 7.0;
+    s = "1,2";
+    ASSERT_EQ(ft_parse_vec3(s, &end, &v), 0);
+    ASSERT(end == s && v.x == 7.0);
+    ASSERT_EQ(ft_parse_vec3("1,,3", NULL, &v), 0);
+    ASSERT_EQ(ft_parse_vec3("1;2;3", NULL, &v), 0);
+    ASSERT_EQ(ft_parse_vec3("1,2,1e999", NULL, &v), 0);
+    ASSERT(v.x == 7.0);
+}
+
+/* ==================== Test Runner ==================== */
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║        ft_conv Unit Test Suite       ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    printf("\n\033[1m=== ft_strto* tests ===\033[0m\n");
+    RUN_TEST(test_strtol_matches_libc);
+    RUN_TEST(test_strtol_edges);
+    RUN_TEST(test_strtoll_random_offsets);
+    RUN_TEST(test_strtol_page_boundary);
+
+    printf("\n\033[1m=== ft_parse_ints tests ===\033[0m\n");
+    RUN_TEST(test_parse_ints_basic);
+    RUN_TEST(test_parse_ints_unterminated);
+    RUN_TEST(test_parse_ints_large);
+
+    printf("\n\033[1m=== Integer formatting tests ===\033[0m\n");
+    RUN_TEST(test_itoa_buf_edges);
+    RUN_TEST(test_itoa_buf_powers_and_random);
+    RUN_TEST(test_u64toa_base_buf);
+    RUN_TEST(test_itoa_and_putnbr);
+    RUN_TEST(test_printf_numbers);
+
+    printf("\n\033[1m=== Double formatting tests ===\033[0m\n");
+    RUN_TEST(test_dtoa_edges_match_libc);
+    RUN_TEST(test_dtoa_random_match_libc);
+    RUN_TEST(test_dtoa_defaults_and_specials);
+    RUN_TEST(test_dtoa_wide_output);
+    RUN_TEST(test_dtoa_shortest_known);
+    RUN_TEST(test_dtoa_shortest_roundtrip);
+    RUN_TEST(test_printf_doubles);
+    RUN_TEST(test_printf_huge_precision);
+
+    printf("\n\033[1m=== Double parsing tests ===\033[0m\n");
+    RUN_TEST(test_strtod_edges_match_libc);
+    RUN_TEST(test_strtod_random_match_libc);
+    RUN_TEST(test_strtod_long_halfway);
+    RUN_TEST(test_strtod_end_and_err);
+    RUN_TEST(test_parse_vec3);
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
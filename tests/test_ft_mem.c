@@ -0,0 +1,754 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_mem.c                                      :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 10:40:00 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 16:01:16 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(a) ASSERT((a) == NULL)
+
+/* ==================== Helpers ==================== */
+
+#define BUF_SIZE 1024
+#define GUARD 0xA5
+
+static void fill_pattern(unsigned char *buf, size_t n, unsigned seed)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        buf[i] = (unsigned char)(i * 131 + seed * 7 + 1);
+}
+
+/* ==================== ft_memcpy tests ==================== */
+
+TEST(test_memcpy_all_sizes_and_offsets)
+{
+    unsigned char src[BUF_SIZE];
+    unsigned char dst[BUF_SIZE];
+    unsigned char ref[BUF_SIZE];
+    size_t so, d_off, n;
+
+    fill_pattern(src, BUF_SIZE, 3);
+    for (so = 0; so < 32; so++)
+        for (d_off = 0; d_off < 32; d_off++)
+            for (n = 0; n < 600; n += (n < 80 ? 1 : 37))
+            {
+                memset(dst, GUARD, BUF_SIZE);
+                memset(ref, GUARD, BUF_SIZE);
+                memcpy(ref + d_off, src + so, n);
+                ASSERT(ft_memcpy(dst + d_off, src + so, n) == dst + d_off);
+                ASSERT(memcmp(dst, ref, BUF_SIZE) == 0);
+            }
+}
+
+TEST(test_memcpy_large_buffer)
+{
+    size_t         n = (1 << 20) + 13;
+    unsigned char  *src = malloc(n);
+    unsigned char  *dst = malloc(n + 1);
+
+    ASSERT(src && dst);
+    fill_pattern(src, n, 9);
+    dst[n] = GUARD;
+    ft_memcpy(dst, src, n);
+    ASSERT(memcmp(dst, src, n) == 0);
+    ASSERT_EQ(dst[n], GUARD);
+    free(src);
+    free(dst);
+}
+
+TEST(test_memcpy_zero_length)
+{
+    char dst[4] = "abc";
+
+    ASSERT(ft_memcpy(dst, "xyz", 0) == dst);
+    ASSERT(strcmp(dst, "abc") == 0);
+}
+
+TEST(test_memcpy_both_null)
+{
+    ASSERT_NULL(ft_memcpy(NULL, NULL, 5));
+}
+
+/* ==================== ft_memmove tests ==================== */
+
+TEST(test_memmove_overlap_both_directions)
+{
+    unsigned char buf[BUF_SIZE];
+    unsigned char ref[BUF_SIZE];
+    size_t n;
+    int shift;
+    size_t base;
+
+    for (n = 0; n < 400; n += (n < 100 ? 1 : 23))
+        for (shift = -70; shift <= 70; shift++)
+            for (base = 100; base < 132; base += 5)
+            {
+                fill_pattern(buf, BUF_SIZE, (unsigned)n);
+                memcpy(ref, buf, BUF_SIZE);
+                memmove(ref + base + shift, ref + base, n);
+                ASSERT(ft_memmove(buf + base + shift, buf + base, n)
+                    == buf + base + shift);
+                ASSERT(memcmp(buf, ref, BUF_SIZE) == 0);
+            }
+}
+
+TEST(test_memmove_front_insert_shift)
+{
+    size_t n = 1 << 20;
+    unsigned char *buf = malloc(n + 8);
+    unsigned char *ref = malloc(n + 8);
+
+    ASSERT(buf && ref);
+    fill_pattern(buf, n + 8, 5);
+    memcpy(ref, buf, n + 8);
+    memmove(ref + 8, ref, n);
+    ft_memmove(buf + 8, buf, n);
+    ASSERT(memcmp(buf, ref, n + 8) == 0);
+    memmove(ref + 3, ref + 11, n - 11);
+    ft_memmove(buf + 3, buf + 11, n - 11);
+    ASSERT(memcmp(buf, ref, n + 8) == 0);
+    free(buf);
+    free(ref);
+}
+
+TEST(test_memmove_disjoint_and_same)
+{
+    char a[32] = "0123456789abcdefghijklmnopqrstu";
+    char b[32] = {0};
+
+    ASSERT(ft_memmove(b, a, 32) == b);
+    ASSERT(memcmp(a, b, 32) == 0);
+    ASSERT(ft_memmove(a, a, 32) == a);
+    ASSERT(memcmp(a, b, 32) == 0);
+}
+
+TEST(test_memmove_both_null)
+{
+    ASSERT_NULL(ft_memmove(NULL, NULL, 5));
+    ASSERT_NULL(ft_memmove(NULL, NULL, 0));
+}
+
+/* ==================== ft_memset / ft_bzero tests ==================== */
+
+TEST(test_memset_all_sizes_and_offsets)
+{
+    unsigned char buf[BUF_SIZE];
+    unsigned char ref[BUF_SIZE];
+    size_t off, n;
+
+    for (off = 0; off < 32; off++)
+        for (n = 0; n < 600; n += (n < 80 ? 1 : 41))
+        {
+            memset(buf, GUARD, BUF_SIZE);
+            memset(ref, GUARD, BUF_SIZE);
+            memset(ref + off, 0x3C, n);
+            ASSERT(ft_memset(buf + off, 0x3C, n) == buf + off);
+            ASSERT(memcmp(buf, ref, BUF_SIZE) == 0);
+        }
+}
+
+TEST(test_memset_value_truncated_to_byte)
+{
+    unsigned char buf[40];
+    size_t i;
+
+    ft_memset(buf, 0x1FF, sizeof(buf));
+    for (i = 0; i < sizeof(buf); i++)
+        ASSERT_EQ(buf[i], 0xFF);
+}
+
+TEST(test_memset_huge_streaming_fill)
+{
+    size_t n = (8 << 20) + 7;
+    unsigned char *buf = malloc(n + 2);
+    size_t i;
+
+    ASSERT(buf);
+    buf[0] = GUARD;
+    buf[n + 1] = GUARD;
+    ft_memset(buf + 1, 0x77, n);
+    ASSERT_EQ(buf[0], GUARD);
+    ASSERT_EQ(buf[n + 1], GUARD);
+    for (i = 1; i <= n; i++)
+        ASSERT_EQ(buf[i], 0x77);
+    ft_bzero(buf + 1, n);
+    for (i = 1; i <= n; i++)
+        ASSERT_EQ(buf[i], 0);
+    free(buf);
+}
+
+/* ==================== ft_memchr / ft_memcmp tests ==================== */
+
+TEST(test_memchr_all_positions)
+{
+    unsigned char buf[300];
+    size_t n;
+    size_t pos;
+
+    memset(buf, 'a', sizeof(buf));
+    for (n = 0; n <= 260; n += 13)
+    {
+        ASSERT_NULL(ft_memchr(buf, 'z', n));
+        for (pos = 0; pos < n; pos += 7)
+        {
+            buf[pos] = 'z';
+            ASSERT(ft_memchr(buf, 'z', n) == buf + pos);
+            ASSERT(ft_memchr(buf, 'z' + 256, n) == buf + pos);
+            buf[pos] = 'a';
+        }
+    }
+}
+
+TEST(test_memcmp_sign_and_length)
+{
+    unsigned char a[200];
+    unsigned char b[200];
+    size_t i;
+
+    fill_pattern(a, sizeof(a), 3);
+    memcpy(b, a, sizeof(b));
+    ASSERT_EQ(ft_memcmp(a, b, sizeof(a)), 0);
+    ASSERT_EQ(ft_memcmp(a, b, 0), 0);
+    for (i = 0; i < sizeof(a); i += 11)
+    {
+        b[i] = (unsigned char)(a[i] + 1);
+        ASSERT(ft_memcmp(a, b, sizeof(a)) < 0);
+        ASSERT(ft_memcmp(b, a, sizeof(a)) > 0);
+        ASSERT_EQ(ft_memcmp(a, b, i), 0);
+        b[i] = a[i];
+    }
+    a[5] = 0x80;
+    b[5] = 0x7f;
+    ASSERT(ft_memcmp(a, b, 6) > 0);
+}
+
+TEST(test_memchr_matches_libc_offsets)
+{
+    unsigned char buf[512];
+    size_t off;
+    size_t n;
+    int c;
+
+    fill_pattern(buf, sizeof(buf), 9);
+    for (off = 0; off < 64; off += 3)
+        for (n = 0; off + n <= sizeof(buf); n += 17)
+            for (c = 0; c < 256; c += 37)
+                ASSERT(ft_memchr(buf + off, c, n) == memchr(buf + off, c, n));
+}
+
+TEST(test_memcmp_matches_libc_offsets)
+{
+    unsigned char a[300];
+    unsigned char b[300];
+    size_t n;
+    size_t pos;
+    int r;
+    int e;
+
+    fill_pattern(a, sizeof(a), 1);
+    for (n = 1; n < 200; n += 5)
+        for (pos = 0; pos < n; pos += 3)
+        {
+            memcpy(b + 7, a + 3, n);
+            b[7 + pos] ^= 0x81;
+            r = ft_memcmp(a + 3, b + 7, n);
+            e = memcmp(a + 3, b + 7, n);
+            ASSERT((r < 0) == (e < 0) && (r > 0) == (e > 0));
+            ASSERT_EQ(ft_memcmp(a + 3, b + 7, pos), 0);
+        }
+}
+
+TEST(test_memchr_memcmp_page_boundary)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    unsigned char *map;
+    unsigned char *end;
+    size_t n;
+
+    map = mmap(NULL, page * 2, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT(map != MAP_FAILED);
+    ASSERT_EQ(mprotect(map + page, page, PROT_NONE), 0);
+    end = map + page;
+    memset(map, 'q', page);
+    for (n = 0; n <= 100; n++)
+    {
+        ASSERT_NULL(ft_memchr(end - n, 'z', n));
+        ASSERT_EQ(ft_memcmp(end - n, map, n), 0);
+        if (n > 0)
+        {
+            end[-1] = 'z';
+            ASSERT(ft_memchr(end - n, 'z', n) == end - 1);
+            ASSERT(ft_memcmp(end - n, map, n) > 0);
+            end[-1] = 'q';
+        }
+    }
+    munmap(map, page * 2);
+}
+
+/* ==================== ft_memswap tests ==================== */
+
+TEST(test_memswap_all_sizes_and_offsets)
+{
+    unsigned char a[316];
+    unsigned char b[316];
+    unsigned char ea[sizeof(a)];
+    unsigned char eb[sizeof(b)];
+    size_t n;
+    size_t off;
+
+    for (off = 0; off < 8; off++)
+        for (n = 0; n <= 300; n++)
+        {
+            fill_pattern(a, sizeof(a), 1);
+            fill_pattern(b, sizeof(b), 2);
+            memcpy(ea, a, sizeof(a));
+            memcpy(eb, b, sizeof(b));
+            memcpy(ea + off, b + 3, n);
+            memcpy(eb + 3, a + off, n);
+            ft_memswap(a + off, b + 3, n);
+            ASSERT_EQ(memcmp(a, ea, sizeof(a)), 0);
+            ASSERT_EQ(memcmp(b, eb, sizeof(b)), 0);
+        }
+}
+
+TEST(test_memswap_large_and_self)
+{
+    size_t n = (1 << 20) + 13;
+    unsigned char *a = malloc(n);
+    unsigned char *b = malloc(n);
+    size_t i;
+
+    ASSERT(a && b);
+    fill_pattern(a, n, 4);
+    fill_pattern(b, n, 5);
+    ft_memswap(a, b, n);
+    ft_memswap(a, a, n);
+    for (i = 0; i < n; i += 997)
+    {
+        ASSERT_EQ(a[i], (unsigned char)(i * 131 + 5 * 7 + 1));
+        ASSERT_EQ(b[i], (unsigned char)(i * 131 + 4 * 7 + 1));
+    }
+    ASSERT_EQ(a[n - 1], (unsigned char)((n - 1) * 131 + 5 * 7 + 1));
+    free(a);
+    free(b);
+}
+
+/* ==================== ft_memrchr / ft_memmem tests ==================== */
+
+static const unsigned char *naive_memmem(const unsigned char *h, size_t n,
+                                         const unsigned char *nd, size_t m,
+                                         int last)
+{
+    const unsigned char *found = NULL;
+    size_t j;
+
+    if (m > n)
+        return (NULL);
+    for (j = 0; j + m <= n; j++)
+        if (memcmp(h + j, nd, m) == 0)
+        {
+            found = h + j;
+            if (!last)
+                return (found);
+        }
+    return (found);
+}
+
+TEST(test_memrchr_all_positions)
+{
+    unsigned char buf[300];
+    size_t off;
+    size_t n;
+    size_t pos;
+
+    memset(buf, 'a', sizeof(buf));
+    for (off = 0; off < 8; off++)
+        for (n = 0; off + n <= sizeof(buf); n += 13)
+        {
+            ASSERT_NULL(ft_memrchr(buf + off, 'z', n));
+            for (pos = 0; pos < n; pos += 5)
+            {
+                buf[off + pos] = 'z';
+                buf[off] = 'z';
+                ASSERT(ft_memrchr(buf + off, 'z', n) == buf + off + pos);
+                ASSERT(ft_memrchr(buf + off, 'z' + 256, n)
+                       == buf + off + pos);
+                buf[off + pos] = 'a';
+                buf[off] = 'a';
+            }
+        }
+}
+
+TEST(test_memmem_edge_cases)
+{
+    const char *h = "hello, world";
+
+    ASSERT(ft_memmem(h, 12, "", 0) == h);
+    ASSERT(ft_memmem_r(h, 12, "", 0) == h + 12);
+    ASSERT_NULL(ft_memmem(h, 3, "hello", 5));
+    ASSERT_NULL(ft_memmem_r(h, 3, "hello", 5));
+    ASSERT(ft_memmem(h, 12, "o", 1) == h + 4);
+    ASSERT(ft_memmem_r(h, 12, "o", 1) == h + 8);
+    ASSERT(ft_memmem(h, 12, h, 12) == h);
+    ASSERT(ft_memmem_r(h, 12, h, 12) == h);
+    ASSERT(ft_memmem(h, 12, "world", 5) == h + 7);
+    ASSERT_NULL(ft_memmem(h, 12, "worlds", 6));
+    ASSERT(ft_memmem("a\0b\0c", 5, "\0c", 2) != NULL);
+}
+
+TEST(test_memmem_matches_naive)
+{
+    unsigned char h[400];
+    unsigned char nd[24];
+    unsigned seed = 12345;
+    size_t i;
+    size_t m;
+    int round;
+    int alpha;
+
+    for (round = 0; round < 3000; round++)
+    {
+        alpha = 2 + round % 3;
+        for (i = 0; i < sizeof(h); i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            h[i] = (unsigned char)('a' + (seed >> 16) % alpha);
+        }
+        m = 2 + round % 22;
+        seed = seed * 1103515245 + 12345;
+        i = (seed >> 16) % (sizeof(h) - m);
+        memcpy(nd, h + i, m);
+        if (round % 4 == 0)
+            nd[m / 2] = 'a' + (nd[m / 2] - 'a' + 1) % alpha;
+        ASSERT(ft_memmem(h, sizeof(h), nd, m)
+               == naive_memmem(h, sizeof(h), nd, m, 0));
+        ASSERT(ft_memmem_r(h, sizeof(h), nd, m)
+               == naive_memmem(h, sizeof(h), nd, m, 1));
+    }
+}
+
+TEST(test_memmem_periodic_worst_case)
+{
+    size_t n = 1 << 20;
+    unsigned char *h = malloc(n);
+    unsigned char nd[1000];
+
+    ASSERT(h);
+    memset(h, 'a', n);
+    memset(nd, 'a', sizeof(nd));
+    nd[sizeof(nd) - 1] = 'b';
+    ASSERT_NULL(ft_memmem(h, n, nd, sizeof(nd)));
+    h[n - 1] = 'b';
+    ASSERT(ft_memmem(h, n, nd, sizeof(nd)) == h + n - sizeof(nd));
+    nd[sizeof(nd) - 1] = 'a';
+    nd[0] = 'b';
+    ASSERT_NULL(ft_memmem_r(h, n - 1, nd, sizeof(nd)));
+    h[0] = 'b';
+    ASSERT(ft_memmem_r(h, n - 1, nd, sizeof(nd)) == h);
+    ASSERT(ft_memmem(h, n, "ab", 2) == h + n - 2);
+    ASSERT(ft_memmem_r(h, n, "ba", 2) == h);
+    free(h);
+}
+
+TEST(test_memrchr_memmem_page_boundary)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    unsigned char *map;
+    unsigned char *end;
+    size_t n;
+
+    map = mmap(NULL, page * 3, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT(map != MAP_FAILED);
+    ASSERT_EQ(mprotect(map, page, PROT_NONE), 0);
+    ASSERT_EQ(mprotect(map + page * 2, page, PROT_NONE), 0);
+    end = map + page * 2;
+    memset(map + page, 'q', page);
+    for (n = 0; n <= 100; n++)
+    {
+        ASSERT_NULL(ft_memrchr(map + page, 'z', n));
+        ASSERT_NULL(ft_memmem(end - n, n, "qz", 2));
+        ASSERT_NULL(ft_memmem_r(map + page, n, "zq", 2));
+        ASSERT(n < 3 || ft_memmem_r(end - n, n, "qqq", 3) == end - 3);
+    }
+    munmap(map, page * 3);
+}
+
+/* ==================== ft_strlen / ft_strchr / ft_strrchr tests ==================== */
+
+TEST(test_strlen_strchr_basic)
+{
+    char buf[200];
+    size_t n;
+
+    for (n = 0; n < sizeof(buf) - 1; n += 9)
+    {
+        memset(buf, 'x', n);
+        buf[n] = '\0';
+        ASSERT_EQ(ft_strlen(buf), n);
+        ASSERT(ft_strchr(buf, '\0') == buf + n);
+        ASSERT_NULL(ft_strchr(buf, 'y'));
+        if (n > 0)
+        {
+            buf[n / 2] = 'y';
+            ASSERT(ft_strchr(buf, 'y') == buf + n / 2);
+        }
+    }
+}
+
+TEST(test_str_scans_all_offsets)
+{
+    char buf[320];
+    size_t off;
+    size_t n;
+    size_t k;
+
+    for (off = 0; off < 64; off++)
+    {
+        for (n = 0; n < 200; n += 7)
+        {
+            memset(buf, 'x', sizeof(buf));
+            buf[off + n] = '\0';
+            buf[off + n + 1] = 'y';
+            ASSERT_EQ(ft_strlen(buf + off), n);
+            ASSERT_NULL(ft_strchr(buf + off, 'y'));
+            ASSERT_NULL(ft_strrchr(buf + off, 'y'));
+            ASSERT(ft_strrchr(buf + off, '\0') == buf + off + n);
+            if (off > 0)
+                buf[off - 1] = 'y';
+            ASSERT_NULL(ft_strrchr(buf + off, 'y'));
+            for (k = 0; n > 0 && k < n; k += 5)
+            {
+                buf[off + k] = (char)0xE9;
+                ASSERT(ft_strrchr(buf + off, 0xE9) == buf + off + k);
+                ASSERT(ft_strchr(buf + off, 0xE9) == buf + off);
+            }
+        }
+    }
+}
+
+TEST(test_strrchr_matches_libc)
+{
+    char buf[300];
+    size_t i;
+    int c;
+
+    srand(13);
+    for (i = 0; i < sizeof(buf) - 1; i++)
+        buf[i] = (char)('a' + rand() % 4);
+    buf[sizeof(buf) - 1] = '\0';
+    for (i = 0; i < 120; i++)
+    {
+        for (c = 'a'; c <= 'e'; c++)
+        {
+            ASSERT(ft_strrchr(buf + i, c) == strrchr(buf + i, c));
+            ASSERT(ft_strchr(buf + i, c) == strchr(buf + i, c));
+        }
+    }
+}
+
+TEST(test_str_scans_page_boundary)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    char *map;
+    char *end;
+    size_t n;
+
+    map = mmap(NULL, page * 3, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT(map != MAP_FAILED);
+    ASSERT_EQ(mprotect(map, page, PROT_NONE), 0);
+    ASSERT_EQ(mprotect(map + page * 2, page, PROT_NONE), 0);
+    end = map + page * 2;
+    memset(map + page, 'q', page);
+    end[-1] = '\0';
+    for (n = 1; n <= 200; n++)
+    {
+        ASSERT_EQ(ft_strlen(end - n), n - 1);
+        ASSERT_NULL(ft_strchr(end - n, 'z'));
+        ASSERT(ft_strchr(end - n, '\0') == end - 1);
+        ASSERT(ft_strrchr(end - n, 'q') == (n > 1 ? end - 2 : NULL));
+        ASSERT_NULL(ft_strrchr(end - n, 'z'));
+    }
+    ASSERT(ft_strrchr(map + page, 'q') == end - 2);
+    munmap(map, page * 3);
+}
+
+/* ==================== ft_calloc tests ==================== */
+
+TEST(test_calloc_small_and_large_zeroed)
+{
+    size_t sizes[] = {1, 63, 4096, 131071, 131072, 1 << 20, 64 << 20};
+    size_t k;
+    size_t i;
+    unsigned char *p;
+
+    for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+    {
+        p = malloc(sizes[k]);
+        ASSERT(p);
+        memset(p, 0xEE, sizes[k]);
+        free(p);
+        p = ft_calloc(sizes[k], 1);
+        ASSERT(p);
+        for (i = 0; i < sizes[k]; i += 509)
+            ASSERT_EQ(p[i], 0);
+        ASSERT_EQ(p[sizes[k] - 1], 0);
+        free(p);
+    }
+}
+
+TEST(test_calloc_overflow_and_zero)
+{
+    void *p;
+
+    ASSERT_NULL(ft_calloc(SIZE_MAX / 2, 3));
+    p = ft_calloc(0, 8);
+    free(p);
+    p = ft_calloc(1 << 16, 8);
+    ASSERT(p);
+    free(p);
+}
+
+/* ==================== CPU dispatch tests ==================== */
+
+TEST(test_simd_force_levels)
+{
+    t_simd top = ft_simd_detect();
+
+    ASSERT(top >= FT_SIMD_SCALAR && top <= FT_SIMD_AVX512);
+    ASSERT_EQ(ft_simd_force(FT_SIMD_SCALAR), 1);
+    ASSERT_EQ(ft_simd_level(), FT_SIMD_SCALAR);
+    ASSERT_EQ(ft_simd_force(top), 1);
+    ASSERT_EQ(ft_simd_level(), top);
+    if (top < FT_SIMD_AVX512)
+    {
+        ASSERT_EQ(ft_simd_force((t_simd)(top + 1)), 0);
+        ASSERT_EQ(ft_simd_level(), top);
+    }
+}
+
+/* ==================== Test Runner ==================== */
+
+static void run_all_tests(void)
+{
+    printf("\n\033[1m=== ft_memcpy tests ===\033[0m\n");
+    RUN_TEST(test_memcpy_all_sizes_and_offsets);
+    RUN_TEST(test_memcpy_large_buffer);
+    RUN_TEST(test_memcpy_zero_length);
+    RUN_TEST(test_memcpy_both_null);
+
+    printf("\n\033[1m=== ft_memmove tests ===\033[0m\n");
+    RUN_TEST(test_memmove_overlap_both_directions);
+    RUN_TEST(test_memmove_front_insert_shift);
+    RUN_TEST(test_memmove_disjoint_and_same);
+    RUN_TEST(test_memmove_both_null);
+
+    printf("\n\033[1m=== ft_memset / ft_bzero tests ===\033[0m\n");
+    RUN_TEST(test_memset_all_sizes_and_offsets);
+    RUN_TEST(test_memset_value_truncated_to_byte);
+    RUN_TEST(test_memset_huge_streaming_fill);
+
+    printf("\n\033[1m=== ft_memchr / ft_memcmp tests ===\033[0m\n");
+    RUN_TEST(test_memchr_all_positions);
+    RUN_TEST(test_memcmp_sign_and_length);
+    RUN_TEST(test_memchr_matches_libc_offsets);
+    RUN_TEST(test_memcmp_matches_libc_offsets);
+    RUN_TEST(test_memchr_memcmp_page_boundary);
+
+    printf("\n\033[1m=== ft_memswap tests ===\033[0m\n");
+    RUN_TEST(test_memswap_all_sizes_and_offsets);
+    RUN_TEST(test_memswap_large_and_self);
+
+    printf("\n\033[1m=== ft_memrchr / ft_memmem tests ===\033[0m\n");
+    RUN_TEST(test_memrchr_all_positions);
+    RUN_TEST(test_memmem_edge_cases);
+    RUN_TEST(test_memmem_matches_naive);
+    RUN_TEST(test_memmem_periodic_worst_case);
+    RUN_TEST(test_memrchr_memmem_page_boundary);
+
+    printf("\n\033[1m=== ft_strlen / ft_strchr / ft_strrchr tests ===\033[0m\n");
+    RUN_TEST(test_strlen_strchr_basic);
+    RUN_TEST(test_str_scans_all_offsets);
+    RUN_TEST(test_strrchr_matches_libc);
+    RUN_TEST(test_str_scans_page_boundary);
+
+    printf("\n\033[1m=== ft_calloc tests ===\033[0m\n");
+    RUN_TEST(test_calloc_small_and_large_zeroed);
+    RUN_TEST(test_calloc_overflow_and_zero);
+}
+
+static const char *simd_name(t_simd level)
+{
+    static const char *names[] = {"scalar", "sse2", "sse4.2", "avx2",
+        "avx512"};
+
+    return (names[level]);
+}
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║       ft_mem Unit Test Suite         ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    t_simd top;
+    int level;
+
+    printf("\n\033[1m=== CPU dispatch tests ===\033[0m\n");
+    RUN_TEST(test_simd_force_levels);
+    top = ft_simd_detect();
+    for (level = FT_SIMD_SCALAR; level <= (int)top; level++)
+    {
+        ft_simd_force((t_simd)level);
+        printf("\n\033[1;35m--- kernels: %s ---\033[0m\n",
+               simd_name((t_simd)level));
+        run_all_tests();
+    }
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
@@ -0,0 +1,309 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_memstats.c                                 :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 19:49:34 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:23:12 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    ft_memstats_reset(); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(a) ASSERT((a) == NULL)
+
+/* ==================== Helpers ==================== */
+
+static const t_memsite *find_site(const char *name)
+{
+    const t_memstats *st = ft_memstats_get();
+    size_t i;
+
+    for (i = 0; i < st->nsites; i++)
+        if (strcmp(st->sites[i].name, name) == 0)
+            return (&st->sites[i]);
+    return (NULL);
+}
+
+/* ==================== Counter tests ==================== */
+
+TEST(test_memstats_enabled_and_reset)
+{
+    const t_memstats *st = ft_memstats_get();
+    char *s;
+
+    ASSERT_EQ(st->enabled, 1);
+    s = ft_strdup("hello");
+    ASSERT(st->allocs == 1 && st->bytes_total == 6);
+    ASSERT_EQ(st->nsites, 1);
+    ft_memstats_reset();
+    ASSERT(st->enabled == 1 && st->allocs == 0 && st->nsites == 0);
+    free(s);
+}
+
+TEST(test_memstats_caller_owned_not_live)
+{
+    const t_memstats *st = ft_memstats_get();
+    const t_memsite *site;
+    char **words;
+    char *s;
+
+    s = ft_strjoin("abc", "de");
+    words = ft_split("a bb ccc", ' ');
+    ASSERT(s && words);
+    ASSERT_EQ(st->bytes_live, 0);
+    ASSERT_EQ(st->bytes_peak, 0);
+    site = find_site("ft_split");
+    ASSERT(site && site->calls == 1);
+    ASSERT_EQ(site->bytes, 4 * sizeof(char *) + 9);
+    ASSERT_EQ(find_site("ft_strjoin")->bytes, 6);
+    ft_split_free(words);
+    free(s);
+}
+
+TEST(test_memstats_vec_growth_live_and_peak)
+{
+    const t_memstats *st = ft_memstats_get();
+    const t_memsite *site;
+    t_vec *v;
+    int i;
+
+    v = ft_vec_new(sizeof(int), 4);
+    ASSERT(v);
+    ASSERT_EQ(st->bytes_live, sizeof(t_vec) + 4 * sizeof(int));
+    for (i = 0; i < 100; i++)
+        ft_vec_push(v, &i);
+    site = find_site("ft_vec_reserve");
+    ASSERT(site && site->calls >= 5);
+    ASSERT_EQ(site->max_request, v->cap * sizeof(int));
+    ASSERT_EQ(st->bytes_live, sizeof(t_vec) + v->cap * sizeof(int));
+    ASSERT_EQ(st->bytes_peak, st->bytes_live);
+    ft_vec_free(v);
+    ASSERT_EQ(st->bytes_live, 0);
+    ASSERT(st->bytes_peak >= sizeof(t_vec) + 100 * sizeof(int));
+    ASSERT(st->frees == 1 && st->reallocs == site->calls);
+}
+
+TEST(test_memstats_hashmap_and_containers_balance)
+{
+    const t_memstats *st = ft_memstats_get();
+    t_hashmap *map;
+    t_deque *d;
+    char key[16];
+    int i;
+
+    map = ft_hashmap_new(2, NULL);
+    d = ft_deque_new(sizeof(int), 2);
+    ASSERT(map && d);
+    for (i = 0; i < 200; i++)
+    {
+        snprintf(key, sizeof(key), "k%d", i);
+        ASSERT(ft_hashmap_set(map, key, NULL));
+        ASSERT(ft_deque_push_back(d, &i));
+    }
+    ASSERT(find_site("ft_hashmap_grow") != NULL);
+    ASSERT(find_site("ft_hashmap_key")->calls == 200);
+    ASSERT(find_site("ft_deque_grow") != NULL);
+    ASSERT(st->bytes_live > 0);
+    ft_hashmap_free(map);
+    ft_deque_free(d);
+    ASSERT_EQ(st->bytes_live, 0);
+}
+
+TEST(test_memstats_strbuf_heap_only)
+{
+    const t_memstats *st = ft_memstats_get();
+    t_strbuf sb;
+    char *s;
+    int i;
+
+    ft_strbuf_init(&sb);
+    ft_strbuf_append(&sb, "inline");
+    ASSERT_EQ(st->allocs, 0);
+    for (i = 0; i < 100; i++)
+        ASSERT(ft_strbuf_append(&sb, "0123456789"));
+    ASSERT(find_site("ft_strbuf_reserve") != NULL);
+    ASSERT_EQ(st->bytes_live, sb.cap);
+    s = ft_strbuf_detach(&sb);
+    ASSERT_EQ(st->bytes_live, 0);
+    free(s);
+    ft_strbuf_append(&sb, "x");
+    s = ft_strbuf_detach(&sb);
+    ASSERT(find_site("ft_strbuf_detach")->calls == 2);
+    free(s);
+    ft_strbuf_free(&sb);
+}
+
+TEST(test_memstats_arena_pool_not_double_counted)
+{
+    const t_memstats *st = ft_memstats_get();
+    t_arena *arena;
+    t_pool *pool;
+    t_vec *v;
+    int i;
+
+    arena = ft_arena_new(1024);
+    pool = ft_pool_new(48);
+    ASSERT(arena && pool);
+    v = ft_arena_vec_new(arena, sizeof(int), 4);
+    for (i = 0; i < 1000; i++)
+        ft_vec_push(v, &i);
+    for (i = 0; i < 200; i++)
+        ft_pool_alloc(pool);
+    ASSERT_NULL(find_site("ft_vec_reserve"));
+    ASSERT(find_site("ft_arena_alloc")->calls >= 2);
+    ASSERT(find_site("ft_pool_alloc")->calls >= 2);
+    ft_arena_free(arena);
+    ft_pool_free(pool);
+    ASSERT_EQ(st->bytes_live, 0);
+}
+
+/* ==================== Histogram / dump tests ==================== */
+
+TEST(test_memstats_histogram_buckets)
+{
+    const t_memsite *site;
+    void *p[4];
+
+    p[0] = ft_calloc(1, 16);
+    p[1] = ft_calloc(1, 17);
+    p[2] = ft_calloc(1, 4096);
+    p[3] = ft_calloc(1, 64 << 20);
+    site = find_site("ft_calloc");
+    ASSERT(site && site->calls == 4);
+    ASSERT_EQ(site->hist[0], 1);
+    ASSERT_EQ(site->hist[1], 1);
+    ASSERT_EQ(site->hist[8], 1);
+    ASSERT_EQ(site->hist[FT_MEMSTATS_BUCKETS - 1], 1);
+    ASSERT_EQ(site->max_request, (size_t)64 << 20);
+    free(p[0]);
+    free(p[1]);
+    free(p[2]);
+    free(p[3]);
+}
+
+TEST(test_memstats_site_table_overflow)
+{
+    const t_memstats *st = ft_memstats_get();
+    static char names[FT_MEMSTATS_SITES + 8][16];
+    int i;
+
+    for (i = 0; i < FT_MEMSTATS_SITES + 8; i++)
+    {
+        snprintf(names[i], sizeof(names[i]), "site%d", i);
+        ft_memstats_record(names[i], 0, 8);
+    }
+    ASSERT_EQ(st->nsites, FT_MEMSTATS_SITES);
+    ASSERT_EQ(strcmp(st->sites[FT_MEMSTATS_SITES - 2].name,
+        names[FT_MEMSTATS_SITES - 2]), 0);
+    ASSERT_EQ(st->sites[FT_MEMSTATS_SITES - 2].calls, 1);
+    ASSERT_EQ(strcmp(st->sites[FT_MEMSTATS_SITES - 1].name, "(other)"), 0);
+    ASSERT_EQ(st->sites[FT_MEMSTATS_SITES - 1].calls, 9);
+    ASSERT_EQ(st->bytes_live, (FT_MEMSTATS_SITES + 8) * 8);
+    ft_memstats_record(names[FT_MEMSTATS_SITES - 2], 8, 0);
+    ASSERT_EQ(st->sites[FT_MEMSTATS_SITES - 2].calls, 2);
+    ASSERT_EQ(st->sites[FT_MEMSTATS_SITES - 1].calls, 9);
+}
+
+TEST(test_memstats_site_table_reset)
+{
+    const t_memstats *st = ft_memstats_get();
+    static char names[FT_MEMSTATS_SITES][16];
+    int i;
+
+    for (i = 0; i < FT_MEMSTATS_SITES; i++)
+    {
+        snprintf(names[i], sizeof(names[i]), "site%d", i);
+        ft_memstats_record(names[i], 0, 8);
+    }
+    ASSERT_EQ(strcmp(st->sites[FT_MEMSTATS_SITES - 1].name, "(other)"), 0);
+    ft_memstats_reset();
+    ASSERT_EQ(st->nsites, 0);
+    ASSERT_EQ(strcmp(st->sites[FT_MEMSTATS_SITES - 1].name, "(other)"), 0);
+    ASSERT_EQ(st->sites[FT_MEMSTATS_SITES - 1].calls, 0);
+    for (i = 0; i < FT_MEMSTATS_SITES - 1; i++)
+        ft_memstats_record(names[i], 0, 8);
+    ASSERT_EQ(st->nsites, FT_MEMSTATS_SITES - 1);
+    ASSERT_EQ(strcmp(st->sites[FT_MEMSTATS_SITES - 2].name,
+        names[FT_MEMSTATS_SITES - 2]), 0);
+}
+
+TEST(test_memstats_dump_format)
+{
+    char buf[4096];
+    int fds[2];
+    ssize_t n;
+    t_vec *v;
+
+    v = ft_vec_new(8, 4);
+    ft_vec_reserve(v, 1000);
+    ASSERT_EQ(pipe(fds), 0);
+    ft_memstats_dump(fds[1]);
+    close(fds[1]);
+    n = read(fds[0], buf, sizeof(buf) - 1);
+    close(fds[0]);
+    ASSERT(n > 0);
+    buf[n] = '\0';
+    ASSERT(strstr(buf, "memstats: allocs=1 reallocs=1 frees=0") == buf);
+    ASSERT(strstr(buf, "  ft_vec_reserve calls=1 bytes=8000 max=8000 <=8192:1\n"));
+    ft_vec_free(v);
+}
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║      ft_memstats Unit Test Suite     ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    printf("\n\033[1m=== Counter tests ===\033[0m\n");
+    RUN_TEST(test_memstats_enabled_and_reset);
+    RUN_TEST(test_memstats_caller_owned_not_live);
+    RUN_TEST(test_memstats_vec_growth_live_and_peak);
+    RUN_TEST(test_memstats_hashmap_and_containers_balance);
+    RUN_TEST(test_memstats_arena_pool_not_double_counted);
+    RUN_TEST(test_memstats_strbuf_heap_only);
+
+    printf("\n\033[1m=== Histogram / dump tests ===\033[0m\n");
+    RUN_TEST(test_memstats_histogram_buckets);
+    RUN_TEST(test_memstats_site_table_overflow);
+    RUN_TEST(test_memstats_site_table_reset);
+    RUN_TEST(test_memstats_dump_format);
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
@@ -0,0 +1,259 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_pool.c                                     :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 18:23:11 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/17 18:23:11 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(a) ASSERT((a) == NULL)
+
+/* ==================== Core tests ==================== */
+
+TEST(test_pool_new_rounds_size)
+{
+    t_pool *p = ft_pool_new(1);
+
+    ASSERT(p);
+    ASSERT_EQ(p->obj_size, 16);
+    ft_pool_free(p);
+    p = ft_pool_new(17);
+    ASSERT(p && p->obj_size == 32);
+    ft_pool_free(p);
+    ASSERT_NULL(ft_pool_new(0));
+    ASSERT_NULL(ft_pool_new(SIZE_MAX));
+    ft_pool_free(NULL);
+}
+
+TEST(test_pool_alloc_distinct_aligned)
+{
+    t_pool *p = ft_pool_new(24);
+    unsigned char *obj[1000];
+    size_t i;
+
+    ASSERT(p);
+    for (i = 0; i < 1000; i++)
+    {
+        obj[i] = ft_pool_alloc(p);
+        ASSERT(obj[i]);
+        ASSERT_EQ((uintptr_t)obj[i] % 16, 0);
+        memset(obj[i], (int)(i & 0xFF), 24);
+    }
+    for (i = 0; i < 1000; i++)
+        ASSERT(obj[i][0] == (unsigned char)i && obj[i][23] == (unsigned char)i);
+    ft_pool_free(p);
+}
+
+TEST(test_pool_release_recycles)
+{
+    t_pool *p = ft_pool_new(32);
+    void *a;
+    void *b;
+    void *chunks;
+
+    ASSERT(p);
+    a = ft_pool_alloc(p);
+    b = ft_pool_alloc(p);
+    chunks = p->chunks;
+    ft_pool_release(p, a);
+    ft_pool_release(p, b);
+    ASSERT(ft_pool_alloc(p) == b);
+    ASSERT(ft_pool_alloc(p) == a);
+    ASSERT(p->chunks == chunks);
+    ft_pool_release(p, NULL);
+    ft_pool_free(p);
+}
+
+TEST(test_pool_large_objects)
+{
+    t_pool *p = ft_pool_new(3000);
+    char *x[20];
+    int i;
+
+    ASSERT(p);
+    for (i = 0; i < 20; i++)
+    {
+        x[i] = ft_pool_alloc(p);
+        ASSERT(x[i]);
+        memset(x[i], 'a' + i, 3000);
+    }
+    for (i = 0; i < 20; i++)
+        ASSERT(x[i][0] == 'a' + i && x[i][2999] == 'a' + i);
+    ft_pool_free(p);
+}
+
+TEST(test_pool_churn_stays_bounded)
+{
+    t_pool *p = ft_pool_new(16);
+    void *live[64];
+    int round;
+    int i;
+    void *chunks;
+
+    ASSERT(p);
+    for (i = 0; i < 64; i++)
+        live[i] = ft_pool_alloc(p);
+    chunks = p->chunks;
+    for (round = 0; round < 10000; round++)
+    {
+        i = round % 64;
+        ft_pool_release(p, live[i]);
+        live[i] = ft_pool_alloc(p);
+        ASSERT(live[i]);
+    }
+    ASSERT(p->chunks == chunks);
+    ft_pool_free(p);
+}
+
+/* ==================== List tests ==================== */
+
+static int g_del_calls = 0;
+
+static void count_del(void *content)
+{
+    (void)content;
+    g_del_calls++;
+}
+
+TEST(test_pool_list_nodes)
+{
+    t_pool *p = ft_pool_new(sizeof(t_list));
+    t_list *lst = NULL;
+    t_list *node;
+    int values[100];
+    int i;
+
+    ASSERT(p);
+    for (i = 0; i < 100; i++)
+    {
+        values[i] = i;
+        node = ft_pool_lstnew(p, &values[i]);
+        ASSERT(node && node->next == NULL);
+        ft_lstadd_back(&lst, node);
+    }
+    ASSERT_EQ(ft_lstsize(lst), 100);
+    ASSERT_EQ(*(int *)ft_lstlast(lst)->content, 99);
+    g_del_calls = 0;
+    ft_pool_lstclear(p, &lst, count_del);
+    ASSERT_NULL(lst);
+    ASSERT_EQ(g_del_calls, 100);
+    node = ft_pool_lstnew(p, NULL);
+    ASSERT(node);
+    ft_pool_lstdelone(p, node, NULL);
+    ft_pool_free(p);
+}
+
+TEST(test_pool_list_rejects_small_pool)
+{
+    t_pool *p = ft_pool_new(8);
+
+    ASSERT(p);
+    ASSERT(p->obj_size >= sizeof(t_list));
+    ft_pool_free(p);
+    ASSERT_NULL(ft_pool_lstnew(NULL, NULL));
+}
+
+/* ==================== Hashmap tests ==================== */
+
+TEST(test_pool_hashmap_buckets)
+{
+    t_pool *p = ft_hashmap_pool_new();
+    t_hashmap *a;
+    t_hashmap *b;
+    char key[32];
+    int i;
+
+    ASSERT(p);
+    a = ft_pool_hashmap_new(p, 4, NULL);
+    b = ft_pool_hashmap_new(p, 1, NULL);
+    ASSERT(a && b && a->pool == p);
+    for (i = 0; i < 2000; i++)
+    {
+        snprintf(key, sizeof(key), "k%d", i);
+        ASSERT(ft_hashmap_set(a, key, (void *)(intptr_t)(i + 1)));
+        ASSERT(ft_hashmap_set(b, key, (void *)(intptr_t)(i + 1)));
+    }
+    ASSERT(ft_hashmap_set(a, "k5", (void *)7));
+    ASSERT(a->size == 2000 && b->size == 2000);
+    ft_hashmap_clear(a);
+    ASSERT_EQ(a->size, 0);
+    ASSERT(ft_hashmap_set(a, "again", (void *)1));
+    ft_hashmap_free(a);
+    ft_hashmap_free(b);
+    ft_pool_free(p);
+}
+
+TEST(test_pool_hashmap_rejects_small_pool)
+{
+    t_pool *p = ft_pool_new(16);
+
+    ASSERT(p);
+    ASSERT_NULL(ft_pool_hashmap_new(p, 8, NULL));
+    ASSERT_NULL(ft_pool_hashmap_new(NULL, 8, NULL));
+    ft_pool_free(p);
+}
+
+/* ==================== Test Runner ==================== */
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║       ft_pool Unit Test Suite        ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    printf("\n\033[1m=== Core tests ===\033[0m\n");
+    RUN_TEST(test_pool_new_rounds_size);
+    RUN_TEST(test_pool_alloc_distinct_aligned);
+    RUN_TEST(test_pool_release_recycles);
+    RUN_TEST(test_pool_large_objects);
+    RUN_TEST(test_pool_churn_stays_bounded);
+
+    printf("\n\033[1m=== List tests ===\033[0m\n");
+    RUN_TEST(test_pool_list_nodes);
+    RUN_TEST(test_pool_list_rejects_small_pool);
+
+    printf("\n\033[1m=== Hashmap tests ===\033[0m\n");
+    RUN_TEST(test_pool_hashmap_buckets);
+    RUN_TEST(test_pool_hashmap_rejects_small_pool);
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
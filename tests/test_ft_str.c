@@ -0,0 +1,681 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_str.c                                      :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/17 23:15:40 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 07:35:35 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(a) ASSERT((a) == NULL)
+
+/* ==================== ft_split tests ==================== */
+
+static size_t count_words(char **words)
+{
+    size_t n;
+
+    n = 0;
+    while (words[n])
+        n++;
+    return (n);
+}
+
+TEST(test_split_basic)
+{
+    char **w = ft_split("  hello world  foo bar ", ' ');
+
+    ASSERT(w);
+    ASSERT_EQ(count_words(w), 4);
+    ASSERT(strcmp(w[0], "hello") == 0 && strcmp(w[1], "world") == 0);
+    ASSERT(strcmp(w[2], "foo") == 0 && strcmp(w[3], "bar") == 0);
+    ft_split_free(w);
+}
+
+TEST(test_split_edge_cases)
+{
+    char **w;
+
+    ASSERT_NULL(ft_split(NULL, ' '));
+    w = ft_split("", ' ');
+    ASSERT(w && w[0] == NULL);
+    ft_split_free(w);
+    w = ft_split(",,,,", ',');
+    ASSERT(w && w[0] == NULL);
+    ft_split_free(w);
+    w = ft_split("one", ',');
+    ASSERT(w && count_words(w) == 1 && strcmp(w[0], "one") == 0);
+    ft_split_free(w);
+    w = ft_split("a b", '\0');
+    ASSERT(w && count_words(w) == 1 && strcmp(w[0], "a b") == 0);
+    ft_split_free(w);
+    ft_split_free(NULL);
+}
+
+TEST(test_split_long_line)
+{
+    size_t fields = 20000;
+    char *line = malloc(fields * 6 + 1);
+    char **w;
+    size_t i;
+
+    ASSERT(line);
+    for (i = 0; i < fields; i++)
+        snprintf(line + i * 6, 7, "%05zu,", i);
+    w = ft_split(line, ',');
+    ASSERT(w);
+    ASSERT_EQ(count_words(w), fields);
+    for (i = 0; i < fields; i++)
+        ASSERT(atoi(w[i]) == (int)i && strlen(w[i]) == 5);
+    ft_split_free(w);
+    free(line);
+}
+
+/* ==================== ft_strjoin tests ==================== */
+
+TEST(test_strjoin_two)
+{
+    char *s;
+
+    s = ft_strjoin("abc", "de");
+    ASSERT(s && strcmp(s, "abcde") == 0);
+    free(s);
+    s = ft_strjoin(NULL, "de");
+    ASSERT(s && strcmp(s, "de") == 0);
+    free(s);
+    s = ft_strjoin("", "");
+    ASSERT(s && s[0] == '\0');
+    free(s);
+}
+
+TEST(test_strjoin_n)
+{
+    char *s;
+
+    s = ft_strjoin_n(4, "/usr", "/local", NULL, "/bin");
+    ASSERT(s && strcmp(s, "/usr/local/bin") == 0);
+    free(s);
+    s = ft_strjoin_n(0);
+    ASSERT(s && s[0] == '\0');
+    free(s);
+    s = ft_strjoin_n(1, "solo");
+    ASSERT(s && strcmp(s, "solo") == 0);
+    free(s);
+}
+
+TEST(test_strjoin_arr)
+{
+    char *parts[] = {"/bin", "/usr/bin", "", "/sbin", NULL};
+    char *empty[] = {NULL};
+    char **words;
+    char *s;
+
+    s = ft_strjoin_arr(parts, ":");
+    ASSERT(s && strcmp(s, "/bin:/usr/bin::/sbin") == 0);
+    free(s);
+    s = ft_strjoin_arr(parts, NULL);
+    ASSERT(s && strcmp(s, "/bin/usr/bin/sbin") == 0);
+    free(s);
+    s = ft_strjoin_arr(empty, ", ");
+    ASSERT(s && s[0] == '\0');
+    free(s);
+    ASSERT_NULL(ft_strjoin_arr(NULL, ","));
+    words = ft_split("ls  -la   /tmp", ' ');
+    s = ft_strjoin_arr(words, " ");
+    ASSERT(s && strcmp(s, "ls -la /tmp") == 0);
+    free(s);
+    ft_split_free(words);
+}
+
+TEST(test_strjoin_arr_many_parts)
+{
+    size_t n = 5000;
+    char **parts = malloc((n + 1) * sizeof(char *));
+    char *s;
+    size_t i;
+
+    ASSERT(parts);
+    for (i = 0; i < n; i++)
+        parts[i] = "field";
+    parts[n] = NULL;
+    s = ft_strjoin_arr(parts, ",");
+    ASSERT(s && strlen(s) == n * 6 - 1);
+    ASSERT(strncmp(s, "field,field,", 12) == 0);
+    ASSERT(strcmp(s + strlen(s) - 6, ",field") == 0);
+    free(s);
+    free(parts);
+}
+
+/* ==================== Substring search tests ==================== */
+
+static const char *naive_find(const char *h, size_t n, const char *nd, size_t m)
+{
+    size_t i;
+
+    if (m == 0)
+        return (h);
+    for (i = 0; i + m <= n; i++)
+        if (memcmp(h + i, nd, m) == 0)
+            return (h + i);
+    return (NULL);
+}
+
+TEST(test_strsearch_successive_matches)
+{
+    const char *hay = "Host: a\nAccept: b\nHost: c\nX-Host: d\n";
+    t_strsearch s;
+    const char *p;
+    size_t n = strlen(hay);
+    int count = 0;
+
+    ft_strsearch_init(&s, "Host: ", 6);
+    p = ft_strsearch_next(&s, hay, n);
+    while (p)
+    {
+        count++;
+        ASSERT(strncmp(p, "Host: ", 6) == 0);
+        p = ft_strsearch_next(&s, p + 1, n - (size_t)(p + 1 - hay));
+    }
+    ASSERT_EQ(count, 3);
+    ft_strsearch_init(&s, "", 0);
+    ASSERT(ft_strsearch_next(&s, hay, n) == hay);
+    ft_strsearch_init(&s, "X", 1);
+    ASSERT(ft_strsearch_next(&s, hay, n) == strchr(hay, 'X'));
+    ft_strsearch_init(&s, "longer than the haystack", 24);
+    ASSERT_NULL(ft_strsearch_next(&s, "short", 5));
+}
+
+static t_strsearch make_searcher(const char *needle)
+{
+    t_strsearch s;
+
+    ft_strsearch_init(&s, needle, strlen(needle));
+    return (s);
+}
+
+TEST(test_strsearch_copy_by_value)
+{
+    const char *hay = "GET / HTTP/1.1\r\nContent-Length: 42\r\n";
+    t_strsearch a;
+    t_strsearch b;
+
+    a = make_searcher("Content-Length: ");
+    b = a;
+    memset(&a, 0xAB, sizeof(a));
+    ASSERT(ft_strsearch_next(&b, hay, strlen(hay)) == strstr(hay, "Content"));
+    ASSERT_NULL(ft_strsearch_next(&b, hay, 20));
+}
+
+TEST(test_strsearch_matches_naive)
+{
+    char hay[2048];
+    char needle[300];
+    t_strsearch s;
+    size_t m;
+    size_t i;
+    int round;
+
+    srand(18);
+    for (round = 0; round < 400; round++)
+    {
+        for (i = 0; i < sizeof(hay); i++)
+            hay[i] = (char)('a' + rand() % (round % 3 + 2));
+        m = 2 + (size_t)rand() % (round % 2 ? 8 : 290);
+        if (rand() % 2)
+            memcpy(needle, hay + rand() % (int)(sizeof(hay) - m), m);
+        else
+            for (i = 0; i < m; i++)
+                needle[i] = (char)('a' + rand() % (round % 3 + 2));
+        ft_strsearch_init(&s, needle, m);
+        ASSERT(ft_strsearch_next(&s, hay, sizeof(hay))
+            == naive_find(hay, sizeof(hay), needle, m));
+    }
+}
+
+TEST(test_strsearch_periodic_and_long)
+{
+    static char hay[100000];
+    char needle[400];
+    t_strsearch s;
+
+    memset(hay, 'a', sizeof(hay));
+    memset(needle, 'a', sizeof(needle));
+    needle[sizeof(needle) - 1] = 'b';
+    ft_strsearch_init(&s, needle, sizeof(needle));
+    ASSERT_NULL(ft_strsearch_next(&s, hay, sizeof(hay)));
+    hay[sizeof(hay) - 1] = 'b';
+    ASSERT(ft_strsearch_next(&s, hay, sizeof(hay))
+        == hay + sizeof(hay) - sizeof(needle));
+    needle[0] = 'b';
+    needle[sizeof(needle) - 1] = 'a';
+    ft_strsearch_init(&s, needle, sizeof(needle));
+    ASSERT_NULL(ft_strsearch_next(&s, hay, sizeof(hay) - 1));
+}
+
+TEST(test_strnstr_short_and_long)
+{
+    const char *h = "the quick brown fox jumps over the lazy dog";
+    char buf[64];
+
+    ASSERT(ft_strnstr(h, "", 0) == h);
+    ASSERT(ft_strnstr(h, "fox", 100) == h + 16);
+    ASSERT_NULL(ft_strnstr(h, "fox", 18));
+    ASSERT(ft_strnstr(h, "jumps over", 100) == h + 20);
+    ASSERT(ft_strnstr(h, "jumps over", 30) == h + 20);
+    ASSERT_NULL(ft_strnstr(h, "jumps over", 29));
+    ASSERT(ft_strnstr(h, "the lazy dog", SIZE_MAX) == h + 31);
+    ASSERT_NULL(ft_strnstr(h, "the lazy dogs", SIZE_MAX));
+    memcpy(buf, "abcdefgh\0abcdefghij", 20);
+    ASSERT_NULL(ft_strnstr(buf, "abcdefghij", 20));
+    ASSERT(ft_strnstr(buf, "abcdefgh", 20) == buf);
+}
+
+TEST(test_strnstr_matches_naive)
+{
+    char hay[512];
+    char needle[40];
+    size_t len;
+    size_t m;
+    size_t i;
+    int round;
+
+    srand(7);
+    for (round = 0; round < 2000; round++)
+    {
+        for (i = 0; i < sizeof(hay) - 1; i++)
+            hay[i] = (char)('a' + rand() % 2);
+        hay[sizeof(hay) - 1] = '\0';
+        hay[rand() % (int)sizeof(hay)] = '\0';
+        m = 1 + (size_t)rand() % 20;
+        for (i = 0; i < m; i++)
+            needle[i] = (char)('a' + rand() % 2);
+        needle[m] = '\0';
+        len = (size_t)rand() % 600;
+        if (len > strlen(hay))
+            i = strlen(hay);
+        else
+            i = len;
+        ASSERT(ft_strnstr(hay, needle, len) == naive_find(hay, i, needle, m));
+    }
+}
+
+/* ==================== t_strview tests ==================== */
+
+static int sv_is(t_strview sv, const char *s)
+{
+    return (ft_sv_eq(sv, ft_sv_from(s)));
+}
+
+TEST(test_sv_new_sub_eq)
+{
+    t_strview sv = ft_sv_from("hello world");
+
+    ASSERT_EQ(sv.len, 11);
+    ASSERT(sv_is(ft_sv_sub(sv, 6, 5), "world"));
+    ASSERT(sv_is(ft_sv_sub(sv, 6, 100), "world"));
+    ASSERT(ft_sv_sub(sv, 50, 3).len == 0);
+    ASSERT(sv_is(ft_sv_new("abcdef", 3), "abc"));
+    ASSERT(!sv_is(ft_sv_new("abcdef", 3), "abcd"));
+    ASSERT(!sv_is(ft_sv_new("abd", 3), "abc"));
+    ASSERT(ft_sv_from(NULL).len == 0);
+}
+
+TEST(test_sv_trim)
+{
+    ASSERT(sv_is(ft_sv_trim(ft_sv_from("  \t x y \n"), " \t\n"), "x y"));
+    ASSERT(ft_sv_trim(ft_sv_from("    "), " ").len == 0);
+    ASSERT(sv_is(ft_sv_trim(ft_sv_from("abc"), ""), "abc"));
+    ASSERT(sv_is(ft_sv_trim(ft_sv_new("xabcx\0", 5), "x"), "abc"));
+}
+
+TEST(test_sv_split_next)
+{
+    t_strview rest = ft_sv_from(",,a,bb,,ccc,");
+    t_strview tok;
+
+    ASSERT(ft_sv_split_next(&rest, ',', &tok) && sv_is(tok, "a"));
+    ASSERT(ft_sv_split_next(&rest, ',', &tok) && sv_is(tok, "bb"));
+    ASSERT(ft_sv_split_next(&rest, ',', &tok) && sv_is(tok, "ccc"));
+    ASSERT(!ft_sv_split_next(&rest, ',', &tok));
+    ASSERT(!ft_sv_split_next(&rest, ',', &tok));
+    rest = ft_sv_new("one two", 3);
+    ASSERT(ft_sv_split_next(&rest, ' ', &tok) && sv_is(tok, "one"));
+    ASSERT(!ft_sv_split_next(&rest, ' ', &tok));
+}
+
+TEST(test_sv_find)
+{
+    t_strview hay = ft_sv_from("abcabcabd");
+
+    ASSERT_EQ(ft_sv_find(hay, ft_sv_from("abd")), 6);
+    ASSERT_EQ(ft_sv_find(hay, ft_sv_from("c")), 2);
+    ASSERT_EQ(ft_sv_find(hay, ft_sv_from("")), 0);
+    ASSERT_EQ(ft_sv_find(hay, ft_sv_from("abe")), FT_SV_NPOS);
+    ASSERT_EQ(ft_sv_find(ft_sv_sub(hay, 0, 8), ft_sv_from("abd")),
+        FT_SV_NPOS);
+}
+
+TEST(test_sv_to_int)
+{
+    int v = 7;
+
+    ASSERT(ft_sv_to_int(ft_sv_from("42"), &v) && v == 42);
+    ASSERT(ft_sv_to_int(ft_sv_from("-2147483648"), &v) && v == INT32_MIN);
+    ASSERT(ft_sv_to_int(ft_sv_from("+2147483647"), &v) && v == INT32_MAX);
+    ASSERT(ft_sv_to_int(ft_sv_new("123456", 3), &v) && v == 123);
+    v = 7;
+    ASSERT(!ft_sv_to_int(ft_sv_from("2147483648"), &v));
+    ASSERT(!ft_sv_to_int(ft_sv_from("-2147483649"), &v));
+    ASSERT(!ft_sv_to_int(ft_sv_from("99999999999999999999"), &v));
+    ASSERT(!ft_sv_to_int(ft_sv_from(""), &v));
+    ASSERT(!ft_sv_to_int(ft_sv_from("-"), &v));
+    ASSERT(!ft_sv_to_int(ft_sv_from("12a"), &v));
+    ASSERT(!ft_sv_to_int(ft_sv_from(" 12"), &v));
+    ASSERT_EQ(v, 7);
+}
+
+TEST(test_sv_parse_without_copies)
+{
+    t_strview rest = ft_sv_from(" 10, -20 ,30,, 40 ");
+    t_strview tok;
+    char *dup;
+    int sum = 0;
+    int v;
+
+    while (ft_sv_split_next(&rest, ',', &tok))
+    {
+        ASSERT(ft_sv_to_int(ft_sv_trim(tok, " "), &v));
+        sum += v;
+    }
+    ASSERT_EQ(sum, 60);
+    dup = ft_sv_dup(ft_sv_new("abcdef", 4));
+    ASSERT(dup && strcmp(dup, "abcd") == 0);
+    free(dup);
+}
+
+/* ==================== t_strbuf tests ==================== */
+
+TEST(test_strbuf_inline_then_heap)
+{
+    t_strbuf sb;
+    size_t i;
+
+    ft_strbuf_init(&sb);
+    ASSERT(sb.data == sb.small && sb.len == 0 && sb.data[0] == '\0');
+    ASSERT(ft_strbuf_append(&sb, "hello"));
+    ASSERT(ft_strbuf_push_char(&sb, ' '));
+    ASSERT(ft_strbuf_append_n(&sb, "worldXXX", 5));
+    ASSERT(strcmp(sb.data, "hello world") == 0 && sb.len == 11);
+    ASSERT(sb.data == sb.small);
+    for (i = 0; i < 1000; i++)
+        ASSERT(ft_strbuf_push_char(&sb, (char)('a' + i % 26)));
+    ASSERT(sb.data != sb.small && sb.len == 1011);
+    ASSERT(strncmp(sb.data, "hello worldabc", 14) == 0);
+    ASSERT_EQ(sb.data[sb.len], '\0');
+    ASSERT(sb.cap > sb.len);
+    ft_strbuf_clear(&sb);
+    ASSERT(sb.len == 0 && sb.data[0] == '\0' && sb.cap > 1000);
+    ft_strbuf_free(&sb);
+    ASSERT(sb.data == sb.small);
+}
+
+TEST(test_strbuf_reserve_and_growth)
+{
+    t_strbuf sb;
+    size_t grows = 0;
+    size_t cap;
+    size_t i;
+
+    ft_strbuf_init(&sb);
+    ASSERT(ft_strbuf_reserve(&sb, 10) && sb.data == sb.small);
+    ASSERT(ft_strbuf_reserve(&sb, 5000) && sb.cap >= 5001);
+    ASSERT(!ft_strbuf_reserve(&sb, SIZE_MAX));
+    ft_strbuf_free(&sb);
+    cap = sb.cap;
+    for (i = 0; i < 100000; i++)
+    {
+        ASSERT(ft_strbuf_append(&sb, "0123456789"));
+        if (sb.cap != cap)
+            grows++;
+        cap = sb.cap;
+    }
+    ASSERT(sb.len == 1000000 && grows < 20);
+    ft_strbuf_free(&sb);
+}
+
+TEST(test_strbuf_appendf)
+{
+    t_strbuf sb;
+    int n;
+
+    ft_strbuf_init(&sb);
+    n = ft_strbuf_appendf(&sb, "%s=%d, %i%% %c [%u] %x %X", "v", -42, 0,
+            'z', 4000000000u, 255, 0xABCu);
+    ASSERT(strcmp(sb.data, "v=-42, 0% z [4000000000] ff ABC") == 0);
+    ASSERT_EQ(n, (int)sb.len);
+    n = ft_strbuf_appendf(&sb, "|%d|%s|%p|", INT32_MIN, NULL, NULL);
+    ASSERT(strcmp(sb.data + 31, "|-2147483648|(null)|(nil)|") == 0);
+    ASSERT_EQ(n, 26);
+    ft_strbuf_clear(&sb);
+    ft_strbuf_appendf(&sb, "%p", (void *)0x1f);
+    ASSERT(strcmp(sb.data, "0x1f") == 0);
+    ASSERT_EQ(ft_strbuf_appendf(&sb, ""), 0);
+    ASSERT_EQ(ft_strbuf_appendf(&sb, NULL), -1);
+    ft_strbuf_clear(&sb);
+    n = ft_strbuf_appendf(&sb, "(%.1f, %.1f) %e %g %.3g", 1.25, -0.05, 1e-7,
+            1e20, 0.0001234);
+    ASSERT(strcmp(sb.data, "(1.2, -0.1) 1.000000e-07 1e+20 0.000123") == 0);
+    ASSERT_EQ(n, (int)sb.len);
+    ft_strbuf_clear(&sb);
+    n = ft_strbuf_appendf(&sb, "%.300f", 1.0);
+    ASSERT_EQ(n, 302);
+    ASSERT(sb.data[0] == '1' && sb.data[1] == '.' && sb.data[301] == '0');
+    ft_strbuf_clear(&sb);
+    n = ft_strbuf_appendf(&sb, "%.99999999999f|%.4294967297g", 0.5, 0.5);
+    ASSERT_EQ(n, FT_PRINTF_PREC_MAX + 2 + 4);
+    ASSERT(strncmp(sb.data, "0.5000", 6) == 0);
+    ASSERT(strcmp(sb.data + FT_PRINTF_PREC_MAX + 2, "|0.5") == 0);
+    ft_strbuf_free(&sb);
+}
+
+TEST(test_strbuf_detach)
+{
+    t_strbuf sb;
+    char *s;
+    size_t i;
+
+    ft_strbuf_init(&sb);
+    ft_strbuf_append(&sb, "short");
+    s = ft_strbuf_detach(&sb);
+    ASSERT(s && strcmp(s, "short") == 0);
+    ASSERT(sb.len == 0 && sb.data == sb.small);
+    free(s);
+    for (i = 0; i < 300; i++)
+        ft_strbuf_appendf(&sb, "%d,", (int)i);
+    s = ft_strbuf_detach(&sb);
+    ASSERT(s && strncmp(s, "0,1,2,", 6) == 0 && strlen(s) == 1090);
+    ASSERT(sb.len == 0 && sb.data == sb.small);
+    free(s);
+}
+
+/* ==================== t_charset tests ==================== */
+
+TEST(test_charset_basic)
+{
+    t_charset set;
+    int c;
+
+    set = ft_charset_from("abc\xff");
+    ASSERT(ft_charset_has(&set, 'a') && ft_charset_has(&set, 'c'));
+    ASSERT(ft_charset_has(&set, 0xff));
+    ASSERT(!ft_charset_has(&set, 'd') && !ft_charset_has(&set, 0));
+    ASSERT(set.count == 4);
+    ft_charset_add(&set, 'a');
+    ASSERT(set.count == 4);
+    set = ft_charset_from(NULL);
+    for (c = 0; c < 256; c++)
+        ASSERT(!ft_charset_has(&set, (unsigned char)c));
+    set = ft_charset_from("0123456789abcdefghij");
+    ASSERT(set.count == 20 && ft_charset_has(&set, 'j'));
+}
+
+TEST(test_strspn_matches_libc)
+{
+    static const char *sets[] = {"", "a", "ab", " \t\n", "xyz.,;:!?",
+        "0123456789abcdef", "0123456789abcdefg", "\x80\xfe"};
+    char buf[160];
+    t_simd top;
+    int level;
+    size_t off;
+    size_t k;
+    size_t i;
+
+    top = ft_simd_detect();
+    for (level = FT_SIMD_SCALAR; level <= (int)top; level++)
+    {
+        ft_simd_force((t_simd)level);
+        for (off = 0; off < 32; off++)
+        {
+            for (i = 0; i < off + 100; i++)
+                buf[i] = "ab \t\nxyz0f\x80"[(i * 7 + off) % 11];
+            buf[off + 100] = '\0';
+            for (k = 0; k < sizeof(sets) / sizeof(*sets); k++)
+            {
+                ASSERT(ft_strspn(buf + off, sets[k]) == strspn(buf + off, sets[k]));
+                ASSERT(ft_strcspn(buf + off, sets[k]) == strcspn(buf + off, sets[k]));
+                ASSERT(ft_strpbrk(buf + off, sets[k]) == strpbrk(buf + off, sets[k]));
+            }
+        }
+        memset(buf, 'a', 150);
+        buf[150] = '\0';
+        ASSERT(ft_strspn(buf + 3, "a") == 147);
+        ASSERT(ft_strcspn(buf + 3, "b") == 147);
+        ASSERT(ft_strpbrk(buf + 3, "xyz") == NULL);
+    }
+    ft_simd_force(top);
+}
+
+TEST(test_strtrim_set)
+{
+    t_charset ws;
+    char *s;
+
+    ws = ft_charset_from(" \t\n");
+    s = ft_strtrim_set(" \t key = value \n", &ws);
+    ASSERT(s && strcmp(s, "key = value") == 0);
+    free(s);
+    s = ft_strtrim_set(" \t\n", &ws);
+    ASSERT(s && strcmp(s, "") == 0);
+    free(s);
+    s = ft_strtrim("xxhixyx", "xy");
+    ASSERT(s && strcmp(s, "hi") == 0);
+    free(s);
+    ASSERT(ft_strtrim_set(NULL, &ws) == NULL);
+}
+
+TEST(test_split_set)
+{
+    t_charset ws;
+    char **w;
+
+    ws = ft_charset_from(" \t,");
+    w = ft_split_set("  a,b\t\tcc ,, d  ", &ws);
+    ASSERT(w && strcmp(w[0], "a") == 0 && strcmp(w[1], "b") == 0);
+    ASSERT(strcmp(w[2], "cc") == 0 && strcmp(w[3], "d") == 0);
+    ASSERT(w[4] == NULL);
+    ft_split_free(w);
+    w = ft_split_set(" ,\t", &ws);
+    ASSERT(w && w[0] == NULL);
+    ft_split_free(w);
+    w = ft_split_set("word", &ws);
+    ASSERT(w && strcmp(w[0], "word") == 0 && w[1] == NULL);
+    ft_split_free(w);
+}
+
+/* ==================== Test Runner ==================== */
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║        ft_str Unit Test Suite        ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    printf("\n\033[1m=== ft_split tests ===\033[0m\n");
+    RUN_TEST(test_split_basic);
+    RUN_TEST(test_split_edge_cases);
+    RUN_TEST(test_split_long_line);
+
+    printf("\n\033[1m=== ft_strjoin tests ===\033[0m\n");
+    RUN_TEST(test_strjoin_two);
+    RUN_TEST(test_strjoin_n);
+    RUN_TEST(test_strjoin_arr);
+    RUN_TEST(test_strjoin_arr_many_parts);
+
+    printf("\n\033[1m=== Substring search tests ===\033[0m\n");
+    RUN_TEST(test_strsearch_successive_matches);
+    RUN_TEST(test_strsearch_copy_by_value);
+    RUN_TEST(test_strsearch_matches_naive);
+    RUN_TEST(test_strsearch_periodic_and_long);
+    RUN_TEST(test_strnstr_short_and_long);
+    RUN_TEST(test_strnstr_matches_naive);
+
+    printf("\n\033[1m=== t_strview tests ===\033[0m\n");
+    RUN_TEST(test_sv_new_sub_eq);
+    RUN_TEST(test_sv_trim);
+    RUN_TEST(test_sv_split_next);
+    RUN_TEST(test_sv_find);
+    RUN_TEST(test_sv_to_int);
+    RUN_TEST(test_sv_parse_without_copies);
+
+    printf("\n\033[1m=== t_strbuf tests ===\033[0m\n");
+    RUN_TEST(test_strbuf_inline_then_heap);
+    RUN_TEST(test_strbuf_reserve_and_growth);
+    RUN_TEST(test_strbuf_appendf);
+    RUN_TEST(test_strbuf_detach);
+
+    printf("\n\033[1m=== t_charset tests ===\033[0m\n");
+    RUN_TEST(test_charset_basic);
+    RUN_TEST(test_strspn_matches_libc);
+    RUN_TEST(test_strtrim_set);
+    RUN_TEST(test_split_set);
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
@@ -0,0 +1,248 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                          :::      ::::::   */
+/*   test_ft_strpool.c                                  :+:      :+:    :+:   */
+/*                                                  +:+ +:+           +:+     */
+/*   By: yiyuli <yy@eyuan.me>                     +#+  +:+         +#+        */
+/*                                              +#+#+#+#+#+      +#+          */
+/*   Created: 2026/10/18 06:01:13 by yiyuli           #+#      #+#            */
+/*   Updated: 2026/10/18 06:01:13 by yiyuli         ###      ########.fr      */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/libft.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ==================== Test Framework ==================== */
+
+static int g_tests_passed = 0;
+static int g_tests_failed = 0;
+
+#define TEST(name) static void name(void)
+#define RUN_TEST(name) do { \
+    printf("  %-50s ", #name); \
+    name(); \
+    printf("\033[32m[PASS]\033[0m\n"); \
+    g_tests_passed++; \
+} while(0)
+
+#define ASSERT(cond) do { \
+    if (!(cond)) { \
+        printf("\033[31m[FAIL]\033[0m\n"); \
+        printf("    Assertion failed: %s\n", #cond); \
+        printf("    File: %s, Line: %d\n", __FILE__, __LINE__); \
+        g_tests_failed++; \
+        return; \
+    } \
+} while(0)
+
+#define ASSERT_EQ(a, b) ASSERT((a) == (b))
+#define ASSERT_NULL(a) ASSERT((a) == NULL)
+
+/* ==================== Helpers ==================== */
+
+static size_t djb2(const char *s, size_t len)
+{
+    size_t hash = 5381;
+
+    while (len--)
+        hash = hash * 33 + (unsigned char)*s++;
+    return (hash);
+}
+
+static int g_freed = 0;
+
+static void count_free(void *p)
+{
+    (void)p;
+    g_freed++;
+}
+
+/* ==================== t_strpool tests ==================== */
+
+TEST(test_strpool_canonical_pointers)
+{
+    t_strpool *pool = ft_strpool_new();
+    char buf[16];
+    const char *a;
+    const char *b;
+
+    ASSERT(pool);
+    strcpy(buf, "identifier");
+    a = ft_strpool_intern(pool, buf);
+    strcpy(buf, "xxxxxxxxxx");
+    ASSERT(a && a != buf && strcmp(a, "identifier") == 0);
+    b = ft_strpool_intern(pool, "identifier");
+    ASSERT(a == b);
+    ASSERT(ft_strpool_intern(pool, "identifieR") != a);
+    ASSERT(ft_strpool_intern_len(pool, "identifier!!", 10) == a);
+    ASSERT(ft_strpool_intern_len(pool, "iden", 4) != a);
+    ASSERT_EQ(pool->count, 3);
+    ASSERT_EQ(ft_strpool_len(a), 10);
+    ASSERT_EQ(ft_strpool_hash(a), djb2("identifier", 10));
+    b = ft_strpool_intern(pool, "");
+    ASSERT(b && b[0] == '\0' && ft_strpool_len(b) == 0);
+    ASSERT(ft_strpool_intern_len(pool, NULL, 0) == b);
+    ASSERT_NULL(ft_strpool_intern(pool, NULL));
+    ASSERT_NULL(ft_strpool_intern(NULL, "x"));
+    ft_strpool_free(pool);
+    ft_strpool_free(NULL);
+}
+
+TEST(test_strpool_find_does_not_add)
+{
+    t_strpool *pool = ft_strpool_new();
+    const char *a;
+
+    ASSERT(pool);
+    ASSERT_NULL(ft_strpool_find(pool, "PATH"));
+    ASSERT_EQ(pool->count, 0);
+    a = ft_strpool_intern(pool, "PATH");
+    ASSERT(ft_strpool_find(pool, "PATH") == a);
+    ASSERT_NULL(ft_strpool_find(pool, "PAT"));
+    ASSERT_EQ(pool->count, 1);
+    ft_strpool_free(pool);
+}
+
+TEST(test_strpool_growth_keeps_pointers)
+{
+    t_strpool *pool = ft_strpool_new();
+    const char **seen;
+    char key[32];
+    int i;
+
+    ASSERT(pool);
+    seen = malloc(50000 * sizeof(*seen));
+    ASSERT(seen);
+    for (i = 0; i < 50000; i++)
+    {
+        snprintf(key, sizeof(key), "sym_%d", i * 7);
+        seen[i] = ft_strpool_intern(pool, key);
+        ASSERT(seen[i] && strcmp(seen[i], key) == 0);
+    }
+    ASSERT_EQ(pool->count, 50000);
+    ASSERT(pool->count * 2 <= pool->cap);
+    for (i = 0; i < 50000; i++)
+    {
+        snprintf(key, sizeof(key), "sym_%d", i * 7);
+        ASSERT(ft_strpool_intern(pool, key) == seen[i]);
+        ASSERT(ft_strpool_find(pool, key) == seen[i]);
+        ASSERT_EQ(ft_strpool_len(seen[i]), strlen(key));
+    }
+    ASSERT_EQ(pool->count, 50000);
+    free(seen);
+    ft_strpool_free(pool);
+}
+
+/* ==================== Interned hashmap tests ==================== */
+
+TEST(test_hashmap_interned_shares_keys)
+{
+    t_strpool *pool = ft_strpool_new();
+    t_hashmap *a;
+    t_hashmap *b;
+    const char *key;
+    char buf[8];
+
+    ASSERT(pool);
+    a = ft_hashmap_new_interned(pool, 0, NULL);
+    b = ft_hashmap_new_interned(pool, 0, NULL);
+    ASSERT(a && b);
+    strcpy(buf, "HOME");
+    ASSERT(ft_hashmap_set(a, buf, (void *)1));
+    strcpy(buf, "XXXX");
+    ASSERT(ft_hashmap_set(b, "HOME", (void *)2));
+    ASSERT_EQ(pool->count, 1);
+    key = ft_strpool_find(pool, "HOME");
+    ASSERT(key);
+    ASSERT(ft_hashmap_get_interned(a, key) == (void *)1);
+    ASSERT(ft_hashmap_get_interned(b, key) == (void *)2);
+    ASSERT(ft_hashmap_set_interned(a, key, (void *)3));
+    ASSERT_EQ(a->size, 1);
+    ASSERT(ft_hashmap_get_interned(a, key) == (void *)3);
+    ASSERT_NULL(ft_hashmap_get_interned(a, ft_strpool_intern(pool, "USER")));
+    ft_hashmap_free(a);
+    ASSERT(ft_hashmap_get_interned(b, key) == (void *)2);
+    ASSERT(strcmp(key, "HOME") == 0);
+    ft_hashmap_free(b);
+    ft_strpool_free(pool);
+}
+
+TEST(test_hashmap_interned_grow_and_clear)
+{
+    t_strpool *pool = ft_strpool_new();
+    t_hashmap *m;
+    char key[32];
+    int i;
+
+    ASSERT(pool);
+    m = ft_hashmap_new_interned(pool, 2, count_free);
+    ASSERT(m);
+    for (i = 0; i < 3000; i++)
+    {
+        snprintf(key, sizeof(key), "k%d", i);
+        ASSERT(ft_hashmap_set(m, key, (void *)(intptr_t)(i + 1)));
+    }
+    ASSERT_EQ(m->size, 3000);
+    ASSERT(m->cap > 2);
+    for (i = 0; i < 3000; i++)
+    {
+        snprintf(key, sizeof(key), "k%d", i);
+        ASSERT(ft_hashmap_get_interned(m, ft_strpool_find(pool, key))
+            == (void *)(intptr_t)(i + 1));
+    }
+    g_freed = 0;
+    ASSERT(ft_hashmap_set(m, "k7", (void *)99));
+    ASSERT_EQ(g_freed, 1);
+    ft_hashmap_clear(m);
+    ASSERT_EQ(g_freed, 3001);
+    ASSERT_EQ(pool->count, 3000);
+    ASSERT(ft_hashmap_set(m, "k1", (void *)1));
+    ft_hashmap_free(m);
+    ft_strpool_free(pool);
+}
+
+TEST(test_hashmap_interned_rejects)
+{
+    t_strpool *pool = ft_strpool_new();
+    t_hashmap *plain = ft_hashmap_new(0, NULL);
+    const char *key;
+
+    ASSERT(pool && plain);
+    ASSERT_NULL(ft_hashmap_new_interned(NULL, 0, NULL));
+    key = ft_strpool_intern(pool, "k");
+    ASSERT_EQ(ft_hashmap_set_interned(plain, key, (void *)1), 0);
+    ASSERT_NULL(ft_hashmap_get_interned(plain, key));
+    ASSERT_EQ(ft_hashmap_set_interned(NULL, key, (void *)1), 0);
+    ft_hashmap_free(plain);
+    ft_strpool_free(pool);
+}
+
+/* ==================== Test Runner ==================== */
+
+int main(void)
+{
+    printf("\n\033[1;36m╔══════════════════════════════════════╗\033[0m\n");
+    printf("\033[1;36m║      ft_strpool Unit Test Suite      ║\033[0m\n");
+    printf("\033[1;36m╚══════════════════════════════════════╝\033[0m\n");
+
+    printf("\n\033[1m=== t_strpool tests ===\033[0m\n");
+    RUN_TEST(test_strpool_canonical_pointers);
+    RUN_TEST(test_strpool_find_does_not_add);
+    RUN_TEST(test_strpool_growth_keeps_pointers);
+
+    printf("\n\033[1m=== Interned hashmap tests ===\033[0m\n");
+    RUN_TEST(test_hashmap_interned_shares_keys);
+    RUN_TEST(test_hashmap_interned_grow_and_clear);
+    RUN_TEST(test_hashmap_interned_rejects);
+
+    printf("\n\033[1m════════════════════════════════════════\033[0m\n");
+    printf("\033[1mResults: \033[32m%d passed\033[0m, \033[31m%d failed\033[0m\n",
+           g_tests_passed, g_tests_failed);
+    printf("\033[1m════════════════════════════════════════\033[0m\n\n");
+
+    return (g_tests_failed > 0 ? 1 : 0);
+}
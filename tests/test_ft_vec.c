@@ -352,6 +352,51 @@ TEST(test_vec_set_empty_vec)
     ft_vec_free(vec);
 }
 
+/* ==================== ft_vec_swap tests ==================== */
+
+TEST(test_vec_swap_basic)
+{
+    t_vec *vec = ft_vec_new(sizeof(int), 4);
+    int val;
+
+    for (val = 0; val < 5; val++)
+        ft_vec_push(vec, &val);
+    ASSERT_EQ(ft_vec_swap(vec, 0, 4), 1);
+    ASSERT_EQ(*(int *)ft_vec_get(vec, 0), 4);
+    ASSERT_EQ(*(int *)ft_vec_get(vec, 4), 0);
+    ASSERT_EQ(ft_vec_swap(vec, 2, 2), 1);
+    ASSERT_EQ(*(int *)ft_vec_get(vec, 2), 2);
+    ft_vec_free(vec);
+}
+
+TEST(test_vec_swap_out_of_bounds)
+{
+    t_vec *vec = ft_vec_new(sizeof(int), 4);
+    int val = 1;
+
+    ft_vec_push(vec, &val);
+    ASSERT_EQ(ft_vec_swap(vec, 0, 1), 0);
+    ASSERT_EQ(ft_vec_swap(vec, 1, 0), 0);
+    ASSERT_EQ(ft_vec_swap(NULL, 0, 0), 0);
+    ft_vec_free(vec);
+}
+
+TEST(test_vec_swap_large_elements)
+{
+    t_vec *vec = ft_vec_new(1000, 2);
+    unsigned char a[1000];
+    unsigned char b[1000];
+
+    memset(a, 'a', sizeof(a));
+    memset(b, 'b', sizeof(b));
+    ft_vec_push(vec, a);
+    ft_vec_push(vec, b);
+    ASSERT_EQ(ft_vec_swap(vec, 0, 1), 1);
+    ASSERT_EQ(memcmp(ft_vec_get(vec, 0), b, sizeof(b)), 0);
+    ASSERT_EQ(memcmp(ft_vec_get(vec, 1), a, sizeof(a)), 0);
+    ft_vec_free(vec);
+}
+
 /* ==================== ft_vec_reserve tests ==================== */
 
 TEST(test_vec_reserve_basic)
@@ -754,6 +799,11 @@ void run_all_tests(void)
     RUN_TEST(test_vec_set_out_of_bounds);
     RUN_TEST(test_vec_set_empty_vec);
 
+    printf("\n\033[1m=== ft_vec_swap tests ===\033[0m\n");
+    RUN_TEST(test_vec_swap_basic);
+    RUN_TEST(test_vec_swap_out_of_bounds);
+    RUN_TEST(test_vec_swap_large_elements);
+
     printf("\n\033[1m=== ft_vec_reserve tests ===\033[0m\n");
     RUN_TEST(test_vec_reserve_basic);
     RUN_TEST(test_vec_reserve_null_vec);
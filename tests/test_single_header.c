@@ -190,6 +190,51 @@ static void	test_ft_vec_math(void)
 		"ft_vec3_len(1,2,2) == 3");
 }
 
+static void	test_ft_conv(void)
+{
+	char	buf[FT_DTOA_BUFSZ];
+	char	*end;
+	t_vec3	v;
+
+	printf("\n=== ft_conv (number conversion) ===\n");
+	test(ft_strtol("  -42x", &end, 10, NULL) == -42 && *end == 'x',
+		"ft_strtol with end pointer");
+	ft_i64toa_buf(INT64_MIN, buf);
+	test(strcmp(buf, "-9223372036854775808") == 0, "ft_i64toa_buf(INT64_MIN)");
+	ft_dtoa_shortest(0.1 + 0.2, buf);
+	test(strcmp(buf, "0.30000000000000004") == 0, "ft_dtoa_shortest");
+	ft_dtoa_fixed(2.5, 0, buf);
+	test(strcmp(buf, "2") == 0, "ft_dtoa_fixed ties to even");
+	test(ft_strtod("2.2250738585072014e-308", NULL, NULL) == 0x1p-1022,
+		"ft_strtod smallest normal");
+	test(ft_parse_vec3("1,2.5,-3", NULL, &v) && v.y == 2.5 && v.z == -3.0,
+		"ft_parse_vec3");
+}
+
+static void	test_ft_alloc(void)
+{
+	t_arena		*arena;
+	t_pool		*pool;
+	t_strpool	*strings;
+	void		*obj;
+
+	printf("\n=== ft_arena / ft_pool / ft_strpool ===\n");
+	arena = ft_arena_new(0);
+	test(arena && strcmp(ft_arena_strdup(arena, "abc"), "abc") == 0,
+		"ft_arena_strdup");
+	ft_arena_free(arena);
+	pool = ft_pool_new(24);
+	obj = ft_pool_alloc(pool);
+	ft_pool_release(pool, obj);
+	test(ft_pool_alloc(pool) == obj, "ft_pool reuses released object");
+	ft_pool_free(pool);
+	strings = ft_strpool_new();
+	test(ft_strpool_intern(strings, "key") == ft_strpool_intern(strings, "key"),
+		"ft_strpool_intern canonical pointer");
+	ft_strpool_free(strings);
+	test(ft_memmem("haystack", 8, "st", 2) != NULL, "ft_memmem");
+}
+
 int	main(void)
 {
 	printf("===========================================\n");
@@ -203,6 +248,8 @@ int	main(void)
 	test_ft_vec();
 	test_ft_deque();
 	test_ft_vec_math();
+	test_ft_conv();
+	test_ft_alloc();
 	printf("\n===========================================\n");
 	printf("Results: %d passed, %d failed\n", g_tests_passed, g_tests_failed);
 	printf("===========================================\n");